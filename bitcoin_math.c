@@ -61,6 +61,19 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#if defined(__SSSE3__)
+#include <tmmintrin.h> // optional SSSE3 hex encoding, enabled by -mssse3 or -march=native
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h> // optional 4 lane field arithmetic for batch key generation, enabled by -mavx2 or -march=native
+#endif
+#if defined(__x86_64__) && defined(__GNUC__)
+#define U256_MULX 1 // BMI2/ADX 4 by 4 limb kernels (inline assembly) are compiled in and selected at run time with cpuid
+#include <cpuid.h>
+#else
+#define U256_MULX 0
+#endif
 
 /* HASH FUNCTIONS RIPEMD160 */
 
@@ -923,14 +936,132 @@ void hmac_sha512(const unsigned char *key, unsigned int key_size, const unsigned
 
 /* BNZ DEFINES */
 
+typedef unsigned __int128 uint128_t; // gcc extension, holds the full product of two 64 bit limbs
+
+#define DIVIDE_STACK_LIMBS 16 // operands of up to 16 limbs (1024 bits) are divided using stack workspace
+#define KARATSUBA_THRESHOLD 24 // balanced products of at least 24 limbs (1536 bits) use Karatsuba multiplication, tuned with benchmark 5
+#define TOOM3_THRESHOLD 384 // balanced products of at least 384 limbs (24576 bits) use Toom-3 multiplication, tuned with benchmark 5
+#define NTT_THRESHOLD 2048 // products whose shorter operand has at least 2048 limbs (131072 bits) use number theoretic transforms, tuned with benchmark 17
+#define NTT_PRIMES 3 // word sized primes of the number theoretic transforms, their product bounds the convolution coefficients
+#define MUL_WS_LIMBS(n) (12 * (n) + 64) // workspace limbs for Karatsuba and Toom-3 multiplication of n limb operands, including all recursion levels
+
+#define RADIX_DC_LIMBS 32 // numbers of at least 32 limbs (2048 bits) are converted to and from strings by divide and conquer, tuned with benchmark 15
+#define RADIX_MAX_LEVELS 40 // powers chunk^(2^i) held by a radix_ctx, enough for strings of more than 2^32 digits
+
+#define MOD_POW_MAX_WINDOW 6 // largest sliding window of exponent bits used by bnz_mod_pow_ctx, a table of 2^(MOD_POW_MAX_WINDOW - 1) odd powers
+#define BNZ_INLINE_BYTES 64 // digits held inside the bnz_t itself, so that values of up to 512 bits never touch the heap
+
+typedef struct {
+    uint8_t *digits; // inline_digits, or a heap block once the capacity exceeds BNZ_INLINE_BYTES
+    uint32_t size; // number of digits in use
+    uint32_t capacity; // number of digits available at digits
+    uint8_t sign; // 0 positive, 1 negative
+    uint8_t inline_digits[BNZ_INLINE_BYTES];
+} bnz_t; // digits may point into the bnz_t itself, so a bnz_t that is to be modified must be copied with bnz_set_bnz rather than by assignment
+
+typedef struct {
+    size_t len; // number of 64 bit limbs in the modulus, 0 if the context is not valid
+    bool montgomery; // true if the modulus is odd and Montgomery multiplication can be used
+    uint64_t m_inv; // -m^(-1) mod 2^64, Montgomery reduction constant
+    uint64_t *m; // modulus, len limbs
+    uint64_t *mu; // floor(2^(128 len) / m), len + 2 limbs, Barrett reduction constant
+    uint64_t *r2; // 2^(128 len) mod m, len limbs, converts a residue into Montgomery form
+    uint64_t *ws; // workspace, 8 len + 8 limbs, so that reductions make no heap allocations
+    uint64_t *limbs; // single allocation holding m, mu, r2 and ws
+} bnz_mod_ctx; // reusable modulus context, precomputed once and shared by bnz_mulmod_ctx and bnz_mod_pow_ctx
+
+typedef struct {
+    const uint8_t *digits; // digits of the scalar, little endian order, read in place and never modified
+    size_t size; // number of digits
+    uint64_t word; // bits of the current 64 bit chunk not yet returned by bit_iter_next_set
+    uint32_t base; // index of bit 0 of the current chunk
+    int64_t bit; // highest bit not yet consumed by bit_iter_next_window, -1 when none remain
+} bit_iter_t; // iterator over the bits of a scalar, lsb first by set bit or msb first by window, so that loops over a scalar make no per bit function calls
+
+typedef void (*bnz_sink_t)(const uint8_t *, size_t, void *); // receives successive pieces of a string, with the arg given to the writer
+
+typedef struct {
+    uint32_t base; // radix, 2 to 64
+    uint32_t k; // digits per chunk
+    uint64_t chunk; // base^k, the largest power of base that fits in a limb
+    uint32_t bits; // bits per digit if base is a power of two, whose digits are sliced straight from the bits of a number, otherwise 0
+    size_t levels; // number of powers held
+    uint64_t *pow[RADIX_MAX_LEVELS]; // pow[i] = chunk^(2^i), the value of a 1 followed by k 2^i zero digits
+    size_t pow_len[RADIX_MAX_LEVELS]; // limbs in pow[i], the msb limb is non-zero
+    uint64_t *mu[RADIX_MAX_LEVELS]; // floor(2^(128 pow_len[i]) / pow[i]), pow_len[i] + 2 limbs, NULL for levels too small to divide by
+    const char *alpha; // digit characters for output
+    bnz_sink_t sink; // output destination
+    void *arg; // passed to sink
+    bool started; // true once a non-zero digit has been written, leading zeros are suppressed until then
+    size_t count; // characters written
+} radix_ctx; // powers of a base shared by the divide and conquer conversions between limbs and digit strings
+
+#define BNZ_ARENA_BYTES 65536 // default arena capacity, ample for the temporaries of a derivation or signature
+
+typedef struct {
+    uint8_t *base; // single heap block
+    size_t capacity; // bytes in base
+    size_t used; // bytes handed out, scratch arrays are released in last in first out order
+    size_t peak; // largest value of used since bnz_arena_init
+    uint64_t allocs; // scratch arrays served from base
+    uint64_t fallbacks; // scratch arrays that did not fit in base and were taken from the heap
+} bnz_arena_t; // bump allocator for the temporary limb arrays of the bnz_t functions
+
+#ifndef BNZ_STATS
+#define BNZ_STATS 0 // build with -DBNZ_STATS=1 to count the calls, operand bytes and processor cycles of the bnz_t functions, see bnz_stats_print
+#endif
+#define BNZ_STATS_FUNCTIONS 64 // instrumented functions that can be told apart
+#define BNZ_STATS_SCOPES 32 // scope paths that can be told apart, including the root
+
+typedef struct {
+    uint64_t calls;
+    uint64_t bytes; // operand digit bytes on entry
+    uint64_t cycles; // including the instrumented functions it calls
+    uint64_t self_cycles; // excluding the instrumented functions it calls
+} bnz_stats_t; // counts for one instrumented function in one scope
+
 typedef struct {
-    size_t sign;
-    size_t size;
-    uint8_t *digits;
-} bnz_t;
+    int32_t id; // index of the function in bnz_stats_names, -1 if the table is full
+    int32_t scope; // scope at entry
+    uint64_t start; // bnz_stats_cycles at entry
+    uint64_t outer_child_cycles; // bnz_stats_child_cycles of the caller, restored on exit
+} bnz_stats_frame; // one instrumented call in progress, on the stack of the instrumented function
+
+/*
+
+With BNZ_STATS set, BNZ_STATS_CALL(bytes), the first statement of an instrumented function, registers the function by name
+on its first call and records a bnz_stats_frame that the compiler closes on every return (the gcc and clang cleanup
+attribute), so functions with several returns need no further changes. BNZ_STATS_SCOPE(name) does the same for a named
+scope: calls made while it is open are counted under it, and scopes opened inside it are counted under their full path,
+e.g. "get_child_normal > get_public_key_compressed". Without BNZ_STATS both macros are empty and cost nothing.
+
+*/
+
+#if BNZ_STATS
+#define BNZ_STATS_CALL(bytes) static int32_t bnz_stats_id = -1; bnz_stats_frame bnz_stats_call __attribute__((cleanup(bnz_stats_leave))) = bnz_stats_enter(&bnz_stats_id, __func__, (bytes))
+#define BNZ_STATS_SCOPE(name) int32_t bnz_stats_outer_scope __attribute__((cleanup(bnz_stats_scope_leave))) = bnz_stats_scope_enter(name)
+#else
+#define BNZ_STATS_CALL(bytes)
+#define BNZ_STATS_SCOPE(name)
+#endif
 
 /* BNZ GLOBAL VARIABLES */
 
+_Thread_local bnz_arena_t *bnz_scratch_arena = NULL; // arena selected by this thread for its bnz_t temporaries, NULL selects malloc and free
+_Thread_local uint64_t bnz_heap_allocs = 0; // number of heap allocations made by init_uint8_array, init_uint64_array and bnz_resize in this thread
+_Thread_local uint64_t bnz_bytes_copied = 0; // number of digit bytes copied between bnz_t numbers and scratch space in this thread
+const char *bnz_stats_names[BNZ_STATS_FUNCTIONS]; // names of the instrumented functions in the order of their first calls
+int32_t bnz_stats_functions = 0; // entries used in bnz_stats_names
+const char *bnz_stats_scope_names[BNZ_STATS_SCOPES] = {"(no scope)"}; // names of the scopes, scope 0 is the root
+int32_t bnz_stats_scope_parents[BNZ_STATS_SCOPES] = {-1}; // enclosing scope of each scope
+int32_t bnz_stats_scopes = 1; // entries used in bnz_stats_scope_names
+int32_t bnz_stats_scope = 0; // scope now open
+uint64_t bnz_stats_child_cycles = 0; // cycles of the instrumented calls completed within the instrumented call in progress
+bnz_stats_t bnz_stats[BNZ_STATS_SCOPES][BNZ_STATS_FUNCTIONS]; // counts by scope and function
+
+const uint64_t ntt_primes[NTT_PRIMES] = {0x3a00000000000001, 0x2280000000000001, 0x1b00000000000001}; // 29 2^57 + 1, 69 2^55 + 1 and 27 2^56 + 1, below 2^62 with product above 2^184, each has roots of unity of every power of 2 order up to 2^55
+const uint64_t ntt_generators[NTT_PRIMES] = {3, 5, 5}; // primitive roots modulo ntt_primes
+
 int8_t char_16[256] = { // ascii - hex
     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
@@ -1029,32 +1160,131 @@ int8_t char_d[256] = {  // ascii - general
 /* BNZ FUNCTIONS */
 
 uint8_t *init_uint8_array(uint32_t);
+uint64_t *init_uint64_array(size_t);
+
+bool bnz_arena_init(bnz_arena_t *, size_t);
+void bnz_arena_free(bnz_arena_t *);
+bnz_arena_t *bnz_arena_select(bnz_arena_t *);
+size_t bnz_arena_mark(const bnz_arena_t *);
+void bnz_arena_reset(bnz_arena_t *, size_t);
+uint64_t *bnz_scratch_alloc(size_t);
+void bnz_scratch_free(uint64_t *);
+
+uint64_t bnz_stats_cycles(void);
+bnz_stats_frame bnz_stats_enter(int32_t *, const char *, size_t);
+void bnz_stats_leave(bnz_stats_frame *);
+int32_t bnz_stats_scope_enter(const char *);
+void bnz_stats_scope_leave(int32_t *);
+void bnz_stats_reset(void);
+void bnz_stats_print(FILE *);
+void bnz_stats_print_at_exit(void);
+
+int32_t cmp_uint64_arr(const uint64_t *, const uint64_t *, size_t);
+uint64_t add_uint64_arr(uint64_t *, const uint64_t *, const uint64_t *, size_t);
+uint64_t sub_uint64_arr(uint64_t *, const uint64_t *, const uint64_t *, size_t);
+uint64_t shift_l_uint64_arr(uint64_t *, const uint64_t *, size_t, uint32_t);
+void shift_r_uint64_arr(uint64_t *, const uint64_t *, size_t, uint32_t);
+void mul_uint64_arr(uint64_t *, const uint64_t *, size_t, const uint64_t *, size_t);
+void sqr_uint64_arr(uint64_t *, const uint64_t *, size_t);
+void divide_uint64_arr(uint64_t *, uint64_t *, const uint64_t *, size_t, const uint64_t *, size_t);
+uint64_t reciprocal_word(uint64_t);
+uint64_t divrem_2by1_word(uint64_t *, uint64_t, uint64_t, uint64_t, uint64_t);
+uint64_t divrem_word_uint64_arr(uint64_t *, const uint64_t *, size_t, uint64_t);
+void reciprocal_square_uint64_arr(uint64_t *, const uint64_t *, size_t, const uint64_t *, size_t);
+uint64_t add_to_uint64_arr(uint64_t *, size_t, const uint64_t *, size_t);
+uint64_t sub_from_uint64_arr(uint64_t *, size_t, const uint64_t *, size_t);
+void negate_uint64_arr(uint64_t *, size_t);
+bool diff_uint64_arr(uint64_t *, const uint64_t *, size_t, const uint64_t *, size_t);
+void divexact_3_uint64_arr(uint64_t *, size_t);
+void sar_1_uint64_arr(uint64_t *, size_t);
+uint64_t mul_add_words_uint64_arr(uint64_t *, uint64_t, const uint64_t *, uint64_t, const uint64_t *, size_t);
+uint64_t mul_sub_words_uint64_arr(uint64_t *, uint64_t, const uint64_t *, uint64_t, const uint64_t *, size_t);
+uint64_t get_top_bits_uint64_arr(const uint64_t *, size_t, uint32_t);
+void mul_karatsuba_uint64_arr(uint64_t *, const uint64_t *, const uint64_t *, size_t, uint64_t *);
+void mul_toom3_uint64_arr(uint64_t *, const uint64_t *, const uint64_t *, size_t, uint64_t *);
+void mul_balanced_uint64_arr(uint64_t *, const uint64_t *, const uint64_t *, size_t, uint64_t *);
+void mul_fast_uint64_arr(uint64_t *, const uint64_t *, size_t, const uint64_t *, size_t);
+uint64_t mont_mul_word(uint64_t, uint64_t, uint64_t, uint64_t);
+uint64_t pow_mod_word(uint64_t, uint64_t, uint64_t);
+void ntt_roots_uint64_arr(uint64_t *, size_t, uint64_t, uint64_t, uint64_t);
+void ntt_uint64_arr(uint64_t *, size_t, const uint64_t *, uint64_t, uint64_t);
+void intt_uint64_arr(uint64_t *, size_t, const uint64_t *, uint64_t, uint64_t);
+void mul_ntt_uint64_arr(uint64_t *, const uint64_t *, size_t, const uint64_t *, size_t);
+void mont_mul_uint64_arr(uint64_t *, const uint64_t *, const uint64_t *, const uint64_t *, uint64_t, size_t, uint64_t *);
+void mont_sqr_uint64_arr(uint64_t *, const uint64_t *, const uint64_t *, uint64_t, size_t, uint64_t *);
+void barrett_reduce_uint64_arr(uint64_t *, const uint64_t *, const uint64_t *, const uint64_t *, size_t, uint64_t *);
+
+size_t bnz_limb_count(const bnz_t *);
+void bnz_get_limbs(uint64_t *, size_t, const bnz_t *);
+void bnz_set_limbs(bnz_t *, const uint64_t *, size_t);
 
 void bnz_init(bnz_t *);
 void bnz_resize(bnz_t *, size_t, bool);
 void bnz_align(bnz_t *, bnz_t *);
 void bnz_reverse_digits(bnz_t *); 
 void bnz_shift_r(bnz_t *, uint32_t);
+void bnz_shift_left(bnz_t *, const bnz_t *, uint32_t);
+void bnz_shift_right(bnz_t *, const bnz_t *, uint32_t);
 void bnz_trim(bnz_t *);
 void bnz_print(const bnz_t *, int32_t, const char *);
 void bnz_free(bnz_t *);
 
 int8_t get_digit(const char *, size_t, uint8_t);
 uint8_t *get_base_n_str(const bnz_t *, uint32_t, const char *, uint32_t *);
+uint8_t *get_base_n_str_bytewise(const bnz_t *, uint32_t, const char *, uint32_t *);
+uint8_t *get_base_n_str_trim(uint8_t *, const char *, uint32_t *);
+size_t radix_limbs(size_t, uint32_t);
+bool radix_ctx_init(radix_ctx *, uint32_t, size_t, bool);
+void radix_ctx_free(radix_ctx *);
+void radix_emit(radix_ctx *, const uint8_t *, size_t);
+void radix_emit_zeros(radix_ctx *, size_t);
+bool radix_put_uint64_arr(radix_ctx *, uint64_t *, size_t, size_t);
+bool radix_get_uint64_arr(radix_ctx *, uint64_t *, size_t, const uint8_t *, size_t);
+bool bnz_write_base_n(const bnz_t *, uint32_t, const char *, bnz_sink_t, void *);
+void hex_encode_uint8_arr(char *, const uint8_t *, size_t);
+void bnz_sink_stdout(const uint8_t *, size_t, void *);
+void bnz_sink_buffer(const uint8_t *, size_t, void *);
 
 void bnz_set_i32(bnz_t *, int32_t);
 void bnz_set_ui32(bnz_t *, uint32_t);
 void bnz_set_str(bnz_t *, const char *, uint8_t);
 void bnz_set_bnz(bnz_t *, const bnz_t *);
 
-int32_t cmp_uint8_arr(uint8_t *, uint8_t *, size_t);
+int32_t cmp_uint8_arr(const uint8_t *, const uint8_t *, size_t);
 int32_t bnz_cmp_i32(const bnz_t *, int32_t);
 int32_t bnz_cmp_bnz(const bnz_t *, const bnz_t *);
+int32_t bnz_cmp_abs(const bnz_t *, const bnz_t *);
 bool bnz_is_zero(const bnz_t *);
 bool bnz_bit_set(const bnz_t *, uint32_t);
+uint32_t bnz_get_bits(const bnz_t *, uint32_t, uint32_t);
+uint64_t get_word_uint8_arr(const uint8_t *, size_t, int64_t);
+uint32_t get_bits_uint8_arr(const uint8_t *, size_t, uint32_t, uint32_t);
+void bit_iter_init(bit_iter_t *, const uint8_t *, size_t);
+bool bit_iter_next_set(bit_iter_t *, uint32_t *);
+bool bit_iter_next_window(bit_iter_t *, uint32_t, uint32_t *, uint32_t *);
 
 void bnz_concatenate_ui8(bnz_t *, const bnz_t *, uint8_t, size_t);
 void bnz_concatenate_bnz(bnz_t *, const bnz_t *, const bnz_t *, size_t);
+void bnz_concat_append_ui8(bnz_t *, uint8_t, size_t);
+void bnz_concat_append(bnz_t *, const bnz_t *, size_t);
+
+uint8_t add_to_uint8_arr(uint8_t *, size_t, const uint8_t *, size_t);
+uint8_t sub_from_uint8_arr(uint8_t *, size_t, const uint8_t *, size_t);
+void sub_reverse_uint8_arr(uint8_t *, const uint8_t *, size_t);
+void bnz_add_signed_assign(bnz_t *, const bnz_t *, size_t);
+void bnz_add_assign(bnz_t *, const bnz_t *);
+void bnz_sub_assign(bnz_t *, const bnz_t *);
+void bnz_mul_to(bnz_t *, const bnz_t *);
+
+uint64_t add_word_uint8_arr(uint8_t *, size_t, uint64_t);
+uint64_t sub_word_uint8_arr(uint8_t *, size_t, uint64_t);
+uint64_t mul_word_uint8_arr(uint8_t *, size_t, uint64_t);
+uint8_t shl1_uint8_arr(uint8_t *, size_t);
+uint64_t bnz_get_word(const bnz_t *);
+int32_t bnz_cmp_word(const bnz_t *, uint64_t);
+void bnz_add_word(bnz_t *, uint64_t, size_t);
+void bnz_mul_word(bnz_t *, uint64_t, size_t);
+void bnz_double(bnz_t *);
 
 void bnz_add_i32(bnz_t *, const bnz_t *, int32_t);
 void bnz_add_bnz(bnz_t *, const bnz_t *, const bnz_t *);
@@ -1063,13 +1293,28 @@ void bnz_subtract_bnz(bnz_t *, const bnz_t *, const bnz_t *);
 void bnz_subtraction(bnz_t *, const bnz_t *, const bnz_t *);
 void bnz_multiply_i32(bnz_t *, const bnz_t *, int32_t);
 void bnz_multiply_bnz(bnz_t *, const bnz_t *, const bnz_t *);
+void bnz_square(bnz_t *, const bnz_t *);
 void bnz_division_signs(bnz_t *, bnz_t *, const bnz_t *, const bnz_t *);
 void bnz_divide_bnz(bnz_t *, bnz_t *, const bnz_t *, const bnz_t *);
 void bnz_division(bnz_t *, bnz_t *, const bnz_t *, const bnz_t *);
+uint64_t bnz_divrem_word(bnz_t *, const bnz_t *, uint64_t);
 void bnz_mod_bnz(bnz_t *, const bnz_t *, const bnz_t *);
 
 void bnz_mod_pow(bnz_t *, const bnz_t *, const bnz_t *, const bnz_t *);
 void bnz_modular_multiplicative_inverse(bnz_t *, const bnz_t *, const bnz_t *);
+void bnz_modular_multiplicative_inverse_euclid(bnz_t *, const bnz_t *, const bnz_t *);
+void bnz_batch_inverse(bnz_t *, const bnz_t *, size_t, const bnz_t *);
+
+void bnz_mod_ctx_init(bnz_mod_ctx *, const bnz_t *);
+void bnz_mod_ctx_free(bnz_mod_ctx *);
+void bnz_get_residue_ctx(uint64_t *, const bnz_t *, bnz_mod_ctx *);
+void bnz_mod_bnz_ctx(bnz_t *, const bnz_t *, bnz_mod_ctx *);
+void bnz_mulmod_ctx(bnz_t *, const bnz_t *, const bnz_t *, bnz_mod_ctx *);
+void bnz_mod_pow_ctx(bnz_t *, const bnz_t *, const bnz_t *, bnz_mod_ctx *);
+void bnz_mod_pow_window_ctx(bnz_t *, const bnz_t *, const bnz_t *, bnz_mod_ctx *, uint32_t);
+uint32_t bnz_mod_pow_window(uint32_t);
+void bnz_mulmod_residues_ctx(uint64_t *, const uint64_t *, const uint64_t *, bnz_mod_ctx *);
+void bnz_sqrmod_residue_ctx(uint64_t *, const uint64_t *, bnz_mod_ctx *);
 
 uint8_t *init_uint8_array(uint32_t len) // allocate and zero a one dimensional uint8_t array of length len
 {
@@ -1079,1439 +1324,5445 @@ uint8_t *init_uint8_array(uint32_t len) // allocate and zero a one dimensional u
     if (!uint8_array) {
         return NULL;
     }
+    bnz_heap_allocs++;
     memset(uint8_array, 0, len);
 
     return uint8_array;
 }
 
-void bnz_init(bnz_t *a) // initiate bnz_t components
+uint64_t *init_uint64_array(size_t len) // allocate and zero a one dimensional uint64_t array of length len
 {
-    a->sign = 0;
-    a->size = 0;
-    a->digits = NULL;
-}
+    uint64_t *uint64_array = NULL;
 
-void bnz_resize(bnz_t *a, size_t new_size, bool preserve) // increase or decrease number of bytes in a->digits, zeroing added bytes, and preserving or zeroing existing bytes
-{
-    uint8_t *tmp = NULL;
-    size_t prev_size = a->size;
+    if (len < 1) len = 1;
 
-    if (new_size < 1) new_size = 1;
+    uint64_array = malloc(len * sizeof(uint64_t));
+    if (!uint64_array) {
+        return NULL;
+    }
+    bnz_heap_allocs++;
+    memset(uint64_array, 0, len * sizeof(uint64_t));
 
-    tmp = realloc(a->digits, new_size); // if realloc is successful, a->digits will be freed automatically. If realloc fails, tmp will be NULL, and a->digits will remain unchanged.
+    return uint64_array;
+}
+bool bnz_arena_init(bnz_arena_t *arena, size_t capacity) // allocate the block of an arena of capacity bytes, return false if the allocation fails
+{
+    arena->base = malloc(capacity);
+    arena->capacity = arena->base ? capacity : 0;
+    arena->used = 0;
+    arena->peak = 0;
+    arena->allocs = 0;
+    arena->fallbacks = 0;
 
-    if (tmp) {
-        if (preserve == true) { // if preserve is true, the original byte values and the sign will be preserved
-            if (new_size > prev_size) { // if the new size is larger than the original size...
-                memset(tmp + prev_size, 0, new_size - prev_size); // ...zero the new bytes
-            }
-        } else { // if preserve is false, all byte values will be zeroed and the sign will be set to positive
-            a->sign = 0; // set sign to positive
-            memset(tmp, 0, new_size); // zero all bytes
-        }
-        a->digits = tmp; // replace a->digits with tmp
-        a->size = new_size; // set new size
-    }
+    return arena->base != NULL;
 }
 
-void bnz_align(bnz_t *a, bnz_t *b) // resize a->digits or b->digits to match the byte count of the longer of a and b
+void bnz_arena_free(bnz_arena_t *arena) // free the block of an arena, which must no longer be selected
 {
-    bnz_trim(a);
-    bnz_trim(b);
-    if (a->size > b->size) {
-        bnz_resize(b, a->size, true);
-    } else {
-        bnz_resize(a, b->size, true);
-    }
+    free(arena->base);
+    arena->base = NULL;
+    arena->capacity = 0;
+    arena->used = 0;
 }
 
-void bnz_reverse_digits(bnz_t *a) // reverse the order of the bytes in a->digits
+bnz_arena_t *bnz_arena_select(bnz_arena_t *arena) // select arena for subsequent bnz_t temporaries of the calling thread, NULL selects the heap, return the previously selected arena so that the caller can restore it, an arena must not be selected by two threads at once
 {
-    uint8_t tmp;
-    size_t i = 0, j = a->size - 1;
+    bnz_arena_t *prev = bnz_scratch_arena;
 
-    while (i < j) {
-        tmp = a->digits[i];
-        a->digits[i] = a->digits[j];
-        a->digits[j] = tmp;
-        i++;
-        j--;
-    }
+    bnz_scratch_arena = arena;
+
+    return prev;
 }
 
-void bnz_shift_r(bnz_t *a, uint32_t sh) // shift the bits in a->digits to the right by sh bits, adding 0 value bits to msb end
+size_t bnz_arena_mark(const bnz_arena_t *arena) // return the current position of arena, 0 if arena is NULL
 {
-    uint8_t msk = 255 >> (8 - sh);
-    size_t i, orig_size = a->size;
+    return arena ? arena->used : 0;
+}
 
-    if (sh < 1 || sh > 7) return;
+void bnz_arena_reset(bnz_arena_t *arena, size_t mark) // release everything taken from arena since mark was returned by bnz_arena_mark, no effect if arena is NULL
+{
+    if (arena && mark <= arena->used) arena->used = mark;
+}
 
-    bnz_resize(a, orig_size + 1, true);
-    bnz_reverse_digits(a);
+uint64_t *bnz_scratch_alloc(size_t len) // allocate and zero len limbs of scratch space from the selected arena, or from the heap if no arena is selected or the arena is full, release with bnz_scratch_free
+{
+    bnz_arena_t *arena = bnz_scratch_arena;
+    uint64_t *p;
+    size_t bytes = (len < 1 ? 1 : len) * sizeof(uint64_t);
 
-    for (i = a->size - 1; i > 0; i--) {
-        a->digits[i] = (a->digits[i - 1] & msk) << (8 - sh) | a->digits[i] >> sh;
+    if (arena && arena->base && bytes <= arena->capacity - arena->used) {
+        p = (uint64_t *)(arena->base + arena->used); // used is always a multiple of 8 bytes
+        arena->used += bytes;
+        if (arena->used > arena->peak) arena->peak = arena->used;
+        arena->allocs++;
+        memset(p, 0, bytes);
+        return p;
     }
 
-    bnz_reverse_digits(a);
-    bnz_resize(a, orig_size, true);
+    if (arena) arena->fallbacks++;
+
+    return init_uint64_array(len);
 }
 
-void bnz_trim(bnz_t *a) // trim 0 value bytes from msb end of a->digits
+void bnz_scratch_free(uint64_t *p) // release scratch space from bnz_scratch_alloc, arena space is released together with everything allocated after it, so scratch space must be released in last in first out order
 {
-    size_t new_size = a->size;
+    bnz_arena_t *arena = bnz_scratch_arena;
 
-    while (a->digits[new_size - 1] == 0 && new_size >= 0) {
-        new_size--;
+    if (arena && arena->base && (uint8_t *)p >= arena->base && (uint8_t *)p < arena->base + arena->capacity) {
+        arena->used = (uint8_t *)p - arena->base;
+    } else {
+        free(p);
     }
-
-    bnz_resize(a, new_size, true);
 }
 
-void bnz_print(const bnz_t *a, int32_t base, const char *txt) // print a in a given base, preceded by optional string txt
+uint64_t bnz_stats_cycles(void) // processor time stamp counter, or nanoseconds of wall clock time where there is none
 {
-    uint8_t *str = NULL;
-    uint32_t i, j, len;
-    bnz_t tmp;
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    struct timespec ts;
 
-    bnz_init(&tmp);
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
 
-    bnz_set_bnz(&tmp, a);
+bnz_stats_frame bnz_stats_enter(int32_t *id, const char *name, size_t bytes) // count a call to the function name, registering it in *id on its first call, and start its clock, used by BNZ_STATS_CALL
+{
+    bnz_stats_frame frame;
 
-    bnz_reverse_digits(&tmp);
+    if (*id < 0 && bnz_stats_functions < BNZ_STATS_FUNCTIONS) {
+        bnz_stats_names[bnz_stats_functions] = name;
+        *id = bnz_stats_functions++;
+    }
 
-    switch (base) {
-        case -2: // binary with spaces between bytes
-            printf("%s", txt);
-            if (bnz_is_zero(&tmp) == true) {
-                printf("0\n");
-            } else {
-                if (tmp.sign) printf("-");
-                for (i = 0; i < tmp.size; i++) { // traverse bytes
-                    for (j = 0; j < 8; j++) { // divide each byte into 8 bits
-                        printf("%d", (tmp.digits[i] >> (7 - j)) & 1);
-                    }
-                    printf(" "); // add space between each byte
-                }
-                printf("\n");
-            }
-            break;
-        case 2: // binary
-            printf("%s", txt);
-            if (bnz_is_zero(&tmp) == true) {
-                printf("0\n");
-            } else {
-                if (tmp.sign) printf("-");
-                for (i = 0; i < tmp.size; i++) { // traverse bytes
-                    for (j = 0; j < 8; j++) { // divide each byte into 8 bits
-                        printf("%d", (tmp.digits[i] >> (7 - j)) & 1);
-                    }
-                }
-                printf("\n");
-            }
-            break;
-        case -16: // hex, upper case, without "0x" prefix, same as default for 0 to F
-            printf("%s", txt);
-            if (bnz_is_zero(&tmp) == true) {
-                printf("0\n");
-            } else {
-                str = get_base_n_str(&tmp, 16, "0123456789ABCDEF", &len);
-                if (!str) {
-                    return;
-                }
-                if (tmp.sign) printf("-");
-                printf("%s\n", str);
-            }
-            break;
-        case 16: // hex, lower case with "0x" prefix
-            printf("%s", txt);
-            if (bnz_is_zero(&tmp) == true) {
-                printf("0x0\n");
-            } else {
-                if (tmp.sign) printf("-");
-                printf("0x");
-                for (i = 0; i < tmp.size; i++) {
-                    printf("%02x", tmp.digits[i]);
-                }
-                printf("\n");
-            }
-            break;
-        case -32: // standard base 32
-            printf("%s", txt);
-            if (bnz_is_zero(&tmp) == true) {
-                printf("0\n");
-            } else {
-                str = get_base_n_str(&tmp, 32, "0123456789ABCDEFGHIJKLMNOPQRSTUV", &len);
-                if (!str) {
-                    return;
-                }
-                if (tmp.sign) printf("-");
-                printf("%s\n", str);
-            }
-            break;
-        case 32: // bech32
-            printf("%s", txt);
-            if (bnz_is_zero(&tmp) == true) {
-                printf("q\n");
-            } else {
-                str = get_base_n_str(&tmp, 32, "qpzry9x8gf2tvdw0s3jn54khce6mua7l", &len);
-                if (!str) {
-                    return;
-                }
-                if (tmp.sign) printf("-");
-                printf("%s\n", str);
-            }
-            break;
-        case -58: // standard base 58
-            printf("%s", txt);
-            if (bnz_is_zero(&tmp) == true) {
-                printf("0\n");
-            } else {
-                str = get_base_n_str(&tmp, 58, "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuv", &len);
-                if (!str) {
-                    return;
-                }
-                if (tmp.sign) printf("-");
-                if (tmp.sign) printf("-");
-                printf("%s\n", str);
-            }
-            break;
-        case 58: // bitcoin base 58
-            printf("%s", txt);
-            if (bnz_is_zero(&tmp) == true) {
-                printf("1\n");
-            } else {
-                str = get_base_n_str(&tmp, 58, "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz", &len);
-                if (!str) {
-                    return;
-                }
-                if (tmp.sign) printf("-");
-                printf("%s\n", str);
-            }
-            break;
-        case 64:
-            printf("%s", txt);
-            if (bnz_is_zero(&tmp) == true) {
-                printf("A\n");
-            } else {
-                str = get_base_n_str(&tmp, 64, "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/", &len);
-                if (!str) {
-                    return;
-                }
-                if (tmp.sign) printf("-");
-                printf("%s\n", str);
-            }
-            break;
-        case 256: // individual byte values, base 10, separated by ", "
-            printf("%s", txt);
-            if (bnz_is_zero(&tmp) == true) {
-                printf("0\n");
-            } else {
-                if (tmp.sign) printf("-");
-                printf("%d", tmp.digits[0]);
-                for (i = 1; i < tmp.size; i++) {
-                    printf(", %d", tmp.digits[i]);
-                }
-                printf("\n");
-            }
-            break;
-        default: // default for 2 to 63
-            printf("%s", txt);
-            if (bnz_is_zero(&tmp) == true) {
-                printf("0\n");
-            } else {
-                if (base >= 2 && base <= 63) {
-                    str = get_base_n_str(&tmp, base, "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz_", &len);
-                    if (!str) {
-                        return;
-                    }
-                    if (tmp.sign) printf("-");
-                    printf("%s\n", str);
-                }
-            }
-            break;
+    frame.id = *id;
+    frame.scope = bnz_stats_scope;
+    frame.outer_child_cycles = bnz_stats_child_cycles;
+    bnz_stats_child_cycles = 0;
+    if (frame.id >= 0) {
+        bnz_stats[frame.scope][frame.id].calls++;
+        bnz_stats[frame.scope][frame.id].bytes += bytes;
     }
+    frame.start = bnz_stats_cycles();
 
-    bnz_free(&tmp);
-    free(str);
+    return frame;
 }
 
-void bnz_free(bnz_t *a) // free bnz_t resources
+void bnz_stats_leave(bnz_stats_frame *frame) // stop the clock of the call in frame and hand its cycles to the caller, run on return by BNZ_STATS_CALL
 {
-    a->sign = 0;
-    a->size = 0;
-    free(a->digits);
-    a->digits = NULL;
+    uint64_t elapsed = bnz_stats_cycles() - frame->start;
+
+    if (frame->id >= 0) {
+        bnz_stats[frame->scope][frame->id].cycles += elapsed;
+        bnz_stats[frame->scope][frame->id].self_cycles += elapsed - bnz_stats_child_cycles;
+    }
+    bnz_stats_child_cycles = frame->outer_child_cycles + elapsed;
 }
 
-int8_t get_digit(const char *str, size_t idx, uint8_t base) // return numerical value of char at index idx of str which represents a number in the given base and in big endian order
+int32_t bnz_stats_scope_enter(const char *name) // open the scope name inside the scope now open and return the scope to restore, if the table is full the calls stay with the enclosing scope
 {
-    int8_t dgt = -1;
+    int32_t i, outer = bnz_stats_scope;
 
-    switch (base) {
-        case 16:
-            dgt = char_16[str[idx]];
-            break;
-        case 32:
-            dgt = char_32[str[idx]];
-            break;
-        case 58:
-            dgt = char_58[str[idx]];
-            break;
-        case 64:
-            dgt = char_64[str[idx]];
-            break;
-        default:
-            if (base >= 2 && base <= 63) dgt = char_d[str[idx]];
-            break;
+    for (i = 1; i < bnz_stats_scopes; i++) {
+        if (bnz_stats_scope_parents[i] == outer && strcmp(bnz_stats_scope_names[i], name) == 0) break;
     }
+    if (i == bnz_stats_scopes) {
+        if (i == BNZ_STATS_SCOPES) return outer;
+        bnz_stats_scope_names[i] = name;
+        bnz_stats_scope_parents[i] = outer;
+        bnz_stats_scopes++;
+    }
+    bnz_stats_scope = i;
 
-    if (dgt < 0 || dgt >= base) return -1;
+    return outer;
+}
 
-    return dgt;
+void bnz_stats_scope_leave(int32_t *outer) // close the scope opened by bnz_stats_scope_enter, run on return by BNZ_STATS_SCOPE
+{
+    bnz_stats_scope = *outer;
 }
 
-uint8_t *get_base_n_str(const bnz_t *a, uint32_t base, const char *alpha, uint32_t *len) // return a null terminated string representing a->digits in given base, big endian order
+void bnz_stats_reset(void) // zero the counts, the functions and scopes seen so far stay registered
 {
-    uint8_t *base_n_str = NULL, *base_n_str_trimmed = NULL;
-    size_t i, j, k, trim = 0;
+    memset(bnz_stats, 0, sizeof(bnz_stats));
+}
 
-    (*len) = (a->size * log10((double)256)) / log10((double)abs(base)) + 1;
+void bnz_stats_print(FILE *out) // write a table of the counts to out, one block per scope path with calls, functions by total cycles
+{
+    int32_t s, i, j, k, order[BNZ_STATS_FUNCTIONS], path[BNZ_STATS_SCOPES], depth;
+    const bnz_stats_t *e;
 
-    base_n_str = init_uint8_array((*len) + 1);
-    if (!base_n_str) {
-        return NULL;
+    if (BNZ_STATS == 0) {
+        fprintf(out, "bnz_t instrumentation not compiled in (build with -DBNZ_STATS=1)\n");
+        return;
     }
 
-    for (i = 0; i < a->size; i++) {
-        k = a->digits[i];
-        for (j = (*len); j > 0; j--) {
-            k += (uint32_t)base_n_str[j - 1] * 256;
-            base_n_str[j - 1] = (uint8_t)(k % abs(base));
-            k /= abs(base);
+    for (s = 0; s < bnz_stats_scopes; s++) {
+        for (i = 0, k = 0; i < bnz_stats_functions; i++) { // functions called in this scope, by cycles, largest first
+            if (bnz_stats[s][i].calls == 0) continue;
+            for (j = k++; j > 0 && bnz_stats[s][order[j - 1]].cycles < bnz_stats[s][i].cycles; j--) {
+                order[j] = order[j - 1];
+            }
+            order[j] = i;
         }
-    }
+        if (k == 0) continue;
 
-    while ((base == 32 && alpha[base_n_str[trim]] == 'q') || (base == 58 && alpha[base_n_str[trim]] == '1') || (base == 64 && alpha[base_n_str[trim]] == 'A') || (base != 64 && alpha[base_n_str[trim]] == '0')) { // trim leading zeros at msb end, 'q' for Bech32, '1' for Bitcoin base 58, 'A' for base 64
-        trim++;
-        (*len)--;
+        for (i = s, depth = 0; i > 0; i = bnz_stats_scope_parents[i]) { // outermost scope first
+            path[depth++] = i;
+        }
+        fprintf(out, "scope: %s", depth == 0 ? bnz_stats_scope_names[0] : "");
+        while (depth > 0) {
+            depth--;
+            fprintf(out, "%s%s", bnz_stats_scope_names[path[depth]], depth > 0 ? " > " : "");
+        }
+        fprintf(out, "\n    %-40s %12s %14s %16s %16s %12s\n", "function", "calls", "bytes", "cycles", "self cycles", "per call");
+        for (i = 0; i < k; i++) {
+            e = &bnz_stats[s][order[i]];
+            fprintf(out, "    %-40s %12llu %14llu %16llu %16llu %12.0f\n", bnz_stats_names[order[i]], (unsigned long long)e->calls, (unsigned long long)e->bytes, (unsigned long long)e->cycles, (unsigned long long)e->self_cycles, (double)e->cycles / e->calls);
+        }
+        fprintf(out, "\n");
     }
+}
 
-    base_n_str_trimmed = init_uint8_array((*len) + 1);
-    if (!base_n_str_trimmed) {
-        free(base_n_str);
-        return NULL;
-    }
+void bnz_stats_print_at_exit(void) // bnz_stats_print to stderr, registered with atexit by main when BNZ_STATS is set
+{
+    bnz_stats_print(stderr);
+}
 
-    for (i = 0; i < (*len); i++) {
-        base_n_str_trimmed[i] = alpha[base_n_str[i + trim]];
-    }
 
-    free(base_n_str);
-    return base_n_str_trimmed;
+int32_t cmp_uint64_arr(const uint64_t *a, const uint64_t *b, size_t len) // compare two 1D uint64_t arrays of 64 bit limbs a and b, from msb to lsb, return -1 if a < b, 0 if a == b, and 1 if a > b
+{
+    size_t idx = len;
+
+    while (idx--) {
+        if (a[idx] > b[idx]) return 1;
+        if (a[idx] < b[idx]) return -1;
+    }
+
+    return 0;
 }
 
-void bnz_set_i32(bnz_t *res, int32_t val) // set bnz_t to 32 bit signed int, if the resultant bnz_t has leading zeros, these are trimmed
+uint64_t add_uint64_arr(uint64_t *res, const uint64_t *a, const uint64_t *b, size_t len) // res = a + b over len limbs, return the carry out of the msb limb, res may alias a or b
 {
-    if (val < 0) { // val is negative
-        res->sign = 1; // sign == 1 for negative val, 0 for positive val
-        val *= -1; // multiply negative int32_t by -1 to de-complement bytes
+    uint128_t t;
+    uint64_t carry = 0;
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+        t = (uint128_t)a[i] + b[i] + carry;
+        res[i] = (uint64_t)t;
+        carry = (uint64_t)(t >> 64);
     }
-    bnz_resize(res, 4, false); // resize res to 4 bytes, zero bytes
-    memcpy(res->digits, &val, 4); // copy bytes from val to res->digits
-    bnz_trim(res); // trim zero bytes from msb end
+
+    return carry;
 }
 
-void bnz_set_ui32(bnz_t *res, uint32_t val) // set bnz_t to 32 bit uint32_t, if the resultant bnz_t has leading zeros, these are trimmed
+uint64_t sub_uint64_arr(uint64_t *res, const uint64_t *a, const uint64_t *b, size_t len) // res = a - b over len limbs, return the borrow out of the msb limb, res may alias a or b
 {
-    bnz_resize(res, 4, false); // resize res to 4 bytes, zero bytes
-    memcpy(res->digits, &val, 4); // copy bytes from val to res->digits
-    bnz_trim(res); // trim zero bytes from msb end
+    uint64_t borrow = 0, t, next_borrow;
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+        t = a[i] - b[i];
+        next_borrow = (a[i] < b[i]) | (t < borrow); // computed before res[i] is written, as res may alias a or b
+        res[i] = t - borrow;
+        borrow = next_borrow;
+    }
+
+    return borrow;
 }
 
-void bnz_set_str(bnz_t *res, const char *str, uint8_t base) // set bnz_t to number represented by str with radix between 2 and 64, and with its digits in big endian order
+uint64_t shift_l_uint64_arr(uint64_t *res, const uint64_t *a, size_t len, uint32_t sh) // res = a << sh over len limbs for 0 <= sh < 64, return the bits shifted out of the msb limb, res may alias a
 {
-    int32_t dgt;
-    size_t i, j, len = (size_t)((double)strlen(str) * log(base)/log(256)) + 1, idx = 0;
-
-    bnz_resize(res, len, false);
+    uint64_t out;
+    size_t i;
 
-    if (str[0] == '-') { // if first symbol of str is "-", set sign to 1 and set starting index of digits to 1 
-        res->sign = 1;
-        idx = 1;
+    if (sh == 0) {
+        memmove(res, a, len * sizeof(uint64_t));
+        return 0;
     }
 
-    for (i = idx; i < strlen(str); i++) {
-        dgt = get_digit(str, i, base);
-        if (dgt != -1) {
-            for (j = len; j > 0; j--) {
-                dgt += res->digits[j - 1] * base;
-                res->digits[j - 1] = dgt & 255;
-                dgt >>= 8;
-            }
-        }
+    out = a[len - 1] >> (64 - sh);
+    for (i = len - 1; i > 0; i--) {
+        res[i] = (a[i] << sh) | (a[i - 1] >> (64 - sh));
     }
+    res[0] = a[0] << sh;
 
-    bnz_reverse_digits(res); // convert a->digits to little endian order
-    bnz_trim(res); // trim zero bytes from msb end
-}
-
-void bnz_set_bnz(bnz_t *res, const bnz_t *val) // set bnz_t equivalent to another bnz_t
-{
-    bnz_resize(res, val->size, false);
-    memcpy(res->digits, val->digits, val->size);
-    res->sign = val->sign;
+    return out;
 }
 
-int32_t cmp_uint8_arr(uint8_t *a, uint8_t *b, size_t len) // compare two 1D uint8_t arrays a and b, from msb to lsb, return -1 if a < b, 0 if a == b, and 1 if a > b 
+void shift_r_uint64_arr(uint64_t *res, const uint64_t *a, size_t len, uint32_t sh) // res = a >> sh over len limbs for 0 <= sh < 64, res may alias a
 {
-    size_t idx = len;
+    size_t i;
 
-    while (idx--) {
-        if (a[idx] > b[idx]) return 1;
-        if (a[idx] < b[idx]) return -1;
+    if (sh == 0) {
+        memmove(res, a, len * sizeof(uint64_t));
+        return;
     }
 
-    return 0;
+    for (i = 0; i < len - 1; i++) {
+        res[i] = (a[i] >> sh) | (a[i + 1] << (64 - sh));
+    }
+    res[len - 1] = a[len - 1] >> sh;
 }
 
-int32_t bnz_cmp_i32(const bnz_t *a, int32_t b) // compare bnz_t with int32_t by converting int32_t to bnz_t and invoking bnz_cmp_bnz
+void mul_uint64_arr(uint64_t *res, const uint64_t *a, size_t a_len, const uint64_t *b, size_t b_len) // res = a * b, schoolbook multiplication of 64 bit limbs with 128 bit products, res holds a_len + b_len limbs and must not alias a or b
 {
-    int32_t res;
-    bnz_t tmp;
-    bnz_init(&tmp);
-    bnz_set_i32(&tmp, b);
-    res = bnz_cmp_bnz(a, &tmp);
-    bnz_free(&tmp);
-    return res;
-}
+    uint128_t t;
+    uint64_t carry;
+    size_t i, j;
 
-int32_t bnz_cmp_bnz(const bnz_t *a, const bnz_t *b) // compare two bnz_t numbers, taking account of signs, and invoking cmp_uint8_arr to compare their digits
-{
-    size_t res;
-    bnz_t aa, bb;
+    memset(res, 0, (a_len + b_len) * sizeof(uint64_t));
 
-    bnz_init(&aa);
-    bnz_init(&bb);
-    
-    bnz_set_bnz(&aa, a);
-    bnz_set_bnz(&bb, b);
-    bnz_align(&aa, &bb);
-    
-    if (aa.sign != bb.sign) { // signs are different
-        if (aa.sign == 0 && bb.sign != 0) {
-            res = 1; // a > -b
-        } else {
-            res = -1; // -a < b
+    for (i = 0; i < b_len; i++) {
+        if (b[i] == 0) continue; // res[i + a_len] is already zero
+        carry = 0;
+        for (j = 0; j < a_len; j++) {
+            t = (uint128_t)a[j] * b[i] + res[i + j] + carry;
+            res[i + j] = (uint64_t)t;
+            carry = (uint64_t)(t >> 64);
         }
-    } else { // signs are the same
-        res = cmp_uint8_arr(aa.digits, bb.digits, aa.size); // compare |a| and |b|
-        switch (res) {
-            case -1: // |a| < |b| => a < b, -a > -b
-                if (aa.sign) res = 1; // reverse cmp value if a and b are negative
-                break;
-            case 1: // |a| > |b| => a > b, -a < -b
-                if (aa.sign) res = -1; // reverse cmp value if a and b are negative
-                break;
-            default:
-                break;
+        res[i + a_len] = carry;
+    }
+}
+void sqr_uint64_arr(uint64_t *res, const uint64_t *a, size_t len) // res = a * a, schoolbook squaring computing each cross product a[i] * a[j] (i < j) once and doubling, res holds 2 len limbs and must not alias a
+{
+    uint128_t t;
+    uint64_t carry;
+    size_t i, j;
+
+    memset(res, 0, 2 * len * sizeof(uint64_t));
+
+    for (i = 0; i < len; i++) { // cross products
+        if (a[i] == 0) continue;
+        carry = 0;
+        for (j = i + 1; j < len; j++) {
+            t = (uint128_t)a[i] * a[j] + res[i + j] + carry;
+            res[i + j] = (uint64_t)t;
+            carry = (uint64_t)(t >> 64);
         }
+        res[i + len] = carry;
     }
 
-    bnz_free(&aa);
-    bnz_free(&bb);
+    shift_l_uint64_arr(res, res, 2 * len, 1); // double the cross products, the msb is always clear
 
-    return res;
+    carry = 0;
+    for (i = 0; i < len; i++) { // add the squares a[i]^2 on the diagonal
+        t = (uint128_t)a[i] * a[i] + res[2 * i] + carry;
+        res[2 * i] = (uint64_t)t;
+        t = (uint128_t)res[2 * i + 1] + (uint64_t)(t >> 64);
+        res[2 * i + 1] = (uint64_t)t;
+        carry = (uint64_t)(t >> 64);
+    }
 }
 
-bool bnz_is_zero(const bnz_t *val) // return true if val == 0, return false if val != 0
+
+void divide_uint64_arr(uint64_t *q, uint64_t *r, const uint64_t *a, size_t a_len, const uint64_t *b, size_t b_len) // q = a / b and r = a % b, Knuth's algorithm D with base 2^64, requires a_len >= b_len and b[b_len - 1] != 0, q holds a_len - b_len + 1 limbs, r holds b_len limbs
 {
+    uint64_t an_stack[DIVIDE_STACK_LIMBS + 1], bn_stack[DIVIDE_STACK_LIMBS]; // workspace for small operands, so that fixed width callers make no heap allocations
+    uint64_t *an = an_stack, *bn = bn_stack, k, t;
+    uint128_t num, q_hat, r_hat, p;
     size_t i;
+    int64_t j;
+    uint32_t sh;
 
-    for (i = 0; i < val->size; i++) {
-        if (val->digits[i] != 0) {
-            return false;
+    if (b_len == 1) { // single limb divisor, one multiplication by a precomputed reciprocal per limb
+        r[0] = divrem_word_uint64_arr(q, a, a_len, b[0]);
+        return;
+    }
+
+    sh = __builtin_clzll(b[b_len - 1]); // left shift required to ensure that the highest bit of bn[b_len - 1] is set
+
+    if (a_len > DIVIDE_STACK_LIMBS) {
+        an = bnz_scratch_alloc(a_len + 1 + b_len);
+        if (!an) {
+            return;
         }
+        bn = an + a_len + 1;
     }
 
-    return true;
-}
+    an[a_len] = shift_l_uint64_arr(an, a, a_len, sh);
+    shift_l_uint64_arr(bn, b, b_len, sh);
 
-bool bnz_bit_set(const bnz_t *val, uint32_t idx) // return true if the specified bit in val is set, return false if it is not set
-{
-    uint32_t byte = idx / 8, bit = idx % 8;
-    return (bool)((val->digits[byte] >> bit) & 1);
-}
+    for (j = a_len - b_len; j >= 0; j--) {
+        num = ((uint128_t)an[j + b_len] << 64) | an[j + b_len - 1];
+        q_hat = num / bn[b_len - 1];
+        r_hat = num % bn[b_len - 1];
+
+        // q_hat adjustment, maximum 2 iterations
+        while ((q_hat >> 64) != 0 || q_hat * bn[b_len - 2] > ((r_hat << 64) | an[j + b_len - 2])) {
+            q_hat--;
+            r_hat += bn[b_len - 1];
+            if ((r_hat >> 64) != 0) break;
+        }
+
+        k = 0; // multiply and subtract, k carries the high half of each product plus the borrow
+        for (i = 0; i < b_len; i++) {
+            p = q_hat * bn[i] + k;
+            k = (uint64_t)(p >> 64);
+            t = an[i + j] - (uint64_t)p;
+            if (an[i + j] < (uint64_t)p) k++;
+            an[i + j] = t;
+        }
+        t = an[j + b_len] - k;
+        q[j] = (uint64_t)q_hat;
+
+        if (an[j + b_len] < k) { // q_hat was one too large, add bn back
+            q[j]--;
+            an[j + b_len] = t + add_uint64_arr(an + j, an + j, bn, b_len);
+        } else {
+            an[j + b_len] = t;
+        }
+    }
 
-void bnz_concatenate_ui8(bnz_t *res, const bnz_t *a, uint8_t b, size_t order) // convert uint8_t to bnz_t and invoke bnz_concatenate_bnz
+    shift_r_uint64_arr(an, an, b_len + 1, sh);
+    memcpy(r, an, b_len * sizeof(uint64_t));
+
+    if (an != an_stack) {
+        bnz_scratch_free(an);
+    }
+}
+uint64_t reciprocal_word(uint64_t d) // v = floor((2^128 - 1) / d) - 2^64, the reciprocal of a normalised divisor d (highest bit set) used by divrem_2by1_word, Moller and Granlund
 {
-    bnz_t bb;
-    bnz_init(&bb);
-    bnz_resize(&bb, 1, false);
-    memcpy(bb.digits, &b, 1);
-    bnz_concatenate_bnz(res, a, &bb, order);
-    bnz_free(&bb);
+    return (uint64_t)(~(uint128_t)0 / d); // the quotient lies between 2^64 and 2^65 - 1, so truncation subtracts 2^64
 }
 
-void bnz_concatenate_bnz(bnz_t *res, const bnz_t *a, const bnz_t *b, size_t order) // res = a || b, in specified order
+uint64_t divrem_2by1_word(uint64_t *r, uint64_t u1, uint64_t u0, uint64_t d, uint64_t v) // return (u1 2^64 + u0) / d and set r to the remainder, d normalised, u1 < d and v = reciprocal_word(d), one multiplication and no division, Moller and Granlund algorithm 4
 {
-    bnz_t tmp; // local variable permits a = a || b, a = b || a
-    bnz_init(&tmp);
-    bnz_resize(&tmp, a->size + b->size, false);
-    if (order) {
-        memcpy(tmp.digits, b->digits, b->size);
-        memcpy(tmp.digits + b->size, a->digits, a->size);
-    } else {
-        memcpy(tmp.digits, a->digits, a->size);
-        memcpy(tmp.digits + a->size, b->digits, b->size);
+    uint128_t q = (uint128_t)v * u1 + (((uint128_t)u1 << 64) | u0);
+    uint64_t q1 = (uint64_t)(q >> 64) + 1, q0 = (uint64_t)q, rem;
+
+    rem = u0 - q1 * d; // computed mod 2^64
+    if (rem > q0) { // q1 was one too large, which is likely
+        q1--;
+        rem += d;
     }
-    bnz_set_bnz(res, &tmp);
-    bnz_free(&tmp);
-}
+    if (rem >= d) { // q1 was one too small, which is unlikely
+        q1++;
+        rem -= d;
+    }
+    *r = rem;
 
-void bnz_add_i32(bnz_t *res, const bnz_t *a, int32_t b) // convert int32_t to bnz_t and invoke bnz_add_bnz
-{
-    bnz_t bb;
-    bnz_init(&bb);
-    bnz_set_i32(&bb, b); // convert b to bnz_t
-    bnz_add_bnz(res, a, &bb);
-    bnz_free(&bb);
+    return q1;
 }
 
-void bnz_add_bnz(bnz_t *res, const bnz_t *a, const bnz_t *b) // res = a + b, taking account of signs, invoking bnz_addition or bnz_subtraction
+uint64_t divrem_word_uint64_arr(uint64_t *q, const uint64_t *a, size_t len, uint64_t d) // q = a / d over len limbs and return a % d, d != 0, q may alias a, the divisor is normalised once and each limb costs one multiplication by its reciprocal rather than a 128 by 64 bit division
 {
-    int32_t cmp;
-    bnz_t tmp, aa, bb;
+    uint64_t v, r = 0, u;
+    uint32_t sh = __builtin_clzll(d);
+    size_t i;
 
-    bnz_init(&tmp);
-    bnz_init(&aa);
-    bnz_init(&bb);
+    if (len == 0) return 0;
 
-    bnz_set_bnz(&aa, a);
-    bnz_set_bnz(&bb, b);
+    d <<= sh;
+    v = reciprocal_word(d);
+    if (sh > 0) r = a[len - 1] >> (64 - sh); // bits shifted out of the top limb, below 2^sh <= d
 
-    bnz_align(&aa, &bb);
+    for (i = len; i > 0; i--) { // a is shifted left by sh on the fly, a[i - 2] is read before q[i - 2] is written
+        u = a[i - 1] << sh;
+        if (sh > 0 && i > 1) u |= a[i - 2] >> (64 - sh);
+        q[i - 1] = divrem_2by1_word(&r, r, u, d, v);
+    }
 
-    cmp = cmp_uint8_arr(aa.digits, bb.digits, aa.size);
+    return r >> sh;
+}
 
-    if (a->sign) { // -a
-        if (b->sign) { // -a, -b
-            bnz_addition(&tmp, &aa, &bb);
-            tmp.sign = 1;
-        } else { // -a, +b
-            if (cmp == -1) { // |a| < |b|
-                bnz_subtraction(&tmp, &bb, &aa);
-                tmp.sign = 0;
-            } else { // |a| >= |b|
-                bnz_subtraction(&tmp, &aa, &bb);
-                tmp.sign = 1;
-            }
-        }
-    } else { // +a
-        if (b->sign) { // +a, -b
-            if (cmp == -1) { // |a| < |b|
-                bnz_subtraction(&tmp, &bb, &aa);
-                tmp.sign = 1;
-            } else { // |a| >= |b|
-                bnz_subtraction(&tmp, &aa, &bb);
-                tmp.sign = 0;
-            }
-        } else { // +a, +b
-            bnz_addition(&tmp, &aa, &bb);
-        }
+void reciprocal_square_uint64_arr(uint64_t *mu2, const uint64_t *mu, size_t len, const uint64_t *m2, size_t len2) // mu2 = floor(2^(128 len2) / m2) for m2 = m^2 of len2 limbs, from mu = floor(2^(128 len) / m) of len + 2 limbs, one Newton step from mu^2 and a final correction, all by fast multiplication, mu2 holds len2 + 2 limbs
+{
+    uint64_t *sq = NULL, *p, *c, one = 1;
+    size_t i, e_len = 2 * len2;
+
+    sq = bnz_scratch_alloc((2 * len + 4) + (2 * len2 + 2) + (3 * len2 + 2));
+    if (!sq) {
+        return;
     }
+    p = sq + 2 * len + 4;
+    c = p + 2 * len2 + 2;
 
-    bnz_trim(&tmp);
+    mul_fast_uint64_arr(sq, mu, len + 2, mu, len + 2); // mu^2 / 2^(64 (4 len - 2 len2)) is at most the target, with a relative error of around 2^(-64 len)
+    memcpy(mu2, sq + 4 * len - 2 * len2, (len2 + 2) * sizeof(uint64_t));
 
-    bnz_set_bnz(res, &tmp);
+    mul_fast_uint64_arr(p, m2, len2, mu2, len2 + 2);
+    negate_uint64_arr(p, e_len); // e = 2^(128 len2) - m2 mu2, which is not negative
+    while (e_len > 0 && p[e_len - 1] == 0) e_len--;
 
-    bnz_free(&tmp);
-    bnz_free(&aa);
-    bnz_free(&bb);
+    if (e_len + 2 > len2) { // mu2 += mu2 e / 2^(128 len2), which squares the relative error and stays at most the target
+        mul_fast_uint64_arr(c, mu2, len2 + 2, p, e_len);
+        add_to_uint64_arr(mu2, len2 + 2, c + 2 * len2, e_len + 2 - len2);
+    }
+
+    mul_fast_uint64_arr(p, m2, len2, mu2, len2 + 2);
+    negate_uint64_arr(p, 2 * len2); // r = 2^(128 len2) - m2 mu2, now a small multiple of m2 at most
+    for (;;) { // final correction, while r >= m2
+        for (i = 2 * len2; i > len2 && p[i - 1] == 0; i--);
+        if (i == len2 && cmp_uint64_arr(p, m2, len2) < 0) break;
+        sub_from_uint64_arr(p, 2 * len2, m2, len2);
+        add_to_uint64_arr(mu2, len2 + 2, &one, 1);
+    }
+
+    bnz_scratch_free(sq);
 }
 
-void bnz_addition(bnz_t *res, const bnz_t *a, const bnz_t *b) // res = |a| + |b|
+uint64_t add_to_uint64_arr(uint64_t *res, size_t res_len, const uint64_t *a, size_t a_len) // res = res + a over res_len limbs where a_len <= res_len, propagating the carry, return the carry out of the msb limb
 {
-    size_t i, carry = 0;
-    bnz_t tmp;
-    bnz_init(&tmp);
-    bnz_resize(&tmp, a->size + 1, false);
-    for (i = 0; i < a->size; i++) {
-        tmp.digits[i] = a->digits[i] + carry;
-        carry = tmp.digits[i] < carry ? 1 : 0;
-        tmp.digits[i] += b->digits[i];
-        if (tmp.digits[i] < b->digits[i]) carry = 1;
+    uint64_t carry = add_uint64_arr(res, res, a, a_len);
+    size_t i;
+
+    for (i = a_len; i < res_len && carry; i++) {
+        res[i] += carry;
+        carry = res[i] == 0;
     }
-    tmp.digits[a->size] = carry;
-    bnz_set_bnz(res, &tmp);
-    bnz_free(&tmp);
+
+    return carry;
 }
 
-void bnz_subtract_bnz(bnz_t *res, const bnz_t *a, const bnz_t *b) // res = a - b, taking account of signs, invoking bnz_subtraction or bnz_addition
+uint64_t sub_from_uint64_arr(uint64_t *res, size_t res_len, const uint64_t *a, size_t a_len) // res = res - a over res_len limbs where a_len <= res_len, propagating the borrow, return the borrow out of the msb limb
 {
-    int32_t cmp;
-    bnz_t tmp, aa, bb;
-
-    bnz_init(&tmp);
-    bnz_init(&aa);
-    bnz_init(&bb);
+    uint64_t borrow = sub_uint64_arr(res, res, a, a_len);
+    size_t i;
 
-    bnz_set_bnz(&aa, a);
-    bnz_set_bnz(&bb, b);
+    for (i = a_len; i < res_len && borrow; i++) {
+        borrow = res[i] == 0;
+        res[i]--;
+    }
 
-    bnz_align(&aa, &bb);
+    return borrow;
+}
 
-    cmp = cmp_uint8_arr(aa.digits, bb.digits, aa.size);
+void negate_uint64_arr(uint64_t *a, size_t len) // a = 2^(64 len) - a, two's complement negation in place
+{
+    uint64_t carry = 1;
+    size_t i;
 
-    if (a->sign) { // -a
-        if (b->sign) { // -a, -b
-            if (cmp == -1) { // |a| < |b|
-                bnz_subtraction(&tmp, &bb, &aa);
-                tmp.sign = 0;
-            } else { // |a| >= |b|
-                bnz_subtraction(&tmp, &aa, &bb);
-                tmp.sign = 1;
-            }
-        } else { // -a, +b
-            bnz_addition(&tmp, &aa, &bb);
-            tmp.sign = 1;
-        }
-    } else { // +a
-        if (b->sign) { // +a, -b
-            bnz_addition(&tmp, &aa, &bb);
-            tmp.sign = 0;
-        } else { // +a, +b
-            if (cmp == -1) { // |a| < |b|
-                bnz_subtraction(&tmp, &bb, &aa);
-                tmp.sign = 1;
-            } else { // |a| >= |b|
-                bnz_subtraction(&tmp, &aa, &bb);
-                tmp.sign = 0;
-            }
-        }
+    for (i = 0; i < len; i++) {
+        a[i] = ~a[i] + carry;
+        carry = carry && a[i] == 0;
     }
+}
 
-    bnz_trim(&tmp);
+bool diff_uint64_arr(uint64_t *res, const uint64_t *a, size_t a_len, const uint64_t *b, size_t b_len) // res = |a - b| over a_len limbs where b_len <= a_len, return true if a < b, res may alias a but not b
+{
+    memmove(res, a, a_len * sizeof(uint64_t));
+    if (sub_from_uint64_arr(res, a_len, b, b_len) == 0) return false;
 
-    bnz_set_bnz(res, &tmp);
+    negate_uint64_arr(res, a_len); // a < b, res holds 2^(64 a_len) - (b - a)
 
-    bnz_free(&tmp);
-    bnz_free(&aa);
-    bnz_free(&bb);
+    return true;
 }
 
-void bnz_subtraction(bnz_t *res, const bnz_t *a, const bnz_t *b) // res = |a| - |b|
+void divexact_3_uint64_arr(uint64_t *a, size_t len) // a = a / 3 in place for a known to be an exact multiple of 3 modulo 2^(64 len), so that two's complement values may be divided
 {
-    size_t i, borrow = 0;
-    bnz_t tmp;
-    bnz_init(&tmp);
-    bnz_resize(&tmp, a->size, false);
-    for (i = 0; i < a->size; i++) {
-        tmp.digits[i] = a->digits[i] - borrow;
-        borrow = tmp.digits[i] > 255 - borrow ? 1 : 0;
-        tmp.digits[i] -= b->digits[i];
-        if (tmp.digits[i] > 255 - b->digits[i]) borrow = 1;
+    uint64_t c = 0, s, l;
+    size_t i;
+
+    for (i = 0; i < len; i++) { // multiply by the inverse of 3 mod 2^64, carrying the high half of q * 3 into the next limb
+        s = a[i];
+        l = s - c;
+        c = l > s;
+        l *= 0xAAAAAAAAAAAAAAABULL;
+        a[i] = l;
+        c += (uint64_t)(((uint128_t)l * 3) >> 64);
     }
-    bnz_set_bnz(res, &tmp);
-    bnz_free(&tmp);
 }
 
-void bnz_multiply_i32(bnz_t *res, const bnz_t *a, int32_t b) // convert int32_t to bnz_t and invoke bnz_multiply_bnz
+void sar_1_uint64_arr(uint64_t *a, size_t len) // a = a >> 1 in place, arithmetic shift of a two's complement value
 {
-    bnz_t bb;
-    bnz_init(&bb);
-    bnz_set_i32(&bb, b);
-    bnz_multiply_bnz(res, a, &bb);
-    bnz_free(&bb);
+    uint64_t top = a[len - 1] & 0x8000000000000000ULL;
+
+    shift_r_uint64_arr(a, a, len, 1);
+    a[len - 1] |= top;
 }
 
-void bnz_multiply_bnz(bnz_t *res, const bnz_t *a, const bnz_t *b) // res = |a| * |b|
+uint64_t mul_add_words_uint64_arr(uint64_t *res, uint64_t x, const uint64_t *a, uint64_t y, const uint64_t *b, size_t len) // res = x * a + y * b over len limbs, return the carry out of the msb limb, res must not alias a or b
 {
-    uint8_t k, t[2];
-    uint16_t m;
-    size_t i, j;
-    bnz_t tmp, aa, bb;
+    uint128_t pa, pb;
+    uint64_t ca = 0, cb = 0, lo, carry = 0;
+    size_t i;
 
-    bnz_init(&tmp);
-    bnz_init(&aa);
-    bnz_init(&bb);
+    for (i = 0; i < len; i++) {
+        pa = (uint128_t)x * a[i] + ca;
+        pb = (uint128_t)y * b[i] + cb;
+        ca = (uint64_t)(pa >> 64);
+        cb = (uint64_t)(pb >> 64);
+        lo = (uint64_t)pa + carry;
+        carry = lo < carry;
+        res[i] = lo + (uint64_t)pb;
+        carry += res[i] < lo;
+    }
 
-    bnz_set_bnz(&aa, a);
-    bnz_set_bnz(&bb, b);
+    return ca + cb + carry;
+}
 
-    bnz_align(&aa, &bb);
-    bnz_resize(&tmp, aa.size * 2, false);
+uint64_t mul_sub_words_uint64_arr(uint64_t *res, uint64_t x, const uint64_t *a, uint64_t y, const uint64_t *b, size_t len) // res = x * a - y * b over len limbs, return the borrow out of the msb limb (0 when x * a >= y * b), res must not alias a or b
+{
+    uint128_t pa, pb;
+    uint64_t ca = 0, cb = 0, la, lb, borrow = 0;
+    size_t i;
 
-    if (a->sign) { // -a
-        if (b->sign) { // -a, -b
-            tmp.sign = 0;
-        } else { // -a, +b
-            tmp.sign = 1;
-        }
-    } else { // +a
-        if (b->sign) { // +a, -b
-            tmp.sign = 1;
-        } else { // +a, +b
-            tmp.sign = 0;
-        }
+    for (i = 0; i < len; i++) {
+        pa = (uint128_t)x * a[i] + ca;
+        pb = (uint128_t)y * b[i] + cb;
+        ca = (uint64_t)(pa >> 64);
+        cb = (uint64_t)(pb >> 64);
+        la = (uint64_t)pa;
+        lb = (uint64_t)pb;
+        res[i] = la - lb - borrow;
+        borrow = la < lb || (la == lb && borrow);
     }
 
-    for (i = 0; i < aa.size; i++) {
-        if (bb.digits[i] == 0) {
-            tmp.digits[i + aa.size] = 0;
-        } else {
-            k = 0;
-            for (j = 0; j < aa.size; j++) {
-                m = aa.digits[j] * bb.digits[i];
-                t[0] = (m & 255) + k;
-                t[1] = (m >> 8) & 255;
-                if (t[0] < k) t[1]++;
-                t[0] += tmp.digits[j + i];
-                if (t[0] < tmp.digits[j + i]) t[1]++;
-                tmp.digits[j + i] = t[0];
-                k = t[1];
-            }    
-            tmp.digits[i + aa.size] = k;
-        }
-    }
+    return (ca - cb - borrow) != 0;
+}
 
-    bnz_trim(&tmp);
+uint64_t get_top_bits_uint64_arr(const uint64_t *a, size_t len, uint32_t sh) // return bits sh to sh + 63 of the len limb array a, bits beyond the msb limb read as 0
+{
+    size_t i = sh / 64;
+    uint32_t r = sh % 64;
+    uint64_t w;
 
-    bnz_set_bnz(res, &tmp);
+    if (i >= len) return 0;
+    w = a[i] >> r;
+    if (r > 0 && i + 1 < len) w |= a[i + 1] << (64 - r);
 
-    bnz_free(&tmp);
-    bnz_free(&aa);
-    bnz_free(&bb);
+    return w;
 }
 
-void bnz_division_signs(bnz_t *q, bnz_t *r, const bnz_t *a, const bnz_t *b) // process signs of q and r in a / b
+void mul_karatsuba_uint64_arr(uint64_t *res, const uint64_t *a, const uint64_t *b, size_t n, uint64_t *ws) // res = a * b for a and b of n >= 2 limbs, Karatsuba multiplication, res holds 2n limbs and must not alias a, b or ws, ws holds MUL_WS_LIMBS(n) limbs
 {
-    if (a->sign) { // -a
-        if (b->sign) { // -a, -b
-            q->sign = 0; // +q
-            r->sign = 1; // -r
-        } else { // -a, +b
-            q->sign = 1; // -q
-            r->sign = 1; // -r
-        }
-    } else { // +a
-        if (b->sign) { // +a, -b
-            q->sign = 1; // -q
-            r->sign = 0; // +r
-        } else { // +a, +b
-            q->sign = 0; // +q
-            r->sign = 0; // +r
+    size_t h = (n + 1) / 2, l = n - h, top;
+    uint64_t *da = ws, *db = ws + h, *t = ws + 2 * h, *m = ws + 4 * h, *next = ws + 6 * h + 1;
+    bool neg;
+
+    // a = a0 + a1 * 2^(64 h), b = b0 + b1 * 2^(64 h)
+    // a * b = z0 + (z0 + z2 - (a0 - a1) * (b0 - b1)) * 2^(64 h) + z2 * 2^(128 h), where z0 = a0 * b0 and z2 = a1 * b1
+    if (a == b) { // squaring, (a0 - a1)^2 is never negative and every product below is a square
+        diff_uint64_arr(da, a, h, a + h, l);
+        db = da;
+        neg = false;
+    } else {
+        neg = diff_uint64_arr(da, a, h, a + h, l) != diff_uint64_arr(db, b, h, b + h, l); // true if (a0 - a1) * (b0 - b1) is negative
+    }
+
+    mul_balanced_uint64_arr(res, a, b, h, next); // res[0..2h) = z0
+    mul_balanced_uint64_arr(res + 2 * h, a + h, b + h, l, next); // res[2h..2n) = z2
+    mul_balanced_uint64_arr(t, da, db, h, next); // t = |a0 - a1| * |b0 - b1|
+
+    memcpy(m, res, 2 * h * sizeof(uint64_t)); // m = z0 + z2 -/+ t, 2h + 1 limbs
+    m[2 * h] = 0;
+    add_to_uint64_arr(m, 2 * h + 1, res + 2 * h, 2 * l);
+    if (neg == true) {
+        add_to_uint64_arr(m, 2 * h + 1, t, 2 * h);
+    } else {
+        sub_from_uint64_arr(m, 2 * h + 1, t, 2 * h);
+    }
+
+    top = 2 * h + 1 < 2 * n - h ? 2 * h + 1 : 2 * n - h; // limbs of m beyond the end of res are zero
+    add_to_uint64_arr(res + h, 2 * n - h, m, top);
+}
+
+void mul_toom3_uint64_arr(uint64_t *res, const uint64_t *a, const uint64_t *b, size_t n, uint64_t *ws) // res = a * b for a and b of n >= 5 limbs, Toom-3 multiplication with evaluation points 0, 1, -1, -2 and infinity, res holds 2n limbs and must not alias a, b or ws, ws holds MUL_WS_LIMBS(n) limbs
+{
+    size_t k = (n + 2) / 3, l = n - 2 * k, L = 2 * k + 3, i, top;
+    uint64_t *a2 = ws, *b2 = ws + k;
+    uint64_t *a_1 = b2 + k, *a_m1 = a_1 + k + 1, *a_m2 = a_m1 + k + 1;
+    uint64_t *b_1 = a_m2 + k + 1, *b_m1 = b_1 + k + 1, *b_m2 = b_m1 + k + 1;
+    uint64_t *w0 = b_m2 + k + 1, *w1 = w0 + L, *w_m1 = w1 + L, *w_m2 = w_m1 + L, *w_inf = w_m2 + L, *next = w_inf + L;
+    uint64_t *w[5];
+    bool neg_m1, neg_m2;
+
+    // a = a0 + a1 * x + a2 * x^2 with x = 2^(64 k), a2 holds l limbs and is zero padded to k limbs, likewise b
+    memset(a2, 0, 2 * k * sizeof(uint64_t));
+    memcpy(a2, a + 2 * k, l * sizeof(uint64_t));
+    memcpy(b2, b + 2 * k, l * sizeof(uint64_t));
+
+    // evaluation, magnitudes of k + 1 limbs with separate signs, w_inf is used as temporary space
+    memcpy(a_1, a, k * sizeof(uint64_t));
+    a_1[k] = add_uint64_arr(a_1, a_1, a2, k); // a0 + a2
+    neg_m1 = diff_uint64_arr(a_m1, a_1, k + 1, a + k, k); // a(-1) = a0 - a1 + a2
+    a_1[k] += add_uint64_arr(a_1, a_1, a + k, k); // a(1) = a0 + a1 + a2
+    a_m2[k] = shift_l_uint64_arr(a_m2, a2, k, 2);
+    a_m2[k] += add_uint64_arr(a_m2, a_m2, a, k); // a0 + 4 a2
+    w_inf[k] = shift_l_uint64_arr(w_inf, a + k, k, 1); // 2 a1
+    neg_m2 = diff_uint64_arr(a_m2, a_m2, k + 1, w_inf, k + 1); // a(-2) = a0 - 2 a1 + 4 a2
+
+    if (a == b) { // squaring, the evaluations of b are those of a and every pointwise product is a square
+        b_1 = a_1;
+        b_m1 = a_m1;
+        b_m2 = a_m2;
+        neg_m1 = false;
+        neg_m2 = false;
+    } else {
+        memcpy(b_1, b, k * sizeof(uint64_t));
+        b_1[k] = add_uint64_arr(b_1, b_1, b2, k);
+        neg_m1 = neg_m1 != diff_uint64_arr(b_m1, b_1, k + 1, b + k, k); // true if a(-1) * b(-1) is negative
+        b_1[k] += add_uint64_arr(b_1, b_1, b + k, k);
+        b_m2[k] = shift_l_uint64_arr(b_m2, b2, k, 2);
+        b_m2[k] += add_uint64_arr(b_m2, b_m2, b, k);
+        w_inf[k] = shift_l_uint64_arr(w_inf, b + k, k, 1);
+        neg_m2 = neg_m2 != diff_uint64_arr(b_m2, b_m2, k + 1, w_inf, k + 1);
+    }
+
+    // pointwise products, held as two's complement values of L limbs
+    memset(w0, 0, 5 * L * sizeof(uint64_t));
+    mul_balanced_uint64_arr(w0, a, b, k, next);
+    mul_balanced_uint64_arr(w1, a_1, b_1, k + 1, next);
+    mul_balanced_uint64_arr(w_m1, a_m1, b_m1, k + 1, next);
+    if (neg_m1 == true) negate_uint64_arr(w_m1, L);
+    mul_balanced_uint64_arr(w_m2, a_m2, b_m2, k + 1, next);
+    if (neg_m2 == true) negate_uint64_arr(w_m2, L);
+    mul_balanced_uint64_arr(w_inf, a + 2 * k, a == b ? a + 2 * k : b + 2 * k, l, next);
+
+    // interpolation, Bodrato's sequence as set out at https://en.wikipedia.org/wiki/Toom%E2%80%93Cook_multiplication
+    sub_uint64_arr(w_m2, w_m2, w1, L); // r3 = (r(-2) - r(1)) / 3
+    divexact_3_uint64_arr(w_m2, L);
+    sub_uint64_arr(w1, w1, w_m1, L); // r1 = (r(1) - r(-1)) / 2
+    sar_1_uint64_arr(w1, L);
+    sub_uint64_arr(w_m1, w_m1, w0, L); // r2 = r(-1) - r(0)
+    sub_uint64_arr(w_m2, w_m1, w_m2, L); // r3 = (r2 - r3) / 2 + 2 r(inf)
+    sar_1_uint64_arr(w_m2, L);
+    add_uint64_arr(w_m2, w_m2, w_inf, L);
+    add_uint64_arr(w_m2, w_m2, w_inf, L);
+    add_uint64_arr(w_m1, w_m1, w1, L); // r2 = r2 + r1 - r(inf)
+    sub_uint64_arr(w_m1, w_m1, w_inf, L);
+    sub_uint64_arr(w1, w1, w_m2, L); // r1 = r1 - r3
+
+    // recomposition, res = r0 + r1 * x + r2 * x^2 + r3 * x^3 + r(inf) * x^4, the coefficients are all non negative
+    w[0] = w0;
+    w[1] = w1;
+    w[2] = w_m1;
+    w[3] = w_m2;
+    w[4] = w_inf;
+    memset(res, 0, 2 * n * sizeof(uint64_t));
+    for (i = 0; i < 5; i++) {
+        top = L < 2 * n - i * k ? L : 2 * n - i * k; // limbs beyond the end of res are zero
+        add_to_uint64_arr(res + i * k, 2 * n - i * k, w[i], top);
+    }
+}
+
+void mul_balanced_uint64_arr(uint64_t *res, const uint64_t *a, const uint64_t *b, size_t n, uint64_t *ws) // res = a * b for a and b of n limbs, choosing schoolbook, Karatsuba or Toom-3 multiplication by size, squaring if a == b, res holds 2n limbs and must not alias a, b or ws, ws holds MUL_WS_LIMBS(n) limbs
+{
+    if (n < KARATSUBA_THRESHOLD) {
+        if (a == b) {
+            sqr_uint64_arr(res, a, n);
+        } else {
+            mul_uint64_arr(res, a, n, b, n);
         }
+    } else if (n < TOOM3_THRESHOLD) {
+        mul_karatsuba_uint64_arr(res, a, b, n, ws);
+    } else {
+        mul_toom3_uint64_arr(res, a, b, n, ws);
     }
 }
 
-void bnz_divide_bnz(bnz_t *q, bnz_t *r, const bnz_t *a, const bnz_t *b) // get q and r of a / b, taking account of signs, invoking bnz_division
+void mul_fast_uint64_arr(uint64_t *res, const uint64_t *a, size_t a_len, const uint64_t *b, size_t b_len) // res = a * b, as mul_uint64_arr but using Karatsuba, Toom-3 or number theoretic transform multiplication for large operands, an unbalanced product below NTT_THRESHOLD is split into balanced products of the length of the shorter operand
 {
-    int32_t cmp;
-
-    bnz_t aa, bb;
-
-    bnz_init(&aa);
-    bnz_init(&bb);
-
-    bnz_set_bnz(&aa, a);
-    bnz_set_bnz(&bb, b);
-    bnz_trim(&aa);
-    bnz_trim(&bb);
+    uint64_t *ws = NULL, *pad, *prod;
+    const uint64_t *t;
+    size_t i, len, top;
 
-    aa.sign = 0;
-    bb.sign = 0;
+    if (a_len < b_len) { // b is the shorter operand
+        t = a;
+        a = b;
+        b = t;
+        len = a_len;
+        a_len = b_len;
+        b_len = len;
+    }
 
-    if (bnz_is_zero(&bb) == true) { // divide by 0
-        printf("div 0 error\n");
-        bnz_set_i32(q, 0);
-        bnz_set_i32(r, 0);
+    if (b_len < KARATSUBA_THRESHOLD) {
+        mul_uint64_arr(res, a, a_len, b, b_len);
         return;
     }
 
-    cmp = bnz_cmp_bnz(&aa, &bb);
-
-    if (cmp == 0) { // |aa| = |bb|
-        bnz_set_i32(q, 1);
-        bnz_set_i32(r, 0);
-        bnz_division_signs(q, r, a, b);
-        bnz_free(&aa);
-        bnz_free(&bb);
+    if (b_len >= NTT_THRESHOLD) {
+        mul_ntt_uint64_arr(res, a, a_len, b, b_len);
         return;
     }
 
-    if (cmp == -1) { // |aa| < |bb|
-        bnz_set_i32(q, 0);
-        bnz_set_bnz(r, &aa);
-        bnz_division_signs(q, r, a, b);
-        bnz_free(&aa);
-        bnz_free(&bb);
+    ws = bnz_scratch_alloc(MUL_WS_LIMBS(b_len) + 3 * b_len);
+    if (!ws) {
+        mul_uint64_arr(res, a, a_len, b, b_len); // fall back on schoolbook multiplication, which needs no workspace
         return;
     }
+    pad = ws + MUL_WS_LIMBS(b_len);
+    prod = pad + b_len;
 
-    bnz_division(q, r, &aa, &bb); // |aa| > |bb|
-    bnz_division_signs(q, r, a, b);
+    if (a_len == b_len) {
+        mul_balanced_uint64_arr(res, a, b, b_len, ws);
+    } else {
+        memset(res, 0, (a_len + b_len) * sizeof(uint64_t));
+        for (i = 0; i < a_len; i += b_len) {
+            len = a_len - i < b_len ? a_len - i : b_len;
+            memset(pad, 0, b_len * sizeof(uint64_t)); // the last slice of a is zero padded
+            memcpy(pad, a + i, len * sizeof(uint64_t));
+            mul_balanced_uint64_arr(prod, pad, b, b_len, ws);
+            top = 2 * b_len < a_len + b_len - i ? 2 * b_len : a_len + b_len - i;
+            add_to_uint64_arr(res + i, a_len + b_len - i, prod, top);
+        }
+    }
 
-    bnz_free(&aa);
-    bnz_free(&bb);   
+    bnz_scratch_free(ws);
 }
 
-void bnz_division(bnz_t *q, bnz_t *r, const bnz_t *a, const bnz_t *b) // get q and r of |a| / |b|
+uint64_t mont_mul_word(uint64_t a, uint64_t b, uint64_t p, uint64_t p_inv) // return a * b * 2^(-64) mod p, single limb Montgomery multiplication, requires odd p < 2^63, a * b < p 2^64 and p_inv = -p^(-1) mod 2^64
 {
-    uint8_t *an = NULL, *bn = NULL, tmp = b->digits[b->size - 1];
-    uint16_t q_hat, r_hat, p, base = 256;
-    int32_t sh = 0, i, j, t, k;
+    uint128_t t = (uint128_t)a * b;
+    uint64_t m = (uint64_t)t * p_inv, r;
 
-    bnz_resize(q, a->size - b->size + 1, false);
-    bnz_resize(r, b->size, false);
+    r = (uint64_t)((t + (uint128_t)m * p) >> 64); // below 2p, the low limb of the sum is 0
+    return r >= p ? r - p : r;
+}
 
-    while (tmp < 128) { // measure left shift required to ensure that the highest bit of bn->digits[bn->size - 1] is set
-        sh++;
-        tmp <<= 1;
-    }
+uint64_t pow_mod_word(uint64_t a, uint64_t e, uint64_t p) // return a^e mod p by square and multiply with 128 bit remainders, for setting up constants
+{
+    uint64_t r = 1 % p;
 
-    // an
-    an = init_uint8_array(2 * (a->size + 1));
-    if (!an) {
-        return;
+    a %= p;
+    while (e > 0) {
+        if (e & 1) r = (uint64_t)((uint128_t)r * a % p);
+        a = (uint64_t)((uint128_t)a * a % p);
+        e >>= 1;
     }
 
-    an[a->size] = a->digits[a->size - 1] >> (8 - sh);
-    for (i = a->size - 1; i > 0; i--) {
-        an[i] = (a->digits[i] << sh) | (a->digits[i-1] >> (8 - sh));
-    }
-    an[0] = a->digits[0] << sh;
+    return r;
+}
 
-    // bn
-    bn = init_uint8_array(2 * b->size);
-    if (!bn) {
-        free(an);
-        return;
+void ntt_roots_uint64_arr(uint64_t *roots, size_t n, uint64_t w, uint64_t p, uint64_t p_inv) // roots[m + j] = w_2m^j mod p in Montgomery form for each transform stage of half length m < n and j < m, where w is a primitive n-th root of unity and w_2m = w^(n / 2m), roots holds n limbs and roots[0] is unused
+{
+    uint64_t x = (uint64_t)(((uint128_t)1 << 64) % p), w_mont = (uint64_t)(((uint128_t)w << 64) % p);
+    size_t m, j;
+
+    if (n < 2) return;
+
+    for (j = 0; j < n / 2; j++) {
+        roots[n / 2 + j] = x;
+        x = mont_mul_word(x, w_mont, p, p_inv);
     }
-    for (i = b->size - 1; i > 0; i--) {
-        bn[i] = (b->digits[i] << sh) | (b->digits[i - 1] >> (8 - sh));
+    for (m = n / 4; m >= 1; m /= 2) { // w_2m = w_4m^2, every other root of the stage above
+        for (j = 0; j < m; j++) roots[m + j] = roots[2 * m + 2 * j];
     }
-    bn[0] = b->digits[0] << sh;
-
-    // main loop
-    for (j = a->size - b->size; j >= 0; j--) {
-        q_hat = ((an[j + b->size] * base) + an[j + b->size - 1]) / bn[b->size - 1];
-        r_hat = ((an[j + b->size] * base) + an[j + b->size - 1]) - (q_hat * bn[b->size - 1]);
+}
 
-        // q_hat adjustment, maximum 2 iterations
-        if (q_hat >= base || q_hat * bn[b->size - 2] > (base * r_hat) + an[j + b->size - 2]) { // first iteration
-            q_hat -= 1;
-            r_hat += bn[b->size - 1];
-            if (r_hat < base) { // second iteration
-                if (q_hat >= base || q_hat * bn[b->size - 2] > (base * r_hat) + an[j + b->size - 2]) {
-                    q_hat -= 1;
-                    r_hat += bn[b->size - 1];
-                }
-            }
-        }
+void ntt_uint64_arr(uint64_t *a, size_t n, const uint64_t *roots, uint64_t p, uint64_t p_inv) // forward number theoretic transform of n residues mod p in place, n a power of 2, roots from ntt_roots_uint64_arr, decimation in frequency so the input is in natural order and the output in bit reversed order
+{
+    uint64_t u, v;
+    size_t m, i, j;
 
-        k = 0;
-        for (i = 0; i < b->size; i++) {
-            p = q_hat * bn[i];
-            t = an[i + j] - k - (p & 255);
-            an[i + j] = t;
-            k = (p >> 8) - (t >> 8);
-        }
-        t = an[j + b->size] - k;
-        an[j + b->size] = t;
-
-        q->digits[j] = q_hat;
-
-        if (t < 0) {
-            k = 0;
-            q->digits[j] = q->digits[j] - 1;
-            for (i = 0; i < b->size; i++) {
-                t = an[i + j] + bn[i] + k;
-                an[i + j] = t;
-                k = t >> 8;
+    for (m = n / 2; m >= 1; m /= 2) {
+        for (i = 0; i < n; i += 2 * m) {
+            for (j = 0; j < m; j++) {
+                u = a[i + j];
+                v = a[i + j + m];
+                a[i + j] = u + v >= p ? u + v - p : u + v;
+                a[i + j + m] = mont_mul_word(u + p - v, roots[m + j], p, p_inv);
             }
-            an[j + b->size] = an[j + b->size] + k;
         }
     }
-
-    for (i = 0; i < b->size; i++) {
-        r->digits[i] = (an[i] >> sh) | (an[i + 1] << (8 - sh));
-    }
-
-    bnz_trim(q);
-    bnz_trim(r);
-
-    free(an);
-    free(bn);
 }
 
-void bnz_mod_bnz(bnz_t *res, const bnz_t *a, const bnz_t *b) // res = a % b, invoking bnz_divide_bnz
+void intt_uint64_arr(uint64_t *a, size_t n, const uint64_t *roots, uint64_t p, uint64_t p_inv) // inverse number theoretic transform of n residues mod p in place without the division by n, roots from ntt_roots_uint64_arr for the inverse root of unity, decimation in time so the input is in bit reversed order and the output in natural order
 {
-    bnz_t q, r;
-
-    bnz_init(&q);
-    bnz_init(&r);
-    
-    bnz_divide_bnz(&q, &r, a, b);
-    bnz_trim(&r);
-    if (r.sign) bnz_add_bnz(&r, &r, b);
-    bnz_set_bnz(res, &r);
+    uint64_t u, v;
+    size_t m, i, j;
 
-    bnz_free(&q);
-    bnz_free(&r);
+    for (m = 1; m < n; m *= 2) {
+        for (i = 0; i < n; i += 2 * m) {
+            for (j = 0; j < m; j++) {
+                u = a[i + j];
+                v = mont_mul_word(a[i + j + m], roots[m + j], p, p_inv);
+                a[i + j] = u + v >= p ? u + v - p : u + v;
+                a[i + j + m] = u >= v ? u - v : u + p - v;
+            }
+        }
+    }
 }
 
-void bnz_mod_pow(bnz_t *res, const bnz_t *a, const bnz_t *b, const bnz_t *c) // get res = a^b mod c, code adapted from the pseudocode at https://en.wikipedia.org/wiki/Modular_exponentiation
+void mul_ntt_uint64_arr(uint64_t *res, const uint64_t *a, size_t a_len, const uint64_t *b, size_t b_len) // res = a * b, cyclic convolution of the limbs by number theoretic transforms modulo each of ntt_primes, the coefficients (below 2^128 min(a_len, b_len)) are recovered by Garner's algorithm and carried into res, squaring if a == b, res holds a_len + b_len limbs and must not alias a or b
 {
-    bnz_t aa, bb;
-
-    bnz_init(&aa);
-    bnz_init(&bb);
+    uint64_t *c, *t, *roots, *iroots, *r[NTT_PRIMES], p, p_inv[NTT_PRIMES], inv, r2, w, scale, p1 = ntt_primes[0], p2 = ntt_primes[1], p3 = ntt_primes[2], inv12, inv123, p1_mod3, m1, m2, d, x_mod3, acc[3], v[3], carry;
+    uint128_t p12 = (uint128_t)p1 * p2, x, lo, hi;
+    size_t n = 1, i, k, len = a_len + b_len;
+    int square = a == b && a_len == b_len;
 
-    bnz_set_i32(res, 1);
-    bnz_set_bnz(&aa, a);
-    bnz_set_bnz(&bb, b);
+    while (n < len) n *= 2;
 
-    while (bnz_cmp_i32(&bb, 0) == 1) {
-        if (bnz_bit_set(&bb, 0) == true) {
-            bnz_multiply_bnz(res, res, &aa);
-            bnz_mod_bnz(res, res, c);
-        }
-        bnz_multiply_bnz(&aa, &aa, &aa);
-        bnz_mod_bnz(&aa, &aa, c);
-        bnz_shift_r(&bb, 1);
+    c = bnz_scratch_alloc((NTT_PRIMES + 3) * n); // residues for each prime, the transform of b, and the roots of unity of both directions
+    if (!c) {
+        mul_uint64_arr(res, a, a_len, b, b_len);
+        return;
     }
+    t = c + NTT_PRIMES * n;
+    roots = t + n;
+    iroots = roots + n;
+
+    for (k = 0; k < NTT_PRIMES; k++) {
+        p = ntt_primes[k];
+        r[k] = c + k * n;
+        inv = p;
+        for (i = 0; i < 5; i++) inv *= 2 - p * inv; // p^(-1) mod 2^64 by Newton's iteration
+        p_inv[k] = -inv;
+        r2 = (uint64_t)(((uint128_t)(uint64_t)(((uint128_t)1 << 64) % p) << 64) % p); // 2^128 mod p, mont_mul_word(x, r2) is x in Montgomery form
+        w = pow_mod_word(ntt_generators[k], (p - 1) / n, p); // primitive n-th root of unity
+        ntt_roots_uint64_arr(roots, n, w, p, p_inv[k]);
+        ntt_roots_uint64_arr(iroots, n, pow_mod_word(w, n - 1, p), p, p_inv[k]);
+
+        for (i = 0; i < a_len; i++) r[k][i] = mont_mul_word(a[i], r2, p, p_inv[k]);
+        ntt_uint64_arr(r[k], n, roots, p, p_inv[k]);
+        if (square) {
+            for (i = 0; i < n; i++) r[k][i] = mont_mul_word(r[k][i], r[k][i], p, p_inv[k]);
+        } else {
+            for (i = 0; i < b_len; i++) t[i] = mont_mul_word(b[i], r2, p, p_inv[k]);
+            memset(t + b_len, 0, (n - b_len) * sizeof(uint64_t));
+            ntt_uint64_arr(t, n, roots, p, p_inv[k]);
+            for (i = 0; i < n; i++) r[k][i] = mont_mul_word(r[k][i], t[i], p, p_inv[k]);
+        }
+        intt_uint64_arr(r[k], n, iroots, p, p_inv[k]);
+        scale = pow_mod_word(n, p - 2, p); // n^(-1), also leaves Montgomery form
+        for (i = 0; i < len; i++) r[k][i] = mont_mul_word(r[k][i], scale, p, p_inv[k]);
+    }
+
+    inv12 = (uint64_t)(((uint128_t)pow_mod_word(p1, p2 - 2, p2) << 64) % p2); // p1^(-1) mod p2 in Montgomery form
+    inv123 = (uint64_t)(((uint128_t)pow_mod_word((uint64_t)(p12 % p3), p3 - 2, p3) << 64) % p3); // (p1 p2)^(-1) mod p3 in Montgomery form
+    p1_mod3 = (uint64_t)(((uint128_t)(p1 % p3) << 64) % p3); // p1 mod p3 in Montgomery form
+
+    acc[0] = acc[1] = acc[2] = 0;
+    for (i = 0; i < len; i++) { // coefficient x = x1 + p1 m1 + p1 p2 m2 with x1 = r[0][i], m1 < p2 and m2 < p3
+        d = r[0][i] >= p2 ? r[0][i] - p2 : r[0][i]; // p1 < 2 p2
+        d = r[1][i] >= d ? r[1][i] - d : r[1][i] + p2 - d;
+        m1 = mont_mul_word(d, inv12, p2, p_inv[1]);
+        x = r[0][i] + (uint128_t)p1 * m1; // below p1 p2
+
+        x_mod3 = r[0][i];
+        while (x_mod3 >= p3) x_mod3 -= p3; // p1 < 3 p3
+        x_mod3 += mont_mul_word(m1, p1_mod3, p3, p_inv[2]);
+        if (x_mod3 >= p3) x_mod3 -= p3;
+        d = r[2][i] >= x_mod3 ? r[2][i] - x_mod3 : r[2][i] + p3 - x_mod3;
+        m2 = mont_mul_word(d, inv123, p3, p_inv[2]);
+
+        lo = (uint128_t)m2 * (uint64_t)p12; // p1 p2 m2, p1 p2 < 2^123
+        hi = (uint128_t)m2 * (uint64_t)(p12 >> 64) + (uint64_t)(lo >> 64);
+        v[0] = (uint64_t)lo;
+        v[1] = (uint64_t)hi;
+        v[2] = (uint64_t)(hi >> 64);
+        lo = (uint128_t)v[0] + (uint64_t)x; // add x1 + p1 m1
+        v[0] = (uint64_t)lo;
+        lo = (uint128_t)v[1] + (uint64_t)(x >> 64) + (uint64_t)(lo >> 64);
+        v[1] = (uint64_t)lo;
+        v[2] += (uint64_t)(lo >> 64);
+
+        lo = (uint128_t)acc[0] + v[0]; // acc += x, the running sum stays below 2^186
+        acc[0] = (uint64_t)lo;
+        lo = (uint128_t)acc[1] + v[1] + (uint64_t)(lo >> 64);
+        acc[1] = (uint64_t)lo;
+        carry = (uint64_t)(lo >> 64);
+        acc[2] += v[2] + carry;
+
+        res[i] = acc[0]; // shift out the finished limb
+        acc[0] = acc[1];
+        acc[1] = acc[2];
+        acc[2] = 0;
+    }
+
+    bnz_scratch_free(c);
+}
+
+void mont_mul_uint64_arr(uint64_t *res, const uint64_t *a, const uint64_t *b, const uint64_t *m, uint64_t m_inv, size_t len, uint64_t *t) // res = a * b * 2^(-64 len) mod m, Montgomery multiplication (CIOS), requires odd m, a < m, b < m and m_inv = -m^(-1) mod 2^64, t is workspace of len + 2 limbs, res may alias a or b
+{
+    uint128_t p;
+    uint64_t carry, u;
+    size_t i, j;
 
-    bnz_free(&aa);
-    bnz_free(&bb);
-}
+    memset(t, 0, (len + 2) * sizeof(uint64_t));
 
-void bnz_modular_multiplicative_inverse(bnz_t *res, const bnz_t *a, const bnz_t *b) // get res where (res * a) mod b = 1, code adapted from the pseudocode of various examples of the extended Euclidean algorithm
-{
-    bnz_t q, rem, tmp1, t, new_t, r, new_r, tmp2;
+    for (i = 0; i < len; i++) {
+        carry = 0; // t = t + a * b[i]
+        for (j = 0; j < len; j++) {
+            p = (uint128_t)a[j] * b[i] + t[j] + carry;
+            t[j] = (uint64_t)p;
+            carry = (uint64_t)(p >> 64);
+        }
+        p = (uint128_t)t[len] + carry;
+        t[len] = (uint64_t)p;
+        t[len + 1] = (uint64_t)(p >> 64);
+
+        u = t[0] * m_inv; // t = (t + u * m) / 2^64, u is chosen so that the low limb of the sum is zero
+        p = (uint128_t)u * m[0] + t[0];
+        carry = (uint64_t)(p >> 64);
+        for (j = 1; j < len; j++) {
+            p = (uint128_t)u * m[j] + t[j] + carry;
+            t[j - 1] = (uint64_t)p;
+            carry = (uint64_t)(p >> 64);
+        }
+        p = (uint128_t)t[len] + carry;
+        t[len - 1] = (uint64_t)p;
+        t[len] = t[len + 1] + (uint64_t)(p >> 64);
+    }
 
-    bnz_init(&q);
-    bnz_init(&rem);
-    bnz_init(&t);
-    bnz_init(&new_t);
-    bnz_init(&r);
-    bnz_init(&new_r);
-    bnz_init(&tmp1);
-    bnz_init(&tmp2);
-
-    bnz_set_i32(&t, 0);
-    bnz_set_i32(&new_t, 1);
-    bnz_set_bnz(&r, b);
-    bnz_set_bnz(&new_r, a);
-
-    while (bnz_is_zero(&new_r) == false) {
-        bnz_divide_bnz(&q, &rem, &r, &new_r);
-        bnz_set_bnz(&tmp1, &new_t);
-        bnz_multiply_bnz(&tmp2, &q, &tmp1);
-        bnz_subtract_bnz(&new_t, &t, &tmp2);
-        bnz_set_bnz(&t, &tmp1);
-        bnz_set_bnz(&tmp1, &new_r);
-        bnz_multiply_bnz(&tmp2, &q, &tmp1);
-        bnz_subtract_bnz(&new_r, &r, &tmp2);
-        bnz_set_bnz(&r, &tmp1);
-    }
-
-    if (bnz_cmp_i32(&r, 1) == 1) {
-        bnz_set_i32(res, 0);
+    if (t[len] != 0 || cmp_uint64_arr(t, m, len) >= 0) { // t < 2m, at most one subtraction
+        sub_uint64_arr(res, t, m, len);
     } else {
-        if (t.sign) bnz_add_bnz(&t, &t, b);
-        bnz_set_bnz(res, &t);
+        memcpy(res, t, len * sizeof(uint64_t));
     }
-
-    bnz_free(&q);
-    bnz_free(&rem);
-    bnz_free(&t);
-    bnz_free(&new_t);
-    bnz_free(&r);
-    bnz_free(&new_r);
-    bnz_free(&tmp1);
-    bnz_free(&tmp2);
 }
+void mont_sqr_uint64_arr(uint64_t *res, const uint64_t *a, const uint64_t *m, uint64_t m_inv, size_t len, uint64_t *t) // res = a * a * 2^(-64 len) mod m, squaring followed by Montgomery reduction, requires odd m, a < m and m_inv = -m^(-1) mod 2^64, t is workspace of 2 len + 1 limbs, res may alias a
+{
+    uint128_t p;
+    uint64_t carry, u;
+    size_t i, j;
 
-/* SECP256K1 DEFINES */
-
-typedef struct {
-    bnz_t x;
-    bnz_t y;
-} APT; // standard affine xy point
-
-typedef struct {
-    bnz_t x;
-    bnz_t y;
-    bnz_t z;
-} JPT; // extended Jacobian xyz point
-
-typedef struct {
-    bnz_t p; // prime
-    bnz_t a; // 0
-    bnz_t b; // 7
-    APT G; // generator point
-    APT G_doublings_mod_p[256]; // xy coordinates of 256 consecutive doublings of the secp256k1 generator point mod secp256k1.p i.e. secp256k1.G * 2^n mod secp256k1.p for n = 0 to 255
-    bnz_t n; // order
-    bnz_t h; // 1
-} SECP256K1;
-
-/* SECP256K1 GLOBAL VARIABLES */
-
-uint8_t g_doublings_data[16384] = {152, 23, 248, 22, 91, 129, 242, 89, 217, 40, 206, 45, 219, 252, 155, 2, 7, 11, 135, 206, 149, 98, 160, 85, 172, 187, 220, 249, 126, 102, 190, 121, 184, 212, 16, 251, 143, 208, 71, 156, 25, 84, 133, 166, 72, 180, 23, 253, 168, 8, 17, 14, 252, 251, 164, 93, 101, 196, 163, 38, 119, 218, 58, 72, 229, 158, 112, 92, 185, 9, 172, 171, 167, 60, 239, 140, 75, 142, 119, 92, 216, 124, 192, 149, 110, 64, 69, 48, 109, 125, 237, 65, 148, 127, 4, 198, 42, 229, 207, 80, 169, 49, 100, 35, 225, 208, 102, 50, 101, 50, 246, 247, 238, 234, 108, 70, 25, 132, 197, 163, 57, 195, 61, 166, 254, 104, 225, 26, 19, 205, 196, 232, 171, 148, 250, 116, 132, 117, 224, 14, 144, 19, 108, 204, 4, 20, 11, 147, 4, 73, 30, 88, 243, 128, 13, 193, 241, 219, 147, 228, 34, 153, 115, 71, 220, 123, 233, 207, 64, 254, 189, 191, 51, 174, 103, 217, 72, 20, 165, 142, 9, 226, 66, 86, 183, 85, 212, 160, 62, 153, 237, 81, 1, 42, 10, 225, 243, 78, 120, 103, 138, 136, 175, 229, 5, 221, 27, 10, 47, 60, 15, 183, 63, 132, 243, 175, 29, 53, 202, 92, 225, 229, 1, 47, 4, 233, 189, 108, 183, 44, 218, 181, 23, 118, 91, 186, 214, 19, 226, 194, 180, 19, 45, 19, 42, 8, 61, 41, 73, 153, 83, 65, 167, 168, 77, 92, 10, 236, 109, 42, 158, 232, 78, 196, 233, 90, 122, 184, 105, 19, 163, 178, 151, 62, 194, 33, 188, 170, 17, 48, 197, 158, 158, 181, 147, 206, 15, 230, 33, 104, 97, 105, 206, 44, 243, 225, 11, 63, 210, 68, 30, 137, 150, 18, 16, 55, 121, 245, 52, 159, 185, 157, 146, 149, 229, 153, 115, 80, 227, 247, 101, 62, 20, 7, 212, 219, 208, 117, 29, 166, 4, 153, 184, 252, 207, 218, 206, 120, 243, 226, 84, 224, 182, 71, 45, 162, 181, 79, 215, 153, 1, 211, 185, 106, 16, 36, 31, 255, 179, 5, 150, 129, 237, 100, 195, 12, 118, 31, 101, 128, 131, 233, 201, 222, 214, 179, 195, 213, 227, 10, 157, 141, 3, 149, 139, 239, 116, 248, 230, 24, 121, 227, 129, 253, 186, 205, 29, 111, 76, 252, 60, 130, 50, 248, 234, 81, 16, 11, 183, 234, 22, 45, 84, 193, 35, 191, 159, 29, 131, 102, 254, 126, 195, 77, 120, 47, 30, 129, 84, 252, 34, 197, 228, 146, 83, 186, 160, 40, 217, 122, 115, 3, 48, 195, 111, 134, 179, 92, 78, 162, 105, 103, 69, 119, 112, 100, 85, 86, 83, 0, 215, 92, 245, 188, 28, 103, 209, 247, 9, 61, 108, 105, 6, 122, 63, 3, 228, 59, 255, 52, 26, 47, 204, 115, 122, 6, 145, 132, 129, 182, 248, 232, 195, 22, 223, 85, 140, 9, 50, 152, 216, 25, 102, 63, 85, 108, 35, 58, 98, 17, 157, 93, 8, 21, 245, 213, 63, 226, 70, 6, 161, 28, 172, 213, 171, 156, 195, 216, 56, 226, 45, 23, 62, 110, 42, 234, 217, 9, 198, 18, 50, 38, 130, 130, 175, 108, 226, 246, 175, 110, 27, 211, 190, 23, 123, 47, 172, 19, 214, 98, 206, 10, 182, 48, 232, 86, 130, 94, 228, 223, 87, 133, 9, 168, 248, 17, 77, 162, 52, 239, 0, 44, 110, 146, 208, 89, 225, 217, 104, 201, 219, 10, 213, 24, 249, 156, 122, 133, 90, 144, 243, 159, 167, 135, 178, 112, 83, 70, 244, 135, 56, 179, 32, 251, 248, 162, 16, 122, 211, 21, 178, 9, 142, 88, 193, 194, 238, 253, 218, 139, 175, 164, 130, 192, 104, 131, 179, 49, 229, 53, 31, 19, 133, 226, 178, 1, 185, 213, 136, 176, 19, 200, 205, 110, 236, 170, 64, 98, 173, 102, 143, 161, 100, 214, 119, 189, 60, 226, 184, 235, 31, 36, 109, 2, 80, 39, 111, 230, 179, 171, 175, 181, 12, 189, 15, 253, 80, 205, 248, 29, 152, 19, 189, 32, 196, 214, 211, 248, 148, 255, 217, 120, 51, 81, 113, 4, 146, 155, 6, 99, 203, 237, 13, 222, 35, 244, 133, 139, 49, 252, 217, 248, 216, 131, 41, 204, 228, 252, 121, 250, 114, 161, 78, 219, 27, 93, 3, 49, 184, 247, 102, 6, 51, 112, 123, 110, 197, 150, 153, 30, 235, 121, 86, 38, 162, 56, 148, 185, 75, 121, 46, 158, 55, 121, 103, 130, 67, 40, 57, 183, 229, 81, 181, 229, 252, 115, 237, 34, 34, 253, 51, 56, 185, 224, 109, 132, 252, 198, 198, 156, 249, 114, 90, 134, 139, 114, 159, 21, 94, 23, 149, 214, 254, 233, 254, 111, 250, 110, 92, 52, 36, 221, 90, 149, 181, 172, 94, 31, 247, 31, 165, 151, 239, 164, 235, 121, 60, 158, 13, 110, 80, 211, 214, 71, 188, 70, 158, 4, 120, 206, 27, 18, 218, 198, 181, 254, 253, 48, 33, 198, 57, 225, 200, 188, 255, 165, 215, 50, 255, 3, 63, 1, 58, 66, 52, 138, 84, 139, 109, 110, 35, 209, 158, 0, 79, 82, 195, 142, 13, 114, 199, 179, 246, 186, 123, 159, 23, 161, 112, 217, 225, 225, 15, 224, 26, 185, 74, 130, 22, 132, 247, 246, 45, 48, 65, 39, 62, 59, 47, 102, 223, 73, 118, 135, 214, 188, 122, 122, 144, 8, 5, 185, 31, 172, 69, 106, 29, 17, 208, 233, 8, 33, 212, 17, 161, 169, 76, 202, 218, 150, 137, 0, 112, 240, 82, 89, 6, 255, 219, 72, 13, 185, 251, 175, 142, 71, 28, 145, 150, 6, 117, 215, 206, 27, 224, 221, 94, 171, 86, 78, 247, 94, 138, 182, 144, 114, 255, 220, 185, 188, 190, 93, 121, 173, 184, 200, 199, 122, 201, 109, 74, 74, 109, 214, 141, 167, 104, 143, 191, 178, 172, 66, 71, 66, 219, 12, 233, 29, 87, 244, 192, 57, 247, 249, 62, 148, 114, 30, 99, 22, 176, 17, 153, 82, 64, 70, 255, 131, 143, 173, 107, 82, 254, 47, 85, 85, 126, 28, 68, 83, 224, 46, 38, 182, 5, 172, 206, 153, 156, 12, 176, 71, 212, 144, 61, 54, 233, 157, 238, 59, 127, 60, 0, 98, 203, 158, 25, 8, 144, 168, 185, 69, 49, 54, 243, 151, 83, 68, 59, 149, 33, 34, 115, 252, 173, 115, 226, 4, 65, 197, 146, 175, 92, 42, 113, 210, 157, 181, 223, 46, 1, 251, 98, 11, 191, 2, 59, 201, 198, 115, 57, 85, 155, 126, 154, 237, 102, 152, 27, 76, 32, 224, 143, 198, 253, 243, 196, 114, 173, 177, 62, 228, 215, 234, 82, 198, 156, 230, 86, 206, 83, 183, 188, 127, 15, 138, 190, 32, 211, 146, 247, 193, 209, 243, 170, 190, 140, 242, 200, 224, 53, 241, 40, 26, 188, 237, 51, 50, 78, 181, 128, 7, 60, 47, 154, 82, 43, 177, 131, 186, 119, 56, 8, 164, 185, 84, 178, 240, 77, 83, 43, 177, 144, 239, 209, 110, 87, 231, 1, 32, 226, 179, 97, 147, 214, 131, 191, 184, 121, 188, 239, 254, 18, 246, 233, 64, 58, 211, 64, 121, 90, 219, 211, 140, 185, 3, 66, 69, 10, 136, 13, 110, 111, 200, 86, 47, 26, 62, 78, 58, 181, 192, 140, 210, 65, 198, 4, 168, 122, 150, 70, 109, 250, 149, 206, 67, 169, 54, 247, 156, 168, 140, 241, 26, 232, 71, 96, 193, 66, 40, 236, 61, 208, 166, 47, 43, 37, 131, 190, 149, 12, 248, 253, 223, 85, 154, 247, 105, 27, 205, 91, 161, 129, 167, 228, 67, 136, 99, 69, 183, 181, 68, 98, 140, 190, 194, 243, 93, 22, 95, 75, 139, 54, 253, 212, 95, 198, 240, 239, 179, 86, 238, 98, 97, 84, 54, 227, 249, 4, 218, 176, 58, 129, 215, 251, 179, 180, 8, 211, 104, 111, 10, 173, 74, 190, 228, 85, 71, 113, 38, 63, 187, 122, 153, 124, 65, 238, 100, 175, 113, 16, 97, 60, 200, 126, 124, 225, 140, 113, 145, 50, 225, 228, 92, 12, 237, 47, 244, 123, 160, 110, 250, 249, 99, 177, 218, 61, 118, 37, 57, 217, 73, 128, 166, 126, 90, 127, 173, 61, 191, 189, 69, 35, 188, 199, 159, 26, 34, 171, 200, 206, 7, 200, 230, 182, 212, 206, 82, 5, 110, 86, 84, 50, 229, 232, 250, 241, 131, 63, 92, 177, 179, 148, 230, 76, 196, 19, 176, 236, 250, 112, 80, 21, 171, 217, 223, 129, 137, 46, 46, 94, 184, 134, 178, 50, 156, 61, 177, 47, 236, 198, 2, 46, 252, 87, 203, 158, 14, 233, 181, 9, 204, 247, 177, 209, 154, 174, 78, 246, 7, 62, 205, 35, 79, 130, 221, 178, 179, 253, 202, 203, 55, 11, 26, 115, 200, 242, 210, 202, 45, 19, 138, 187, 9, 128, 28, 129, 195, 39, 6, 19, 100, 83, 45, 117, 244, 64, 168, 84, 15, 133, 62, 134, 79, 40, 221, 249, 182, 185, 227, 238, 175, 178, 178, 91, 148, 218, 252, 50, 82, 146, 21, 97, 203, 123, 231, 192, 166, 255, 219, 0, 183, 199, 72, 213, 11, 192, 113, 247, 107, 109, 153, 219, 229, 166, 186, 60, 114, 95, 159, 179, 158, 157, 6, 220, 1, 72, 73, 121, 55, 101, 160, 96, 38, 110, 77, 130, 136, 116, 19, 33, 169, 152, 196, 92, 89, 181, 103, 232, 150, 213, 48, 160, 12, 214, 131, 211, 31, 7, 73, 152, 7, 67, 10, 36, 45, 198, 163, 115, 87, 196, 125, 61, 52, 77, 116, 123, 67, 134, 167, 239, 87, 158, 47, 176, 116, 66, 180, 122, 176, 74, 151, 233, 229, 42, 109, 155, 104, 236, 3, 222, 40, 201, 39, 54, 137, 24, 133, 180, 209, 11, 219, 18, 215, 213, 77, 88, 12, 119, 199, 175, 127, 42, 1, 123, 50, 126, 87, 128, 16, 185, 108, 34, 213, 156, 126, 223, 162, 66, 188, 40, 106, 67, 189, 75, 38, 17, 171, 4, 119, 147, 39, 18, 230, 141, 141, 123, 113, 67, 130, 17, 106, 34, 190, 51, 76, 226, 92, 247, 212, 180, 147, 224, 78, 169, 111, 124, 216, 232, 56, 36, 75, 216, 107, 242, 43, 157, 236, 189, 213, 31, 198, 139, 167, 157, 167, 54, 98, 5, 92, 200, 218, 187, 210, 64, 189, 36, 101, 76, 169, 244, 97, 134, 241, 219, 200, 226, 194, 43, 155, 227, 160, 96, 60, 93, 126, 58, 158, 1, 5, 149, 33, 121, 253, 128, 98, 249, 146, 217, 31, 32, 181, 250, 215, 125, 14, 202, 62, 83, 154, 131, 25, 169, 55, 18, 150, 71, 9, 181, 211, 194, 18, 200, 238, 95, 186, 152, 191, 190, 147, 212, 164, 191, 238, 153, 137, 222, 225, 218, 79, 253, 221, 18, 247, 17, 167, 195, 205, 228, 154, 157, 8, 120, 241, 218, 126, 238, 105, 242, 240, 14, 151, 163, 140, 154, 93, 253, 151, 210, 71, 8, 233, 190, 118, 214, 102, 103, 143, 192, 75, 234, 196, 95, 73, 24, 193, 49, 96, 28, 166, 253, 123, 169, 167, 215, 74, 28, 56, 197, 63, 73, 125, 24, 227, 172, 147, 0, 156, 147, 219, 50, 16, 69, 240, 204, 94, 145, 9, 167, 95, 62, 143, 228, 238, 142, 35, 59, 245, 106, 147, 76, 69, 222, 46, 66, 112, 141, 68, 178, 8, 221, 239, 95, 208, 241, 156, 71, 140, 83, 217, 49, 8, 225, 204, 59, 198, 173, 5, 205, 185, 239, 225, 151, 55, 145, 168, 51, 210, 159, 173, 198, 212, 162, 167, 68, 50, 78, 70, 35, 113, 71, 254, 31, 76, 21, 176, 231, 155, 175, 216, 48, 69, 203, 14, 164, 153, 235, 41, 179, 238, 63, 211, 24, 123, 212, 51, 159, 65, 229, 199, 168, 117, 244, 154, 94, 35, 172, 197, 16, 112, 105, 162, 177, 249, 24, 83, 45, 249, 145, 254, 238, 110, 114, 44, 101, 236, 227, 209, 64, 43, 31, 164, 232, 5, 180, 235, 58, 217, 114, 87, 25, 164, 237, 75, 235, 207, 76, 244, 176, 141, 164, 57, 91, 131, 215, 239, 191, 3, 60, 155, 162, 21, 18, 159, 69, 222, 123, 155, 160, 208, 145, 39, 103, 113, 110, 105, 218, 68, 15, 16, 9, 90, 198, 43, 214, 92, 189, 15, 172, 149, 81, 255, 24, 74, 255, 183, 102, 6, 9, 12, 48, 243, 200, 46, 119, 11, 160, 146, 49, 225, 217, 205, 6, 247, 77, 30, 79, 40, 5, 75, 8, 8, 125, 35, 249, 200, 217, 216, 153, 65, 76, 43, 255, 93, 65, 168, 113, 199, 181, 206, 242, 137, 9, 140, 152, 250, 114, 93, 163, 197, 106, 115, 170, 17, 101, 21, 245, 107, 222, 96, 108, 150, 220, 185, 44, 23, 210, 255, 52, 32, 67, 79, 4, 189, 77, 251, 253, 191, 71, 220, 51, 60, 230, 177, 27, 188, 149, 188, 57, 133, 82, 156, 37, 192, 98, 50, 116, 129, 164, 196, 4, 103, 38, 94, 60, 21, 143, 251, 149, 176, 73, 217, 221, 69, 10, 9, 19, 38, 84, 172, 137, 19, 222, 29, 83, 205, 188, 180, 217, 17, 250, 22, 24, 98, 224, 197, 157, 122, 162, 108, 154, 98, 178, 75, 139, 27, 250, 184, 184, 167, 55, 119, 88, 44, 160, 101, 132, 112, 40, 167, 240, 201, 12, 90, 117, 81, 93, 215, 63, 51, 71, 231, 214, 246, 70, 105, 26, 150, 141, 159, 154, 150, 26, 110, 170, 118, 131, 200, 129, 37, 76, 128, 3, 54, 196, 76, 17, 12, 7, 69, 1, 254, 175, 242, 45, 253, 52, 229, 230, 205, 138, 44, 133, 179, 243, 100, 68, 141, 127, 167, 23, 192, 4, 74, 122, 34, 201, 29, 27, 237, 199, 98, 226, 27, 3, 225, 13, 160, 86, 148, 242, 24, 79, 164, 121, 237, 28, 158, 65, 221, 146, 242, 90, 83, 151, 101, 23, 164, 182, 107, 94, 64, 64, 137, 146, 97, 112, 157, 86, 131, 92, 169, 54, 126, 226, 132, 87, 216, 148, 222, 197, 106, 138, 2, 201, 178, 41, 15, 205, 93, 249, 185, 234, 137, 128, 76, 34, 63, 185, 244, 211, 31, 0, 190, 185, 97, 88, 189, 154, 96, 21, 73, 52, 241, 126, 195, 144, 238, 14, 164, 167, 246, 229, 176, 223, 98, 41, 6, 236, 146, 122, 166, 138, 14, 22, 123, 225, 47, 214, 32, 108, 105, 126, 249, 18, 133, 30, 213, 176, 8, 91, 2, 234, 34, 150, 177, 54, 82, 229, 252, 161, 172, 209, 9, 68, 76, 160, 124, 197, 80, 224, 52, 229, 181, 18, 146, 238, 224, 233, 111, 126, 194, 216, 224, 44, 105, 86, 62, 198, 240, 1, 81, 143, 24, 83, 17, 194, 127, 186, 117, 4, 125, 125, 233, 98, 149, 195, 191, 147, 58, 139, 81, 231, 205, 33, 56, 121, 173, 162, 24, 158, 43, 76, 69, 204, 89, 108, 198, 86, 89, 95, 247, 156, 198, 195, 126, 151, 85, 89, 177, 221, 96, 10, 240, 178, 12, 193, 170, 206, 243, 164, 190, 207, 15, 179, 191, 226, 47, 89, 217, 109, 105, 148, 144, 141, 104, 94, 45, 245, 106, 29, 164, 102, 178, 248, 92, 236, 215, 59, 20, 159, 131, 194, 10, 83, 91, 213, 70, 174, 108, 234, 254, 136, 0, 9, 24, 191, 222, 85, 49, 45, 68, 65, 204, 87, 137, 28, 152, 92, 205, 62, 191, 18, 78, 110, 176, 186, 225, 220, 151, 108, 107, 124, 229, 8, 43, 117, 238, 10, 4, 164, 10, 135, 161, 49, 179, 224, 202, 30, 20, 121, 225, 178, 157, 175, 97, 50, 197, 225, 135, 219, 26, 98, 11, 0, 77, 234, 44, 48, 72, 31, 133, 114, 62, 58, 41, 199, 25, 241, 245, 125, 203, 204, 114, 217, 130, 85, 130, 109, 203, 85, 210, 224, 24, 143, 91, 13, 106, 239, 88, 92, 71, 253, 98, 153, 248, 119, 27, 31, 62, 64, 160, 87, 214, 40, 113, 113, 20, 33, 38, 170, 214, 93, 160, 61, 32, 202, 112, 245, 113, 14, 66, 93, 211, 114, 154, 100, 248, 125, 62, 54, 195, 0, 93, 68, 242, 141, 91, 201, 91, 52, 87, 85, 210, 13, 136, 220, 149, 91, 65, 66, 235, 89, 131, 255, 67, 96, 176, 72, 96, 81, 118, 94, 198, 29, 130, 180, 70, 20, 160, 29, 194, 181, 130, 210, 183, 83, 210, 123, 159, 98, 179, 183, 162, 194, 254, 134, 254, 236, 127, 57, 162, 53, 56, 111, 4, 53, 8, 209, 16, 201, 41, 30, 247, 163, 55, 169, 87, 45, 18, 149, 22, 148, 56, 48, 105, 177, 108, 236, 193, 139, 151, 250, 51, 222, 131, 133, 128, 125, 101, 237, 254, 60, 202, 255, 230, 75, 190, 103, 179, 220, 156, 4, 145, 29, 169, 103, 218, 29, 190, 104, 122, 226, 168, 158, 126, 161, 64, 247, 8, 197, 173, 199, 222, 229, 128, 151, 236, 247, 99, 244, 65, 188, 66, 22, 72, 53, 170, 172, 155, 201, 65, 231, 31, 130, 204, 227, 94, 131, 90, 234, 204, 53, 159, 189, 139, 113, 216, 0, 175, 250, 12, 12, 124, 88, 239, 161, 95, 54, 205, 186, 77, 35, 182, 142, 51, 248, 16, 190, 96, 95, 83, 192, 159, 160, 132, 195, 12, 157, 41, 56, 232, 89, 253, 220, 127, 46, 137, 81, 138, 14, 84, 195, 22, 218, 24, 226, 180, 186, 168, 237, 135, 80, 96, 104, 82, 241, 133, 76, 15, 89, 194, 65, 255, 216, 23, 143, 230, 238, 155, 80, 129, 196, 255, 209, 19, 25, 28, 25, 219, 157, 65, 219, 224, 39, 209, 91, 109, 32, 1, 173, 164, 189, 88, 183, 177, 55, 147, 203, 206, 29, 150, 145, 169, 31, 57, 8, 96, 184, 109, 233, 162, 202, 64, 59, 19, 255, 219, 41, 206, 22, 217, 201, 60, 59, 83, 176, 69, 156, 199, 89, 118, 0, 96, 108, 239, 156, 79, 155, 33, 199, 107, 59, 141, 167, 1, 223, 39, 101, 87, 144, 62, 197, 138, 79, 57, 110, 42, 55, 192, 128, 65, 164, 245, 234, 239, 89, 217, 5, 198, 217, 36, 192, 183, 55, 26, 204, 92, 84, 87, 159, 6, 17, 187, 247, 208, 8, 236, 81, 33, 242, 94, 147, 0, 224, 166, 221, 76, 51, 11, 170, 79, 144, 83, 200, 113, 39, 2, 107, 9, 203, 157, 105, 52, 68, 225, 129, 153, 153, 19, 28, 60, 13, 194, 202, 236, 201, 136, 109, 16, 128, 188, 208, 135, 192, 91, 169, 124, 164, 56, 31, 15, 205, 87, 173, 133, 15, 173, 170, 231, 110, 42, 93, 153, 22, 99, 25, 145, 249, 60, 117, 70, 65, 157, 175, 117, 165, 1, 183, 205, 235, 119, 46, 223, 197, 103, 166, 126, 77, 159, 93, 60, 185, 189, 152, 134, 187, 225, 82, 252, 85, 204, 195, 13, 178, 138, 203, 241, 56, 48, 91, 86, 21, 227, 85, 215, 9, 227, 110, 12, 194, 211, 131, 26, 166, 211, 214, 85, 97, 183, 193, 245, 113, 202, 57, 212, 33, 118, 67, 224, 240, 245, 130, 204, 46, 221, 175, 48, 132, 103, 10, 228, 215, 62, 191, 97, 191, 165, 26, 16, 247, 13, 22, 137, 33, 246, 43, 5, 90, 190, 98, 78, 159, 107, 51, 45, 54, 245, 217, 129, 231, 203, 66, 118, 34, 70, 33, 201, 203, 71, 227, 164, 12, 151, 109, 243, 167, 87, 154, 110, 11, 108, 11, 111, 80, 143, 63, 36, 250, 135, 12, 125, 72, 48, 175, 142, 187, 67, 93, 146, 207, 72, 104, 51, 28, 79, 66, 197, 48, 149, 113, 97, 250, 42, 93, 149, 159, 70, 71, 96, 216, 58, 244, 89, 249, 239, 202, 139, 155, 58, 4, 58, 181, 121, 103, 144, 202, 100, 119, 202, 156, 113, 167, 131, 89, 211, 11, 205, 123, 142, 42, 55, 96, 132, 126, 4, 16, 234, 179, 104, 253, 71, 46, 142, 232, 121, 69, 81, 169, 12, 66, 16, 3, 148, 179, 164, 61, 42, 11, 119, 183, 16, 81, 3, 63, 241, 139, 128, 210, 119, 231, 137, 3, 61, 141, 91, 193, 59, 223, 80, 105, 153, 25, 243, 80, 195, 157, 114, 94, 25, 170, 91, 179, 51, 24, 116, 141, 203, 204, 3, 197, 43, 112, 155, 136, 188, 239, 96, 101, 170, 188, 82, 141, 36, 54, 64, 70, 249, 135, 191, 10, 100, 133, 1, 138, 165, 54, 187, 20, 68, 178, 199, 29, 215, 166, 188, 215, 202, 9, 225, 246, 86, 34, 126, 31, 7, 210, 58, 184, 92, 149, 63, 201, 34, 174, 238, 77, 55, 74, 115, 175, 141, 169, 190, 117, 120, 33, 67, 229, 0, 99, 214, 40, 56, 41, 247, 6, 248, 6, 44, 3, 22, 153, 79, 205, 79, 182, 101, 17, 23, 22, 214, 231, 106, 173, 100, 138, 94, 12, 159, 42, 182, 242, 186, 77, 148, 220, 176, 174, 149, 115, 224, 70, 124, 229, 234, 58, 127, 156, 192, 128, 35, 26, 188, 27, 22, 72, 190, 153, 0, 86, 103, 132, 143, 20, 146, 175, 147, 154, 176, 9, 213, 239, 138, 89, 241, 106, 149, 100, 52, 25, 134, 142, 111, 98, 56, 196, 153, 21, 30, 132, 10, 105, 230, 151, 131, 241, 244, 167, 113, 222, 27, 184, 137, 134, 129, 208, 230, 33, 255, 205, 193, 52, 237, 94, 56, 83, 84, 46, 84, 229, 143, 69, 192, 140, 220, 134, 32, 236, 78, 48, 107, 87, 244, 235, 233, 25, 222, 1, 103, 245, 35, 234, 232, 195, 235, 59, 40, 124, 130, 242, 120, 112, 162, 131, 220, 226, 28, 252, 190, 66, 38, 200, 71, 209, 103, 95, 77, 19, 190, 86, 4, 128, 84, 175, 61, 8, 34, 246, 246, 2, 161, 170, 32, 181, 32, 91, 209, 246, 27, 50, 72, 116, 202, 87, 230, 231, 206, 103, 179, 21, 87, 44, 175, 15, 58, 231, 125, 129, 78, 205, 27, 182, 220, 90, 113, 9, 50, 137, 157, 54, 111, 140, 125, 206, 195, 145, 205, 85, 194, 31, 61, 60, 203, 112, 189, 226, 61, 149, 143, 24, 229, 38, 251, 243, 104, 186, 88, 59, 202, 219, 73, 84, 171, 183, 184, 49, 203, 210, 22, 105, 23, 208, 25, 167, 70, 232, 88, 77, 163, 18, 16, 129, 40, 225, 243, 30, 140, 120, 96, 117, 219, 68, 237, 215, 209, 139, 14, 6, 55, 140, 209, 183, 234, 60, 118, 188, 198, 245, 40, 45, 19, 185, 17, 89, 34, 145, 137, 241, 14, 143, 142, 34, 66, 92, 99, 17, 158, 239, 253, 132, 156, 150, 54, 250, 54, 177, 89, 53, 118, 184, 39, 155, 172, 201, 124, 152, 77, 139, 218, 167, 195, 250, 195, 134, 237, 6, 198, 201, 251, 71, 89, 74, 248, 221, 15, 24, 250, 61, 65, 164, 115, 124, 99, 145, 241, 236, 3, 184, 217, 249, 6, 96, 33, 132, 58, 96, 144, 104, 216, 2, 16, 40, 92, 47, 221, 164, 126, 212, 196, 69, 14, 163, 226, 184, 105, 186, 89, 48, 96, 142, 198, 128, 124, 45, 215, 127, 75, 116, 34, 157, 92, 23, 218, 228, 167, 229, 69, 23, 218, 57, 41, 72, 132, 194, 54, 220, 28, 28, 65, 43, 37, 234, 238, 134, 174, 188, 56, 238, 78, 122, 203, 52, 35, 40, 247, 114, 20, 85, 17, 146, 141, 233, 240, 159, 88, 206, 10, 171, 98, 249, 2, 115, 112, 201, 147, 233, 25, 144, 146, 22, 124, 38, 116, 20, 122, 238, 242, 54, 207, 117, 190, 24, 135, 72, 44, 220, 86, 140, 47, 29, 230, 85, 255, 191, 11, 249, 201, 72, 34, 87, 162, 62, 136, 18, 138, 157, 54, 226, 43, 218, 53, 2, 117, 99, 225, 24, 186, 53, 180, 85, 187, 6, 165, 215, 238, 33, 45, 105, 148, 5, 250, 227, 100, 9, 181, 75, 172, 13, 253, 118, 111, 28, 221, 119, 8, 159, 169, 208, 133, 64, 217, 72, 27, 193, 74, 7, 68, 92, 224, 22, 110, 26, 225, 200, 191, 130, 6, 139, 191, 127, 118, 111, 140, 49, 56, 225, 198, 173, 23, 36, 175, 240, 150, 37, 94, 173, 225, 48, 212, 162, 135, 91, 6, 214, 135, 189, 230, 208, 66, 231, 224, 183, 19, 83, 94, 15, 219, 99, 209, 116, 247, 203, 110, 77, 16, 124, 20, 162, 130, 37, 78, 60, 36, 1, 212, 34, 51, 160, 178, 40, 108, 233, 162, 243, 36, 246, 58, 135, 162, 62, 246, 5, 40, 183, 249, 218, 77, 188, 25, 176, 191, 245, 78, 102, 233, 151, 7, 231, 86, 98, 228, 173, 192, 50, 109, 105, 252, 41, 207, 219, 234, 200, 221, 76, 13, 213, 12, 200, 4, 27, 243, 14, 18, 174, 189, 206, 80, 2, 32, 38, 141, 12, 71, 38, 15, 185, 168, 224, 216, 58, 139, 103, 114, 78, 251, 74, 29, 186, 54, 238, 195, 45, 111, 31, 211, 55, 244, 91, 113, 180, 59, 237, 235, 51, 230, 22, 21, 62, 100, 100, 145, 139, 156, 45, 7, 13, 147, 212, 142, 59, 208, 148, 245, 161, 104, 64, 206, 169, 190, 174, 110, 118, 192, 56, 18, 5, 120, 123, 199, 40, 183, 205, 5, 40, 2, 116, 204, 45, 37, 70, 9, 23, 220, 195, 209, 226, 121, 201, 214, 89, 19, 39, 187, 45, 176, 157, 138, 102, 122, 142, 120, 82, 21, 176, 25, 22, 194, 14, 43, 40, 215, 220, 205, 185, 17, 106, 138, 117, 234, 178, 231, 21, 156, 203, 112, 7, 91, 29, 39, 39, 151, 60, 224, 88, 114, 141, 122, 78, 130, 138, 80, 227, 101, 160, 226, 127, 135, 172, 73, 153, 208, 87, 228, 145, 244, 231, 52, 88, 164, 58, 93, 131, 171, 52, 129, 210, 116, 29, 114, 151, 51, 100, 247, 154, 63, 27, 116, 104, 88, 102, 137, 13, 119, 209, 43, 218, 183, 224, 45, 125, 44, 103, 133, 166, 19, 3, 121, 79, 9, 227, 200, 68, 143, 41, 197, 252, 23, 127, 231, 229, 194, 98, 250, 155, 4, 116, 99, 235, 178, 67, 91, 155, 27, 72, 124, 37, 252, 23, 31, 188, 144, 139, 153, 150, 109, 46, 223, 70, 234, 137, 59, 31, 166, 200, 21, 18, 134, 193, 54, 192, 158, 15, 116, 107, 207, 76, 83, 118, 110, 232, 207, 110, 127, 28, 215, 221, 40, 221, 191, 119, 210, 227, 10, 85, 67, 213, 50, 221, 227, 42, 70, 219, 45, 139, 156, 176, 92, 113, 213, 182, 232, 190, 232, 35, 9, 23, 199, 210, 200, 251, 236, 71, 13, 2, 121, 237, 170, 248, 24, 32, 20, 30, 8, 243, 183, 135, 238, 92, 31, 29, 169, 193, 68, 6, 65, 170, 22, 61, 0, 37, 178, 140, 98, 159, 86, 0, 248, 178, 211, 218, 221, 200, 137, 113, 90, 225, 142, 223, 226, 78, 50, 138, 116, 116, 207, 132, 89, 37, 28, 26, 170, 16, 31, 246, 190, 69, 174, 53, 7, 60, 56, 212, 226, 221, 20, 162, 193, 53, 142, 12, 217, 35, 140, 92, 193, 0, 176, 204, 57, 216, 140, 164, 196, 162, 21, 176, 80, 45, 119, 191, 71, 186, 215, 95, 226, 69, 111, 220, 200, 53, 34, 82, 40, 216, 84, 169, 43, 10, 42, 200, 96, 175, 89, 217, 255, 50, 136, 102, 15, 198, 38, 146, 15, 177, 19, 148, 145, 241, 201, 6, 107, 164, 136, 25, 155, 128, 191, 72, 9, 137, 229, 200, 216, 136, 127, 203, 212, 190, 210, 124, 201, 8, 255, 77, 109, 140, 65, 195, 209, 197, 116, 107, 220, 70, 102, 203, 109, 133, 98, 165, 83, 10, 0, 139, 126, 69, 176, 110, 57, 81, 94, 130, 30, 51, 193, 22, 239, 182, 240, 145, 98, 198, 228, 92, 13, 54, 89, 46, 55, 127, 44, 149, 38, 90, 112, 239, 5, 31, 64, 61, 140, 49, 103, 61, 101, 143, 57, 190, 222, 34, 132, 104, 45, 61, 137, 188, 98, 136, 166, 0, 88, 76, 234, 19, 245, 150, 79, 19, 118, 137, 88, 2, 241, 233, 176, 214, 114, 101, 25, 33, 245, 67, 242, 31, 19, 139, 190, 242, 190, 189, 197, 35, 252, 230, 88, 46, 198, 126, 249, 76, 209, 212, 126, 39, 130, 62, 28, 115, 99, 53, 133, 251, 188, 197, 31, 20, 83, 103, 103, 61, 140, 103, 161, 177, 69, 125, 130, 151, 67, 187, 140, 24, 11, 128, 248, 134, 54, 151, 222, 7, 8, 32, 3, 28, 184, 176, 34, 102, 113, 154, 50, 131, 22, 116, 92, 236, 14, 82, 96, 116, 16, 36, 33, 39, 31, 54, 182, 215, 1, 166, 61, 206, 141, 116, 13, 46, 36, 17, 74, 245, 156, 155, 107, 50, 53, 140, 89, 33, 154, 192, 212, 229, 171, 232, 216, 143, 243, 25, 216, 236, 204, 42, 117, 105, 252, 77, 228, 176, 241, 168, 115, 40, 240, 224, 124, 6, 79, 195, 1, 24, 70, 127, 206, 96, 98, 23, 174, 180, 178, 149, 78, 168, 193, 152, 193, 81, 128, 35, 146, 210, 236, 247, 30, 106, 119, 73, 144, 240, 167, 113, 181, 165, 111, 43, 168, 45, 188, 45, 124, 71, 61, 111, 116, 102, 7, 126, 210, 170, 150, 81, 92, 230, 22, 19, 26, 79, 232, 155, 64, 200, 222, 115, 26, 173, 72, 71, 218, 216, 133, 112, 221, 209, 199, 111, 129, 121, 32, 166, 213, 196, 51, 32, 160, 176, 148, 188, 199, 239, 49, 101, 83, 107, 88, 144, 102, 92, 102, 83, 139, 148, 88, 217, 128, 11, 108, 45, 49, 80, 72, 240, 71, 220, 15, 16, 126, 30, 77, 238, 227, 62, 204, 233, 146, 8, 140, 150, 75, 236, 231, 102, 113, 42, 142, 80, 159, 178, 214, 42, 31, 198, 73, 154, 52, 6, 215, 136, 182, 151, 82, 72, 157, 106, 113, 155, 210, 237, 44, 89, 190, 44, 174, 169, 11, 219, 234, 190, 97, 69, 44, 61, 250, 33, 153, 15, 217, 89, 19, 232, 178, 74, 238, 80, 137, 143, 215, 236, 102, 131, 220, 142, 245, 191, 66, 88, 199, 155, 118, 95, 104, 217, 176, 255, 11, 146, 213, 173, 115, 120, 123, 118, 119, 161, 65, 71, 93, 63, 247, 206, 228, 220, 200, 186, 131, 231, 47, 54, 23, 248, 75, 45, 250, 55, 32, 141, 204, 83, 41, 67, 220, 191, 117, 245, 200, 62, 4, 3, 65, 191, 75, 65, 72, 131, 61, 212, 216, 193, 175, 224, 125, 3, 229, 218, 91, 117, 29, 132, 220, 229, 224, 16, 31, 72, 236, 3, 91, 95, 189, 221, 11, 153, 251, 9, 141, 249, 249, 181, 211, 148, 170, 75, 83, 113, 69, 239, 52, 61, 158, 199, 200, 99, 140, 219, 45, 42, 121, 124, 33, 171, 195, 62, 27, 214, 210, 247, 108, 11, 244, 148, 84, 253, 103, 164, 13, 224, 165, 76, 219, 122, 47, 206, 197, 85, 184, 172, 0, 9, 121, 254, 220, 96, 91, 210, 67, 191, 153, 254, 38, 23, 66, 85, 133, 96, 229, 245, 229, 143, 9, 82, 18, 185, 215, 96, 113, 115, 230, 42, 87, 119, 68, 46, 253, 74, 109, 196, 251, 155, 28, 187, 244, 25, 53, 64, 43, 58, 239, 245, 21, 148, 169, 100, 194, 237, 75, 172, 119, 163, 115, 221, 77, 15, 89, 173, 22, 154, 137, 182, 246, 246, 36, 15, 241, 226, 185, 75, 248, 129, 174, 76, 230, 208, 130, 23, 15, 84, 106, 182, 101, 196, 216, 43, 19, 12, 95, 112, 13, 117, 76, 248, 53, 249, 152, 224, 221, 142, 125, 252, 209, 79, 158, 159, 78, 111, 181, 45, 16, 0, 2, 174, 252, 162, 70, 84, 168, 204, 203, 99, 41, 212, 33, 29, 45, 88, 240, 173, 17, 220, 211, 86, 168, 204, 41, 52, 229, 232, 50, 37, 231, 252, 228, 10, 106, 134, 37, 183, 197, 166, 198, 209, 219, 232, 231, 180, 113, 23, 143, 94, 144, 234, 245, 173, 7, 162, 244, 176, 114, 99, 224, 221, 49, 238, 78, 249, 52, 112, 178, 112, 72, 16, 135, 119, 74, 72, 215, 140, 72, 90, 173, 178, 123, 162, 18, 254, 140, 225, 188, 116, 137, 144, 122, 62, 255, 210, 62, 228, 174, 9, 254, 60, 237, 198, 78, 219, 191, 94, 4, 60, 63, 173, 79, 48, 189, 141, 156, 143, 107, 4, 162, 76, 19, 172, 14, 136, 9, 33, 125, 32, 6, 114, 225, 118, 19, 242, 183, 150, 246, 25, 172, 153, 23, 177, 242, 59, 16, 191, 69, 66, 155, 53, 121, 190, 13, 99, 73, 220, 164, 191, 223, 228, 6, 103, 71, 23, 91, 200, 4, 120, 138, 148, 245, 31, 180, 219, 122, 157, 17, 146, 131, 25, 234, 31, 115, 144, 133, 120, 214, 6, 84, 59, 189, 107, 205, 123, 202, 124, 160, 201, 221, 196, 241, 6, 98, 170, 19, 28, 210, 198, 245, 14, 148, 196, 99, 80, 157, 200, 168, 234, 40, 179, 249, 143, 228, 64, 251, 117, 114, 26, 176, 153, 85, 32, 166, 177, 199, 75, 29, 183, 18, 15, 33, 191, 74, 151, 64, 160, 217, 203, 252, 48, 105, 78, 106, 233, 142, 95, 171, 221, 207, 26, 197, 172, 228, 19, 155, 15, 9, 120, 109, 95, 135, 219, 252, 48, 218, 234, 1, 71, 185, 148, 174, 2, 127, 84, 151, 85, 208, 8, 105, 173, 64, 133, 245, 163, 226, 221, 11, 177, 4, 34, 224, 12, 220, 249, 187, 208, 88, 83, 212, 213, 92, 113, 122, 60, 33, 242, 88, 180, 52, 117, 194, 242, 223, 237, 126, 106, 243, 245, 80, 72, 187, 144, 161, 91, 36, 6, 173, 19, 112, 80, 98, 228, 90, 11, 173, 109, 75, 172, 127, 200, 14, 94, 137, 147, 137, 240, 124, 46, 98, 116, 185, 26, 13, 14, 72, 35, 131, 237, 159, 174, 102, 127, 154, 180, 50, 129, 84, 94, 28, 239, 212, 194, 95, 61, 123, 93, 85, 76, 50, 254, 38, 235, 172, 222, 163, 211, 42, 76, 29, 250, 89, 185, 43, 143, 70, 127, 131, 15, 246, 252, 79, 188, 29, 83, 212, 161, 203, 15, 226, 112, 201, 213, 254, 25, 28, 144, 31, 206, 199, 187, 16, 66, 233, 246, 222, 141, 102, 197, 2, 6, 109, 39, 70, 226, 184, 134, 150, 9, 48, 135, 175, 153, 188, 225, 255, 251, 173, 139, 73, 153, 237, 13, 87, 135, 34, 41, 74, 184, 117, 76, 212, 36, 127, 15, 14, 29, 0, 47, 82, 19, 239, 20, 97, 153, 216, 120, 220, 172, 224, 80, 104, 99, 145, 49, 28, 33, 235, 101, 78, 79, 194, 166, 167, 236, 104, 234, 239, 21, 68, 188, 115, 159, 65, 40, 193, 113, 135, 132, 179, 159, 149, 19, 228, 23, 154, 113, 163, 7, 3, 21, 218, 20, 60, 88, 157, 134, 71, 184, 170, 60, 213, 251, 8, 59, 58, 204, 240, 221, 44, 198, 173, 112, 140, 131, 226, 135, 154, 65, 165, 82, 147, 187, 141, 78, 179, 244, 122, 42, 39, 124, 78, 230, 170, 220, 23, 24, 148, 179, 224, 51, 221, 247, 191, 20, 150, 11, 83, 27, 104, 239, 109, 159, 208, 111, 225, 24, 11, 157, 108, 118, 156, 116, 23, 77, 27, 110, 124, 110, 30, 130, 226, 144, 135, 239, 27, 90, 242, 17, 155, 156, 93, 56, 78, 159, 38, 138, 38, 143, 136, 150, 38, 176, 23, 144, 137, 43, 171, 20, 216, 218, 235, 154, 0, 18, 178, 50, 249, 192, 27, 229, 228, 250, 139, 53, 54, 131, 121, 69, 187, 240, 52, 179, 181, 218, 44, 174, 67, 47, 113, 95, 126, 161, 53, 38, 175, 168, 131, 181, 145, 191, 245, 49, 40, 14, 127, 34, 99, 142, 114, 244, 168, 212, 95, 144, 110, 247, 68, 246, 103, 229, 96, 113, 112, 94, 203, 138, 214, 152, 97, 211, 247, 136, 20, 14, 94, 120, 207, 134, 181, 183, 222, 90, 240, 4, 93, 68, 102, 143, 214, 51, 184, 98, 167, 137, 59, 237, 99, 2, 193, 141, 107, 238, 18, 48, 201, 13, 147, 18, 71, 139, 150, 84, 160, 128, 250, 85, 37, 101, 147, 108, 135, 127, 50, 1, 51, 32, 185, 89, 217, 159, 156, 254, 125, 189, 254, 112, 80, 83, 117, 185, 151, 25, 94, 37, 105, 153, 176, 38, 64, 82, 179, 234, 4, 212, 178, 182, 39, 251, 64, 40, 126, 66, 50, 118, 5, 67, 190, 178, 61, 110, 199, 165, 106, 104, 97, 173, 56, 242, 16, 27, 139, 119, 190, 61, 78, 167, 254, 111, 185, 60, 242, 183, 61, 29, 112, 119, 123, 63, 151, 107, 89, 107, 18, 147, 175, 182, 204, 222, 116, 246, 124, 41, 19, 11, 155, 219, 104, 5, 110, 228, 86, 151, 31, 150, 124, 217, 143, 72, 48, 55, 222, 229, 14, 87, 187, 14, 205, 232, 80, 216, 3, 14, 24, 255, 128, 66, 48, 200, 65, 148, 237, 174, 191, 58, 63, 249, 9, 14, 255, 139, 233, 77, 254, 116, 55, 242, 9, 30, 145, 19, 139, 18, 118, 161, 175, 25, 250, 139, 254, 158, 158, 190, 61, 25, 241, 28, 213, 51, 208, 186, 21, 48, 77, 171, 79, 216, 189, 16, 91, 81, 135, 180, 36, 246, 211, 254, 201, 63, 124, 122, 230, 142, 105, 217, 41, 57, 99, 5, 117, 5, 116, 136, 60, 150, 194, 167, 147, 14, 148, 156, 184, 111, 201, 241, 4, 84, 18, 122, 39, 69, 43, 200, 125, 81, 44, 208, 127, 145, 36, 66, 127, 83, 68, 124, 70, 255, 12, 6, 134, 74, 62, 69, 253, 49, 10, 88, 51, 189, 183, 63, 111, 109, 147, 19, 80, 208, 87, 107, 18, 132, 239, 163, 157, 25, 31, 163, 175, 71, 147, 243, 11, 195, 186, 72, 225, 176, 63, 191, 162, 235, 163, 196, 227, 194, 98, 22, 6, 19, 220, 167, 193, 57, 222, 189, 23, 68, 42, 192, 82, 41, 67, 96, 183, 121, 225, 68, 21, 211, 104, 153, 89, 13, 87, 162, 16, 14, 207, 119, 246, 19, 65, 230, 118, 1, 172, 1, 25, 45, 117, 177, 180, 50, 32, 109, 181, 210, 51, 42, 94, 211, 240, 129, 6, 215, 102, 112, 87, 207, 149, 78, 238, 141, 223, 13, 201, 165, 135, 17, 58, 168, 153, 249, 28, 105, 174, 41, 44, 98, 87, 93, 0, 16, 200, 97, 129, 216, 201, 135, 238, 59, 199, 82, 158, 14, 83, 138, 112, 192, 185, 61, 71, 155, 241, 164, 88, 138, 62, 53, 109, 60, 167, 205, 62, 40, 56, 109, 187, 220, 86, 150, 250, 151, 168, 249, 225, 17, 72, 136, 155, 190, 245, 228, 205, 198, 22, 27, 46, 158, 181, 178, 134, 109, 75, 55, 159, 207, 98, 228, 149, 131, 100, 189, 25, 226, 59, 139, 196, 79, 3, 207, 25, 242, 26, 50, 111, 43, 83, 145, 10, 12, 28, 15, 63, 201, 209, 145, 239, 71, 25, 24, 171, 104, 190, 180, 195, 102, 180, 90, 161, 6, 43, 227, 40, 232, 243, 124, 209, 9, 194, 171, 227, 25, 34, 234, 75, 3, 189, 147, 238, 118, 245, 151, 131, 47, 156, 113, 124, 13, 95, 203, 120, 160, 68, 108, 175, 234, 186, 81, 23, 96, 208, 173, 184, 53, 212, 160, 124, 234, 42, 54, 236, 223, 70, 178, 60, 21, 115, 158, 175, 48, 75, 93, 232, 111, 9, 132, 7, 145, 184, 203, 43, 36, 80, 177, 58, 238, 203, 38, 223, 67, 198, 124, 143, 154, 143, 63, 116, 170, 27, 40, 232, 225, 171, 178, 3, 107, 197, 56, 199, 195, 132, 154, 105, 217, 53, 231, 23, 233, 207, 128, 120, 239, 78, 49, 130, 187, 187, 191, 172, 46, 143, 113, 127, 83, 210, 26, 149, 120, 181, 63, 137, 27, 171, 98, 70, 120, 176, 170, 221, 228, 201, 184, 73, 234, 151, 113, 100, 148, 170, 231, 146, 105, 42, 179, 53, 116, 3, 124, 205, 94, 132, 120, 85, 17, 53, 111, 5, 243, 24, 109, 49, 222, 100, 93, 106, 116, 167, 83, 246, 83, 64, 42, 29, 165, 208, 166, 206, 195, 226, 109, 139, 151, 7, 29, 230, 41, 108, 139, 148, 184, 105, 248, 148, 96, 153, 227, 252, 84, 35, 241, 34, 205, 236, 12, 29, 188, 163, 191, 74, 204, 100, 163, 136, 56, 56, 243, 71, 249, 126, 83, 14, 18, 225, 222, 30, 168, 148, 249, 136, 149, 73, 187, 24, 113, 108, 65, 91, 103, 72, 14, 25, 55, 41, 3, 15, 141, 154, 202, 72, 219, 74, 255, 5, 143, 108, 26, 168, 104, 247, 190, 252, 214, 112, 245, 20, 246, 213, 165, 198, 201, 180, 102, 228, 207, 184, 65, 174, 52, 31, 192, 192, 101, 16, 53, 172, 115, 255, 78, 252, 133, 91, 209, 112, 209, 67, 188, 205, 206, 184, 117, 64, 11, 122, 147, 124, 92, 127, 53, 228, 190, 245, 132, 11, 75, 193, 246, 136, 101, 159, 46, 55, 20, 80, 146, 58, 95, 46, 215, 209, 119, 40, 151, 124, 99, 199, 100, 226, 129, 91, 182, 72, 101, 98, 149, 216, 31, 153, 125, 93, 215, 62, 54, 121, 225, 103, 176, 43, 99, 141, 66, 3, 235, 64, 195, 24, 8, 198, 142, 114, 174, 126, 188, 242, 56, 170, 191, 254, 36, 132, 7, 119, 75, 89, 91, 186, 63, 12, 196, 14, 122, 175, 236, 3, 103, 162, 3, 32, 98, 67, 58, 138, 78, 4, 113, 137, 239, 110, 19, 253, 241, 221, 113, 198, 239, 238, 97, 205, 168, 223, 42, 138, 247, 177, 242, 124, 165, 239, 197, 181, 145, 209, 161, 103, 204, 82, 198, 243, 52, 168, 141, 33, 60, 203, 177, 141, 236, 132, 29, 95, 74, 2, 63, 212, 160, 3, 112, 27, 134, 159, 81, 103, 83, 202, 156, 14, 20, 141, 99, 217, 157, 142, 158, 217, 167, 55, 134, 107, 227, 41, 138, 216, 92, 118, 200, 255, 248, 254, 134, 98, 110, 186, 206, 27, 50, 187, 69, 169, 167, 163, 192, 28, 173, 25, 220, 54, 114, 81, 56, 60, 141, 246, 70, 253, 54, 230, 64, 4, 30, 53, 3, 210, 145, 145, 176, 229, 84, 138, 189, 161, 23, 131, 25, 154, 97, 241, 253, 3, 148, 151, 203, 252, 240, 103, 172, 121, 43, 35, 231, 144, 158, 146, 155, 91, 117, 115, 133, 60, 125, 12, 71, 254, 195, 18, 92, 110, 192, 2, 141, 64, 3, 110, 103, 79, 86, 10, 21, 73, 221, 78, 232, 147, 54, 199, 255, 206, 97, 135, 30, 87, 51, 100, 15, 235, 24, 117, 149, 42, 3, 148, 218, 184, 231, 246, 253, 78, 231, 228, 136, 20, 81, 59, 255, 149, 77, 88, 204, 146, 176, 8, 40, 118, 201, 156, 201, 215, 228, 161, 5, 72, 164, 223, 4, 40, 106, 114, 175, 197, 20, 244, 19, 212, 230, 246, 91, 178, 92, 62, 154, 70, 249, 32, 182, 138, 105, 203, 242, 83, 206, 197, 140, 237, 5, 209, 54, 109, 125, 252, 249, 19, 26, 73, 112, 197, 53, 138, 16, 180, 54, 153, 197, 220, 41, 0, 197, 149, 108, 198, 216, 114, 158, 102, 119, 227, 52, 92, 186, 228, 153, 219, 64, 165, 12, 163, 226, 134, 34, 129, 75, 83, 192, 9, 19, 235, 227, 176, 240, 102, 250, 131, 104, 208, 12, 172, 211, 12, 225, 189, 182, 58, 163, 120, 218, 27, 227, 63, 135, 230, 67, 192, 105, 227, 176, 55, 209, 56, 156, 233, 19, 106, 169, 23, 49, 252, 215, 113, 232, 155, 7, 98, 202, 186, 218, 72, 16, 159, 39, 191, 119, 119, 186, 211, 221, 115, 243, 212, 47, 186, 226, 188, 7, 157, 157, 6, 186, 253, 240, 86, 173, 241, 227, 52, 102, 121, 1, 207, 6, 161, 36, 190, 249, 232, 98, 72, 215, 207, 216, 118, 37, 83, 242, 39, 121, 90, 115, 116, 222, 86, 137, 11, 178, 207, 182, 226, 142, 77, 93, 223, 192, 227, 120, 23, 161, 241, 146, 167, 86, 81, 251, 239, 25, 32, 171, 127, 93, 71, 185, 218, 138, 125, 58, 179, 31, 68, 20, 234, 15, 232, 120, 236, 201, 106, 27, 41, 180, 252, 169, 46, 50, 175, 128, 94, 21, 45, 71, 148, 202, 163, 140, 118, 137, 30, 119, 0, 142, 99, 127, 222, 209, 238, 88, 205, 131, 15, 139, 231, 176, 45, 22, 249, 210, 119, 56, 204, 45, 18, 55, 122, 254, 30, 237, 196, 26, 152, 101, 18, 164, 142, 240, 161, 12, 68, 75, 63, 138, 184, 105, 192, 123, 176, 96, 162, 192, 105, 66, 77, 30, 162, 2, 47, 78, 157, 220, 84, 137, 175, 34, 225, 94, 205, 210, 176, 200, 166, 16, 139, 153, 18, 39, 218, 27, 232, 217, 41, 178, 193, 188, 14, 199, 155, 129, 7, 169, 211, 41, 248, 247, 197, 28, 108, 150, 43, 175, 203, 148, 246, 81, 94, 240, 0, 23, 139, 120, 246, 71, 42, 60, 24, 195, 100, 108, 235, 42, 216, 70, 204, 250, 95, 60, 99, 61, 240, 190, 97, 186, 62, 166, 64, 253, 83, 213, 141, 53, 19, 90, 249, 20, 100, 139, 192, 149, 246, 171, 71, 80, 89, 162, 57, 244, 212, 182, 80, 72, 104, 86, 53, 42, 134, 110, 139, 237, 229, 155, 62, 211, 218, 3, 216, 208, 131, 51, 24, 90, 60, 172, 36, 161, 159, 235, 244, 45, 188, 16, 13, 180, 28, 209, 14, 145, 8, 94, 234, 112, 96, 225, 196, 188, 123, 192, 221, 21, 105, 253, 30, 3, 130, 161, 242, 67, 117, 86, 29, 229, 72, 186, 19, 67, 112, 205, 223, 123, 105, 1, 163, 161, 126, 23, 30, 4, 26, 13, 12, 19, 26, 161, 192, 247, 219, 53, 23, 155, 15, 212, 37, 250, 9, 24, 8, 245, 228, 103, 251, 28, 249, 112, 115, 174, 165, 75, 242, 22, 3, 66, 17, 216, 181, 52, 76, 0, 101, 57, 180, 116, 255, 11, 158, 65, 210, 232, 243, 73, 240, 121, 255, 156, 229, 225, 39, 179, 69, 58, 136, 238, 191, 165, 132, 247, 99, 250, 154, 166, 161, 72, 223, 5, 223, 121, 252, 60, 94, 27, 238, 9, 226, 4, 200, 166, 38, 11, 49, 174, 215, 174, 156, 92, 23, 105, 153, 79, 251, 251, 132, 222, 173, 57, 90, 79, 126, 45, 137, 195, 142, 88, 22, 238, 74, 134, 246, 165, 231, 18, 199, 148, 98, 21, 70, 170, 72, 209, 132, 55, 230, 12, 75, 84, 142, 13, 56, 229, 217, 29, 49, 130, 75, 237, 101, 179, 99, 99, 81, 7, 65, 100, 73, 3, 219, 166, 68, 254, 225, 67, 27, 121, 93, 39, 88, 111, 93, 200, 178, 252, 117, 134, 107, 66, 13, 92, 6, 93, 35, 179, 164, 4, 5, 252, 11, 66, 133, 75, 70, 26, 141, 172, 88, 5, 79, 93, 52, 151, 113, 66, 55, 146, 201, 166, 148, 127, 236, 184, 63, 69, 243, 52, 108, 122, 70, 85, 25, 212, 78, 176, 63, 62, 198, 122, 171, 255, 127, 48, 17, 11, 51, 204, 8, 226, 141, 103, 18, 5, 157, 63, 70, 54, 185, 214, 137, 179, 133, 173, 144, 80, 241, 110, 203, 72, 77, 29, 153, 77, 137, 130, 21, 190, 250, 174, 57, 184, 34, 114, 66, 217, 203, 253, 175, 97, 130, 163, 32, 54, 122, 80, 14, 81, 1, 220, 167, 237, 176, 24, 40, 173, 123, 112, 70, 230, 91, 18, 126, 61, 94, 66, 72, 21, 29, 75, 244, 119, 64, 201, 248, 14, 212, 44, 126, 199, 30, 114, 32, 57, 197, 59, 154, 44, 8, 238, 174, 64, 238, 155, 136, 93, 249, 30, 50, 139, 26, 166, 130, 179, 250, 220, 42, 8, 117, 91, 144, 151, 229, 69, 19, 228, 58, 16, 14, 249, 60, 133, 219, 249, 107, 99, 156, 167, 82, 239, 209, 187, 117, 201, 33, 206, 218, 190, 149, 33, 245, 70, 161, 10, 119, 90, 244, 106, 103, 117, 118, 176, 148, 240, 33, 178, 165, 103, 234, 64, 27, 179, 219, 210, 93, 233, 154, 176, 254, 83, 176, 10, 155, 169, 165, 68, 84, 228, 76, 252, 83, 187, 12, 226, 196, 204, 254, 30, 66, 222, 219, 20, 129, 90, 178, 218, 249, 251, 188, 185, 147, 25, 207, 161, 117, 76, 210, 87, 74, 221, 135, 105, 36, 147, 203, 36, 229, 241, 153, 244, 147, 117, 191, 138, 167, 229, 16, 24, 125, 203, 207, 209, 193, 77, 232, 45, 29, 254, 88, 218, 192, 196, 158, 76, 68, 123, 27, 53, 163, 62, 114, 120, 86, 140, 232, 46, 22, 31, 152, 173, 193, 57, 146, 51, 95, 59, 246, 210, 185, 104, 143, 130, 255, 31, 80, 121, 191, 60, 242, 253, 11, 81, 149, 254, 44, 234, 187, 93, 33, 190, 182, 194, 144, 29, 222, 134, 57, 6, 186, 45, 159, 42, 102, 118, 112, 242, 76, 248, 125, 132, 230, 174, 126, 98, 231, 173, 88, 152, 216, 89, 175, 217, 127, 231, 235, 175, 252, 88, 129, 78, 120, 253, 174, 73, 77, 30, 120, 170, 3, 98, 182, 144, 107, 70, 216, 244, 125, 26, 45, 15, 110, 240, 166, 156, 53, 16, 242, 35, 231, 53, 209, 13, 161, 89, 252, 50, 205, 38, 32, 182, 41, 87, 203, 219, 232, 78, 29, 157, 136, 224, 61, 42, 141, 167, 90, 92, 31, 158, 97, 214, 55, 133, 111, 213, 133, 158, 83, 100, 117, 243, 12, 206, 218, 250, 200, 114, 65, 51, 159, 183, 84, 217, 172, 74, 104, 37, 41, 114, 74, 82, 223, 49, 82, 198, 179, 73, 55, 65, 133, 214, 193, 120, 162, 180, 87, 205, 218, 100, 83, 43, 8, 244, 31, 95, 26, 246, 120, 200, 204, 217, 26, 48, 255, 70, 103, 121, 39, 223, 217, 122, 145, 10, 33, 49, 34, 123, 12, 253, 19, 39, 127, 252, 11, 242, 175, 26, 230, 137, 55, 125, 115, 214, 248, 129, 190, 57, 122, 123, 229, 181, 80, 84, 27, 14, 103, 17, 30, 35, 83, 80, 253, 134, 102, 62, 30, 104, 3, 101, 232, 72, 31, 9, 54, 140, 25, 249, 159, 249, 95, 214, 133, 175, 118, 1, 251, 243, 228, 188, 115, 235, 111, 87, 56, 44, 130, 201, 209, 81, 201, 78, 231, 199, 108, 40, 183, 2, 234, 208, 166, 97, 22, 28, 79, 239, 208, 58, 99, 99, 30, 47, 175, 205, 59, 35, 226, 254, 59, 149, 114, 161, 91, 130, 26, 83, 136, 47, 54, 219, 171, 16, 65, 198, 30, 224, 115, 103, 104, 183, 203, 48, 75, 183, 181, 38, 61, 70, 61, 3, 104, 117, 133, 52, 228, 129, 60, 223, 31, 169, 196, 195, 119, 87, 44, 158, 111, 155, 98, 187, 101, 2, 53, 198, 116, 159, 5, 115, 166, 41, 156, 254, 47, 25, 250, 224, 80, 80, 113, 17, 236, 23, 72, 70, 23, 11, 178, 21, 205, 13, 112, 225, 122, 170, 52, 180, 203, 12, 7, 124, 34, 66, 150, 218, 183, 69, 248, 213, 10, 79, 94, 212, 65, 173, 223, 181, 56, 35, 73, 45, 86, 23, 189, 218, 180, 10, 32, 26, 74, 192, 18, 222, 6, 225, 134, 71, 77, 233, 16, 70, 135, 197, 218, 156, 109, 76, 36, 87, 117, 30, 123, 109, 208, 28, 44, 16, 156, 109, 5, 120, 244, 254, 97, 83, 202, 230, 108, 167, 105, 215, 146, 171, 9, 246, 126, 193, 38, 76, 105, 104, 16, 224, 149, 128, 230, 70, 57, 62, 243, 16, 230, 9, 127, 158, 226, 234, 32, 174, 110, 251, 22, 7, 29, 78, 13, 47, 79, 3, 199, 102, 66, 90, 164, 55, 21, 150, 235, 49, 243, 235, 24, 155, 250, 0, 140, 75, 65, 2, 103, 198, 164, 210, 231, 84, 108, 227, 129, 250, 218, 250, 194, 116, 201, 54, 55, 58, 52, 220, 169, 161, 33, 165, 254, 103, 114, 164, 239, 95, 218, 138, 193, 176, 154, 76, 232, 179, 47, 18, 41, 127, 41, 126, 253, 239, 225, 107, 99, 249, 91, 187, 168, 111, 180, 162, 109, 23, 192, 207, 36, 107, 88, 138, 151, 57, 97, 250, 104, 242, 20, 248, 164, 161, 156, 149, 237, 39, 169, 237, 93, 77, 113, 104, 152, 166, 97, 156, 7, 187, 143, 255, 235, 162, 157, 103, 148, 149, 24, 3, 241, 237, 87, 240, 199, 127, 214, 221, 22, 198, 46, 41, 161, 114, 237, 45, 234, 130, 188, 185, 212, 88, 125, 74, 0, 38, 254, 159, 119, 132, 244, 119, 72, 138, 162, 63, 150, 148, 180, 195, 113, 59, 27, 199, 126, 20, 216, 177, 230, 117, 203, 2, 103, 183, 197, 138, 185, 101, 75, 124, 200, 173, 78, 243, 204, 169, 178, 7, 30, 138, 128, 248, 150, 73, 206, 102, 192, 226, 197, 118, 252, 199, 1, 208, 203, 196, 105, 125, 238, 90, 169, 54, 209, 78, 244, 232, 35, 229, 66, 233, 186, 153, 137, 62, 195, 226, 46, 15, 3, 191, 42, 25, 26, 130, 19, 164, 193, 110, 98, 200, 236, 65, 62, 203, 96, 252, 221, 127, 153, 192, 146, 139, 48, 79, 8, 61, 20, 211, 142, 233, 169, 192, 206, 16, 62, 159, 130, 212, 157, 230, 108, 162, 231, 81, 253, 44, 207, 33, 148, 138, 14, 226, 131, 14, 66, 192, 178, 166, 208, 24, 187, 175, 26, 106, 0, 27, 71, 75, 152, 167, 15, 48, 142, 117, 42, 97, 232, 74, 123, 145, 91, 126, 217, 169, 47, 227, 214, 228, 53, 60, 32, 245, 137, 32, 119, 182, 191, 56, 13, 208, 248, 107, 3, 186, 250, 202, 245, 156, 35, 130, 13, 156, 35, 156, 204, 243, 5, 47, 85, 156, 42, 59, 155, 21, 57, 8, 100, 4, 153, 255, 123, 129, 109, 42, 2, 138, 59, 232, 25, 81, 150, 42, 189, 215, 76, 253, 132, 32, 152, 76, 73, 156, 80, 158, 143, 66, 5, 232, 215, 86, 81, 223, 18, 31, 63, 182, 206, 36, 144, 56, 233, 36, 104, 120, 94, 183, 226, 253, 254, 254, 11, 119, 198, 206, 16, 113, 141, 241, 170, 113, 246, 186, 122, 40, 249, 149, 101, 114, 35, 135, 104, 72, 134, 139, 171, 221, 124, 174, 65, 45, 207, 111, 142, 198, 83, 18, 77, 14, 159, 55, 12, 45, 216, 0, 105, 17, 237, 107, 37, 41, 120, 216, 89, 69, 38, 115, 228, 29, 0, 69, 75, 246, 201, 230, 241, 202, 57, 175, 49, 134, 122, 215, 114, 64, 3, 55, 198, 123, 239, 44, 81, 211, 38, 25, 189, 229, 121, 239, 128, 107, 222, 179, 158, 242, 60, 79, 66, 121, 125, 150, 203, 203, 113, 197, 189, 188, 35, 194, 64, 53, 210, 200, 46, 102, 227, 14, 158, 69, 182, 69, 186, 113, 26, 182, 240, 11, 243, 47, 91, 227, 72, 109, 174, 179, 196, 179, 29, 102, 229, 22, 223, 218, 225, 109, 224, 243, 6, 109, 135, 124, 6, 31, 181, 62, 3, 117, 243, 62, 37, 17, 194, 121, 190, 118, 5, 137, 182, 147, 21, 244, 1, 115, 111, 211, 228, 136, 60, 130, 217, 240, 232, 216, 229, 217, 162, 98, 90, 150, 189, 213, 121, 73, 245, 240, 217, 70, 220, 9, 229, 240, 238, 254, 216, 87, 106, 177, 171, 4, 62, 30, 134, 183, 233, 193, 77, 100, 94, 21, 15, 72, 118, 166, 55, 23, 1, 163, 168, 79, 190, 102, 171, 221, 224, 186, 33, 115, 15, 107, 197, 61, 140, 188, 125, 247, 39, 202, 169, 151, 50, 27, 86, 60, 51, 63, 31, 174, 240, 202, 27, 130, 65, 93, 135, 4, 208, 2, 108, 36, 210, 151, 209, 212, 20, 251, 120, 86, 51, 187, 244, 124, 36, 238, 214, 41, 198, 75, 109, 224, 206, 81, 127, 132, 142, 71, 31, 89, 231, 207, 17, 86, 16, 186, 94, 242, 215, 134, 6, 128, 113, 251, 104, 93, 134, 1, 26, 45, 130, 31, 174, 157, 60, 199, 4, 11, 88, 141, 154, 7, 12, 27, 80, 39, 84, 115, 115, 54, 150, 221, 98, 52, 210, 18, 205, 232, 67, 105, 73, 91, 15, 218, 222, 165, 197, 115, 126, 198, 31, 111, 29, 35, 6, 143, 17, 170, 52, 50, 121, 64, 184, 11, 40, 200, 128, 138, 214, 32, 49, 19, 107, 38, 132, 76, 41, 90, 41, 69, 120, 143, 123, 14, 91, 139, 226, 176, 119, 145, 31, 75, 12, 208, 134, 181, 244, 255, 169, 139, 219, 253, 182, 18, 164, 44, 34, 218, 139, 130, 43, 112, 111, 60, 5, 237, 172, 60, 55, 82, 55, 251, 142, 47, 64, 190, 64, 122, 103, 156, 64, 106, 241, 218, 82, 160, 236, 119, 174, 141, 38, 164, 188, 158, 36, 89, 6, 84, 22, 78, 14, 227, 116, 90, 167, 166, 215, 153, 39, 83, 20, 23, 49, 65, 42, 228, 212, 109, 50, 110, 11, 26, 92, 50, 152, 237, 107, 47, 79, 159, 184, 77, 248, 118, 153, 105, 127, 227, 251, 66, 111, 118, 171, 6, 181, 84, 65, 28, 237, 93, 7, 149, 146, 133, 108, 212, 45, 226, 209, 217, 169, 78, 65, 246, 95, 2, 97, 77, 228, 198, 148, 136, 152, 197, 67, 80, 7, 173, 35, 70, 2, 127, 63, 166, 167, 81, 76, 223, 125, 114, 252, 73, 110, 232, 147, 234, 86, 89, 11, 77, 141, 10, 8, 193, 149, 204, 105, 39, 101, 60, 183, 123, 64, 42, 234, 100, 81, 126, 89, 229, 84, 229, 198, 228, 114, 13, 26, 234, 193, 182, 197, 147, 88, 83, 75, 157, 202, 116, 113, 16, 219, 103, 154, 93, 61, 141, 194, 15, 152, 149, 64, 234, 156, 68, 115, 185, 174, 18, 150, 176, 48, 122, 144, 112, 2, 220, 82, 66, 128, 92, 246, 125, 237, 74, 50, 132, 124, 171, 150, 175, 36, 114, 150, 67, 40, 51, 126, 12, 59, 33, 25, 79, 31, 236, 90, 195, 192, 48, 241, 47, 31, 182, 116, 87, 54, 138, 100, 73, 151, 145, 178, 129, 131, 243, 168, 31, 219, 224, 141, 74, 62, 43, 247, 3, 114, 13, 136, 129, 38, 211, 40, 2, 73, 111, 162, 30, 51, 201, 50, 227, 181, 144, 242, 176, 151, 30, 99, 9, 171, 57, 174, 189, 74, 138, 38, 184, 219, 243, 182, 2, 47, 90, 105, 181, 156, 32, 52, 43, 39, 205, 215, 228, 149, 151, 123, 82, 34, 28, 30, 142, 107, 132, 225, 182, 97, 193, 105, 28, 107, 236, 15, 167, 246, 2, 74, 133, 55, 152, 59, 59, 47, 41, 235, 254, 160, 83, 174, 47, 157, 126, 91, 111, 28, 17, 9, 117, 29, 19, 87, 91, 131, 69, 241, 74, 99, 150, 22, 128, 190, 238, 150, 90, 194, 67, 140, 221, 63, 48, 137, 87, 157, 163, 174, 53, 237, 209, 25, 127, 69, 113, 77, 225, 251, 73, 0, 49, 212, 32, 230, 242, 94, 59, 223, 1, 58, 90, 166, 3, 135, 230, 2, 141, 74, 212, 218, 202, 211, 174, 79, 2, 29, 134, 134, 118, 44, 237, 144, 141, 61, 244, 184, 111, 92, 255, 12, 148, 160, 142, 121, 150, 76, 5, 253, 115, 211, 139, 142, 136, 202, 209, 168, 59, 20, 196, 238, 220, 229, 254, 229, 219, 223, 81, 109, 31, 230, 205, 25, 73, 193, 249, 77, 93, 13, 209, 202, 6, 172, 235, 146, 1, 73, 136, 194, 205, 6, 213, 181, 212, 133, 29, 58, 194, 116, 9, 5, 40, 135, 45, 9, 81, 236, 53, 0, 4, 158, 164, 29, 252, 176, 198, 192, 112, 141, 122, 229, 84, 69, 222, 233, 136, 112, 184, 228, 212, 23, 83, 210, 140, 153, 204, 210, 216, 202, 50, 237, 224, 185, 29, 124, 209, 32, 49, 182, 125, 171, 159, 180, 172, 159, 218, 82, 11, 210, 89, 88, 55, 202, 65, 165, 4, 2, 3, 29, 95, 239, 159, 18, 85, 248, 131, 232, 212, 24, 116, 203, 22, 64, 195, 99, 203, 109, 195, 40, 110, 54, 112, 28, 17, 228, 73, 128, 241, 96, 99, 77, 114, 171, 33, 232, 223, 45, 133, 89, 106, 12, 78, 237, 239, 35, 236, 20, 198, 25, 59, 139, 89, 207, 22, 84, 17, 212, 208, 103, 227, 60, 245, 99, 248, 203, 239, 173, 46, 116, 65, 180, 238, 89, 255, 251, 233, 6, 56, 175, 71, 165, 20, 47, 167, 147, 150, 188, 47, 69, 85, 244, 18, 210, 26, 229, 148, 137, 13, 63, 190, 173, 236, 207, 59, 54, 101, 140, 149, 61, 209, 58, 44, 94, 32, 30, 11, 110, 122, 132, 14, 203, 229, 69, 196, 61, 140, 242, 35, 108, 215, 251, 205, 152, 31, 172, 200, 153, 252, 203, 8, 3, 127, 77, 5, 137, 52, 82, 33, 96, 198, 28, 156, 138, 237, 250, 112, 72, 71, 74, 168, 25, 57, 156, 157, 89, 252, 212, 3, 94, 126, 190, 230, 200, 100, 108, 247, 38, 83, 144, 65, 230, 96, 242, 75, 4, 79, 88, 87, 221, 77, 74, 15, 79, 184, 221, 236, 9, 74, 105, 123, 251, 94, 67, 240, 53, 133, 62, 165, 38, 211, 12, 164, 42, 201, 213, 105, 252, 66, 10, 15, 216, 85, 98, 50, 5, 60, 46, 126, 50, 199, 136, 129, 134, 52, 37, 81, 102, 123, 112, 60, 165, 72, 224, 171, 193, 47, 184, 64, 226, 218, 189, 181, 111, 108, 101, 145, 248, 31, 0, 230, 124, 156, 171, 162, 25, 95, 32, 52, 137, 144, 161, 22, 3, 113, 51, 164, 221, 36, 62, 126, 251, 21, 174, 135, 21, 164, 207, 76, 162, 226, 232, 124, 38, 54, 136, 182, 30, 192, 178, 115, 122, 194, 181, 3, 230, 9, 110, 89, 32, 238, 59, 43, 43, 175, 76, 27, 93, 111, 12, 206, 131, 201, 70, 194, 179, 199, 138, 102, 57, 13, 91, 95, 91, 61, 56, 146, 175, 172, 18, 162, 50, 0, 23, 139, 163, 240, 178, 194, 115, 133, 93, 172, 154, 84, 167, 239, 234, 135, 146, 113, 145, 12, 250, 223, 22, 113, 83, 21, 81, 107, 93, 43, 125, 148, 193, 112, 29, 90, 51, 21, 36, 28, 13, 185, 209, 23, 189, 229, 89, 169, 32, 33, 56, 33, 90, 204, 212, 145, 139, 58, 73, 225, 145, 187, 6, 142, 29, 40, 95, 224, 141, 223, 47, 209, 29, 11, 23, 87, 96, 168, 162, 133, 35, 147, 190, 153, 232, 101, 76, 226, 62, 188, 82, 81, 70, 98, 242, 29, 247, 218, 162, 217, 173, 7, 72, 106, 106, 178, 240, 26, 154, 92, 84, 253, 130, 93, 202, 153, 24, 102, 142, 162, 212, 141, 63, 19, 124, 223, 133, 220, 70, 10, 17, 148, 3, 100, 224, 82, 124, 103, 253, 115, 103, 174, 177, 126, 148, 52, 240, 199, 232, 152, 207, 198, 161, 245, 128, 215, 234, 107, 36, 43, 221, 201, 37, 15, 15, 47, 101, 151, 205, 216, 182, 78, 68, 33, 240, 134, 11, 107, 97, 60, 55, 80, 128, 70, 16, 56, 228, 116, 3, 194, 135, 12, 206, 170, 121, 124, 35, 101, 229, 124, 209, 148, 109, 248, 224, 90, 50, 191, 181, 204, 121, 107, 59, 91, 196, 95, 17, 192, 188, 128, 154, 44, 154, 200, 241, 50, 232, 145, 122, 244, 188, 10, 115, 115, 28, 87, 12, 3, 110, 218, 2, 44, 119, 208, 138, 3, 214, 202, 8, 249, 125, 39, 76, 79, 111, 105, 61, 25, 30, 153, 206, 65, 80, 36, 159, 171, 21, 202, 66, 147, 119, 52, 140, 250, 137, 104, 131, 167, 190, 6, 129, 166, 133, 110, 214, 238, 0, 184, 252, 209, 228, 124, 100, 201, 87, 28, 200, 38, 239, 210, 104, 102, 66, 185, 236, 62, 151, 166, 177, 18, 223, 212, 167, 251, 240, 206, 128, 24, 163, 141, 81, 164, 57, 20, 66, 17, 132, 160, 35, 142, 223, 118, 165, 200, 142, 178, 225, 26, 225, 139, 238, 243, 217, 20, 245, 167, 16, 46, 67, 44, 216, 140, 229, 175, 151, 43, 201, 178, 64, 102, 231, 32, 191, 166, 64, 150, 72, 112, 218, 91, 114, 197, 206, 141, 251, 172, 201, 99, 160, 59, 111, 174, 27, 231, 123, 134, 32, 101, 84, 59, 90, 59, 239, 98, 204, 93, 158, 53, 200, 130, 202, 157, 118, 242, 72, 18, 245, 48, 96, 24, 93, 96, 121, 34, 97, 199, 84, 33, 58, 253, 165, 62, 95, 146, 219, 45, 209, 237, 111, 160, 126, 191, 68, 135, 213, 62, 149, 51, 88, 239, 92, 160, 37, 54, 227, 32, 59, 240, 118, 249, 233, 214, 248, 173, 69, 135, 91, 55, 8, 222, 167, 170, 171, 188, 155, 83, 5, 76, 224, 162, 90, 188, 254, 192, 71, 90, 100, 154, 142, 136, 52, 179, 160, 4, 33, 229, 165, 173, 87, 176, 150, 61, 166, 251, 22, 217, 74, 16, 250, 248, 169, 163, 228, 73, 233, 253, 101, 128, 230, 203, 244, 207, 1, 172, 53, 60, 193, 201, 128, 144, 104, 142, 101, 102, 194, 20, 120, 136, 160, 43, 245, 174, 86, 136, 19, 97, 235, 223, 236, 143, 107, 171, 39, 70, 178, 112, 129, 121, 15, 171, 218, 231, 84, 56, 89, 232, 231, 113, 173, 88, 190, 137, 56, 118, 143, 32, 58, 154, 207, 245, 209, 48, 187, 56, 140, 222, 41, 150, 254, 5, 10, 227, 195, 222, 40, 140, 167, 120, 119, 172, 67, 159, 253, 193, 63, 81, 59, 86, 172, 36, 255, 17, 132, 179, 135, 0, 88, 255, 242, 18, 142, 9, 247, 47, 178, 165, 181, 154, 109, 98, 52, 121, 232, 115, 16, 37, 28, 234, 167, 167, 238, 4, 225, 90, 106, 241, 44, 147, 227, 15, 127, 45, 72, 47, 99, 209, 6, 160, 92, 107, 121, 185, 231, 152, 157, 168, 186, 137, 16, 231, 56, 243, 138, 169, 237, 37, 191, 181, 156, 202, 193, 124, 115, 42, 16, 66, 223, 47, 158, 22, 25, 140, 152, 184, 18, 15, 143, 98, 242, 43, 114, 93, 134, 25, 233, 174, 242, 170, 61, 66, 101, 115, 154, 224, 75, 162, 21, 201, 194, 3, 98, 135, 80, 24, 240, 27, 7, 52, 195, 161, 69, 189, 92, 124, 181, 187, 128, 28, 35, 106, 156, 143, 9, 226, 76, 8, 28, 188, 0, 54, 227, 74, 207, 77, 80, 93, 161, 122, 82, 225, 32, 150, 163, 223, 118, 99, 111, 120, 19, 18, 80, 200, 17, 25, 91, 158, 195, 3, 76, 89, 46, 163, 51, 104, 229, 155, 203, 58, 52, 24, 2, 181, 152, 105, 80, 246, 153, 1, 94, 236, 201, 67, 47, 164, 153, 50, 68, 192, 191, 47, 96, 253, 36, 63, 175, 190, 80, 10, 151, 72, 29, 168, 190, 172, 3, 217, 6, 156, 218, 158, 176, 92, 126, 173, 229, 116, 98, 249, 213, 46, 253, 122, 14, 211, 159, 114, 99, 68, 168, 55, 230, 94, 149, 40, 9, 31, 9, 205, 91, 147, 14, 24, 197, 63, 216, 168, 168, 239, 38, 61, 172, 238, 149, 58, 9, 19, 138, 183, 39, 168, 66, 63, 61, 0, 33, 86, 194, 158, 221, 89, 15, 166, 71, 16, 35, 231, 240, 88, 91, 197, 233, 229, 124, 214, 138, 177, 76, 176, 99, 209, 218, 80, 211, 113, 55, 238, 189, 137, 79, 73, 176, 86, 1, 50, 174, 22, 16, 92, 223, 56, 102, 80, 130, 72, 30, 71, 178, 59, 4, 76, 175, 75, 92, 105, 31, 122, 34, 213, 82, 121, 202, 151, 17, 240, 255, 76, 49, 156, 82, 191, 69, 162, 121, 240, 104, 182, 148, 201, 196, 195, 162, 172, 107, 57, 12, 168, 197, 227, 202, 4, 131, 158, 203, 29, 156, 152, 59, 118, 224, 52, 195, 36, 10, 94, 1, 140, 209, 178, 65, 23, 137, 8, 255, 205, 88, 114, 18, 106, 14, 184, 30, 128, 210, 199, 98, 194, 44, 141, 80, 194, 255, 249, 21, 140, 197, 72, 112, 212, 238, 11, 142, 197, 13, 115, 16, 164, 242, 140, 60, 189, 105, 156, 248, 176, 73, 243, 226, 79, 192, 212, 224, 216, 123, 52, 126, 179, 189, 156, 224, 232, 75, 52, 66, 186, 21, 2, 118, 236, 10, 134, 129, 55, 114, 130, 15, 40, 47, 235, 31, 81, 39, 216, 99, 81, 231, 170, 39, 69, 53, 173, 7, 169, 180, 69, 86, 133, 178, 227, 160, 243, 100, 144, 57, 9, 177, 109, 236, 243, 254, 208, 133, 98, 249, 177, 78, 162, 55, 194, 130, 21, 51, 119, 104, 233, 81, 135, 62, 102, 245, 44, 88, 110, 73, 157, 226, 11, 140, 163, 19, 132, 100, 3, 31, 222, 202, 95, 29, 20, 109, 53, 86, 247, 31, 113, 9, 224, 130, 180, 104, 4, 223, 17, 205, 207, 166, 7, 246, 244, 196, 164, 25, 75, 15, 121, 107, 255, 211, 56, 195, 111, 248, 255, 182, 10, 107, 226, 123, 180, 165, 63, 168, 203, 9, 174, 156, 31, 102, 150, 242, 62, 235, 249, 47, 27, 152, 58, 208, 203, 224, 163, 227, 171, 205, 12, 187, 224, 139, 151, 133, 222, 121, 36, 61, 254, 248, 196, 172, 103, 195, 98, 193, 211, 190, 126, 45, 44, 155, 20, 65, 168, 51, 144, 51, 152, 46, 233, 112, 36, 15, 73, 239, 5, 120, 236, 179, 40, 207, 2, 153, 155, 92, 65, 43, 84, 48, 124, 219, 146, 91, 13, 201, 252, 211, 243, 227, 40, 221, 221, 248, 235, 156, 194, 5, 130, 155, 74, 102, 186, 167, 114, 40, 254, 61, 236, 250, 157, 132, 124, 78, 250, 212, 250, 209, 77, 112, 243, 80, 60, 52, 34, 237, 38, 115, 243, 239, 49, 113, 211, 186, 24, 120, 139, 133, 14, 247, 115, 84, 254, 253, 72, 163, 20, 151, 225, 143, 126, 8, 38, 69, 130, 4, 84, 143, 48, 32, 218, 130, 136, 109, 251, 253, 93, 184, 152, 23, 4, 182, 201, 193, 151, 206, 238, 151, 206, 13, 43, 255, 7, 153, 194, 240, 1, 30, 149, 44, 235, 44, 14, 185, 111, 237, 183, 199, 54, 121, 208, 84, 220, 196, 244, 138, 24, 186, 36, 245, 254, 19, 61, 73, 239, 248, 73, 49, 175, 169, 211, 59, 88, 180, 56, 230, 78, 92, 235, 61, 34, 187, 177, 236, 187, 158, 226, 120, 159, 108, 54, 95, 188, 219, 130, 41, 72, 162, 199, 22, 176, 38, 231, 86, 132, 237, 227, 18, 148, 185, 93, 9, 157, 188, 181, 199, 57, 83, 250, 185, 10, 34, 102, 175, 233, 91, 27, 166, 27, 68, 128, 35, 97, 159, 40, 133, 88, 118, 225, 128, 69, 31, 1, 96, 88, 219, 151, 4, 89, 235, 54, 180, 246, 192, 240, 42, 4, 229, 40, 26, 37, 175, 82, 132, 106, 96, 95, 176, 174, 103, 238, 70, 91, 231, 179, 4, 237, 240, 118, 137, 154, 50, 120, 124, 171, 157, 197, 150, 121, 154, 119, 85, 167, 48, 30, 98, 57, 14, 239, 46, 36, 131, 93, 152, 183, 94, 221, 46, 20, 32, 63, 189, 192, 12, 37, 29, 96, 48, 95, 83, 233, 131, 139, 12, 222, 136, 246, 159, 235, 123, 191, 190, 77, 19, 135, 185, 55, 210, 202, 170, 84, 200, 253, 126, 241, 227, 80, 184, 199, 218, 95, 6, 119, 112, 204, 13, 65, 226, 86, 248, 44, 94, 14, 120, 40, 221, 214, 140, 20, 238, 241, 87, 43, 33, 27, 48, 230, 178, 210, 158, 234, 128, 232, 177, 228, 187, 127, 130, 236, 147, 194, 174, 139, 182, 5, 214, 102, 49, 144, 134, 49, 166, 247, 127, 104, 18, 29, 125, 198, 242, 190, 113, 11, 123, 114, 60, 146, 156, 15, 198, 93, 129, 177, 12, 183, 68, 110, 239, 97, 116, 184, 24, 146, 10, 71, 96, 54, 107, 110, 87, 141, 124, 45, 62, 151, 107, 229, 220, 167, 18, 127, 183, 197, 219, 87, 142, 188, 210, 163, 107, 109, 129, 68, 26, 249, 240, 66, 76, 101, 46, 204, 115, 179, 239, 12, 63, 196, 172, 134, 79, 177, 133, 111, 75, 236, 101, 85, 196, 210, 218, 229, 15, 151, 197, 119, 73, 223, 216, 88, 216, 86, 249, 121, 203, 178, 8, 179, 71, 18, 191, 24, 48, 148, 59, 151, 72, 233, 7, 237, 250, 117, 144, 135, 59, 184, 119, 4, 88, 150, 53, 27, 81, 241, 90, 68, 1, 58, 187, 55, 100, 27, 220, 60, 79, 104, 117, 31, 118, 250, 113, 253, 187, 66, 215, 212, 164, 212, 39, 69, 91, 38, 90, 119, 11, 23, 76, 112, 138, 114, 114, 105, 109, 156, 85, 181, 142, 142, 37, 49, 233, 7, 51, 77, 23, 211, 208, 155, 61, 243, 53, 94, 187, 225, 108, 148, 179, 64, 75, 149, 156, 22, 180, 94, 232, 224, 222, 63, 76, 54, 51, 30, 251, 179, 226, 32, 33, 250, 88, 59, 127, 170, 249, 71, 127, 206, 253, 88, 122, 33, 229, 230, 76, 227, 74, 190, 231, 186, 189, 81, 31, 242, 73, 166, 234, 61, 217, 90, 186, 5, 83, 122, 212, 89, 126, 63, 241, 101, 185, 166, 1, 90, 170, 121, 152, 248, 128, 154, 198, 58, 176, 187, 91, 237, 121, 50, 190, 168, 176, 201, 31, 204, 193, 219, 83, 180, 61, 95, 112, 92, 123, 51, 158, 234, 121, 34, 0, 165, 62, 98, 194, 238, 151, 185, 190, 179, 157, 219, 58, 218, 189, 91, 240, 117, 121, 174, 97, 204, 102, 2, 135, 249, 200, 217, 170, 246, 95, 9, 124, 224, 77, 119, 60, 113, 78, 231, 174, 109, 45, 78, 55, 249, 134, 174, 144, 12, 158, 78, 5, 175, 124, 62, 150, 86, 255, 253, 254, 105, 252, 197, 86, 94, 149, 16, 126, 187, 156, 142, 66, 172, 83, 158, 18, 93, 200, 137, 30, 205, 253, 46, 130, 27, 224, 179, 22, 253, 50, 162, 178, 63, 24, 18, 183, 21, 33, 218, 178, 41, 154, 238, 138, 149, 203, 94, 65, 218, 184, 85, 232, 213, 67, 34, 146, 17, 71, 137, 18, 125, 38, 86, 199, 86, 9, 225, 174, 182, 236, 133, 91, 72, 148, 246, 200, 148, 68, 20, 96, 189, 75, 78, 243, 144, 5, 80, 173, 75, 42, 63, 126, 194, 85, 57, 84, 91, 230, 50, 145, 253, 225, 139, 158, 70, 230, 129, 246, 105, 214, 181, 139, 79, 210, 52, 218, 45, 99, 35, 30, 64, 55, 161, 201, 240, 216, 182, 65, 229, 46, 244, 236, 109, 223, 145, 147, 157, 22, 207, 197, 67, 45, 164, 228, 20, 148, 186, 222, 49, 113, 127, 58, 241, 228, 216, 168, 223, 238, 134, 232, 76, 211, 138, 251, 204, 153, 252, 38, 53, 199, 209, 22, 231, 146, 159, 77, 187, 98, 143, 62, 163, 46, 63, 48, 42, 77, 174, 247, 98, 197, 83, 5, 77, 239, 196, 86, 248, 172, 240, 62, 141, 177, 207, 132, 251, 81, 100, 253, 17, 9, 44, 19, 134, 144, 173, 208, 63, 232, 0, 210, 146, 180, 42, 250, 204, 68, 195, 27, 92, 122, 254, 182, 120, 21, 135, 177, 178, 206, 69, 231, 107, 105, 254, 213, 185, 31, 29, 250, 161, 199, 243, 220, 213, 226, 66, 0, 187, 219, 158, 111, 160, 129, 110, 113, 188, 134, 64, 178, 124, 32, 238, 30, 123, 51, 41, 116, 14, 103, 69, 187, 78, 105, 253, 10, 46, 6, 2, 122, 95, 201, 97, 36, 209, 150, 177, 210, 156, 38, 246, 174, 25, 189, 44, 101, 213, 192, 148, 239, 25, 15, 212, 8, 121, 37, 87, 124, 1, 252, 192, 225, 17, 33, 110, 52, 44, 171, 101, 212, 20, 235, 169, 168, 62, 163, 14, 204, 230, 47, 69, 175, 151, 229, 171, 222, 67, 245, 19, 97, 38, 79, 7, 246, 99, 230, 251, 181, 3, 210, 61, 178, 47, 138, 28, 113, 59, 122, 144, 249, 25, 191, 0, 67, 157, 59, 23, 71, 73, 234, 143, 168, 118, 53, 181, 146, 107, 43, 53, 171, 173, 15, 22, 84, 217, 189, 12, 54, 239, 15, 200, 30, 253, 206, 7, 193, 28, 220, 28, 103, 123, 160, 149, 98, 127, 231, 70, 1, 94, 191, 171, 167, 88, 73, 58, 47, 13, 52, 181, 86, 55, 233, 239, 174, 228, 249, 79, 65, 93, 128, 174, 13, 86, 144, 216, 235, 246, 98, 132, 142, 187, 144, 252, 68, 3, 170, 238, 203, 198, 75, 240, 25, 53, 234, 231, 91, 187, 189, 224, 71, 120, 176, 48, 64, 9, 163, 25, 33, 48, 198, 153, 14, 254, 183, 90, 101, 15, 137, 127, 71, 5, 230, 56, 246, 195, 46, 243, 50, 184, 123, 219, 77, 95, 84, 251, 227, 145, 57, 133, 159, 100, 40, 0, 213, 92, 127, 223, 152, 134, 252, 19, 8, 101, 78, 174, 110, 17, 153, 240, 88, 110, 45, 91, 46, 88, 115, 236, 189, 2, 67, 23, 45, 6, 228, 126, 80, 102, 128, 99, 20, 118, 255, 98, 13, 26, 17, 254, 175, 42, 0, 7, 126, 44, 142, 154, 204, 6, 22, 60, 65, 193, 161, 193, 76, 26, 141, 61, 130, 15, 203, 96, 216, 79, 192, 188, 51, 182, 144, 151, 178, 185, 228, 249, 176, 180, 13, 61, 223, 196, 102, 32, 108, 231, 206, 113, 193, 2, 204, 80, 51, 240, 227, 253, 6, 185, 176, 203, 65, 109, 222, 58, 132, 241, 43, 232, 73, 190, 66, 102, 54, 40, 89, 219, 157, 136, 186, 88, 125, 113, 144, 52, 206, 139, 250, 13, 104, 244, 10, 176, 145, 47, 12, 103, 4, 140, 119, 106, 20, 208, 239, 131, 61, 72, 151, 178, 208, 209, 94, 126, 47, 29, 151, 170, 10, 135, 178, 212, 249, 39, 152, 102, 221, 138, 2, 84, 51, 236, 224, 24, 179, 172, 92, 222, 121, 85, 54, 178, 17, 25, 38, 203, 126, 60, 152, 252, 238, 207, 20, 205, 11, 92, 11, 103, 229, 36, 126, 89, 138, 206, 240, 78, 87, 5, 72, 90, 199, 166, 174, 89, 174, 140, 0, 16, 239, 123, 10, 38, 26, 69, 120, 155, 86, 160, 173, 214, 59, 199, 25, 31, 40, 48, 153, 185, 9, 211, 102, 9, 38, 116, 45, 140, 128, 69, 134, 255, 174, 193, 112, 167, 16, 93, 131, 140, 185, 151, 147, 144, 93, 248, 249, 139, 157, 121, 126, 217, 211, 82, 46, 60, 131, 80, 184, 222, 189, 238, 196, 141, 190, 17, 135, 228, 181, 211, 58, 64, 93, 39, 137, 170, 106, 94, 201, 186, 118, 99, 180, 219, 141, 75, 109, 140, 150, 147, 251, 64, 0, 18, 76, 73, 143, 207, 120, 190, 178, 10, 238, 187, 44, 120, 78, 151, 123, 152, 24, 179, 136, 50, 101, 170, 177, 81, 172, 145, 232, 42, 230, 217, 131, 195, 60, 98, 157, 144, 29, 10, 16, 59, 168, 99, 45, 142, 170, 132, 38, 113, 13, 129, 96, 28, 7, 214, 126, 249, 238, 128, 49, 121, 168, 118, 109, 119, 185, 40, 154, 32, 18, 0, 141, 18, 123, 160, 26, 187, 206, 58, 126, 240, 229, 34, 29, 246, 192, 80, 250, 17, 40, 79, 63, 125, 141, 205, 56, 59, 33, 122, 165, 147, 50, 104, 94, 138, 166, 129, 34, 135, 210, 44, 183, 169, 235, 151, 35, 146, 198, 132, 107, 72, 80, 127, 24, 35, 190, 197, 89, 212, 134, 131, 68, 210, 40, 35, 231, 54, 8, 233, 2, 254, 64, 1, 120, 224, 116, 144, 97, 238, 78, 150, 99, 248, 157, 48, 137, 77, 40, 58, 56, 132, 108, 222, 77, 147, 11, 88, 61, 201, 251, 75, 195, 177, 249, 159, 163, 65, 207, 137, 107, 58, 251, 108, 59, 101, 42, 219, 186, 30, 186, 20, 248, 49, 218, 203, 211, 42, 241, 215, 175, 117, 159, 252, 240, 221, 105, 20, 45, 226, 183, 21, 77, 91, 226, 60, 90, 29, 127, 50, 29, 207, 112, 177, 216, 142, 254, 37, 216, 195, 139, 226, 62, 175, 153, 63, 191, 191, 109, 58, 135, 99, 95, 224, 146, 91, 18, 52, 139, 208, 68, 159, 74, 117, 51, 167, 22, 0, 250, 168, 105, 110, 203, 219, 133, 255, 65, 222, 240, 52, 190, 16, 105, 218, 62, 249, 152, 175, 5, 230, 92, 5, 1, 211, 137, 52, 95, 208, 192, 198, 204, 46, 163, 191, 177, 60, 171, 88, 108, 199, 49, 208, 107, 165, 123, 254, 107, 34, 236, 155, 207, 221, 76, 194, 126, 6, 95, 43, 211, 83, 14, 34, 165, 187, 213, 181, 138, 40, 26, 66, 232, 136, 125, 107, 191, 165, 177, 17, 26, 114, 202, 208, 97, 29, 218, 241, 54, 216, 26, 15, 186, 95, 101, 138, 180, 121, 210, 153, 56, 167, 102, 41, 30, 201, 97, 97, 118, 192, 121, 108, 48, 153, 124, 90, 245, 87, 129, 105, 195, 211, 44, 210, 16, 194, 179, 52, 233, 248, 225, 131, 84, 96, 35, 58, 40, 193, 29, 246, 213, 133, 223, 68, 196, 244, 78, 11, 224, 123, 156, 21, 149, 50, 162, 235, 63, 238, 41, 189, 156, 118, 22, 58, 21, 49, 62, 72, 1, 228, 92, 69, 109, 162, 82, 32, 13, 178, 116, 222, 192, 32, 146, 227, 201, 184, 123, 45, 217, 188, 118, 142, 23, 65, 5, 167, 6, 221, 116, 145, 196, 204, 56, 178, 100, 86, 181, 59, 38, 37, 40, 244, 131, 205, 15, 173, 169, 74, 223, 251, 85, 109, 232, 244, 123, 98, 241, 205, 174, 190, 173, 131, 182, 253, 229, 45, 35, 216, 209, 206, 251, 197, 234, 207, 193, 11, 108, 241, 100, 107, 178, 68, 153, 243, 92, 153, 109, 71, 245, 40, 207, 237, 183, 157, 229, 17, 37, 198, 164, 205, 212, 16, 240, 88, 27, 127, 64, 117, 113, 213, 52, 66, 178, 250, 126, 110, 66, 42, 29, 71, 116, 183, 232, 31, 176, 110, 200, 76, 19, 1, 52, 109, 243, 80, 213, 227, 68, 67, 85, 180, 67, 19, 78, 6, 13, 97, 176, 115, 42, 6, 30, 111, 68, 224, 29, 49, 21, 102, 65, 253, 232, 152, 255, 21, 114, 144, 6, 151, 12, 255, 130, 226, 168, 12, 204, 244, 17, 49, 199, 247, 206, 214, 107, 221, 80, 62, 154, 103, 139, 136, 21, 37, 91, 60, 127, 251, 171, 9, 28, 184, 141, 91, 53, 151, 127, 161, 83, 118, 127, 234, 185, 94, 193, 193, 103, 61, 117, 170, 158, 190, 239, 99, 110, 166, 94, 128, 111, 135, 203, 203, 174, 127, 226, 231, 242, 198, 202, 86, 229, 197, 254, 208, 10, 193, 104, 160, 3, 129, 104, 229, 58, 232, 129, 80, 52, 42, 164, 217, 101, 219, 76, 25, 111, 170, 226, 229, 22, 212, 247, 61, 0, 36, 134, 176, 74, 159, 204, 17, 203, 56, 66, 41, 103, 183, 74, 37, 67, 142, 229, 50, 89, 188, 239, 6, 210, 55, 238, 70, 222, 223, 230, 59, 185, 22, 34, 14, 101, 72, 117, 221, 215, 127, 82, 234, 229, 28, 59, 32, 146, 143, 184, 247, 72, 47, 143, 73, 57, 145, 190, 183, 179, 39, 135, 9, 225, 220, 72, 53, 16, 225, 176, 211, 17, 242, 156, 20, 227, 80, 226, 130, 96, 201, 122, 252, 12, 164, 102, 61, 130, 166, 217, 156, 8, 78, 60, 234, 174, 25, 58, 146, 101, 191, 226, 151, 230, 127, 217, 66, 225, 121, 149, 55, 77, 118, 21, 202, 123, 117, 128, 180, 145, 225, 159, 102, 190, 251, 67, 124, 73, 25, 131, 222, 130, 243, 34, 192, 8, 37, 81, 250, 177, 89, 93, 177, 202, 19, 105, 110, 229, 57, 45, 135, 133, 162, 201, 185, 83, 74, 23, 115, 250, 154, 7, 172, 19, 218, 131, 67, 133, 185, 140, 29, 58, 107, 100, 230, 249, 71, 44, 95, 21, 180, 87, 22, 156, 252, 171, 55, 220, 201, 204, 115, 210, 13, 132, 111, 163, 93, 95, 17, 1, 69, 14, 14, 40, 61, 213, 163, 46, 185, 241, 30, 7, 199, 48, 182, 107, 148, 150, 231, 226, 230, 32, 147, 181, 70, 187, 21, 253, 124, 192, 60, 105, 168, 61, 121, 201, 30, 129, 85, 70, 135, 151, 173, 161, 11, 74, 228, 89, 21, 79, 254, 122, 173, 211, 116, 118, 7, 26, 48, 79, 181, 231, 163, 76, 194, 108, 19, 104, 174, 53, 112, 219, 113, 126, 160, 128, 2, 168, 219, 81, 163, 215, 36, 168, 12, 142, 152, 237, 183, 18, 236, 203, 132, 11, 41, 16, 249, 210, 25, 4, 246, 207, 87, 207, 98, 218, 36, 157, 86, 220, 65, 45, 25, 89, 7, 86, 236, 4, 65, 36, 25, 168, 94, 252, 106, 233, 175, 180, 33, 163, 33, 88, 219, 175, 193, 102, 61, 62, 85, 99, 250, 197, 209, 130, 201, 81, 218, 80, 187, 247, 174, 101, 81, 212, 161, 14, 100, 188, 75, 199, 196, 187, 31, 220, 207, 177, 93, 72, 230, 221, 59, 198, 27, 49, 38, 165, 52, 3, 227, 59, 204, 147, 186, 183, 117, 148, 240, 223, 79, 136, 61, 139, 145, 228, 48, 231, 57, 224, 219, 140, 1, 245, 237, 87, 62, 61, 92, 120, 67, 25, 152, 150, 147, 149, 253, 242, 36, 117, 248, 171, 184, 233, 133, 147, 112, 200, 100, 63, 101, 156, 132, 214, 156, 75, 106, 56, 160, 139, 221, 49, 195, 136, 40, 85, 126, 46, 59, 245, 200, 11, 148, 90, 39, 7, 199, 71, 23, 57, 107, 34, 2, 215, 94, 217, 115, 221, 167, 44, 227, 175, 222, 167, 13, 255, 5, 20, 238, 203, 69, 127, 200, 120, 178, 230, 34, 41, 40, 247, 38, 129, 246, 244, 159, 13, 207, 148, 130, 155, 104, 62, 31, 181, 2, 249, 117, 78, 79, 31, 33, 246, 221, 17, 179, 20, 139, 200, 119, 243, 156, 27, 215, 251, 174, 190, 227, 61, 224, 82, 162, 11, 250, 11, 88, 221, 172, 245, 170, 143, 210, 186, 213, 173, 141, 195, 214, 73, 243, 130, 249, 2, 137, 155, 155, 102, 231, 225, 212, 82, 79, 129, 89, 131, 79, 67, 78, 151, 165, 195, 61, 218, 244, 60, 196, 233, 121, 9, 124, 13, 10, 64, 246, 245, 150, 140, 90, 188, 20, 179, 41, 74, 210, 206, 65, 255, 61, 223, 169, 63, 20, 23, 23, 168, 43, 67, 242, 83, 162, 54, 123, 83, 12, 233, 247, 249, 69, 184, 232, 201, 245, 164, 213, 75, 222, 7, 27, 145, 224, 227, 212, 204, 183, 121, 240, 193, 251, 239, 82, 189, 81, 177, 130, 157, 12, 52, 81, 187, 45, 186, 31, 86, 61, 164, 160, 204, 143, 154, 16, 59, 21, 161, 69, 214, 86, 30, 64, 174, 80, 58, 166, 210, 5, 148, 248, 220, 116, 33, 20, 212, 82, 202, 132, 244, 10, 117, 15, 167, 32, 130, 148, 178, 88, 238, 90, 86, 183, 252, 67, 100, 251, 134, 45, 232, 95, 218, 114, 202, 172, 75, 108, 124, 73, 19, 196, 54, 107, 205, 185, 34, 249, 37, 55, 3, 2, 114, 188, 35, 94, 82, 0, 97, 167, 131, 241, 186, 207, 160, 242, 168, 40, 230, 124, 55, 97, 147, 115, 202, 197, 54, 35, 142, 209, 177, 105, 221, 88, 189, 136, 86, 51, 77, 203, 156, 190, 159, 172, 222, 67, 57, 108, 197, 88, 202, 90, 250, 95, 106, 183, 86, 45, 208, 219, 90, 253, 246, 72, 110, 144, 50, 147, 143, 35, 64, 132, 227, 167, 248, 174, 247, 241, 66, 244, 172, 127, 98, 31, 67, 3, 208, 220, 168, 132, 1, 195, 238, 207, 63, 171, 195, 189, 43, 68, 124, 121, 218, 255, 213, 68, 11, 59, 78, 89, 68, 146, 17, 87, 148, 172, 31, 140, 167, 199, 163, 37, 250, 242, 122, 31, 187, 221, 13, 159, 226, 162, 197, 54, 144, 1, 16, 203, 71, 181, 223, 158, 253, 101, 204, 13, 94, 32, 250, 220, 49, 192, 229, 48, 9, 175, 34, 204, 100, 200, 157, 206, 137, 131, 139, 8, 71, 15, 186, 169, 210, 204, 154, 115, 224, 23, 86, 180, 249, 54, 52, 123, 49, 57, 56, 189, 189, 172, 107, 134, 220, 207, 215, 150, 120, 238, 144, 184, 30, 71, 53, 35, 126, 88, 100, 137, 101, 175, 159, 94, 158, 41, 88, 179, 234, 58, 19, 57, 10, 185, 133, 161, 153, 194, 71, 100, 221, 150, 174, 226, 2, 105, 191, 213, 205, 159, 217, 13, 72, 132, 67, 140, 216, 188, 68, 239, 242, 145, 42, 162, 182, 224, 148, 18, 12, 47, 201, 84, 139, 242, 44, 15, 148, 223, 66, 177, 214, 102, 184, 168, 175, 76, 12, 71, 155, 101, 14, 214, 134, 29, 75, 128, 34, 229, 36, 172, 215, 154, 234, 215, 120, 162, 137, 112, 235, 106, 66, 179, 176, 20, 25, 108, 13, 178, 29, 168, 205, 41, 210, 85, 228, 79, 237, 228, 42, 213, 226, 135, 186, 2, 97, 100, 209, 217, 196, 158, 129, 222, 133, 144, 184, 43, 236, 160, 244, 156, 98, 77, 156, 233, 160, 152, 250, 126, 232, 75, 54, 162, 51, 198, 64, 9, 101, 240, 102, 47, 51, 161, 19, 224, 97, 118, 193, 236, 204, 15, 157, 176, 35, 203, 14, 166, 56, 207, 190, 80, 15, 100, 80, 0, 229, 5, 89, 84, 94, 239, 117, 157, 211, 206, 150, 226, 137, 227, 167, 196, 113, 98, 219, 13, 114, 1, 31, 123, 99, 199, 255, 98, 74, 8, 43, 111, 120, 170, 16, 248, 146, 162, 224, 243, 10, 186, 243, 122, 115, 219, 250, 19, 19, 88, 228, 69, 221, 134, 108, 141, 53, 253, 231, 80, 162, 206, 166, 10, 47, 4, 222, 73, 229, 211, 70, 165, 179, 133, 216, 228, 228, 224, 189, 129, 132, 126, 5, 121, 151, 181, 177, 100, 109, 85, 46, 38, 43, 196, 121, 10, 144, 202, 178, 236, 156, 243, 91, 162, 132, 221, 4, 84, 186, 140, 123, 238, 56, 20, 241, 233, 108, 82, 51, 68, 229, 221, 97, 149, 41, 5, 214, 46, 57, 191, 146, 212, 209, 108, 60, 212, 159, 139, 58, 56, 189, 80, 164, 41, 150, 145, 163, 74, 162, 196, 114, 57, 202, 141, 175, 86, 92, 62, 89, 37, 185, 77, 246, 206, 32, 210, 239, 107, 87, 215, 182, 95, 12, 40, 155, 67, 191, 195, 108, 202, 38, 150, 141, 211, 131, 131, 225, 135, 225, 71, 215, 119, 20, 223, 147, 200, 124, 218, 48, 23, 235, 136, 70, 30, 239, 71, 28, 59, 183, 163, 219, 79, 165, 118, 93, 195, 250, 90, 127, 117, 9, 82, 162, 34, 115, 9, 5, 200, 188, 75, 214, 87, 10, 169, 34, 73, 41, 203, 21, 67, 88, 224, 147, 143, 211, 146, 33, 110, 156, 159, 137, 118, 182, 59, 42, 91, 208, 247, 254, 162, 7, 32, 137, 249, 17, 3, 24, 64, 219, 178, 22, 254, 237, 173, 5, 148, 226, 61, 121, 1, 61, 126, 34, 110, 196, 0, 81, 61, 91, 210, 208, 5, 75, 170, 79, 215, 148, 54, 219, 165, 252, 241, 2, 105, 238, 107, 102, 175, 108, 63, 48, 214, 188, 48, 206, 177, 196, 211, 254, 252, 127, 99, 244, 23, 232, 154, 151, 182, 98, 170, 2, 129, 167, 87, 74, 70, 19, 39, 204, 110, 127, 144, 90, 73, 63, 225, 66, 9, 29, 168, 0, 243, 72, 202, 176, 204, 83, 52, 67, 126, 239, 128, 69, 97, 4, 144, 21, 190, 105, 174, 132, 80, 6, 198, 73, 88, 199, 119, 229, 171, 206, 125, 190, 130, 145, 209, 18, 254, 133, 140, 200, 5, 236, 98, 83, 36, 50, 245, 248, 60, 235, 128, 148, 107, 249, 255, 193, 103, 111, 166, 210, 219, 231, 197, 69, 43, 245, 161, 164, 220, 239, 220, 99, 254, 67, 0, 215, 217, 34, 130, 199, 51, 200, 208, 165, 233, 194, 188, 188, 229, 248, 217, 1, 162, 132, 249, 252, 118, 165, 178, 25, 69, 24, 242, 96, 122, 79, 151, 153, 45, 9, 125, 166, 241, 189, 123, 255, 98, 133, 1, 247, 180, 205, 97, 100, 98, 229, 97, 11, 40, 166, 170, 123, 191, 134, 74, 229, 11, 168, 170, 161, 101, 171, 43, 144, 149, 64, 113, 231, 39, 59, 23, 252, 229, 189, 42, 166, 125, 71, 150, 65, 59, 140, 180, 131, 68, 182, 103, 226, 91, 205, 41, 236, 196, 221, 110, 106, 133, 104, 182, 218, 187, 7, 42, 214, 24, 97, 58, 115, 176, 147, 242, 34, 29, 51, 74, 123, 159, 193, 73, 253, 182, 19, 251, 161, 121, 79, 241, 61, 163, 119, 102, 243, 131, 45, 13, 58, 218, 202, 136, 133, 242, 226, 237, 204, 217, 12, 122, 201, 29, 204, 11, 67, 239, 154, 46, 254, 19, 183, 245, 157, 74, 188, 193, 51, 31, 88, 102, 214, 88, 215, 22, 123, 84, 250, 251, 169, 232, 166, 202, 152, 183, 244, 173, 55, 57, 56, 6, 92, 120, 110, 202, 129, 58, 13, 25, 235, 252, 243, 69, 229, 45, 40, 9, 196, 133, 247, 33, 178, 137, 46, 180, 186, 231, 108, 98, 199, 197, 171, 192, 204, 206, 17, 94, 61, 67, 218, 100, 204, 245, 166, 32, 113, 78, 104, 119, 178, 39, 146, 45, 252, 119, 142, 33, 229, 149, 175, 196, 189, 235, 29, 48, 16, 168, 33, 211, 219, 152, 228, 42, 105, 207, 90, 92, 39, 222, 84, 6, 126, 32, 114, 138, 131, 196, 188, 253, 110, 193, 129, 105, 17, 28, 28, 236, 199, 232, 233, 30, 142, 30, 3, 122, 102, 111, 177, 78, 168, 194, 156, 176, 115, 191, 197, 39, 152, 100, 112, 59, 116, 214, 144, 2, 151, 208, 217, 61, 53, 91, 70, 91, 127, 126, 173, 182, 136, 244, 129, 255, 215, 187, 146, 21, 169, 199, 63, 54, 191, 201, 233, 115, 127, 101, 98, 216, 0, 62, 93, 21, 97, 141, 168, 7, 134, 135, 169, 29, 171, 29, 3, 187, 123, 90, 73, 109, 92, 173, 100, 25, 240, 208, 57, 34, 124, 21, 130, 124, 62, 6, 28, 214, 149, 136, 213, 171, 161, 129, 209, 170, 76, 50, 229, 15, 179, 74, 149, 163, 114, 148, 10, 227, 101, 75, 105, 46, 163, 82, 148, 116, 140, 61, 210, 192, 139, 41, 248, 123, 169, 40, 140, 130, 148, 239, 203, 115, 220, 113, 158, 69, 185, 28, 69, 240, 132, 231, 122, 235, 192, 124, 31, 243, 237, 143, 55, 147, 81, 48, 163, 99, 4, 163, 64, 226, 216, 17, 118, 31, 32, 251, 93, 77, 252, 73, 222, 232, 15, 19, 200, 162, 13, 127, 4, 166, 213, 190, 150, 241, 162, 56, 42, 135, 193, 26, 171, 91, 209, 41, 196, 243, 129, 165, 1, 95, 84, 30, 62, 211, 147, 239, 247, 182, 66, 106, 219, 57, 95, 170, 233, 161, 23, 77, 50, 122, 163, 244, 19, 250, 179, 81, 38, 100, 238, 106, 34, 52, 244, 45, 119, 101, 179, 161, 142, 239, 49, 63, 37, 7, 166, 3, 55, 45, 248, 238, 91, 155, 254, 100, 37, 45, 18, 229, 1, 163, 230, 130, 219, 110, 129, 121, 107, 171, 125, 243, 20, 95, 146, 3, 18, 174, 20, 250, 149, 144, 56, 120, 6, 166, 247, 217, 138, 104, 0, 24, 174, 211, 227, 120, 177, 3, 49, 189, 32, 108, 213, 163, 126, 26, 192, 13, 195, 192, 197, 198, 191, 12, 91, 172, 255, 54, 97, 61, 255, 119, 96, 140, 24, 110, 187, 166, 112, 230, 245, 1, 64, 242, 118, 118, 84, 193, 173, 150, 221, 44, 55, 208, 64, 14, 0, 228, 132, 190, 57, 50, 19, 224, 202, 172, 31, 17, 186, 196, 72, 55, 179, 75, 90, 12, 53, 139, 60, 210, 31, 7, 79, 206, 148, 221, 193, 168, 39, 149, 19, 102, 150, 234, 8, 69, 185, 98, 14, 163, 52, 175, 85, 233, 248, 240, 156, 190, 131, 183, 53, 215, 197, 149, 251, 12, 124, 78, 226, 130, 39, 238, 200, 187, 250, 14, 98, 50, 182, 144, 161, 29, 19, 147, 162, 185, 90, 171, 164, 35, 42, 207, 99, 130, 157, 85, 21, 243, 109, 166, 243, 217, 12, 34, 118, 113, 99, 95, 194, 207, 144, 149, 252, 214, 243, 235, 110, 29, 122, 2, 158, 255, 4, 159, 10, 152, 215, 9, 56, 144, 73, 144, 152, 115, 40, 77, 233, 237, 79, 21, 83, 97, 213, 102, 212, 183, 179, 204, 226, 77, 139, 151, 49, 220, 85, 123, 12, 76, 84, 136, 86, 42, 216, 130, 62, 171, 107, 206, 60, 254, 141, 158, 42, 115, 99, 231, 82, 82, 207, 108, 249, 130, 33, 160, 23, 236, 234, 1, 94, 207, 150, 139, 96, 173, 181, 199, 186, 31, 101, 110, 193, 165, 237, 223, 1, 132, 227, 139, 63, 4, 50, 189, 232, 195, 182, 29, 163, 173, 10, 236, 113, 114, 240, 222, 79, 201, 214, 26, 37, 27, 62, 230, 43, 164, 144, 55, 178, 14, 136, 25, 235, 61, 71, 10, 209, 88, 203, 158, 20, 244, 4, 240, 23, 69, 249, 129, 170, 136, 15, 213, 232, 219, 94, 213, 25, 73, 105, 107, 252};
+    sqr_uint64_arr(t, a, len);
+    t[2 * len] = 0;
 
-/* SECP256K1 FUNCTIONS */
+    for (i = 0; i < len; i++) { // t = t + u * m * 2^(64 i), u is chosen so that limb i of the sum is zero
+        u = t[i] * m_inv;
+        carry = 0;
+        for (j = 0; j < len; j++) {
+            p = (uint128_t)u * m[j] + t[i + j] + carry;
+            t[i + j] = (uint64_t)p;
+            carry = (uint64_t)(p >> 64);
+        }
+        add_to_uint64_arr(t + i + len, len + 1 - i, &carry, 1); // t[2 len] absorbs the final carry
+    }
 
-SECP256K1 secp256k1_init(void);
-void secp256k1_populate_G_doublings_mod_p(APT *);
-void secp256k1_free(SECP256K1);
-void secp256k1_point_addition(const SECP256K1, const APT *, const APT *, APT *); // r = (p + q) mod secp256k1.p
-void secp256k1_point_doubling(const SECP256K1, const APT *, APT *); // r = 2p mod secp256k1.p
-void secp256k1_scalar_multiplication(const SECP256K1, const APT *, const bnz_t *, APT *); // r = q * m mod secp256k1.p
-void get_affine_from_jacobian(const SECP256K1, const JPT *, APT *);
-void secp256k1_jacobian_point_addition(const SECP256K1, const JPT *, const APT *, JPT *);
-void secp256k1_jacobian_scalar_multiplication(const SECP256K1, const bnz_t *, APT *);
-bool secp256k1_valid_point(const SECP256K1, const APT);
+    if (t[2 * len] != 0 || cmp_uint64_arr(t + len, m, len) >= 0) { // t / 2^(64 len) < 2m, at most one subtraction
+        sub_uint64_arr(res, t + len, m, len);
+    } else {
+        memcpy(res, t + len, len * sizeof(uint64_t));
+    }
+}
 
-SECP256K1 secp256k1_init() // initiate secp256k1 curve, y^2 = (x^3 + 7) mod secp256k1.p
+void barrett_reduce_uint64_arr(uint64_t *res, const uint64_t *a, const uint64_t *m, const uint64_t *mu, size_t len, uint64_t *t) // res = a mod m for a of 2 len limbs, Barrett reduction (HAC 14.42), requires m[len - 1] != 0 and mu = floor(2^(128 len) / m) of len + 2 limbs, t is workspace of 4 len + 5 limbs, res must not alias t
 {
-    const char *secp256k1_p = "115792089237316195423570985008687907853269984665640564039457584007908834671663"; // prime, base 10
-    const char *secp256k1_G_x = "55066263022277343669578718895168534326250603453777594175500187360389116729240"; // generator x, base 10
-    const char *secp256k1_G_y = "32670510020758816978083085130507043184471273380659243275938904335757337482424"; // generator y, base 10
-    const char *secp256k1_n = "115792089237316195423570985008687907852837564279074904382605163141518161494337"; // order, base 10
-
-    SECP256K1 secp256k1;
-
-    bnz_init(&secp256k1.p);
-    bnz_init(&secp256k1.a);
-    bnz_init(&secp256k1.b);
-    bnz_init(&secp256k1.G.x);
-    bnz_init(&secp256k1.G.y);
-    bnz_init(&secp256k1.n);
-    bnz_init(&secp256k1.h);
+    uint64_t *q2 = t, *r2 = t + 2 * len + 3;
 
-    bnz_set_str(&secp256k1.p, secp256k1_p, 10); // prime
-    bnz_set_i32(&secp256k1.a, 0);
-    bnz_set_i32(&secp256k1.b, 7);
-    bnz_set_str(&secp256k1.G.x, secp256k1_G_x, 10); // generator x
-    bnz_set_str(&secp256k1.G.y, secp256k1_G_y, 10); // generator y
-    bnz_set_str(&secp256k1.n, secp256k1_n, 10); // order
-    bnz_set_i32(&secp256k1.h, 1); // included for completeness, but not used in any functions
+    mul_uint64_arr(q2, a + len - 1, len + 1, mu, len + 2); // q2 = floor(a / 2^(64 (len - 1))) * mu
+    mul_uint64_arr(r2, q2 + len + 1, len + 2, m, len); // r2 = floor(q2 / 2^(64 (len + 1))) * m, the quotient estimate is at most 2 too small
 
-    secp256k1_populate_G_doublings_mod_p(secp256k1.G_doublings_mod_p);
+    sub_uint64_arr(t, a, r2, len + 1); // r = (a - r2) mod 2^(64 (len + 1))
+    while (t[len] != 0 || cmp_uint64_arr(t, m, len) >= 0) {
+        t[len] -= sub_uint64_arr(t, t, m, len);
+    }
 
-    return secp256k1;
+    memcpy(res, t, len * sizeof(uint64_t));
 }
 
-void secp256k1_populate_G_doublings_mod_p(APT *G_doublings_mod_p)
-{
-    int i;
 
-    for (i = 0; i < 256; i++) { // initiate and resize bnz_t variables within the G_doublings_mod_p array and populate with data from the g_doublings_data array
-        bnz_init(&G_doublings_mod_p[i].x); // initiate x
-        bnz_init(&G_doublings_mod_p[i].y); // initiate y
-        bnz_resize(&G_doublings_mod_p[i].x, 32, false); // resize x.digits to 32 bytes
-        bnz_resize(&G_doublings_mod_p[i].y, 32, false); // resize y.digits to 32 bytes
-        memcpy(G_doublings_mod_p[i].x.digits, g_doublings_data + i * 64, 32); // populate x.digits from the g_doublings_data array
-        memcpy(G_doublings_mod_p[i].y.digits, g_doublings_data + i * 64 + 32, 32); // populate y.digits from the g_doublings_data array
-    }
+size_t bnz_limb_count(const bnz_t *a) // number of 64 bit limbs needed to hold a->digits
+{
+    return (a->size + 7) / 8;
 }
 
-void secp256k1_free(SECP256K1 secp256k1) // free secp256k1 curve
+void bnz_get_limbs(uint64_t *limbs, size_t len, const bnz_t *a) // load a->digits into len 64 bit limbs, little endian order, zero padding at the msb end
 {
-    int i;
-    bnz_free(&secp256k1.p);
-    bnz_free(&secp256k1.a);
-    bnz_free(&secp256k1.b);
-    bnz_free(&secp256k1.G.x);
-    bnz_free(&secp256k1.G.y);
+    size_t i;
 
-    for (i = 0; i < 256; i++) {
-        bnz_free(&secp256k1.G_doublings_mod_p[i].x);
-        bnz_free(&secp256k1.G_doublings_mod_p[i].y);
-    }
+    memset(limbs, 0, len * sizeof(uint64_t));
 
-    bnz_free(&secp256k1.n);
-    bnz_free(&secp256k1.h);
+    for (i = 0; i < a->size && i < 8 * len; i++) {
+        limbs[i / 8] |= (uint64_t)a->digits[i] << (8 * (i % 8));
+    }
+    bnz_bytes_copied += i;
 }
 
-void secp256k1_point_doubling(const SECP256K1 secp256k1, const APT *p, APT *r) // r = 2p mod secp256k1.p
+void bnz_set_limbs(bnz_t *res, const uint64_t *limbs, size_t len) // set res->digits from len 64 bit limbs, little endian order, trimming zero bytes from the msb end, res->sign is set to positive
 {
-    bnz_t slope, tmp;
+    size_t i;
 
-    APT pp, rr;
+    bnz_resize(res, 8 * len, false);
 
-    bnz_init(&tmp);
-    bnz_init(&slope);
-
-    bnz_init(&pp.x);
-    bnz_init(&pp.y);
-    bnz_init(&rr.x);
-    bnz_init(&rr.y);
-
-    bnz_set_bnz(&pp.x, &p->x);
-    bnz_set_bnz(&pp.y, &p->y);
-    bnz_set_bnz(&rr.x, &p->x);
-    bnz_set_bnz(&rr.y, &p->y);
-
-    if (bnz_is_zero(&pp.y) == false) {
-        bnz_multiply_i32(&tmp, &pp.y, 2);
-        bnz_modular_multiplicative_inverse(&tmp, &tmp, &secp256k1.p);
-        bnz_multiply_bnz(&slope, &pp.x, &pp.x);
-        bnz_multiply_i32(&slope, &slope, 3);
-        bnz_add_bnz(&slope, &slope, &secp256k1.a);
-        bnz_multiply_bnz(&slope, &slope, &tmp);
-        bnz_mod_bnz(&slope, &slope, &secp256k1.p);
-        bnz_multiply_bnz(&rr.x, &slope, &slope);
-        bnz_subtract_bnz(&rr.x, &rr.x, &pp.x);
-        bnz_subtract_bnz(&rr.x, &rr.x, &pp.x);
-        bnz_mod_bnz(&rr.x, &rr.x, &secp256k1.p);
-        bnz_subtract_bnz(&tmp, &pp.x, &rr.x);
-        bnz_multiply_bnz(&rr.y, &slope, &tmp);
-        bnz_subtract_bnz(&rr.y, &rr.y, &pp.y);
-        bnz_mod_bnz(&rr.y, &rr.y, &secp256k1.p);
-    } else {
-        bnz_set_i32(&rr.x, 0);
-        bnz_set_i32(&rr.y, 0);
+    for (i = 0; i < 8 * len; i++) {
+        res->digits[i] = (uint8_t)(limbs[i / 8] >> (8 * (i % 8)));
     }
+    bnz_bytes_copied += 8 * len;
 
-    bnz_set_bnz(&r->x, &rr.x);
-    bnz_set_bnz(&r->y, &rr.y);
-
-    bnz_free(&tmp);
-    bnz_free(&slope);
-    bnz_free(&pp.x);
-    bnz_free(&pp.y);
-    bnz_free(&rr.x);
-    bnz_free(&rr.y);
+    bnz_trim(res);
 }
 
-void secp256k1_point_addition(const SECP256K1 secp256k1, const APT *p, const APT *q, APT *r) // r = (p + q) mod secp256k1.p
+void bnz_init(bnz_t *a) // initiate bnz_t components, with the inline digits as storage
 {
-    bnz_t tmp, slope;
-
-    APT pp, qq, rr;
-
-    bnz_init(&tmp);
-    bnz_init(&slope);
-
-    bnz_init(&pp.x);
-    bnz_init(&pp.y);
-    bnz_init(&qq.x);
-    bnz_init(&qq.y);
-    bnz_init(&rr.x);
-    bnz_init(&rr.y);
+    a->sign = 0;
+    a->size = 0;
+    a->capacity = BNZ_INLINE_BYTES;
+    a->digits = a->inline_digits;
+}
 
-    bnz_set_bnz(&qq.x, &q->x);
-    bnz_set_bnz(&qq.y, &q->y);
-    bnz_set_bnz(&pp.x, &p->x);
-    bnz_set_bnz(&pp.y, &p->y);
-    bnz_set_bnz(&rr.x, &r->x);
-    bnz_set_bnz(&rr.y, &r->y);
+void bnz_resize(bnz_t *a, size_t new_size, bool preserve) // increase or decrease number of bytes in a->digits, zeroing added bytes, and preserving or zeroing existing bytes, only visiting the heap when new_size exceeds the capacity
+{
+    uint8_t *tmp = NULL;
+    size_t prev_size = a->size, new_capacity;
 
-    bnz_set_i32(&slope, 0);
+    BNZ_STATS_CALL(new_size);
 
-    bnz_mod_bnz(&pp.x, &pp.x, &secp256k1.p);
-    bnz_mod_bnz(&pp.y, &pp.y, &secp256k1.p);
-    bnz_mod_bnz(&qq.x, &qq.x, &secp256k1.p);
-    bnz_mod_bnz(&qq.y, &qq.y, &secp256k1.p);
+    if (new_size < 1) new_size = 1;
 
-    if (bnz_is_zero(&pp.x) == true && bnz_is_zero(&pp.y) == true  ) {
-        bnz_set_bnz(&r->x, &qq.x);
-        bnz_set_bnz(&r->y, &qq.y);
-        bnz_free(&tmp);
-        bnz_free(&slope);
-        bnz_free(&pp.x);
-        bnz_free(&pp.y);
-        bnz_free(&qq.x);
-        bnz_free(&qq.y);
-        bnz_free(&rr.x);
-        bnz_free(&rr.y);
-        return;
+    if (new_size > a->capacity) { // grow geometrically, so that a run of small increases costs few reallocations
+        new_capacity = 2 * (size_t)a->capacity > new_size ? 2 * (size_t)a->capacity : new_size;
+        if (a->capacity <= BNZ_INLINE_BYTES) { // move the inline digits to the heap
+            tmp = malloc(new_capacity);
+            if (tmp) memcpy(tmp, a->inline_digits, prev_size);
+            bnz_bytes_copied += prev_size;
+        } else {
+            tmp = realloc(a->digits, new_capacity); // if realloc is successful, a->digits will be freed automatically. If realloc fails, tmp will be NULL, and a->digits will remain unchanged.
+            bnz_bytes_copied += prev_size; // counted as moved, although realloc may extend the block in place
+        }
+        if (!tmp) {
+            return;
+        }
+        bnz_heap_allocs++;
+        a->digits = tmp; // replace a->digits with tmp
+        a->capacity = (uint32_t)new_capacity;
     }
 
-    if (bnz_is_zero(&qq.x) == true && bnz_is_zero(&qq.y) == true) {
-        bnz_set_bnz(&r->x, &pp.x);
-        bnz_set_bnz(&r->y, &pp.y);
-        bnz_free(&tmp);
-        bnz_free(&slope);
-        bnz_free(&pp.x);
-        bnz_free(&pp.y);
-        bnz_free(&qq.x);
-        bnz_free(&qq.y);
-        bnz_free(&rr.x);
-        bnz_free(&rr.y);
-        return;
+    if (preserve == true) { // if preserve is true, the original byte values and the sign will be preserved
+        if (new_size > prev_size) { // if the new size is larger than the original size...
+            memset(a->digits + prev_size, 0, new_size - prev_size); // ...zero the new bytes
+        }
+    } else { // if preserve is false, all byte values will be zeroed and the sign will be set to positive
+        a->sign = 0; // set sign to positive
+        memset(a->digits, 0, new_size); // zero all bytes
     }
+    a->size = (uint32_t)new_size; // set new size
+}
 
-    if (bnz_is_zero(&qq.y) == false) {
-        bnz_subtract_bnz(&tmp, &secp256k1.p, &qq.y);
-        bnz_mod_bnz(&tmp, &tmp, &secp256k1.p);
+void bnz_align(bnz_t *a, bnz_t *b) // resize a->digits or b->digits to match the byte count of the longer of a and b
+{
+    bnz_trim(a);
+    bnz_trim(b);
+    if (a->size > b->size) {
+        bnz_resize(b, a->size, true);
     } else {
-        bnz_set_i32(&tmp, 0);
-    }
-
-    if (bnz_cmp_bnz(&pp.y, &tmp) == 0 && bnz_cmp_bnz(&pp.x, &qq.x) == 0) {
-        bnz_set_i32(&r->x, 0);
-        bnz_set_i32(&r->y, 0);
-        bnz_free(&tmp);
-        bnz_free(&slope);
-        bnz_free(&pp.x);
-        bnz_free(&pp.y);
-        bnz_free(&qq.x);
-        bnz_free(&qq.y);
-        bnz_free(&rr.x);
-        bnz_free(&rr.y);
-        return;
+        bnz_resize(a, b->size, true);
     }
-
-    if (bnz_cmp_bnz(&pp.x, &qq.x) == 0 && bnz_cmp_bnz(&pp.y, &qq.y) == 0) {
-        secp256k1_point_doubling(secp256k1, &pp, &rr);
-    } else {
-        bnz_subtract_bnz(&tmp, &pp.x, &qq.x);
-        bnz_mod_bnz(&tmp, &tmp, &secp256k1.p);
-        bnz_modular_multiplicative_inverse(&tmp, &tmp, &secp256k1.p);
-        bnz_subtract_bnz(&slope, &pp.y, &qq.y);
-        bnz_multiply_bnz(&slope, &slope, &tmp);
-        bnz_mod_bnz(&slope, &slope, &secp256k1.p);
-        bnz_multiply_bnz(&rr.x, &slope, &slope);
-        bnz_subtract_bnz(&rr.x, &rr.x, &pp.x);
-        bnz_subtract_bnz(&rr.x, &rr.x, &qq.x);
-        bnz_mod_bnz(&rr.x, &rr.x, &secp256k1.p);
-        bnz_subtract_bnz(&tmp, &pp.x, &rr.x);
-        bnz_multiply_bnz(&rr.y, &slope, &tmp);
-        bnz_subtract_bnz(&rr.y, &rr.y, &pp.y);
-        bnz_mod_bnz(&rr.y, &rr.y, &secp256k1.p);
-    }
-
-    bnz_set_bnz(&r->x, &rr.x);
-    bnz_set_bnz(&r->y, &rr.y);
-
-    bnz_free(&tmp);
-    bnz_free(&slope);
-    bnz_free(&pp.x);
-    bnz_free(&pp.y);
-    bnz_free(&qq.x);
-    bnz_free(&qq.y);
-    bnz_free(&rr.x);
-    bnz_free(&rr.y);
 }
 
-void secp256k1_scalar_multiplication(const SECP256K1 secp256k1, const APT *q, const bnz_t *m, APT *r) // r = q * m mod secp256k1.p
+void bnz_reverse_digits(bnz_t *a) // reverse the order of the bytes in a->digits
 {
-    size_t i, bits = 8 * m->size;
+    uint8_t tmp;
+    size_t i = 0, j = a->size - 1;
 
-    APT qq;
-    
-    bnz_init(&qq.x);
-    bnz_init(&qq.y);
+    while (i < j) {
+        tmp = a->digits[i];
+        a->digits[i] = a->digits[j];
+        a->digits[j] = tmp;
+        i++;
+        j--;
+    }
+}
 
-    bnz_set_bnz(&qq.x, &q->x);
-    bnz_set_bnz(&qq.y, &q->y);
+void bnz_shift_r(bnz_t *a, uint32_t sh) // shift the bits in a->digits to the right by sh bits, adding 0 value bits to msb end
+{
+    size_t i;
 
-    bnz_set_i32(&r->x, 0);
-    bnz_set_i32(&r->y, 0);
+    if (sh < 1 || sh > 7 || a->size < 1) return;
 
-    for (i = 0; i < bits; i++) {
-        if (bnz_bit_set(m, i) == true) {
-            secp256k1_point_addition(secp256k1, &qq, r, r);
-        }
-        secp256k1_point_doubling(secp256k1, &qq, &qq);
+    for (i = 0; i < a->size - 1; i++) {
+        a->digits[i] = (a->digits[i] >> sh) | (a->digits[i + 1] << (8 - sh));
     }
-
-    bnz_free(&qq.x);
-    bnz_free(&qq.y);
+    a->digits[a->size - 1] >>= sh;
 }
 
-void get_affine_from_jacobian(const SECP256K1 secp256k1, const JPT *jpt, APT *apt)
+void bnz_shift_left(bnz_t *res, const bnz_t *a, uint32_t sh) // res = a * 2^sh, a whole 64 bit word of output at a time from the msb end, res may alias a
 {
-    bnz_t z_inv, z_inv_2, z_inv_3;
+    size_t q = sh / 8, len = a->size, new_size = len + q + 1, n;
+    uint32_t r = sh % 8;
+    uint8_t sign = a->sign;
+    uint64_t w;
+    int64_t o;
 
-    bnz_init(&z_inv);
-    bnz_init(&z_inv_2);
-    bnz_init(&z_inv_3);
+    BNZ_STATS_CALL(a->size);
 
-    bnz_modular_multiplicative_inverse(&z_inv, &jpt->z, &secp256k1.p); // z_inv = modular_multiplicative_inverse(jpt.z)
-    bnz_mod_bnz(&z_inv, &z_inv, &secp256k1.p);
-    bnz_multiply_bnz(&z_inv_2, &z_inv, &z_inv); // z_inv_2 = z_inv^2
-    bnz_mod_bnz(&z_inv_2, &z_inv_2, &secp256k1.p);
-    bnz_multiply_bnz(&z_inv_3, &z_inv_2, &z_inv); // z_inv_3 = z_inv^3
-    bnz_mod_bnz(&z_inv_3, &z_inv_3, &secp256k1.p);
+    if (bnz_is_zero(a) == true) {
+        bnz_set_i32(res, 0);
+        return;
+    }
 
-    bnz_multiply_bnz(&apt->x, &jpt->x, &z_inv_2); // apt.x = jpt.x / jpt.z^2
-    bnz_mod_bnz(&apt->x, &apt->x, &secp256k1.p);
+    bnz_resize(res, new_size, res == a); // in place, the bytes of a are kept at the bottom of the resized digits
+    if (res != a) bnz_bytes_copied += len;
 
-    bnz_multiply_bnz(&apt->y, &jpt->y, &z_inv_3); // apt.y = jpt.y / jpt.z^3
-    bnz_mod_bnz(&apt->y, &apt->y, &secp256k1.p);
+    for (o = 8 * (((int64_t)new_size - 1) / 8); o >= 0; o -= 8) { // each output word only reads input bytes at or below its own position, so working down from the msb end is safe in place
+        w = get_word_uint8_arr(a->digits, len, o - (int64_t)q) << r;
+        if (r > 0) w |= (get_word_uint8_arr(a->digits, len, o - (int64_t)q - 1) & 255) >> (8 - r); // top r bits of the byte below
+        n = new_size - (size_t)o < 8 ? new_size - (size_t)o : 8;
+        memcpy(res->digits + o, &w, n);
+    }
 
-    bnz_free(&z_inv);
-    bnz_free(&z_inv_2);
-    bnz_free(&z_inv_3);
+    res->sign = sign;
+    bnz_trim(res); // delete any leading zeros from the msb end
 }
 
-void secp256k1_jacobian_point_addition(const SECP256K1 secp256k1, const JPT *p, const APT *q, JPT *r) // r = (p + q) mod secp256k1.p
+void bnz_shift_right(bnz_t *res, const bnz_t *a, uint32_t sh) // res = a / 2^sh rounded toward zero (sign and magnitude, so |res| = |a| >> sh), a whole 64 bit word of output at a time from the lsb end, res may alias a
 {
-    /*
-    The "madd-2004-hmv" addition formulas:
-    Assumptions: Z2=1.
-    Cost: 8M + 3S + 6add + 1*2.
-    Source: 2004 Hankerson Menezes Vanstone, page 91.
-    Explicit formulas:
-        T1 = Z1^2
-        T2 = T1*Z1
-        T1 = T1*X2
-        T2 = T2*Y2
-        T1 = T1-X1
-        T2 = T2-Y1
-        Z3 = Z1*T1
-        T3 = T1^2
-        T4 = T3*T1
-        T3 = T3*X1
-        T1 = 2*T3
-        X3 = T2^2
-        X3 = X3-T1
-        X3 = X3-T4
-        T3 = T3-X3
-        T3 = T3*T2
-        T4 = T4*Y1
-        Y3 = T3-T4
-    */
+    size_t q = sh / 8, len = a->size, new_size, n, o;
+    uint32_t r = sh % 8;
+    uint8_t sign = a->sign;
+    uint64_t w;
 
-    bnz_t t1, t2, t3, t4;
-
-    bnz_init(&t1);
-    bnz_init(&t2);
-    bnz_init(&t3);
-    bnz_init(&t4);
-
-    if (bnz_is_zero(&p->x) == true && bnz_is_zero(&p->y) == true && bnz_is_zero(&p->z) == true ) { // if this is the first addition, set r.x = q.x, r.y = q.y and r.z = 1 and return
-        bnz_set_bnz(&r->x, &q->x);
-        bnz_set_bnz(&r->y, &q->y);
-        bnz_set_i32(&r->z, 1);
-        bnz_free(&t1);
-        bnz_free(&t2);
-        bnz_free(&t3);
-        bnz_free(&t4);
+    BNZ_STATS_CALL(a->size);
+
+    if (q >= len) {
+        bnz_set_i32(res, 0);
         return;
     }
+    new_size = len - q;
 
-    bnz_multiply_bnz(&t1, &p->z, &p->z); // T1 = Z1^2
-    bnz_mod_bnz(&t1, &t1, &secp256k1.p);
-    bnz_multiply_bnz(&t2, &t1, &p->z); // T2 = T1*Z1
-    bnz_mod_bnz(&t2, &t2, &secp256k1.p);
-    bnz_multiply_bnz(&t1, &t1, &q->x); // T1 = T1*X2
-    bnz_mod_bnz(&t1, &t1, &secp256k1.p);
-    bnz_multiply_bnz(&t2, &t2, &q->y); // T2 = T2*Y2
-    bnz_mod_bnz(&t2, &t2, &secp256k1.p);
-    bnz_subtract_bnz(&t1, &t1, &p->x); // T1 = T1-X1
-    bnz_mod_bnz(&t1, &t1, &secp256k1.p);
-    bnz_subtract_bnz(&t2, &t2, &p->y); // T2 = T2-Y1
-    bnz_mod_bnz(&t2, &t2, &secp256k1.p);
-    bnz_multiply_bnz(&r->z, &p->z, &t1); // Z3 = Z1*T1
-    bnz_mod_bnz(&r->z, &r->z, &secp256k1.p);
-    bnz_multiply_bnz(&t3, &t1, &t1); // T3 = T1^2
-    bnz_mod_bnz(&t3, &t3, &secp256k1.p);
-    bnz_multiply_bnz(&t4, &t3, &t1); // T4 = T3*T1
-    bnz_mod_bnz(&t4, &t4, &secp256k1.p);
-    bnz_multiply_bnz(&t3, &t3, &p->x); // T3 = T3*X1
-    bnz_mod_bnz(&t3, &t3, &secp256k1.p);
-    bnz_multiply_i32(&t1, &t3, 2); // T1 = 2*T3
-    bnz_mod_bnz(&t1, &t1, &secp256k1.p);
-    bnz_multiply_bnz(&r->x, &t2, &t2); // X3 = T2^2
-    bnz_mod_bnz(&r->x, &r->x, &secp256k1.p);
-    bnz_subtract_bnz(&r->x, &r->x, &t1); // X3 = X3-T1
-    bnz_mod_bnz(&r->x, &r->x, &secp256k1.p);
-    bnz_subtract_bnz(&r->x, &r->x, &t4); // X3 = X3-T4
-    bnz_mod_bnz(&r->x, &r->x, &secp256k1.p);
-    bnz_subtract_bnz(&t3, &t3, &r->x); // T3 = T3-X3
-    bnz_mod_bnz(&t3, &t3, &secp256k1.p);
-    bnz_multiply_bnz(&t3, &t3, &t2); // T3 = T3*T2
-    bnz_mod_bnz(&t3, &t3, &secp256k1.p);
-    bnz_multiply_bnz(&t4, &t4, &p->y); // T4 = T4*Y1
-    bnz_mod_bnz(&t4, &t4, &secp256k1.p);
-    bnz_subtract_bnz(&r->y, &t3, &t4); // Y3 = T3-T4
-    bnz_mod_bnz(&r->y, &r->y, &secp256k1.p);
-
-    bnz_free(&t1);
-    bnz_free(&t2);
-    bnz_free(&t3);
-    bnz_free(&t4);
-}
-
-void secp256k1_jacobian_scalar_multiplication(const SECP256K1 secp256k1, const bnz_t *m, APT *r) // r = (secp256k1.G * m) mod secp256k1.p
-{
-    size_t i, bits = 8 * m->size;
-
-    JPT tmp; // running total
-
-    bnz_init(&tmp.x);
-    bnz_init(&tmp.y);
-    bnz_init(&tmp.z);
+    if (res != a) {
+        bnz_resize(res, new_size, false);
+        bnz_bytes_copied += new_size;
+    }
 
-    for (i = 0; i < bits; i++) { // from lsb to msb
-        if (bnz_bit_set(m, i) == true) {
-            secp256k1_jacobian_point_addition(secp256k1, &tmp, &secp256k1.G_doublings_mod_p[i], &tmp); // if the current bit is set, add the corresponding Secp256k1 doubling value to the running total
-        }
+    for (o = 0; o < new_size; o += 8) { // each output word only reads input bytes at or above its own position, so working up from the lsb end is safe in place
+        w = get_word_uint8_arr(a->digits, len, (int64_t)(o + q)) >> r;
+        if (r > 0) w |= (get_word_uint8_arr(a->digits, len, (int64_t)(o + q + 8)) & 255) << (64 - r); // bottom r bits of the byte above
+        n = new_size - o < 8 ? new_size - o : 8;
+        memcpy(res->digits + o, &w, n);
     }
-    get_affine_from_jacobian(secp256k1, &tmp, r); // convert final JPT into the corresponding APT via the formulae: APT.x = JPT.x / JPT.z^2 and APT.y = JPT.y / JPT.z^3
 
-    bnz_free(&tmp.x); // free resources
-    bnz_free(&tmp.y);
-    bnz_free(&tmp.z);
+    if (res == a) bnz_resize(res, new_size, true);
+    res->sign = sign;
+    bnz_trim(res); // delete any leading zeros from the msb end
+    if (bnz_is_zero(res) == true) res->sign = 0;
 }
 
-bool secp256k1_valid_point(const SECP256K1 secp256k1, const APT apt) // check that a given xy point is on Secp256k1 by confirming that y^2 mod Secp256k1.p = x^3 + 7 mod Secp256k1.p
+void bnz_trim(bnz_t *a) // trim 0 value bytes from msb end of a->digits
 {
-    int32_t cmp;
-    bnz_t lhs, rhs; // left hand side and right hand side of the equation
-
-    bnz_init(&lhs); // initiate lhs and rhs
-    bnz_init(&rhs);
-
-    bnz_multiply_bnz(&lhs, &apt.y, &apt.y); // lhs = y^2
-    bnz_mod_bnz(&lhs, &lhs, &secp256k1.p); // lhs = y^2 mod Secp256k1.p
-
-    bnz_multiply_bnz(&rhs, &apt.x, &apt.x); // rhs = x^2
-    bnz_multiply_bnz(&rhs, &rhs, &apt.x); // rhs = x^3
-    bnz_add_i32(&rhs, &rhs, 7); // rhs = x^3 + 7
-    bnz_mod_bnz(&rhs, &rhs, &secp256k1.p); // rhs = x^3 + 7 mod Secp256k1.p
-
-    cmp = bnz_cmp_bnz(&lhs, &rhs); // compare lhs and rhs
-
-    bnz_free(&lhs); // free resources
-    bnz_free(&rhs);
+    size_t new_size = a->size;
 
-    if (cmp == 0) { // lhs == rhs
-        return true;
-    } else { // lhs != rhs
-        return false;
+    while (new_size > 0 && a->digits[new_size - 1] == 0) {
+        new_size--;
     }
+
+    bnz_resize(a, new_size, true);
 }
 
-/* BITCOIN GLOBAL VARIABLES */
+void bnz_print(const bnz_t *a, int32_t base, const char *txt) // print a in a given base, preceded by optional string txt
+{
+    char hex[256];
+    uint32_t i, j;
+    bnz_t tmp;
 
-const char bip39_wds[2048][9] = {"abandon", "ability", "able", "about", "above", "absent", "absorb", "abstract", "absurd", "abuse", "access", "accident", "account", "accuse", "achieve", "acid", "acoustic", "acquire", "across", "act", "action", "actor", "actress", "actual", "adapt", "add", "addict", "address", "adjust", "admit", "adult", "advance", "advice", "aerobic", "affair", "afford", "afraid", "again", "age", "agent", "agree", "ahead", "aim", "air", "airport", "aisle", "alarm", "album", "alcohol", "alert", "alien", "all", "alley", "allow", "almost", "alone", "alpha", "already", "also", "alter", "always", "amateur", "amazing", "among", "amount", "amused", "analyst", "anchor", "ancient", "anger", "angle", "angry", "animal", "ankle", "announce", "annual", "another", "answer", "antenna", "antique", "anxiety", "any", "apart", "apology", "appear", "apple", "approve", "april", "arch", "arctic", "area", "arena", "argue", "arm", "armed", "armor", "army", "around", "arrange", "arrest", "arrive", "arrow", "art", "artefact", "artist", "artwork", "ask", "aspect", "assault", "asset", "assist", "assume", "asthma", "athlete", "atom", "attack", "attend", "attitude", "attract", "auction", "audit", "august", "aunt", "author", "auto", "autumn", "average", "avocado", "avoid", "awake", "aware", "away", "awesome", "awful", "awkward", "axis", "baby", "bachelor", "bacon", "badge", "bag", "balance", "balcony", "ball", "bamboo", "banana", "banner", "bar", "barely", "bargain", "barrel", "base", "basic", "basket", "battle", "beach", "bean", "beauty", "because", "become", "beef", "before", "begin", "behave", "behind", "believe", "below", "belt", "bench", "benefit", "best", "betray", "better", "between", "beyond", "bicycle", "bid", "bike", "bind", "biology", "bird", "birth", "bitter", "black", "blade", "blame", "blanket", "blast", "bleak", "bless", "blind", "blood", "blossom", "blouse", "blue", "blur", "blush", "board", "boat", "body", "boil", "bomb", "bone", "bonus", "book", "boost", "border", "boring", "borrow", "boss", "bottom", "bounce", "box", "boy", "bracket", "brain", "brand", "brass", "brave", "bread", "breeze", "brick", "bridge", "brief", "bright", "bring", "brisk", "broccoli", "broken", "bronze", "broom", "brother", "brown", "brush", "bubble", "buddy", "budget", "buffalo", "build", "bulb", "bulk", "bullet", "bundle", "bunker", "burden", "burger", "burst", "bus", "business", "busy", "butter", "buyer", "buzz", "cabbage", "cabin", "cable", "cactus", "cage", "cake", "call", "calm", "camera", "camp", "can", "canal", "cancel", "candy", "cannon", "canoe", "canvas", "canyon", "capable", "capital", "captain", "car", "carbon", "card", "cargo", "carpet", "carry", "cart", "case", "cash", "casino", "castle", "casual", "cat", "catalog", "catch", "category", "cattle", "caught", "cause", "caution", "cave", "ceiling", "celery", "cement", "census", "century", "cereal", "certain", "chair", "chalk", "champion", "change", "chaos", "chapter", "charge", "chase", "chat", "cheap", "check", "cheese", "chef", "cherry", "chest", "chicken", "chief", "child", "chimney", "choice", "choose", "chronic", "chuckle", "chunk", "churn", "cigar", "cinnamon", "circle", "citizen", "city", "civil", "claim", "clap", "clarify", "claw", "clay", "clean", "clerk", "clever", "click", "client", "cliff", "climb", "clinic", "clip", "clock", "clog", "close", "cloth", "cloud", "clown", "club", "clump", "cluster", "clutch", "coach", "coast", "coconut", "code", "coffee", "coil", "coin", "collect", "color", "column", "combine", "come", "comfort", "comic", "common", "company", "concert", "conduct", "confirm", "congress", "connect", "consider", "control", "convince", "cook", "cool", "copper", "copy", "coral", "core", "corn", "correct", "cost", "cotton", "couch", "country", "couple", "course", "cousin", "cover", "coyote", "crack", "cradle", "craft", "cram", "crane", "crash", "crater", "crawl", "crazy", "cream", "credit", "creek", "crew", "cricket", "crime", "crisp", "critic", "crop", "cross", "crouch", "crowd", "crucial", "cruel", "cruise", "crumble", "crunch", "crush", "cry", "crystal", "cube", "culture", "cup", "cupboard", "curious", "current", "curtain", "curve", "cushion", "custom", "cute", "cycle", "dad", "damage", "damp", "dance", "danger", "daring", "dash", "daughter", "dawn", "day", "deal", "debate", "debris", "decade", "december", "decide", "decline", "decorate", "decrease", "deer", "defense", "define", "defy", "degree", "delay", "deliver", "demand", "demise", "denial", "dentist", "deny", "depart", "depend", "deposit", "depth", "deputy", "derive", "describe", "desert", "design", "desk", "despair", "destroy", "detail", "detect", "develop", "device", "devote", "diagram", "dial", "diamond", "diary", "dice", "diesel", "diet", "differ", "digital", "dignity", "dilemma", "dinner", "dinosaur", "direct", "dirt", "disagree", "discover", "disease", "dish", "dismiss", "disorder", "display", "distance", "divert", "divide", "divorce", "dizzy", "doctor", "document", "dog", "doll", "dolphin", "domain", "donate", "donkey", "donor", "door", "dose", "double", "dove", "draft", "dragon", "drama", "drastic", "draw", "dream", "dress", "drift", "drill", "drink", "drip", "drive", "drop", "drum", "dry", "duck", "dumb", "dune", "during", "dust", "dutch", "duty", "dwarf", "dynamic", "eager", "eagle", "early", "earn", "earth", "easily", "east", "easy", "echo", "ecology", "economy", "edge", "edit", "educate", "effort", "egg", "eight", "either", "elbow", "elder", "electric", "elegant", "element", "elephant", "elevator", "elite", "else", "embark", "embody", "embrace", "emerge", "emotion", "employ", "empower", "empty", "enable", "enact", "end", "endless", "endorse", "enemy", "energy", "enforce", "engage", "engine", "enhance", "enjoy", "enlist", "enough", "enrich", "enroll", "ensure", "enter", "entire", "entry", "envelope", "episode", "equal", "equip", "era", "erase", "erode", "erosion", "error", "erupt", "escape", "essay", "essence", "estate", "eternal", "ethics", "evidence", "evil", "evoke", "evolve", "exact", "example", "excess", "exchange", "excite", "exclude", "excuse", "execute", "exercise", "exhaust", "exhibit", "exile", "exist", "exit", "exotic", "expand", "expect", "expire", "explain", "expose", "express", "extend", "extra", "eye", "eyebrow", "fabric", "face", "faculty", "fade", "faint", "faith", "fall", "false", "fame", "family", "famous", "fan", "fancy", "fantasy", "farm", "fashion", "fat", "fatal", "father", "fatigue", "fault", "favorite", "feature", "february", "federal", "fee", "feed", "feel", "female", "fence", "festival", "fetch", "fever", "few", "fiber", "fiction", "field", "figure", "file", "film", "filter", "final", "find", "fine", "finger", "finish", "fire", "firm", "first", "fiscal", "fish", "fit", "fitness", "fix", "flag", "flame", "flash", "flat", "flavor", "flee", "flight", "flip", "float", "flock", "floor", "flower", "fluid", "flush", "fly", "foam", "focus", "fog", "foil", "fold", "follow", "food", "foot", "force", "forest", "forget", "fork", "fortune", "forum", "forward", "fossil", "foster", "found", "fox", "fragile", "frame", "frequent", "fresh", "friend", "fringe", "frog", "front", "frost", "frown", "frozen", "fruit", "fuel", "fun", "funny", "furnace", "fury", "future", "gadget", "gain", "galaxy", "gallery", "game", "gap", "garage", "garbage", "garden", "garlic", "garment", "gas", "gasp", "gate", "gather", "gauge", "gaze", "general", "genius", "genre", "gentle", "genuine", "gesture", "ghost", "giant", "gift", "giggle", "ginger", "giraffe", "girl", "give", "glad", "glance", "glare", "glass", "glide", "glimpse", "globe", "gloom", "glory", "glove", "glow", "glue", "goat", "goddess", "gold", "good", "goose", "gorilla", "gospel", "gossip", "govern", "gown", "grab", "grace", "grain", "grant", "grape", "grass", "gravity", "great", "green", "grid", "grief", "grit", "grocery", "group", "grow", "grunt", "guard", "guess", "guide", "guilt", "guitar", "gun", "gym", "habit", "hair", "half", "hammer", "hamster", "hand", "happy", "harbor", "hard", "harsh", "harvest", "hat", "have", "hawk", "hazard", "head", "health", "heart", "heavy", "hedgehog", "height", "hello", "helmet", "help", "hen", "hero", "hidden", "high", "hill", "hint", "hip", "hire", "history", "hobby", "hockey", "hold", "hole", "holiday", "hollow", "home", "honey", "hood", "hope", "horn", "horror", "horse", "hospital", "host", "hotel", "hour", "hover", "hub", "huge", "human", "humble", "humor", "hundred", "hungry", "hunt", "hurdle", "hurry", "hurt", "husband", "hybrid", "ice", "icon", "idea", "identify", "idle", "ignore", "ill", "illegal", "illness", "image", "imitate", "immense", "immune", "impact", "impose", "improve", "impulse", "inch", "include", "income", "increase", "index", "indicate", "indoor", "industry", "infant", "inflict", "inform", "inhale", "inherit", "initial", "inject", "injury", "inmate", "inner", "innocent", "input", "inquiry", "insane", "insect", "inside", "inspire", "install", "intact", "interest", "into", "invest", "invite", "involve", "iron", "island", "isolate", "issue", "item", "ivory", "jacket", "jaguar", "jar", "jazz", "jealous", "jeans", "jelly", "jewel", "job", "join", "joke", "journey", "joy", "judge", "juice", "jump", "jungle", "junior", "junk", "just", "kangaroo", "keen", "keep", "ketchup", "key", "kick", "kid", "kidney", "kind", "kingdom", "kiss", "kit", "kitchen", "kite", "kitten", "kiwi", "knee", "knife", "knock", "know", "lab", "label", "labor", "ladder", "lady", "lake", "lamp", "language", "laptop", "large", "later", "latin", "laugh", "laundry", "lava", "law", "lawn", "lawsuit", "layer", "lazy", "leader", "leaf", "learn", "leave", "lecture", "left", "leg", "legal", "legend", "leisure", "lemon", "lend", "length", "lens", "leopard", "lesson", "letter", "level", "liar", "liberty", "library", "license", "life", "lift", "light", "like", "limb", "limit", "link", "lion", "liquid", "list", "little", "live", "lizard", "load", "loan", "lobster", "local", "lock", "logic", "lonely", "long", "loop", "lottery", "loud", "lounge", "love", "loyal", "lucky", "luggage", "lumber", "lunar", "lunch", "luxury", "lyrics", "machine", "mad", "magic", "magnet", "maid", "mail", "main", "major", "make", "mammal", "man", "manage", "mandate", "mango", "mansion", "manual", "maple", "marble", "march", "margin", "marine", "market", "marriage", "mask", "mass", "master", "match", "material", "math", "matrix", "matter", "maximum", "maze", "meadow", "mean", "measure", "meat", "mechanic", "medal", "media", "melody", "melt", "member", "memory", "mention", "menu", "mercy", "merge", "merit", "merry", "mesh", "message", "metal", "method", "middle", "midnight", "milk", "million", "mimic", "mind", "minimum", "minor", "minute", "miracle", "mirror", "misery", "miss", "mistake", "mix", "mixed", "mixture", "mobile", "model", "modify", "mom", "moment", "monitor", "monkey", "monster", "month", "moon", "moral", "more", "morning", "mosquito", "mother", "motion", "motor", "mountain", "mouse", "move", "movie", "much", "muffin", "mule", "multiply", "muscle", "museum", "mushroom", "music", "must", "mutual", "myself", "mystery", "myth", "naive", "name", "napkin", "narrow", "nasty", "nation", "nature", "near", "neck", "need", "negative", "neglect", "neither", "nephew", "nerve", "nest", "net", "network", "neutral", "never", "news", "next", "nice", "night", "noble", "noise", "nominee", "noodle", "normal", "north", "nose", "notable", "note", "nothing", "notice", "novel", "now", "nuclear", "number", "nurse", "nut", "oak", "obey", "object", "oblige", "obscure", "observe", "obtain", "obvious", "occur", "ocean", "october", "odor", "off", "offer", "office", "often", "oil", "okay", "old", "olive", "olympic", "omit", "once", "one", "onion", "online", "only", "open", "opera", "opinion", "oppose", "option", "orange", "orbit", "orchard", "order", "ordinary", "organ", "orient", "original", "orphan", "ostrich", "other", "outdoor", "outer", "output", "outside", "oval", "oven", "over", "own", "owner", "oxygen", "oyster", "ozone", "pact", "paddle", "page", "pair", "palace", "palm", "panda", "panel", "panic", "panther", "paper", "parade", "parent", "park", "parrot", "party", "pass", "patch", "path", "patient", "patrol", "pattern", "pause", "pave", "payment", "peace", "peanut", "pear", "peasant", "pelican", "pen", "penalty", "pencil", "people", "pepper", "perfect", "permit", "person", "pet", "phone", "photo", "phrase", "physical", "piano", "picnic", "picture", "piece", "pig", "pigeon", "pill", "pilot", "pink", "pioneer", "pipe", "pistol", "pitch", "pizza", "place", "planet", "plastic", "plate", "play", "please", "pledge", "pluck", "plug", "plunge", "poem", "poet", "point", "polar", "pole", "police", "pond", "pony", "pool", "popular", "portion", "position", "possible", "post", "potato", "pottery", "poverty", "powder", "power", "practice", "praise", "predict", "prefer", "prepare", "present", "pretty", "prevent", "price", "pride", "primary", "print", "priority", "prison", "private", "prize", "problem", "process", "produce", "profit", "program", "project", "promote", "proof", "property", "prosper", "protect", "proud", "provide", "public", "pudding", "pull", "pulp", "pulse", "pumpkin", "punch", "pupil", "puppy", "purchase", "purity", "purpose", "purse", "push", "put", "puzzle", "pyramid", "quality", "quantum", "quarter", "question", "quick", "quit", "quiz", "quote", "rabbit", "raccoon", "race", "rack", "radar", "radio", "rail", "rain", "raise", "rally", "ramp", "ranch", "random", "range", "rapid", "rare", "rate", "rather", "raven", "raw", "razor", "ready", "real", "reason", "rebel", "rebuild", "recall", "receive", "recipe", "record", "recycle", "reduce", "reflect", "reform", "refuse", "region", "regret", "regular", "reject", "relax", "release", "relief", "rely", "remain", "remember", "remind", "remove", "render", "renew", "rent", "reopen", "repair", "repeat", "replace", "report", "require", "rescue", "resemble", "resist", "resource", "response", "result", "retire", "retreat", "return", "reunion", "reveal", "review", "reward", "rhythm", "rib", "ribbon", "rice", "rich", "ride", "ridge", "rifle", "right", "rigid", "ring", "riot", "ripple", "risk", "ritual", "rival", "river", "road", "roast", "robot", "robust", "rocket", "romance", "roof", "rookie", "room", "rose", "rotate", "rough", "round", "route", "royal", "rubber", "rude", "rug", "rule", "run", "runway", "rural", "sad", "saddle", "sadness", "safe", "sail", "salad", "salmon", "salon", "salt", "salute", "same", "sample", "sand", "satisfy", "satoshi", "sauce", "sausage", "save", "say", "scale", "scan", "scare", "scatter", "scene", "scheme", "school", "science", "scissors", "scorpion", "scout", "scrap", "screen", "script", "scrub", "sea", "search", "season", "seat", "second", "secret", "section", "security", "seed", "seek", "segment", "select", "sell", "seminar", "senior", "sense", "sentence", "series", "service", "session", "settle", "setup", "seven", "shadow", "shaft", "shallow", "share", "shed", "shell", "sheriff", "shield", "shift", "shine", "ship", "shiver", "shock", "shoe", "shoot", "shop", "short", "shoulder", "shove", "shrimp", "shrug", "shuffle", "shy", "sibling", "sick", "side", "siege", "sight", "sign", "silent", "silk", "silly", "silver", "similar", "simple", "since", "sing", "siren", "sister", "situate", "six", "size", "skate", "sketch", "ski", "skill", "skin", "skirt", "skull", "slab", "slam", "sleep", "slender", "slice", "slide", "slight", "slim", "slogan", "slot", "slow", "slush", "small", "smart", "smile", "smoke", "smooth", "snack", "snake", "snap", "sniff", "snow", "soap", "soccer", "social", "sock", "soda", "soft", "solar", "soldier", "solid", "solution", "solve", "someone", "song", "soon", "sorry", "sort", "soul", "sound", "soup", "source", "south", "space", "spare", "spatial", "spawn", "speak", "special", "speed", "spell", "spend", "sphere", "spice", "spider", "spike", "spin", "spirit", "split", "spoil", "sponsor", "spoon", "sport", "spot", "spray", "spread", "spring", "spy", "square", "squeeze", "squirrel", "stable", "stadium", "staff", "stage", "stairs", "stamp", "stand", "start", "state", "stay", "steak", "steel", "stem", "step", "stereo", "stick", "still", "sting", "stock", "stomach", "stone", "stool", "story", "stove", "strategy", "street", "strike", "strong", "struggle", "student", "stuff", "stumble", "style", "subject", "submit", "subway", "success", "such", "sudden", "suffer", "sugar", "suggest", "suit", "summer", "sun", "sunny", "sunset", "super", "supply", "supreme", "sure", "surface", "surge", "surprise", "surround", "survey", "suspect", "sustain", "swallow", "swamp", "swap", "swarm", "swear", "sweet", "swift", "swim", "swing", "switch", "sword", "symbol", "symptom", "syrup", "system", "table", "tackle", "tag", "tail", "talent", "talk", "tank", "tape", "target", "task", "taste", "tattoo", "taxi", "teach", "team", "tell", "ten", "tenant", "tennis", "tent", "term", "test", "text", "thank", "that", "theme", "then", "theory", "there", "they", "thing", "this", "thought", "three", "thrive", "throw", "thumb", "thunder", "ticket", "tide", "tiger", "tilt", "timber", "time", "tiny", "tip", "tired", "tissue", "title", "toast", "tobacco", "today", "toddler", "toe", "together", "toilet", "token", "tomato", "tomorrow", "tone", "tongue", "tonight", "tool", "tooth", "top", "topic", "topple", "torch", "tornado", "tortoise", "toss", "total", "tourist", "toward", "tower", "town", "toy", "track", "trade", "traffic", "tragic", "train", "transfer", "trap", "trash", "travel", "tray", "treat", "tree", "trend", "trial", "tribe", "trick", "trigger", "trim", "trip", "trophy", "trouble", "truck", "true", "truly", "trumpet", "trust", "truth", "try", "tube", "tuition", "tumble", "tuna", "tunnel", "turkey", "turn", "turtle", "twelve", "twenty", "twice", "twin", "twist", "two", "type", "typical", "ugly", "umbrella", "unable", "unaware", "uncle", "uncover", "under", "undo", "unfair", "unfold", "unhappy", "uniform", "unique", "unit", "universe", "unknown", "unlock", "until", "unusual", "unveil", "update", "upgrade", "uphold", "upon", "upper", "upset", "urban", "urge", "usage", "use", "used", "useful", "useless", "usual", "utility", "vacant", "vacuum", "vague", "valid", "valley", "valve", "van", "vanish", "vapor", "various", "vast", "vault", "vehicle", "velvet", "vendor", "venture", "venue", "verb", "verify", "version", "very", "vessel", "veteran", "viable", "vibrant", "vicious", "victory", "video", "view", "village", "vintage", "violin", "virtual", "virus", "visa", "visit", "visual", "vital", "vivid", "vocal", "voice", "void", "volcano", "volume", "vote", "voyage", "wage", "wagon", "wait", "walk", "wall", "walnut", "want", "warfare", "warm", "warrior", "wash", "wasp", "waste", "water", "wave", "way", "wealth", "weapon", "wear", "weasel", "weather", "web", "wedding", "weekend", "weird", "welcome", "west", "wet", "whale", "what", "wheat", "wheel", "when", "where", "whip", "whisper", "wide", "width", "wife", "wild", "will", "win", "window", "wine", "wing", "wink", "winner", "winter", "wire", "wisdom", "wise", "wish", "witness", "wolf", "woman", "wonder", "wood", "wool", "word", "work", "world", "worry", "worth", "wrap", "wreck", "wrestle", "wrist", "write", "wrong", "yard", "year", "yellow", "you", "young", "youth", "zebra", "zero", "zone", "zoo"};
+    bnz_init(&tmp);
 
-/* BITCOIN FUNCTIONS */
+    bnz_set_bnz(&tmp, a);
 
-void get_ripemd160(bnz_t *, const uint8_t *);
-void get_sha256(bnz_t *, const uint8_t *);
-void get_sha512(bnz_t *, const uint8_t *);
-void get_ripemd160_sha256(bnz_t *, const bnz_t *, size_t);
-void get_sha256_sha256(bnz_t *, const bnz_t *, size_t);
-bool is_valid_private_key(const SECP256K1, const bnz_t *);
-void bnz_256_bit_rnd(bnz_t *);
-void entropy_checksum(bnz_t *);
-void get_bip39_word_ids_bnz(bnz_t *, uint32_t *);
-void get_bip39_word_ids_str(bnz_t *, bnz_t *, uint8_t *, char *);
+    bnz_reverse_digits(&tmp);
+
+    switch (base) {
+        case -2: // binary with spaces between bytes
+            printf("%s", txt);
+            if (bnz_is_zero(&tmp) == true) {
+                printf("0\n");
+            } else {
+                if (tmp.sign) printf("-");
+                for (i = 0; i < tmp.size; i++) { // traverse bytes
+                    for (j = 0; j < 8; j++) { // divide each byte into 8 bits
+                        printf("%d", (tmp.digits[i] >> (7 - j)) & 1);
+                    }
+                    printf(" "); // add space between each byte
+                }
+                printf("\n");
+            }
+            break;
+        case 2: // binary
+            printf("%s", txt);
+            if (bnz_is_zero(&tmp) == true) {
+                printf("0\n");
+            } else {
+                if (tmp.sign) printf("-");
+                for (i = 0; i < tmp.size; i++) { // traverse bytes
+                    for (j = 0; j < 8; j++) { // divide each byte into 8 bits
+                        printf("%d", (tmp.digits[i] >> (7 - j)) & 1);
+                    }
+                }
+                printf("\n");
+            }
+            break;
+        case -16: // hex, upper case, without "0x" prefix, same as default for 0 to F
+            printf("%s", txt);
+            if (bnz_is_zero(&tmp) == true) {
+                printf("0\n");
+            } else {
+                if (tmp.sign) printf("-");
+                bnz_write_base_n(a, 16, "0123456789ABCDEF", bnz_sink_stdout, NULL); // digits are written as they are produced
+                printf("\n");
+            }
+            break;
+        case 16: // hex, lower case with "0x" prefix
+            printf("%s", txt);
+            if (bnz_is_zero(&tmp) == true) {
+                printf("0x0\n");
+            } else {
+                if (tmp.sign) printf("-");
+                printf("0x");
+                for (i = 0; i < tmp.size; i += sizeof(hex) / 2) { // whole keys and hashes in one piece
+                    j = tmp.size - i < sizeof(hex) / 2 ? tmp.size - i : sizeof(hex) / 2;
+                    hex_encode_uint8_arr(hex, tmp.digits + i, j);
+                    fwrite(hex, 1, 2 * j, stdout);
+                }
+                printf("\n");
+            }
+            break;
+        case -32: // standard base 32
+            printf("%s", txt);
+            if (bnz_is_zero(&tmp) == true) {
+                printf("0\n");
+            } else {
+                if (tmp.sign) printf("-");
+                bnz_write_base_n(a, 32, "0123456789ABCDEFGHIJKLMNOPQRSTUV", bnz_sink_stdout, NULL); // digits are written as they are produced
+                printf("\n");
+            }
+            break;
+        case 32: // bech32
+            printf("%s", txt);
+            if (bnz_is_zero(&tmp) == true) {
+                printf("q\n");
+            } else {
+                if (tmp.sign) printf("-");
+                bnz_write_base_n(a, 32, "qpzry9x8gf2tvdw0s3jn54khce6mua7l", bnz_sink_stdout, NULL); // digits are written as they are produced
+                printf("\n");
+            }
+            break;
+        case -58: // standard base 58
+            printf("%s", txt);
+            if (bnz_is_zero(&tmp) == true) {
+                printf("0\n");
+            } else {
+                if (tmp.sign) printf("-");
+                bnz_write_base_n(a, 58, "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuv", bnz_sink_stdout, NULL); // digits are written as they are produced
+                printf("\n");
+            }
+            break;
+        case 58: // bitcoin base 58
+            printf("%s", txt);
+            if (bnz_is_zero(&tmp) == true) {
+                printf("1\n");
+            } else {
+                if (tmp.sign) printf("-");
+                bnz_write_base_n(a, 58, "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz", bnz_sink_stdout, NULL); // digits are written as they are produced
+                printf("\n");
+            }
+            break;
+        case 64:
+            printf("%s", txt);
+            if (bnz_is_zero(&tmp) == true) {
+                printf("A\n");
+            } else {
+                if (tmp.sign) printf("-");
+                bnz_write_base_n(a, 64, "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/", bnz_sink_stdout, NULL); // digits are written as they are produced
+                printf("\n");
+            }
+            break;
+        case 256: // individual byte values, base 10, separated by ", "
+            printf("%s", txt);
+            if (bnz_is_zero(&tmp) == true) {
+                printf("0\n");
+            } else {
+                if (tmp.sign) printf("-");
+                printf("%d", tmp.digits[0]);
+                for (i = 1; i < tmp.size; i++) {
+                    printf(", %d", tmp.digits[i]);
+                }
+                printf("\n");
+            }
+            break;
+        default: // default for 2 to 63
+            printf("%s", txt);
+            if (bnz_is_zero(&tmp) == true) {
+                printf("0\n");
+            } else {
+                if (base >= 2 && base <= 63) {
+                    if (tmp.sign) printf("-");
+                    bnz_write_base_n(a, base, "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz_", bnz_sink_stdout, NULL); // digits are written as they are produced
+                    printf("\n");
+                }
+            }
+            break;
+    }
+
+    bnz_free(&tmp);
+}
+
+void bnz_free(bnz_t *a) // free bnz_t resources
+{
+    if (a->capacity > BNZ_INLINE_BYTES) free(a->digits); // a heap block, the capacity is tested rather than the pointer so that by value copies such as the SECP256K1 parameters are handled
+    bnz_init(a);
+}
+
+int8_t get_digit(const char *str, size_t idx, uint8_t base) // return numerical value of char at index idx of str which represents a number in the given base and in big endian order
+{
+    int8_t dgt = -1;
+
+    switch (base) {
+        case 16:
+            dgt = char_16[str[idx]];
+            break;
+        case 32:
+            dgt = char_32[str[idx]];
+            break;
+        case 58:
+            dgt = char_58[str[idx]];
+            break;
+        case 64:
+            dgt = char_64[str[idx]];
+            break;
+        default:
+            if (base >= 2 && base <= 63) dgt = char_d[str[idx]];
+            break;
+    }
+
+    if (dgt < 0 || dgt >= base) return -1;
+
+    return dgt;
+}
+
+uint8_t *get_base_n_str(const bnz_t *a, uint32_t base, const char *alpha, uint32_t *len) // return a null terminated string representing a->digits in given base, big endian order, written straight into its buffer by radix_put_uint64_arr
+{
+    uint8_t *base_n_str = NULL, *pos;
+    uint64_t *limbs = NULL;
+    size_t i, n = bnz_limb_count(a);
+    radix_ctx ctx;
+
+    (*len) = (a->size * log10((double)256)) / log10((double)abs(base)) + 1;
+
+    base_n_str = init_uint8_array((*len) + 1);
+    if (!base_n_str) {
+        return NULL;
+    }
+
+    if (!radix_ctx_init(&ctx, base, (*len), true)) {
+        free(base_n_str);
+        return NULL;
+    }
+
+    limbs = bnz_scratch_alloc(n);
+    if (!limbs) {
+        radix_ctx_free(&ctx);
+        free(base_n_str);
+        return NULL;
+    }
+
+    for (i = 0; i < a->size; i++) { // load a->digits, big endian order, into little endian limbs
+        limbs[i / 8] |= (uint64_t)a->digits[a->size - 1 - i] << (8 * (i % 8));
+    }
+
+    pos = base_n_str;
+    ctx.alpha = alpha;
+    ctx.sink = bnz_sink_buffer;
+    ctx.arg = &pos;
+    if (!radix_put_uint64_arr(&ctx, limbs, n, (*len))) {
+        bnz_scratch_free(limbs);
+        radix_ctx_free(&ctx);
+        free(base_n_str);
+        return NULL;
+    }
+    (*len) = ctx.count; // leading zeros were never written, so no trimmed copy is needed
+
+    bnz_scratch_free(limbs);
+    radix_ctx_free(&ctx);
+
+    return base_n_str;
+}
+
+uint8_t *get_base_n_str_bytewise(const bnz_t *a, uint32_t base, const char *alpha, uint32_t *len) // reference version of get_base_n_str, multiplying the whole digit string by 256 for each byte of a, quadratic in the digit count
+{
+    uint8_t *base_n_str = NULL;
+    size_t i, j, k;
+
+    (*len) = (a->size * log10((double)256)) / log10((double)abs(base)) + 1;
+
+    base_n_str = init_uint8_array((*len) + 1);
+    if (!base_n_str) {
+        return NULL;
+    }
+
+    for (i = 0; i < a->size; i++) {
+        k = a->digits[i];
+        for (j = (*len); j > 0; j--) {
+            k += (uint32_t)base_n_str[j - 1] * 256;
+            base_n_str[j - 1] = (uint8_t)(k % abs(base));
+            k /= abs(base);
+        }
+    }
+
+    return get_base_n_str_trim(base_n_str, alpha, len);
+}
+
+uint8_t *get_base_n_str_trim(uint8_t *base_n_str, const char *alpha, uint32_t *len) // trim the zero digits at the msb end of the len digit values in base_n_str, which is freed, and return them mapped through alpha as a null terminated string, updating len
+{
+    uint8_t *base_n_str_trimmed = NULL;
+    size_t i, trim = 0;
+
+    while (trim < (*len) && base_n_str[trim] == 0) { // trim leading zeros at msb end, alpha[0] is 'q' for Bech32, '1' for Bitcoin base 58 and 'A' for base 64
+        trim++;
+    }
+    (*len) -= trim;
+
+    base_n_str_trimmed = init_uint8_array((*len) + 1);
+    if (!base_n_str_trimmed) {
+        free(base_n_str);
+        return NULL;
+    }
+
+    for (i = 0; i < (*len); i++) {
+        base_n_str_trimmed[i] = alpha[base_n_str[i + trim]];
+    }
+
+    free(base_n_str);
+    return base_n_str_trimmed;
+}
+
+size_t radix_limbs(size_t digits, uint32_t base) // number of limbs that can hold any number of the given number of digits in base
+{
+    return (size_t)(digits * log2((double)base) / 64) + 2;
+}
+
+bool radix_ctx_init(radix_ctx *ctx, uint32_t base, size_t digits, bool divide) // prepare the powers of base used to convert numbers of up to digits digits, with the reciprocals needed to divide by them if divide is true, no powers are needed below RADIX_DC_LIMBS limbs, return false if an allocation fails
+{
+    uint64_t *num = NULL, *rem = NULL;
+    size_t i, len;
+
+    memset(ctx, 0, sizeof(radix_ctx));
+    ctx->base = base;
+    ctx->chunk = base;
+    ctx->k = 1;
+    while (ctx->chunk <= UINT64_MAX / base) { // chunk = base^k, e.g. 58^10 for base 58
+        ctx->chunk *= base;
+        ctx->k++;
+    }
+
+    if ((base & (base - 1)) == 0) { // bit slicing needs no powers
+        ctx->bits = __builtin_ctz(base);
+        return true;
+    }
+
+    if (radix_limbs(digits, base) < RADIX_DC_LIMBS) return true;
+
+    for (i = 0; i < RADIX_MAX_LEVELS && (i == 0 || ((size_t)ctx->k << i) <= digits); i++) { // pow[i] = pow[i - 1]^2 while it has no more digits than the largest number
+        if (i == 0) {
+            ctx->pow[0] = bnz_scratch_alloc(1);
+            if (!ctx->pow[0]) break;
+            ctx->pow[0][0] = ctx->chunk;
+            ctx->pow_len[0] = 1;
+        } else {
+            len = 2 * ctx->pow_len[i - 1];
+            ctx->pow[i] = bnz_scratch_alloc(len);
+            if (!ctx->pow[i]) break;
+            mul_fast_uint64_arr(ctx->pow[i], ctx->pow[i - 1], ctx->pow_len[i - 1], ctx->pow[i - 1], ctx->pow_len[i - 1]);
+            if (ctx->pow[i][len - 1] == 0) len--;
+            ctx->pow_len[i] = len;
+        }
+        ctx->levels = i + 1;
+
+        if (divide == false || 2 * ctx->pow_len[i] < RADIX_DC_LIMBS) continue; // only powers of at least half of RADIX_DC_LIMBS limbs are divided by
+
+        len = ctx->pow_len[i];
+        ctx->mu[i] = bnz_scratch_alloc(len + 2);
+        if (!ctx->mu[i]) break;
+        if (i > 0 && ctx->mu[i - 1]) {
+            reciprocal_square_uint64_arr(ctx->mu[i], ctx->mu[i - 1], ctx->pow_len[i - 1], ctx->pow[i], len);
+        } else { // the first reciprocal, by a single division
+            num = bnz_scratch_alloc(2 * len + 1 + len);
+            if (!num) break;
+            rem = num + 2 * len + 1;
+            num[2 * len] = 1;
+            divide_uint64_arr(ctx->mu[i], rem, num, 2 * len + 1, ctx->pow[i], len);
+            bnz_scratch_free(num);
+        }
+    }
+
+    if (i < RADIX_MAX_LEVELS && (i == 0 || ((size_t)ctx->k << i) <= digits)) { // an allocation failed
+        radix_ctx_free(ctx);
+        return false;
+    }
+
+    return true;
+}
+
+void radix_ctx_free(radix_ctx *ctx) // release the powers and reciprocals of a radix_ctx, in the reverse order of their allocation
+{
+    size_t i;
+
+    for (i = RADIX_MAX_LEVELS; i > 0; i--) {
+        if (ctx->mu[i - 1]) bnz_scratch_free(ctx->mu[i - 1]);
+        if (ctx->pow[i - 1]) bnz_scratch_free(ctx->pow[i - 1]);
+        ctx->mu[i - 1] = NULL;
+        ctx->pow[i - 1] = NULL;
+    }
+    ctx->levels = 0;
+}
+
+void radix_emit(radix_ctx *ctx, const uint8_t *dgt, size_t len) // write len digit values through ctx->alpha to ctx->sink, suppressing zeros until the first non-zero digit
+{
+    uint8_t out[256];
+    size_t i, n = 0;
+
+    for (i = 0; i < len; i++) {
+        if (ctx->started == false) {
+            if (dgt[i] == 0) continue;
+            ctx->started = true;
+        }
+        out[n++] = ctx->alpha[dgt[i]];
+        if (n == sizeof(out)) {
+            ctx->sink(out, n, ctx->arg);
+            ctx->count += n;
+            n = 0;
+        }
+    }
+    if (n > 0) {
+        ctx->sink(out, n, ctx->arg);
+        ctx->count += n;
+    }
+}
+
+void radix_emit_zeros(radix_ctx *ctx, size_t len) // write len zero digits, nothing before the first non-zero digit
+{
+    uint8_t zeros[256] = {0};
+    size_t n;
+
+    while (ctx->started == true && len > 0) {
+        n = len < sizeof(zeros) ? len : sizeof(zeros);
+        radix_emit(ctx, zeros, n);
+        len -= n;
+    }
+}
+
+bool radix_put_uint64_arr(radix_ctx *ctx, uint64_t *x, size_t n, size_t digits) // write x of n limbs, which it overwrites, as exactly digits digits in ctx->base, most significant first, x < base^digits, x is split by the power of the base nearest its square root and the halves written in turn, return false if an allocation fails
+{
+    uint8_t dgt_stack[64 * RADIX_DC_LIMBS + 64], *dgt = dgt_stack;
+    uint64_t *q = NULL, *t, *t2, rem, one = 1;
+    size_t i, j, k, cap, cnt = 0;
+
+    while (n > 0 && x[n - 1] == 0) n--;
+
+    if (n == 0) {
+        radix_emit_zeros(ctx, digits);
+        return true;
+    }
+
+    if (ctx->bits > 0) { // power of two base, digit j is bits j bits to (j + 1) bits - 1 of x, linear time
+        cnt = (64 * n + ctx->bits - 1) / ctx->bits; // digits within the limbs of x
+        if (cnt < digits) {
+            radix_emit_zeros(ctx, digits - cnt);
+        } else {
+            cnt = digits;
+        }
+        for (i = cnt; i > 0; i -= j) {
+            for (j = 0; j < sizeof(dgt_stack) && j < i; j++) {
+                k = (i - 1 - j) * ctx->bits; // bit position of the digit
+                rem = x[k / 64] >> (k % 64);
+                if (k % 64 + ctx->bits > 64 && k / 64 + 1 < n) rem |= x[k / 64 + 1] << (64 - k % 64);
+                dgt_stack[j] = (uint8_t)(rem & (ctx->base - 1));
+            }
+            radix_emit(ctx, dgt_stack, j);
+        }
+        return true;
+    }
+
+    for (i = 0; i < ctx->levels && 2 * ctx->pow_len[i] < n; i++); // the smallest power with at least half the limbs of x
+
+    if (n < RADIX_DC_LIMBS || i == ctx->levels || !ctx->mu[i]) { // one limb sized chunk of digits per division by ctx->chunk
+        cap = 64 * n + 64; // more than the digits of x in any base
+        if (cap > sizeof(dgt_stack)) {
+            dgt = (uint8_t *)bnz_scratch_alloc(cap / 8);
+            if (!dgt) {
+                return false;
+            }
+        }
+        while (n > 0) { // digits are produced from the lsb end
+            rem = divrem_word_uint64_arr(x, x, n, ctx->chunk);
+            while (n > 0 && x[n - 1] == 0) n--;
+            for (j = 0; j < ctx->k && cnt < cap; j++) {
+                dgt[cap - 1 - cnt++] = (uint8_t)(rem % ctx->base);
+                rem /= ctx->base;
+            }
+        }
+        if (cnt > digits) cnt = digits; // the excess digits are zeros
+        radix_emit_zeros(ctx, digits - cnt);
+        radix_emit(ctx, dgt + cap - cnt, cnt);
+        if (dgt != dgt_stack) bnz_scratch_free((uint64_t *)dgt);
+        return true;
+    }
+
+    k = ctx->pow_len[i]; // k < n <= 2 k, so x < 2^(128 k) as Barrett reduction requires
+    q = bnz_scratch_alloc((n - k + 2) + (n + 3) + (n + 2));
+    if (!q) {
+        return false;
+    }
+    t = q + n - k + 2;
+    t2 = t + n + 3;
+
+    mul_fast_uint64_arr(t, x + k - 1, n - k + 1, ctx->mu[i], k + 2); // q = floor(floor(x / 2^(64 (k - 1))) mu / 2^(64 (k + 1))), at most 2 too small
+    memcpy(q, t + k + 1, (n - k + 2) * sizeof(uint64_t));
+    mul_fast_uint64_arr(t2, q, n - k + 2, ctx->pow[i], k);
+    sub_uint64_arr(x, x, t2, n); // x = x - q pow[i], the remainder
+    for (;;) {
+        for (j = n; j > k && x[j - 1] == 0; j--);
+        if (j == k && cmp_uint64_arr(x, ctx->pow[i], k) < 0) break;
+        sub_from_uint64_arr(x, n, ctx->pow[i], k);
+        add_to_uint64_arr(q, n - k + 2, &one, 1);
+    }
+
+    if (!radix_put_uint64_arr(ctx, q, n - k + 2, digits - ((size_t)ctx->k << i)) || !radix_put_uint64_arr(ctx, x, k, (size_t)ctx->k << i)) { // the quotient, then the remainder in exactly k 2^i digits
+        bnz_scratch_free(q);
+        return false;
+    }
+
+    bnz_scratch_free(q);
+    return true;
+}
+
+bool radix_get_uint64_arr(radix_ctx *ctx, uint64_t *x, size_t x_len, const uint8_t *dgt, size_t m) // set x of x_len limbs to the value of the m digit values dgt in ctx->base, most significant first, the string is split at the largest power of the base with fewer digits, and the halves recombined by fast multiplication, return false if an allocation fails
+{
+    uint64_t *hi = NULL, *lo, *t, w, c, carry;
+    uint128_t p;
+    size_t i, j, l, len = 0, hi_len, lo_len, cnt;
+
+    memset(x, 0, x_len * sizeof(uint64_t));
+
+    if (ctx->bits > 0) { // power of two base, each digit is ored into its bits of x, linear time
+        for (j = 0; j < m; j++) {
+            l = (m - 1 - j) * ctx->bits; // bit position of the digit
+            if (l / 64 >= x_len) continue; // a leading zero beyond x
+            x[l / 64] |= (uint64_t)dgt[j] << (l % 64);
+            if (l % 64 + ctx->bits > 64 && l / 64 + 1 < x_len) x[l / 64 + 1] |= (uint64_t)dgt[j] >> (64 - l % 64);
+        }
+        return true;
+    }
+
+    for (i = ctx->levels; i > 0 && ((size_t)ctx->k << (i - 1)) >= m; i--); // the largest power with fewer digits than the string
+
+    if (i == 0 || 2 * ctx->pow_len[i - 1] < RADIX_DC_LIMBS) { // Horner's rule, one limb sized chunk of digits at a time
+        for (j = 0; j < m; j += cnt) {
+            cnt = j == 0 && m % ctx->k ? m % ctx->k : ctx->k; // the first chunk takes the odd digits
+            w = 0;
+            c = 1;
+            for (l = 0; l < cnt; l++) {
+                w = w * ctx->base + dgt[j + l];
+                c *= ctx->base;
+            }
+            carry = w;
+            for (l = 0; l < len; l++) { // x = x c + w
+                p = (uint128_t)x[l] * c + carry;
+                x[l] = (uint64_t)p;
+                carry = (uint64_t)(p >> 64);
+            }
+            if (carry && len < x_len) x[len++] = carry;
+        }
+        return true;
+    }
+    i--;
+
+    l = (size_t)ctx->k << i; // digits in the low half
+    hi_len = radix_limbs(m - l, ctx->base);
+    lo_len = ctx->pow_len[i];
+    hi = bnz_scratch_alloc(hi_len + lo_len + hi_len + lo_len);
+    if (!hi) {
+        return false;
+    }
+    lo = hi + hi_len;
+    t = lo + lo_len;
+
+    if (!radix_get_uint64_arr(ctx, hi, hi_len, dgt, m - l) || !radix_get_uint64_arr(ctx, lo, lo_len, dgt + m - l, l)) {
+        bnz_scratch_free(hi);
+        return false;
+    }
+
+    while (hi_len > 1 && hi[hi_len - 1] == 0) hi_len--;
+    mul_fast_uint64_arr(t, hi, hi_len, ctx->pow[i], lo_len); // x = hi pow[i] + lo
+    add_to_uint64_arr(t, hi_len + lo_len, lo, lo_len);
+    memcpy(x, t, (hi_len + lo_len < x_len ? hi_len + lo_len : x_len) * sizeof(uint64_t));
+
+    bnz_scratch_free(hi);
+    return true;
+}
+
+bool bnz_write_base_n(const bnz_t *a, uint32_t base, const char *alpha, bnz_sink_t sink, void *arg) // write |a| in the given base, with its digits in big endian order, to sink in pieces as they are produced, "0" (alpha[0]) for zero, return false if an allocation fails
+{
+    uint64_t *limbs = NULL;
+    size_t n = bnz_limb_count(a), digits = (size_t)(a->size * log10((double)256) / log10((double)base)) + 1;
+    bool ok;
+    radix_ctx ctx;
+
+    BNZ_STATS_CALL(a->size);
+
+    if (!radix_ctx_init(&ctx, base, digits, true)) {
+        return false;
+    }
+
+    limbs = bnz_scratch_alloc(n);
+    if (!limbs) {
+        radix_ctx_free(&ctx);
+        return false;
+    }
+    bnz_get_limbs(limbs, n, a);
+
+    ctx.alpha = alpha;
+    ctx.sink = sink;
+    ctx.arg = arg;
+    ok = radix_put_uint64_arr(&ctx, limbs, n, digits);
+    if (ok == true && ctx.count == 0) sink((const uint8_t *)alpha, 1, arg);
+
+    bnz_scratch_free(limbs);
+    radix_ctx_free(&ctx);
+
+    return ok;
+}
+
+void hex_encode_uint8_arr(char *out, const uint8_t *a, size_t len) // write the len bytes of a as 2 len lower case hex characters, in the same order and without a terminator, 16 bytes at a time with SSSE3 if the compiler targets it
+{
+    static const char hex[16] = "0123456789abcdef";
+    size_t i = 0;
+#if defined(__SSSE3__)
+    const __m128i lut = _mm_loadu_si128((const __m128i *)hex), mask = _mm_set1_epi8(15);
+    __m128i v, hi, lo;
+
+    for (; i + 16 <= len; i += 16) { // each nibble indexes the 16 character table with one shuffle
+        v = _mm_loadu_si128((const __m128i *)(a + i));
+        hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(v, 4), mask));
+        lo = _mm_shuffle_epi8(lut, _mm_and_si128(v, mask));
+        _mm_storeu_si128((__m128i *)(out + 2 * i), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128((__m128i *)(out + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+#endif
+
+    for (; i < len; i++) {
+        out[2 * i] = hex[a[i] >> 4];
+        out[2 * i + 1] = hex[a[i] & 15];
+    }
+}
+
+void bnz_sink_stdout(const uint8_t *str, size_t len, void *arg) // bnz_sink_t writing to stdout, arg is unused
+{
+    (void)arg;
+
+    fwrite(str, 1, len, stdout);
+}
+
+void bnz_sink_buffer(const uint8_t *str, size_t len, void *arg) // bnz_sink_t appending to a buffer, arg points to the uint8_t * at which to write, which is advanced, the buffer must be large enough
+{
+    uint8_t **pos = (uint8_t **)arg;
+
+    memcpy(*pos, str, len);
+    (*pos) += len;
+}
+
+void bnz_set_i32(bnz_t *res, int32_t val) // set bnz_t to 32 bit signed int, if the resultant bnz_t has leading zeros, these are trimmed
+{
+    bnz_resize(res, 4, false); // resize res to 4 bytes, zero bytes, set sign to positive
+    if (val < 0) { // val is negative
+        res->sign = 1; // sign == 1 for negative val, 0 for positive val, set after bnz_resize which would otherwise clear it
+        val *= -1; // multiply negative int32_t by -1 to de-complement bytes
+    }
+    memcpy(res->digits, &val, 4); // copy bytes from val to res->digits
+    bnz_trim(res); // trim zero bytes from msb end
+}
+
+void bnz_set_ui32(bnz_t *res, uint32_t val) // set bnz_t to 32 bit uint32_t, if the resultant bnz_t has leading zeros, these are trimmed
+{
+    bnz_resize(res, 4, false); // resize res to 4 bytes, zero bytes
+    memcpy(res->digits, &val, 4); // copy bytes from val to res->digits
+    bnz_trim(res); // trim zero bytes from msb end
+}
+
+void bnz_set_str(bnz_t *res, const char *str, uint8_t base) // set bnz_t to number represented by str with radix between 2 and 64, and with its digits in big endian order, characters that are not digits in base are skipped
+{
+    uint8_t *dgt = NULL;
+    uint64_t *x = NULL;
+    size_t i, m = 0, x_len, str_len = strlen(str), idx = 0, sign = 0;
+    int8_t d;
+    radix_ctx ctx;
+
+    BNZ_STATS_CALL(str_len);
+
+    if (str[0] == '-') { // if first symbol of str is "-", set sign to 1 and set starting index of digits to 1
+        sign = 1;
+        idx = 1;
+    }
+
+    dgt = (uint8_t *)bnz_scratch_alloc(str_len / 8 + 1);
+    if (!dgt) {
+        return;
+    }
+    for (i = idx; i < str_len; i++) { // digit values, most significant first
+        d = get_digit(str, i, base);
+        if (d != -1) dgt[m++] = d;
+    }
+
+    x_len = radix_limbs(m, base);
+    if (!radix_ctx_init(&ctx, base, m, false)) {
+        bnz_scratch_free((uint64_t *)dgt);
+        return;
+    }
+    x = bnz_scratch_alloc(x_len);
+    if (x && radix_get_uint64_arr(&ctx, x, x_len, dgt, m)) {
+        bnz_set_limbs(res, x, x_len);
+        res->sign = sign;
+    }
+
+    if (x) bnz_scratch_free(x);
+    radix_ctx_free(&ctx);
+    bnz_scratch_free((uint64_t *)dgt);
+}
+
+void bnz_set_bnz(bnz_t *res, const bnz_t *val) // set bnz_t equivalent to another bnz_t
+{
+    BNZ_STATS_CALL(val->size);
+
+    if (res == val) return;
+
+    bnz_resize(res, val->size, false);
+    memcpy(res->digits, val->digits, val->size);
+    bnz_bytes_copied += val->size;
+    res->sign = val->sign;
+}
+
+int32_t cmp_uint8_arr(const uint8_t *a, const uint8_t *b, size_t len) // compare two 1D uint8_t arrays a and b, from msb to lsb, return -1 if a < b, 0 if a == b, and 1 if a > b 
+{
+    size_t idx = len;
+
+    while (idx--) {
+        if (a[idx] > b[idx]) return 1;
+        if (a[idx] < b[idx]) return -1;
+    }
+
+    return 0;
+}
+
+int32_t bnz_cmp_i32(const bnz_t *a, int32_t b) // compare bnz_t with int32_t, taking account of signs as bnz_cmp_bnz does, and invoking bnz_cmp_word to compare the digits of a with |b|
+{
+    int32_t res;
+    size_t b_sign = b < 0 ? 1 : 0;
+
+    if (a->sign != b_sign) return a->sign == 0 ? 1 : -1; // a > -b or -a < b
+
+    res = bnz_cmp_word(a, b < 0 ? (uint64_t)(-(int64_t)b) : (uint64_t)b); // compare |a| and |b|
+    return a->sign ? -res : res; // reverse cmp value if a and b are negative
+}
+
+int32_t bnz_cmp_bnz(const bnz_t *a, const bnz_t *b) // compare two bnz_t numbers, taking account of signs, and invoking bnz_cmp_abs to compare their digits
+{
+    int32_t res;
+
+    BNZ_STATS_CALL(a->size + b->size);
+
+    if (a->sign != b->sign) { // signs are different
+        if (a->sign == 0 && b->sign != 0) {
+            res = 1; // a > -b
+        } else {
+            res = -1; // -a < b
+        }
+    } else { // signs are the same
+        res = bnz_cmp_abs(a, b); // compare |a| and |b|
+        if (a->sign) res = -res; // reverse cmp value if a and b are negative
+    }
+
+    return res;
+}
+
+int32_t bnz_cmp_abs(const bnz_t *a, const bnz_t *b) // compare |a| and |b| in place, ignoring zero bytes at the msb end, return -1 if |a| < |b|, 0 if |a| == |b|, and 1 if |a| > |b|
+{
+    size_t a_size = a->size, b_size = b->size;
+
+    BNZ_STATS_CALL(a->size + b->size);
+
+    while (a_size > 0 && a->digits[a_size - 1] == 0) a_size--;
+    while (b_size > 0 && b->digits[b_size - 1] == 0) b_size--;
+
+    if (a_size != b_size) return a_size > b_size ? 1 : -1;
+
+    return cmp_uint8_arr(a->digits, b->digits, a_size);
+}
+
+bool bnz_is_zero(const bnz_t *val) // return true if val == 0, return false if val != 0
+{
+    size_t i;
+
+    for (i = 0; i < val->size; i++) {
+        if (val->digits[i] != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool bnz_bit_set(const bnz_t *val, uint32_t idx) // return true if the specified bit in val is set, return false if it is not set
+{
+    uint32_t byte = idx / 8, bit = idx % 8;
+    return (bool)((val->digits[byte] >> bit) & 1);
+}
+
+uint32_t bnz_get_bits(const bnz_t *val, uint32_t idx, uint32_t count) // return bits idx to idx + count - 1 of |val| as an unsigned integer, bit idx in the lsb, for count <= 25, bits beyond the last digit read as 0
+{
+    return get_bits_uint8_arr(val->digits, val->size, idx, count);
+}
+
+uint64_t get_word_uint8_arr(const uint8_t *a, size_t len, int64_t byte) // return bytes byte to byte + 7 of the len byte little endian array a as a 64 bit word, bytes outside the array (including negative positions) read as 0
+{
+    uint64_t w = 0;
+    int64_t lo = byte < 0 ? 0 : byte, hi = byte + 8 > (int64_t)len ? (int64_t)len : byte + 8;
+
+    if (lo < hi) memcpy((uint8_t *)&w + (lo - byte), a + lo, (size_t)(hi - lo));
+
+    return w;
+}
+
+uint32_t get_bits_uint8_arr(const uint8_t *a, size_t len, uint32_t idx, uint32_t count) // return bits idx to idx + count - 1 of the len byte little endian array a, bit idx in the lsb, for count <= 25, bits beyond the array read as 0
+{
+    uint32_t byte = idx / 8, i, bits = 0;
+
+    for (i = 0; i < 4 && byte + i < len; i++) {
+        bits |= (uint32_t)a[byte + i] << (8 * i); // up to 4 bytes cover any 25 bit window
+    }
+
+    return (bits >> (idx % 8)) & ((1U << count) - 1);
+}
+
+void bit_iter_init(bit_iter_t *it, const uint8_t *digits, size_t size) // start an iteration over the bits of the size byte little endian scalar at digits, it->bit is left at the highest set bit (-1 for 0), so it->bit + 1 is the bit length of the scalar
+{
+    it->digits = digits;
+    it->size = size;
+    it->base = 0;
+    it->word = get_word_uint8_arr(digits, size, 0);
+
+    while (size > 0 && digits[size - 1] == 0) size--; // skip zero bytes at the msb end
+    it->bit = size == 0 ? -1 : 8 * ((int64_t)size - 1) + 31 - __builtin_clz(digits[size - 1]);
+}
+
+bool bit_iter_next_set(bit_iter_t *it, uint32_t *idx) // lsb first, set *idx to the index of the next set bit and return true, or return false when no set bits remain, zero bits are skipped 64 at a time
+{
+    while (it->word == 0) {
+        if (it->base + 64 >= 8 * it->size) return false;
+        it->base += 64;
+        it->word = get_word_uint8_arr(it->digits, it->size, it->base / 8);
+    }
+
+    *idx = it->base + __builtin_ctzll(it->word);
+    it->word &= it->word - 1; // clear the lowest set bit
+
+    return true;
+}
+
+bool bit_iter_next_window(bit_iter_t *it, uint32_t w, uint32_t *window, uint32_t *len) // msb first, skip zero bits from it->bit down and take the next window of up to w bits (w <= 25) that starts and ends on a set bit, set *window to its (odd) value and *len to the number of bits consumed, the zeros skipped plus the window, and return true, or return false with *len set to the number of zero bits remaining
+{
+    uint32_t byte_bits;
+    int64_t top, lo;
+
+    *len = 0;
+    while (it->bit >= 0) { // skip zero bits, a byte at a time
+        byte_bits = it->digits[it->bit / 8] & ((2U << (it->bit % 8)) - 1); // bits of the current byte at or below it->bit
+        if (byte_bits != 0) break;
+        *len += it->bit % 8 + 1;
+        it->bit -= it->bit % 8 + 1;
+    }
+    if (it->bit < 0) return false;
+
+    top = 8 * (it->bit / 8) + 31 - __builtin_clz(byte_bits); // highest set bit at or below it->bit
+    *len += (uint32_t)(it->bit - top);
+    lo = top - (int64_t)w + 1 > 0 ? top - (int64_t)w + 1 : 0;
+    *window = get_bits_uint8_arr(it->digits, it->size, (uint32_t)lo, (uint32_t)(top - lo + 1));
+    while ((*window & 1) == 0) { // the window ends on a set bit, so that only odd powers are needed
+        *window >>= 1;
+        lo++;
+    }
+    *len += (uint32_t)(top - lo + 1);
+    it->bit = lo - 1;
+
+    return true;
+}
+
+void bnz_concatenate_ui8(bnz_t *res, const bnz_t *a, uint8_t b, size_t order) // res = a || b, in specified order, where b is a single byte
+{
+    if (res != a) bnz_set_bnz(res, a);
+    bnz_concat_append_ui8(res, b, order);
+}
+
+void bnz_concatenate_bnz(bnz_t *res, const bnz_t *a, const bnz_t *b, size_t order) // res = a || b, in specified order, writing straight into res unless res is b
+{
+    size_t size = a->size + b->size;
+    uint64_t *scratch = NULL;
+    uint8_t *tmp = NULL;
+
+    BNZ_STATS_CALL(a->size + b->size);
+
+    if (res == a) {
+        bnz_concat_append(res, b, order);
+        return;
+    }
+
+    if (res != b) {
+        bnz_resize(res, size, false);
+        memcpy(res->digits + (order ? b->size : 0), a->digits, a->size);
+        memcpy(res->digits + (order ? 0 : a->size), b->digits, b->size);
+        bnz_bytes_copied += size;
+        return;
+    }
+
+    scratch = bnz_scratch_alloc((size + 7) / 8); // scratch copy permits b = a || b, b = b || a
+    if (!scratch) {
+        return;
+    }
+    tmp = (uint8_t *)scratch;
+    if (order) {
+        memcpy(tmp, b->digits, b->size);
+        memcpy(tmp + b->size, a->digits, a->size);
+    } else {
+        memcpy(tmp, a->digits, a->size);
+        memcpy(tmp + a->size, b->digits, b->size);
+    }
+    bnz_resize(res, size, false);
+    memcpy(res->digits, tmp, size);
+    bnz_bytes_copied += 2 * size;
+    bnz_scratch_free(scratch);
+}
+
+void bnz_concat_append_ui8(bnz_t *res, uint8_t b, size_t order) // res = res || b in place, b at the msb end if order is 0 and at the lsb end otherwise
+{
+    size_t size = res->size;
+
+    bnz_resize(res, size + 1, true);
+    if (order) {
+        memmove(res->digits + 1, res->digits, size);
+        bnz_bytes_copied += size;
+        res->digits[0] = b;
+    } else {
+        res->digits[size] = b;
+    }
+}
+
+void bnz_concat_append(bnz_t *res, const bnz_t *b, size_t order) // res = res || b in place, b at the msb end if order is 0 and at the lsb end otherwise, b may be res
+{
+    size_t size = res->size, b_size = b->size; // b->size changes with res->size if b is res
+
+    bnz_resize(res, size + b_size, true);
+    if (order) {
+        memmove(res->digits + b_size, res->digits, size);
+        memcpy(res->digits, b == res ? res->digits + b_size : b->digits, b_size);
+        bnz_bytes_copied += size + b_size;
+    } else {
+        memcpy(res->digits + size, b->digits, b_size);
+        bnz_bytes_copied += b_size;
+    }
+}
+
+uint8_t add_to_uint8_arr(uint8_t *res, size_t res_len, const uint8_t *a, size_t a_len) // res = res + a in place, where a_len <= res_len and a may be res, return carry
+{
+    size_t i;
+    uint32_t t = 0;
+
+    for (i = 0; i < a_len; i++) {
+        t += (uint32_t)res[i] + a[i];
+        res[i] = (uint8_t)t;
+        t >>= 8;
+    }
+    for (; t && i < res_len; i++) {
+        t += res[i];
+        res[i] = (uint8_t)t;
+        t >>= 8;
+    }
+
+    return (uint8_t)t;
+}
+
+uint8_t sub_from_uint8_arr(uint8_t *res, size_t res_len, const uint8_t *a, size_t a_len) // res = res - a in place, where a_len <= res_len, return borrow
+{
+    size_t i;
+    uint32_t borrow = 0, t;
+
+    for (i = 0; i < a_len; i++) {
+        t = (uint32_t)res[i] - a[i] - borrow;
+        res[i] = (uint8_t)t;
+        borrow = (t >> 8) & 1;
+    }
+    for (; borrow && i < res_len; i++) {
+        borrow = res[i] == 0;
+        res[i]--;
+    }
+
+    return (uint8_t)borrow;
+}
+
+void sub_reverse_uint8_arr(uint8_t *res, const uint8_t *a, size_t len) // res = a - res in place, where res <= a
+{
+    size_t i;
+    uint32_t borrow = 0, t;
+
+    for (i = 0; i < len; i++) {
+        t = (uint32_t)a[i] - res[i] - borrow;
+        res[i] = (uint8_t)t;
+        borrow = (t >> 8) & 1;
+    }
+}
+
+void bnz_add_signed_assign(bnz_t *res, const bnz_t *b, size_t b_sign) // res = res + b, with b taken to have sign b_sign, in place, b may be res
+{
+    size_t b_size = b->size, n;
+
+    if (b == res) {
+        if (res->sign != b_sign) { // res - res
+            bnz_set_i32(res, 0);
+        } else { // res + res
+            bnz_double(res);
+        }
+        return;
+    }
+
+    if (res->sign == b_sign) { // same signs, add magnitudes
+        n = res->size > b_size ? res->size : b_size;
+        bnz_resize(res, n + 1, true); // room for the carry, the sign is preserved
+        add_to_uint8_arr(res->digits, n + 1, b->digits, b_size);
+    } else if (bnz_cmp_abs(res, b) >= 0) { // |res| >= |b|, subtract magnitudes, keeping the sign of res
+        sub_from_uint8_arr(res->digits, res->size, b->digits, b_size < res->size ? b_size : res->size); // any bytes of b above res->size are zero
+    } else { // |res| < |b|, res = b - res, taking the sign of b
+        bnz_resize(res, b_size, true);
+        sub_reverse_uint8_arr(res->digits, b->digits, b_size);
+        res->sign = b_sign;
+    }
+
+    bnz_trim(res);
+    if (bnz_is_zero(res) == true) res->sign = 0;
+}
+
+void bnz_add_assign(bnz_t *res, const bnz_t *b) // res = res + b in place, taking account of signs, b may be res
+{
+    BNZ_STATS_CALL(res->size + b->size);
+
+    bnz_add_signed_assign(res, b, b->sign);
+}
+
+void bnz_sub_assign(bnz_t *res, const bnz_t *b) // res = res - b in place, taking account of signs, b may be res
+{
+    BNZ_STATS_CALL(res->size + b->size);
+
+    bnz_add_signed_assign(res, b, b->sign ? 0 : 1);
+}
+
+void bnz_mul_to(bnz_t *res, const bnz_t *a) // res = res * a in place, taking account of signs, multipliers of up to 64 bits are applied to the digits of res directly
+{
+    size_t a_size = a->size;
+
+    BNZ_STATS_CALL(res->size + a->size);
+
+    while (a_size > 0 && a->digits[a_size - 1] == 0) a_size--;
+
+    if (a == res || a_size > 8) {
+        bnz_multiply_bnz(res, res, a);
+        return;
+    }
+
+    bnz_mul_word(res, bnz_get_word(a), a->sign);
+}
+
+uint64_t add_word_uint8_arr(uint8_t *res, size_t len, uint64_t w) // res = res + w in place, 8 bytes at a time while the carry lasts, return any carry out of the top byte
+{
+    size_t i;
+    uint64_t limb;
+
+    for (i = 0; i + 8 <= len && w != 0; i += 8) {
+        memcpy(&limb, res + i, 8);
+        limb += w;
+        w = limb < w; // carry
+        memcpy(res + i, &limb, 8);
+    }
+    for (; i < len && w != 0; i++) { // remaining bytes when len is not a multiple of 8
+        limb = (uint64_t)res[i] + (w & 255);
+        res[i] = (uint8_t)limb;
+        w = (w >> 8) + (limb >> 8);
+    }
+
+    return w;
+}
+
+uint64_t sub_word_uint8_arr(uint8_t *res, size_t len, uint64_t w) // res = res - w in place, 8 bytes at a time while the borrow lasts, return any borrow out of the top byte
+{
+    size_t i;
+    uint64_t limb, borrow;
+
+    for (i = 0; i + 8 <= len && w != 0; i += 8) {
+        memcpy(&limb, res + i, 8);
+        borrow = limb < w;
+        limb -= w;
+        w = borrow;
+        memcpy(res + i, &limb, 8);
+    }
+    for (; i < len && w != 0; i++) { // remaining bytes when len is not a multiple of 8
+        borrow = res[i] < (w & 255);
+        res[i] -= (uint8_t)w;
+        w = (w >> 8) + borrow;
+    }
+
+    return w;
+}
+
+uint64_t mul_word_uint8_arr(uint8_t *res, size_t len, uint64_t w) // res = res * w in place, 8 bytes at a time with 128 bit products, return the carry word out of the top byte
+{
+    size_t i;
+    uint64_t limb, carry = 0;
+    uint128_t t;
+
+    for (i = 0; i + 8 <= len; i += 8) {
+        memcpy(&limb, res + i, 8);
+        t = (uint128_t)limb * w + carry;
+        limb = (uint64_t)t;
+        carry = (uint64_t)(t >> 64);
+        memcpy(res + i, &limb, 8);
+    }
+    for (; i < len; i++) { // remaining bytes when len is not a multiple of 8
+        t = (uint128_t)res[i] * w + carry;
+        res[i] = (uint8_t)t;
+        carry = (uint64_t)(t >> 8);
+    }
+
+    return carry;
+}
+
+uint8_t shl1_uint8_arr(uint8_t *res, size_t len) // res = res << 1 in place, 8 bytes at a time, return the bit shifted out of the top byte
+{
+    size_t i;
+    uint64_t limb, carry = 0, next;
+
+    for (i = 0; i + 8 <= len; i += 8) {
+        memcpy(&limb, res + i, 8);
+        next = limb >> 63;
+        limb = (limb << 1) | carry;
+        carry = next;
+        memcpy(res + i, &limb, 8);
+    }
+    for (; i < len; i++) { // remaining bytes when len is not a multiple of 8
+        next = res[i] >> 7;
+        res[i] = (uint8_t)((res[i] << 1) | carry);
+        carry = next;
+    }
+
+    return (uint8_t)carry;
+}
+
+uint64_t bnz_get_word(const bnz_t *a) // return the least significant 64 bits of |a|
+{
+    uint64_t w = 0;
+
+    memcpy(&w, a->digits, a->size < 8 ? a->size : 8);
+
+    return w;
+}
+
+int32_t bnz_cmp_word(const bnz_t *a, uint64_t w) // compare |a| and w in place, ignoring zero bytes at the msb end, return -1 if |a| < w, 0 if |a| == w, and 1 if |a| > w
+{
+    size_t a_size = a->size;
+    uint64_t aa;
+
+    while (a_size > 8 && a->digits[a_size - 1] == 0) a_size--;
+    if (a_size > 8) return 1;
+
+    aa = bnz_get_word(a);
+    if (aa != w) return aa > w ? 1 : -1;
+
+    return 0;
+}
+
+void bnz_add_word(bnz_t *res, uint64_t w, size_t w_sign) // res = res + w in place, with w taken to have sign w_sign, working on the digits of res directly
+{
+    size_t n = res->size;
+    uint64_t v;
+
+    BNZ_STATS_CALL(res->size);
+
+    if (res->sign == w_sign) { // same signs, add magnitudes
+        n = (n > 8 ? n : 8) + 1; // room for the carry
+        bnz_resize(res, n, true);
+        add_word_uint8_arr(res->digits, n, w);
+    } else if (bnz_cmp_word(res, w) >= 0) { // |res| >= w, subtract magnitudes, keeping the sign of res
+        sub_word_uint8_arr(res->digits, n, w);
+    } else { // |res| < w, res = w - |res|, taking the sign of w
+        v = w - bnz_get_word(res);
+        bnz_resize(res, 8, true);
+        memcpy(res->digits, &v, 8);
+        res->sign = w_sign;
+    }
+
+    bnz_trim(res);
+    if (bnz_is_zero(res) == true) res->sign = 0;
+}
+
+void bnz_mul_word(bnz_t *res, uint64_t w, size_t w_sign) // res = res * w in place, with w taken to have sign w_sign, working on the digits of res directly
+{
+    size_t size = res->size;
+    uint64_t carry;
+
+    BNZ_STATS_CALL(res->size);
+
+    bnz_resize(res, size + 8, true);
+    carry = mul_word_uint8_arr(res->digits, size, w);
+    memcpy(res->digits + size, &carry, 8);
+    res->sign = (res->sign != 0) != (w_sign != 0); // -res, +w and +res, -w give a negative result
+
+    bnz_trim(res);
+    if (bnz_is_zero(res) == true) res->sign = 0;
+}
+
+void bnz_double(bnz_t *res) // res = 2 * res in place, shifting the digits of res left by one bit
+{
+    size_t size = res->size;
+
+    bnz_resize(res, size + 1, true);
+    shl1_uint8_arr(res->digits, size + 1);
+
+    bnz_trim(res);
+    if (bnz_is_zero(res) == true) res->sign = 0;
+}
+
+void bnz_add_i32(bnz_t *res, const bnz_t *a, int32_t b) // res = a + b, taking account of signs, adding |b| to or subtracting it from a copy of a with bnz_add_word
+{
+    BNZ_STATS_CALL(a->size);
+
+    bnz_set_bnz(res, a);
+    bnz_add_word(res, b < 0 ? (uint64_t)(-(int64_t)b) : (uint64_t)b, b < 0 ? 1 : 0);
+}
+
+void bnz_add_bnz(bnz_t *res, const bnz_t *a, const bnz_t *b) // res = a + b, taking account of signs, invoking bnz_addition or bnz_subtraction
+{
+    int32_t cmp = bnz_cmp_abs(a, b);
+    size_t a_sign = a->sign, b_sign = b->sign; // signs are read before res, which may alias a or b, is overwritten
+
+    BNZ_STATS_CALL(a->size + b->size);
+
+    if (a == b) { // a + a
+        bnz_set_bnz(res, a);
+        bnz_double(res);
+        return;
+    }
+
+    if (a_sign == b_sign) { // -a, -b or +a, +b
+        bnz_addition(res, a, b);
+        res->sign = a_sign;
+    } else if (cmp == -1) { // -a, +b or +a, -b with |a| < |b|
+        bnz_subtraction(res, b, a);
+        res->sign = b_sign;
+    } else { // -a, +b or +a, -b with |a| >= |b|
+        bnz_subtraction(res, a, b);
+        res->sign = a_sign;
+    }
+}
+
+void bnz_addition(bnz_t *res, const bnz_t *a, const bnz_t *b) // res = |a| + |b|, 64 bit limbs with add-with-carry
+{
+    uint64_t *aa = NULL, *bb = NULL;
+    size_t len = bnz_limb_count(a) > bnz_limb_count(b) ? bnz_limb_count(a) : bnz_limb_count(b);
+
+    BNZ_STATS_CALL(a->size + b->size);
+
+    aa = bnz_scratch_alloc(2 * len + 1);
+    if (!aa) {
+        return;
+    }
+    bb = aa + len + 1;
+
+    bnz_get_limbs(aa, len, a);
+    bnz_get_limbs(bb, len, b);
+    aa[len] = add_uint64_arr(aa, aa, bb, len);
+    bnz_set_limbs(res, aa, len + 1);
+
+    bnz_scratch_free(aa);
+}
+
+void bnz_subtract_bnz(bnz_t *res, const bnz_t *a, const bnz_t *b) // res = a - b, taking account of signs, invoking bnz_subtraction or bnz_addition
+{
+    int32_t cmp = bnz_cmp_abs(a, b);
+    size_t a_sign = a->sign, b_sign = b->sign ? 0 : 1; // b_sign is the sign of -b, signs are read before res, which may alias a or b, is overwritten
+
+    BNZ_STATS_CALL(a->size + b->size);
+
+    if (a_sign == b_sign) { // -a, +b or +a, -b
+        bnz_addition(res, a, b);
+        res->sign = a_sign;
+    } else if (cmp == -1) { // -a, -b or +a, +b with |a| < |b|
+        bnz_subtraction(res, b, a);
+        res->sign = b_sign;
+    } else { // -a, -b or +a, +b with |a| >= |b|
+        bnz_subtraction(res, a, b);
+        res->sign = a_sign;
+    }
+}
+
+void bnz_subtraction(bnz_t *res, const bnz_t *a, const bnz_t *b) // res = |a| - |b| where |a| >= |b|, 64 bit limbs with subtract-with-borrow
+{
+    uint64_t *aa = NULL, *bb = NULL;
+    size_t len = bnz_limb_count(a) > bnz_limb_count(b) ? bnz_limb_count(a) : bnz_limb_count(b);
+
+    BNZ_STATS_CALL(a->size + b->size);
+
+    aa = bnz_scratch_alloc(2 * len);
+    if (!aa) {
+        return;
+    }
+    bb = aa + len;
+
+    bnz_get_limbs(aa, len, a);
+    bnz_get_limbs(bb, len, b);
+    sub_uint64_arr(aa, aa, bb, len);
+    bnz_set_limbs(res, aa, len);
+
+    bnz_scratch_free(aa);
+}
+
+void bnz_multiply_i32(bnz_t *res, const bnz_t *a, int32_t b) // res = a * b, taking account of signs, multiplying a copy of a by |b| with bnz_mul_word, or doubling it with bnz_double if |b| is 2
+{
+    BNZ_STATS_CALL(a->size);
+
+    bnz_set_bnz(res, a);
+
+    if (b == 2 || b == -2) {
+        bnz_double(res);
+        if (b < 0 && bnz_is_zero(res) == false) res->sign = res->sign ? 0 : 1;
+        return;
+    }
+
+    bnz_mul_word(res, b < 0 ? (uint64_t)(-(int64_t)b) : (uint64_t)b, b < 0 ? 1 : 0);
+}
+
+void bnz_multiply_bnz(bnz_t *res, const bnz_t *a, const bnz_t *b) // res = a * b, taking account of signs, 64 bit limbs with 128 bit products, Karatsuba or Toom-3 multiplication for large operands
+{
+    uint64_t *aa = NULL, *bb = NULL, *tmp = NULL;
+    size_t a_len = bnz_limb_count(a), b_len = bnz_limb_count(b), sign = (a->sign != 0) != (b->sign != 0); // -a, +b and +a, -b give a negative result
+
+    BNZ_STATS_CALL(a->size + b->size);
+
+    if (a == b) { // self multiplication
+        bnz_square(res, a);
+        return;
+    }
+
+    aa = bnz_scratch_alloc(2 * (a_len + b_len));
+    if (!aa) {
+        return;
+    }
+    bb = aa + a_len;
+    tmp = bb + b_len;
+
+    bnz_get_limbs(aa, a_len, a);
+    bnz_get_limbs(bb, b_len, b);
+    mul_fast_uint64_arr(tmp, aa, a_len, bb, b_len);
+    bnz_set_limbs(res, tmp, a_len + b_len);
+    res->sign = bnz_is_zero(res) == true ? 0 : sign; // a zero product is positive
+
+    bnz_scratch_free(aa);
+}
+void bnz_square(bnz_t *res, const bnz_t *a) // res = a * a, computing each cross product once, Karatsuba or Toom-3 squaring for large operands
+{
+    uint64_t *aa = NULL, *tmp = NULL;
+    size_t a_len = bnz_limb_count(a);
+
+    BNZ_STATS_CALL(a->size);
+
+    aa = bnz_scratch_alloc(3 * a_len);
+    if (!aa) {
+        return;
+    }
+    tmp = aa + a_len;
+
+    bnz_get_limbs(aa, a_len, a);
+    mul_fast_uint64_arr(tmp, aa, a_len, aa, a_len); // a == b selects squaring at every level
+    bnz_set_limbs(res, tmp, 2 * a_len);
+
+    bnz_scratch_free(aa);
+}
+
+
+void bnz_division_signs(bnz_t *q, bnz_t *r, const bnz_t *a, const bnz_t *b) // process signs of q and r in a / b
+{
+    if (a->sign) { // -a
+        if (b->sign) { // -a, -b
+            q->sign = 0; // +q
+            r->sign = 1; // -r
+        } else { // -a, +b
+            q->sign = 1; // -q
+            r->sign = 1; // -r
+        }
+    } else { // +a
+        if (b->sign) { // +a, -b
+            q->sign = 1; // -q
+            r->sign = 0; // +r
+        } else { // +a, +b
+            q->sign = 0; // +q
+            r->sign = 0; // +r
+        }
+    }
+}
+
+void bnz_divide_bnz(bnz_t *q, bnz_t *r, const bnz_t *a, const bnz_t *b) // get q and r of a / b, taking account of signs, invoking bnz_division
+{
+    int32_t cmp;
+    size_t a_sign = a->sign, b_sign = b->sign, b_size = b->size; // saved because q or r may be a or b
+    uint64_t rem;
+    bnz_t sa, sb; // sign carriers for bnz_division_signs
+
+    BNZ_STATS_CALL(a->size + b->size);
+
+    if (bnz_is_zero(b) == true) { // divide by 0
+        printf("div 0 error\n");
+        bnz_set_i32(q, 0);
+        bnz_set_i32(r, 0);
+        return;
+    }
+
+    bnz_init(&sa);
+    bnz_init(&sb);
+    sa.sign = a_sign;
+    sb.sign = b_sign;
+    while (b_size > 0 && b->digits[b_size - 1] == 0) b_size--; // ignore zero bytes at the msb end
+
+    cmp = bnz_cmp_abs(a, b); // compares |a| and |b| in place, so no trimmed copies are made
+
+    if (cmp == 0) { // |a| = |b|
+        bnz_set_i32(q, 1);
+        bnz_set_i32(r, 0);
+    } else if (cmp == -1) { // |a| < |b|
+        bnz_set_i32(q, 0);
+        bnz_set_bnz(r, a);
+        bnz_trim(r);
+    } else if (b_size <= 8) { // |a| > |b| and b fits in one limb
+        rem = get_word_uint8_arr(b->digits, b_size, 0); // read before q or r, which may be b, is written
+        rem = bnz_divrem_word(q, a, rem);
+        bnz_set_limbs(r, &rem, 1);
+    } else { // |a| > |b|
+        bnz_division(q, r, a, b);
+    }
+
+    bnz_division_signs(q, r, &sa, &sb);
+}
+
+void bnz_division(bnz_t *q, bnz_t *r, const bnz_t *a, const bnz_t *b) // get q and r of |a| / |b| where |a| > |b|, 64 bit limbs
+{
+    uint64_t *aa = NULL, *bb = NULL, *qq = NULL, *rr = NULL;
+    size_t a_len = bnz_limb_count(a), b_len = bnz_limb_count(b);
+
+    BNZ_STATS_CALL(a->size + b->size);
+
+    aa = bnz_scratch_alloc(2 * a_len + 2 * b_len + 1); // aa, bb, and qq and rr of at most a_len + 1 and b_len limbs
+    if (!aa) {
+        return;
+    }
+    bb = aa + a_len;
+    qq = bb + b_len;
+
+    bnz_get_limbs(aa, a_len, a);
+    bnz_get_limbs(bb, b_len, b);
+
+    while (a_len > 1 && aa[a_len - 1] == 0) a_len--; // ignore zero limbs at the msb end
+    while (b_len > 1 && bb[b_len - 1] == 0) b_len--;
+
+    rr = qq + a_len - b_len + 1;
+
+    divide_uint64_arr(qq, rr, aa, a_len, bb, b_len);
+
+    bnz_set_limbs(q, qq, a_len - b_len + 1);
+    bnz_set_limbs(r, rr, b_len);
+
+    bnz_scratch_free(aa);
+}
+
+uint64_t bnz_divrem_word(bnz_t *q, const bnz_t *a, uint64_t d) // q = a / d truncated towards zero and return |a| % d, d != 0, q takes the sign of a and may be a, one pass of divrem_word_uint64_arr
+{
+    uint64_t *limbs = NULL, rem;
+    size_t len = bnz_limb_count(a), sign = a->sign;
+
+    BNZ_STATS_CALL(a->size);
+
+    if (d == 0) { // divide by 0
+        printf("div 0 error\n");
+        bnz_set_i32(q, 0);
+        return 0;
+    }
+
+    limbs = bnz_scratch_alloc(len);
+    if (!limbs) {
+        return 0;
+    }
+
+    bnz_get_limbs(limbs, len, a);
+    rem = divrem_word_uint64_arr(limbs, limbs, len, d);
+    bnz_set_limbs(q, limbs, len);
+    if (bnz_is_zero(q) == false) q->sign = sign;
+
+    bnz_scratch_free(limbs);
+
+    return rem;
+}
+
+void bnz_mod_bnz(bnz_t *res, const bnz_t *a, const bnz_t *b) // res = a % b, invoking bnz_divide_bnz, the remainder is written straight into res unless res is b
+{
+    bnz_t q, r, *rem = res == b ? &r : res; // b is still needed after the division
+
+    BNZ_STATS_CALL(a->size + b->size);
+
+    bnz_init(&q);
+    bnz_init(&r);
+    
+    bnz_divide_bnz(&q, rem, a, b);
+    bnz_trim(rem);
+    if (bnz_is_zero(rem) == true) rem->sign = 0; // a zero remainder is positive, rather than being replaced by b
+    if (rem->sign) bnz_add_assign(rem, b);
+    if (rem != res) bnz_set_bnz(res, rem);
+
+    bnz_free(&q);
+    bnz_free(&r);
+}
+
+void bnz_mod_pow(bnz_t *res, const bnz_t *a, const bnz_t *b, const bnz_t *c) // get res = a^b mod c, code adapted from the pseudocode at https://en.wikipedia.org/wiki/Modular_exponentiation, using a modulus context so that no division is performed after setup
+{
+    bnz_mod_ctx ctx;
+
+    BNZ_STATS_CALL(a->size + b->size + c->size);
+
+    bnz_mod_ctx_init(&ctx, c);
+    bnz_mod_pow_ctx(res, a, b, &ctx);
+    bnz_mod_ctx_free(&ctx);
+}
+
+void bnz_modular_multiplicative_inverse(bnz_t *res, const bnz_t *a, const bnz_t *b) // get res where (res * a) mod b = 1 and 0 <= res < b, or res = 0 if there is none, Lehmer's extended Euclidean algorithm (Knuth, TAOCP vol. 2, 4.5.2, algorithm L) on 64 bit limbs, for b > 1
+{
+    uint64_t *ws = NULL, *u, *v, *tu, *tv, *nu, *nv, *ntu, *ntv, *q, *prod, *swap;
+    int64_t uh, vh, A, B, C, D, T, qh;
+    size_t n, un, vn, tn;
+    uint32_t sh, steps;
+    bool odd = false; // parity of the number of Euclid steps taken, the cofactor of a is positive after an odd number
+    bnz_t am;
+
+    BNZ_STATS_CALL(a->size + b->size);
+
+    if (b->sign == 1 || bnz_cmp_i32(b, 1) <= 0) { // the signs of the quotients matter for b <= 1, so keep the original algorithm
+        bnz_modular_multiplicative_inverse_euclid(res, a, b);
+        return;
+    }
+
+    n = bnz_limb_count(b) + 1;
+    bnz_init(&am);
+    bnz_mod_bnz(&am, a, b); // 0 <= am < b
+
+    ws = bnz_scratch_alloc(11 * n);
+    if (!ws) {
+        bnz_free(&am);
+        return;
+    }
+    u = ws; // the remainders, u > v, u = b and v = a mod b to start with
+    v = u + n;
+    tu = v + n; // magnitudes of the cofactors of a, whose signs alternate with each Euclid step
+    tv = tu + n;
+    nu = tv + n;
+    nv = nu + n;
+    ntu = nv + n;
+    ntv = ntu + n;
+    q = ntv + n;
+    prod = q + n; // 2 n limbs
+
+    bnz_get_limbs(u, n, b);
+    bnz_get_limbs(v, n, &am);
+    tv[0] = 1;
+    un = n;
+    while (un > 0 && u[un - 1] == 0) un--;
+    vn = n;
+    while (vn > 0 && v[vn - 1] == 0) vn--;
+
+    while (vn > 0) {
+        sh = 64 * (uint32_t)(un - 1) + 64 - __builtin_clzll(u[un - 1]); // bit length of u
+        sh = sh > 62 ? sh - 62 : 0;
+        uh = (int64_t)(get_top_bits_uint64_arr(u, un, sh) & 0x3FFFFFFFFFFFFFFFULL); // leading 62 bits of u, and the bits of v in the same positions
+        vh = (int64_t)(get_top_bits_uint64_arr(v, vn, sh) & 0x3FFFFFFFFFFFFFFFULL);
+
+        A = 1; // the quotients of the leading bits are the true quotients for as long as the quotients of (uh + A) / (vh + C) and (uh + B) / (vh + D) agree
+        B = 0;
+        C = 0;
+        D = 1;
+        steps = 0;
+        while (vh + C > 0 && vh + D > 0) {
+            qh = (uh + A) / (vh + C);
+            if (qh != (uh + B) / (vh + D)) break;
+            T = A - qh * C;
+            A = C;
+            C = T;
+            T = B - qh * D;
+            B = D;
+            D = T;
+            T = uh - qh * vh;
+            uh = vh;
+            vh = T;
+            steps++;
+        }
+
+        if (B == 0) { // no quotient could be found from the leading bits, take one full Euclid step with a multiple precision division
+            divide_uint64_arr(q, nv, u, un, v, vn); // q = u / v, nv = u mod v
+            memset(nv + vn, 0, (n - vn) * sizeof(uint64_t));
+            tn = n;
+            while (tn > 0 && tv[tn - 1] == 0) tn--;
+            memset(prod, 0, 2 * n * sizeof(uint64_t));
+            if (tn > 0) mul_uint64_arr(prod, q, un - vn + 1, tv, tn);
+            add_to_uint64_arr(prod, 2 * n, tu, n); // |t| = |tu| + q * |tv|, as tu and tv have opposite signs
+            memcpy(ntv, prod, n * sizeof(uint64_t));
+            memcpy(nu, v, n * sizeof(uint64_t));
+            memcpy(ntu, tv, n * sizeof(uint64_t));
+            odd = !odd;
+        } else { // apply the steps to the full numbers, (u, v) = (A u + B v, C u + D v), where A and B (and C and D) have opposite signs
+            if (B <= 0) { // then A >= 0
+                mul_sub_words_uint64_arr(nu, (uint64_t)A, u, (uint64_t)-B, v, n);
+            } else {
+                mul_sub_words_uint64_arr(nu, (uint64_t)B, v, (uint64_t)-A, u, n);
+            }
+            if (D <= 0) { // then C >= 0
+                mul_sub_words_uint64_arr(nv, (uint64_t)C, u, (uint64_t)-D, v, n);
+            } else {
+                mul_sub_words_uint64_arr(nv, (uint64_t)D, v, (uint64_t)-C, u, n);
+            }
+            mul_add_words_uint64_arr(ntu, (uint64_t)(A < 0 ? -A : A), tu, (uint64_t)(B < 0 ? -B : B), tv, n); // the cofactor magnitudes add
+            mul_add_words_uint64_arr(ntv, (uint64_t)(C < 0 ? -C : C), tu, (uint64_t)(D < 0 ? -D : D), tv, n);
+            if (steps & 1) odd = !odd;
+        }
+
+        swap = u; // (u, v, tu, tv) = (nu, nv, ntu, ntv) by swapping pointers rather than by copying
+        u = nu;
+        nu = swap;
+        swap = v;
+        v = nv;
+        nv = swap;
+        swap = tu;
+        tu = ntu;
+        ntu = swap;
+        swap = tv;
+        tv = ntv;
+        ntv = swap;
+        un = n;
+        while (un > 0 && u[un - 1] == 0) un--;
+        vn = n;
+        while (vn > 0 && v[vn - 1] == 0) vn--;
+    }
+
+    if (un != 1 || u[0] != 1) { // gcd(a, b) != 1
+        bnz_set_i32(res, 0);
+    } else {
+        bnz_set_limbs(res, tu, n);
+        if (odd == false && bnz_is_zero(res) == false) { // a negative cofactor, res = b - |t|
+            res->sign = 1;
+            bnz_add_assign(res, b);
+        }
+    }
+
+    bnz_scratch_free(ws);
+    bnz_free(&am);
+}
+
+void bnz_modular_multiplicative_inverse_euclid(bnz_t *res, const bnz_t *a, const bnz_t *b) // get res where (res * a) mod b = 1, code adapted from the pseudocode of various examples of the extended Euclidean algorithm, one multiple precision division per step
+{
+    bnz_t q, tmp, t_0, t_1, r_0, r_1;
+    bnz_t *t = &t_0, *new_t = &t_1, *r = &r_0, *new_r = &r_1, *swap; // the pairs (t, new_t) and (r, new_r) are rotated by swapping pointers rather than by copying
+
+    BNZ_STATS_CALL(a->size + b->size);
+
+    bnz_init(&q);
+    bnz_init(&tmp);
+    bnz_init(&t_0);
+    bnz_init(&t_1);
+    bnz_init(&r_0);
+    bnz_init(&r_1);
+
+    bnz_set_i32(t, 0);
+    bnz_set_i32(new_t, 1);
+    bnz_set_bnz(r, b);
+    bnz_set_bnz(new_r, a);
+
+    while (bnz_is_zero(new_r) == false) {
+        bnz_divide_bnz(&q, r, r, new_r); // q = r / new_r, r = r mod new_r
+        swap = r; // (r, new_r) = (new_r, r mod new_r)
+        r = new_r;
+        new_r = swap;
+        bnz_set_bnz(&tmp, new_t);
+        bnz_mul_to(&tmp, &q);
+        bnz_sub_assign(t, &tmp); // t = t - q * new_t
+        swap = t; // (t, new_t) = (new_t, t - q * new_t)
+        t = new_t;
+        new_t = swap;
+    }
+
+    if (bnz_cmp_i32(r, 1) == 1) {
+        bnz_set_i32(res, 0);
+    } else {
+        if (t->sign) bnz_add_assign(t, b);
+        bnz_set_bnz(res, t);
+    }
+
+    bnz_free(&q);
+    bnz_free(&tmp);
+    bnz_free(&t_0);
+    bnz_free(&t_1);
+    bnz_free(&r_0);
+    bnz_free(&r_1);
+}
+
+void bnz_batch_inverse(bnz_t *res, const bnz_t *a, size_t n, const bnz_t *modulus) // res[i] = modular multiplicative inverse of a[i] mod modulus for i < n, Montgomery's trick of one inversion and 3 modular multiplications per element, res[i] = 0 if a[i] = 0 mod modulus, every res[i] = 0 if the product of the other a[i] has no inverse, res must not alias a
+{
+    size_t i;
+    bool started = false;
+    bnz_t acc, inv, t;
+    bnz_mod_ctx ctx;
+
+    BNZ_STATS_CALL(n * modulus->size);
+
+    if (n == 0) return;
+
+    bnz_init(&acc);
+    bnz_init(&inv);
+    bnz_init(&t);
+    bnz_mod_ctx_init(&ctx, modulus);
+
+    for (i = 0; i < n; i++) { // res[i] = product of the non-zero a[j] mod modulus for j < i, acc = product for j <= i
+        bnz_mod_bnz_ctx(&t, &a[i], &ctx);
+        bnz_set_bnz(&res[i], &acc);
+        if (bnz_is_zero(&t) == false) {
+            if (started == false) {
+                bnz_set_bnz(&acc, &t);
+                bnz_set_i32(&res[i], 1);
+                started = true;
+            } else {
+                bnz_mulmod_ctx(&acc, &acc, &t, &ctx);
+            }
+        }
+    }
+
+    bnz_modular_multiplicative_inverse(&inv, &acc, modulus); // inv = 1 / (a[0] * ... * a[n - 1]), the only inversion, zero if every a[i] is zero or the product has no inverse
+
+    for (i = n; i-- > 0;) { // inv = 1 / (a[0] * ... * a[i]), res[i] = inv * (a[0] * ... * a[i - 1])
+        bnz_mod_bnz_ctx(&t, &a[i], &ctx);
+        if (bnz_is_zero(&t) == true) {
+            bnz_set_i32(&res[i], 0);
+        } else {
+            bnz_mulmod_ctx(&res[i], &res[i], &inv, &ctx);
+            bnz_mulmod_ctx(&inv, &inv, &t, &ctx);
+        }
+    }
+
+    bnz_mod_ctx_free(&ctx);
+    bnz_free(&acc);
+    bnz_free(&inv);
+    bnz_free(&t);
+}
+
+void bnz_mod_ctx_init(bnz_mod_ctx *ctx, const bnz_t *m) // precompute the Montgomery (odd m) and Barrett constants for reduction modulo |m|, ctx->len = 0 if m = 0
+{
+    uint64_t *num = NULL, inv;
+    size_t len = bnz_limb_count(m), k;
+    int i;
+
+    BNZ_STATS_CALL(m->size);
+
+    ctx->len = 0;
+    ctx->montgomery = false;
+    ctx->m_inv = 0;
+    ctx->limbs = NULL;
+    ctx->m = ctx->mu = ctx->r2 = ctx->ws = NULL;
+
+    if (len == 0) return;
+
+    ctx->limbs = init_uint64_array(11 * len + 10); // m (len), mu (len + 2), r2 (len), workspace (8 len + 8)
+    if (!ctx->limbs) return;
+    ctx->m = ctx->limbs;
+    bnz_get_limbs(ctx->m, len, m);
+    while (len > 0 && ctx->m[len - 1] == 0) len--; // ignore zero limbs at the msb end
+    if (len == 0) {
+        bnz_mod_ctx_free(ctx);
+        return;
+    }
+    k = len;
+    ctx->mu = ctx->m + k;
+    ctx->r2 = ctx->mu + k + 2;
+    ctx->ws = ctx->r2 + k;
+
+    num = bnz_scratch_alloc(2 * k + 1); // 2^(128 k)
+    if (!num) {
+        bnz_mod_ctx_free(ctx);
+        return;
+    }
+    num[2 * k] = 1;
+    divide_uint64_arr(ctx->mu, ctx->r2, num, 2 * k + 1, ctx->m, k); // mu = 2^(128 k) / m, r2 = 2^(128 k) mod m, the only division
+    bnz_scratch_free(num);
+
+    if (ctx->m[0] & 1) { // -m^(-1) mod 2^64 by Newton's iteration, each step doubles the number of correct low bits
+        inv = ctx->m[0];
+        for (i = 0; i < 5; i++) inv *= 2 - ctx->m[0] * inv;
+        ctx->m_inv = -inv;
+        ctx->montgomery = true;
+    }
+
+    ctx->len = k;
+}
+
+void bnz_mod_ctx_free(bnz_mod_ctx *ctx) // free resources held by ctx
+{
+    free(ctx->limbs);
+    ctx->limbs = NULL;
+    ctx->m = ctx->mu = ctx->r2 = ctx->ws = NULL;
+    ctx->len = 0;
+}
+
+void bnz_get_residue_ctx(uint64_t *res, const bnz_t *a, bnz_mod_ctx *ctx) // res = a mod m as ctx->len limbs, Barrett reduction for 0 <= a < 2^(128 len), otherwise falls back on bnz_mod_bnz
+{
+    size_t k = ctx->len;
+    bnz_t m, r;
+
+    if (a->sign == 0 && bnz_limb_count(a) <= 2 * k) {
+        bnz_get_limbs(ctx->ws, 2 * k, a);
+        barrett_reduce_uint64_arr(res, ctx->ws, ctx->m, ctx->mu, k, ctx->ws + 2 * k);
+        return;
+    }
+
+    bnz_init(&m);
+    bnz_init(&r);
+    bnz_set_limbs(&m, ctx->m, k);
+    bnz_mod_bnz(&r, a, &m);
+    bnz_get_limbs(res, k, &r);
+    bnz_free(&m);
+    bnz_free(&r);
+}
+
+void bnz_mod_bnz_ctx(bnz_t *res, const bnz_t *a, bnz_mod_ctx *ctx) // res = a mod m, where m is the modulus of ctx
+{
+    uint64_t *r;
+
+    BNZ_STATS_CALL(a->size);
+
+    if (ctx->len == 0) {
+        bnz_set_i32(res, 0);
+        return;
+    }
+    r = ctx->ws + 6 * ctx->len + 5;
+    bnz_get_residue_ctx(r, a, ctx);
+    bnz_set_limbs(res, r, ctx->len);
+}
+
+void bnz_mulmod_ctx(bnz_t *res, const bnz_t *a, const bnz_t *b, bnz_mod_ctx *ctx) // res = (a * b) mod m, where m is the modulus of ctx, one multiplication and one Barrett reduction
+{
+    uint64_t *ra, *rb;
+    size_t k = ctx->len;
+
+    BNZ_STATS_CALL(a->size + b->size);
+
+    if (k == 0) {
+        bnz_set_i32(res, 0);
+        return;
+    }
+    ra = ctx->ws + 6 * k + 5;
+    rb = ra + k;
+    bnz_get_residue_ctx(ra, a, ctx);
+    bnz_get_residue_ctx(rb, b, ctx);
+    mul_uint64_arr(ctx->ws, ra, k, rb, k);
+    barrett_reduce_uint64_arr(ra, ctx->ws, ctx->m, ctx->mu, k, ctx->ws + 2 * k);
+    bnz_set_limbs(res, ra, k);
+}
+
+void bnz_mulmod_residues_ctx(uint64_t *res, const uint64_t *a, const uint64_t *b, bnz_mod_ctx *ctx) // res = a * b mod m for residues of ctx->len limbs, Montgomery multiplication for odd m and Barrett reduction otherwise, res may alias a or b but not ctx->ws
+{
+    size_t k = ctx->len;
+
+    if (ctx->montgomery == true) {
+        mont_mul_uint64_arr(res, a, b, ctx->m, ctx->m_inv, k, ctx->ws);
+    } else {
+        mul_uint64_arr(ctx->ws, a, k, b, k);
+        barrett_reduce_uint64_arr(res, ctx->ws, ctx->m, ctx->mu, k, ctx->ws + 2 * k);
+    }
+}
+
+void bnz_sqrmod_residue_ctx(uint64_t *res, const uint64_t *a, bnz_mod_ctx *ctx) // res = a * a mod m for a residue of ctx->len limbs, as bnz_mulmod_residues_ctx, res may alias a but not ctx->ws
+{
+    size_t k = ctx->len;
+
+    if (ctx->montgomery == true) {
+        mont_sqr_uint64_arr(res, a, ctx->m, ctx->m_inv, k, ctx->ws);
+    } else {
+        sqr_uint64_arr(ctx->ws, a, k);
+        barrett_reduce_uint64_arr(res, ctx->ws, ctx->m, ctx->mu, k, ctx->ws + 2 * k);
+    }
+}
+
+uint32_t bnz_mod_pow_window(uint32_t bits) // sliding window width for an exponent of the given number of bits, balancing the 2^(w - 1) table multiplications against the bits / (w + 1) window multiplications
+{
+    if (bits > 671) return MOD_POW_MAX_WINDOW;
+    if (bits > 239) return 5;
+    if (bits > 79) return 4;
+    if (bits > 23) return 3;
+    return 1;
+}
+
+void bnz_mod_pow_ctx(bnz_t *res, const bnz_t *a, const bnz_t *b, bnz_mod_ctx *ctx) // res = a^b mod m, where m is the modulus of ctx, left to right sliding window exponentiation with a window chosen from the size of b, res = 1 mod m for b <= 0
+{
+    bit_iter_t it;
+
+    BNZ_STATS_CALL(a->size + b->size);
+
+    bit_iter_init(&it, b->digits, b->size);
+    bnz_mod_pow_window_ctx(res, a, b, ctx, bnz_mod_pow_window((uint32_t)(it.bit + 1)));
+}
+
+void bnz_mod_pow_window_ctx(bnz_t *res, const bnz_t *a, const bnz_t *b, bnz_mod_ctx *ctx, uint32_t w) // res = a^b mod m, where m is the modulus of ctx, left to right sliding window exponentiation with windows of up to w bits (1 <= w <= MOD_POW_MAX_WINDOW, w = 1 is plain square and multiply) over a table of the odd powers a, a^3, ..., a^(2^w - 1), with Montgomery multiplication for odd m and Barrett reduction otherwise, b is read in place and not modified, res = 1 mod m for b <= 0
+{
+    uint64_t *base, *acc, *one, *table = NULL;
+    size_t k = ctx->len, t;
+    uint32_t window, len;
+    bool started = false;
+    bit_iter_t it;
+
+    BNZ_STATS_CALL(a->size + b->size);
+
+    if (k == 0) {
+        bnz_set_i32(res, 0);
+        return;
+    }
+    base = ctx->ws + 6 * k + 5;
+    acc = base + k;
+
+    bnz_get_residue_ctx(base, a, ctx);
+    if (ctx->montgomery == true) mont_mul_uint64_arr(base, base, ctx->r2, ctx->m, ctx->m_inv, k, ctx->ws); // base = base * 2^(64 k) mod m
+
+    bit_iter_init(&it, b->digits, b->sign == 1 ? 0 : b->size); // b < 0 is treated as b = 0
+
+    if (w < 1 || w > MOD_POW_MAX_WINDOW) w = 1;
+    if (w > 1 && it.bit >= 0) {
+        table = bnz_scratch_alloc(((size_t)1 << (w - 1)) * k); // table[t] = base^(2 t + 1)
+        if (!table) w = 1;
+    }
+    if (w == 1) {
+        table = base;
+    } else if (it.bit >= 0) {
+        memcpy(table, base, k * sizeof(uint64_t));
+        bnz_sqrmod_residue_ctx(acc, base, ctx); // acc = base^2, briefly
+        for (t = 1; t < ((size_t)1 << (w - 1)); t++) {
+            bnz_mulmod_residues_ctx(table + t * k, table + (t - 1) * k, acc, ctx);
+        }
+    }
+
+    while (bit_iter_next_window(&it, w, &window, &len) == true) { // one squaring for every bit consumed, zero or in the window, and one multiplication per window
+        if (started == true) {
+            for (; len > 0; len--) {
+                bnz_sqrmod_residue_ctx(acc, acc, ctx);
+            }
+            bnz_mulmod_residues_ctx(acc, acc, table + (window >> 1) * k, ctx);
+        } else {
+            memcpy(acc, table + (window >> 1) * k, k * sizeof(uint64_t));
+            started = true;
+        }
+    }
+    if (started == true) {
+        for (; len > 0; len--) { // zero bits below the last window
+            bnz_sqrmod_residue_ctx(acc, acc, ctx);
+        }
+    }
+
+    if (table != base && table != NULL) bnz_scratch_free(table);
+
+    if (started == false) { // b <= 0, res = 1 mod m
+        memset(acc, 0, k * sizeof(uint64_t));
+        acc[0] = (k > 1 || ctx->m[0] > 1) ? 1 : 0;
+    } else if (ctx->montgomery == true) { // convert out of Montgomery form, acc = acc * 1 * 2^(-64 k) mod m
+        one = ctx->ws + k + 2;
+        memset(one, 0, k * sizeof(uint64_t));
+        one[0] = 1;
+        mont_mul_uint64_arr(acc, acc, one, ctx->m, ctx->m_inv, k, ctx->ws);
+    }
+
+    bnz_set_limbs(res, acc, k);
+}
+
+/* U256 DEFINES */
+
+typedef struct {
+    uint64_t d[4]; // 64 bit limbs, least significant limb first
+} u256_t; // fixed width 256 bit unsigned integer, held on the stack
+
+typedef struct {
+    uint64_t d[8]; // 64 bit limbs, least significant limb first
+} u512_t; // fixed width 512 bit unsigned integer, holds the full product of two u256_t
+
+/* U256 FUNCTIONS */
+
+void u256_set_ui64(u256_t *, uint64_t);
+void u256_set_bnz(u256_t *, const bnz_t *);
+void u256_get_bnz(bnz_t *, const u256_t *);
+void u256_set_bytes(u256_t *, const uint8_t *);
+void u256_get_bytes(uint8_t *, const u256_t *);
+
+int32_t u256_cmp(const u256_t *, const u256_t *);
+bool u256_is_zero(const u256_t *);
+bool u256_is_one(const u256_t *);
+bool u256_bit_set(const u256_t *, uint32_t);
+
+uint64_t u256_add(u256_t *, const u256_t *, const u256_t *);
+uint64_t u256_sub(u256_t *, const u256_t *, const u256_t *);
+void u256_shift_r1(u256_t *, const u256_t *, uint64_t);
+void mul_4x4_uint64_arr(uint64_t *, const uint64_t *, const uint64_t *);
+void sqr_4x4_uint64_arr(uint64_t *, const uint64_t *);
+#if U256_MULX
+void mul_4x4_mulx_uint64_arr(uint64_t *, const uint64_t *, const uint64_t *);
+void sqr_4x4_mulx_uint64_arr(uint64_t *, const uint64_t *);
+#endif
+bool mul_4x4_has_mulx(void);
+bool mul_4x4_self_check(void);
+void mul_4x4_select(void);
+void mul_4x4_first(uint64_t *, const uint64_t *, const uint64_t *);
+void sqr_4x4_first(uint64_t *, const uint64_t *);
+void u256_mul(u512_t *, const u256_t *, const u256_t *);
+void u256_sqr(u512_t *, const u256_t *);
+void u256_divide(u256_t *, u256_t *, const u256_t *, const u256_t *);
+void u512_mod_u256(u256_t *, const u512_t *, const u256_t *);
+
+void u256_mod(u256_t *, const u256_t *, const u256_t *);
+void u256_add_mod(u256_t *, const u256_t *, const u256_t *, const u256_t *);
+void u256_sub_mod(u256_t *, const u256_t *, const u256_t *, const u256_t *);
+void u256_mul_mod(u256_t *, const u256_t *, const u256_t *, const u256_t *);
+void u256_inv_mod(u256_t *, const u256_t *, const u256_t *);
+
+void (*mul_4x4)(uint64_t *, const uint64_t *, const uint64_t *) = mul_4x4_first; // 4 by 4 limb multiplication kernel behind u256_mul and sc_mul, chosen by mul_4x4_select on first use
+void (*sqr_4x4)(uint64_t *, const uint64_t *) = sqr_4x4_first; // 4 limb squaring kernel behind u256_sqr and sc_sqr, chosen by mul_4x4_select on first use
+
+void mul_4x4_uint64_arr(uint64_t *res, const uint64_t *a, const uint64_t *b) // res = a * b for 4 limb a and b, portable kernel of fully unrolled rows of 128 bit products, res holds 8 limbs and may alias a or b
+{
+    uint64_t t[8] = {0}, carry;
+    uint128_t p;
+    int i, j;
+
+    for (i = 0; i < 4; i++) {
+        carry = 0;
+        for (j = 0; j < 4; j++) {
+            p = (uint128_t)a[j] * b[i] + t[i + j] + carry;
+            t[i + j] = (uint64_t)p;
+            carry = (uint64_t)(p >> 64);
+        }
+        t[i + 4] = carry;
+    }
+
+    memcpy(res, t, sizeof(t));
+}
+
+void sqr_4x4_uint64_arr(uint64_t *res, const uint64_t *a) // res = a * a for 4 limb a, portable kernel computing the 6 cross products once and doubling, res holds 8 limbs and may alias a
+{
+    uint64_t t[8] = {0}, carry;
+    uint128_t p;
+    int i, j;
+
+    for (i = 0; i < 3; i++) { // cross products
+        carry = 0;
+        for (j = i + 1; j < 4; j++) {
+            p = (uint128_t)a[i] * a[j] + t[i + j] + carry;
+            t[i + j] = (uint64_t)p;
+            carry = (uint64_t)(p >> 64);
+        }
+        t[i + 4] = carry;
+    }
+
+    for (i = 7; i > 0; i--) t[i] = (t[i] << 1) | (t[i - 1] >> 63); // double the cross products, t[0] is zero
+
+    carry = 0;
+    for (i = 0; i < 4; i++) { // add the squares a[i]^2 on the diagonal
+        p = (uint128_t)a[i] * a[i] + t[2 * i] + carry;
+        t[2 * i] = (uint64_t)p;
+        p = (uint128_t)t[2 * i + 1] + (uint64_t)(p >> 64);
+        t[2 * i + 1] = (uint64_t)p;
+        carry = (uint64_t)(p >> 64);
+    }
+
+    memcpy(res, t, sizeof(t));
+}
+
+#if U256_MULX
+void mul_4x4_mulx_uint64_arr(uint64_t *res, const uint64_t *a, const uint64_t *b) // res = a * b for 4 limb a and b, hand scheduled BMI2/ADX kernel, each row of 4 mulx products is added with two interleaved carry chains, the low halves with adcx on the carry flag and the high halves with adox on the overflow flag, res holds 8 limbs and may alias a or b, requires mul_4x4_has_mulx()
+{
+    uint64_t t[8];
+
+    __asm__(
+        "movq 0(%[b]), %%rdx\n\t" // row 0: a * b[0] at t[0..4]
+        "mulxq 0(%[a]), %%r8, %%r9\n\t"
+        "mulxq 8(%[a]), %%rax, %%r10\n\t"
+        "addq %%rax, %%r9\n\t"
+        "mulxq 16(%[a]), %%rax, %%r11\n\t"
+        "adcq %%rax, %%r10\n\t"
+        "mulxq 24(%[a]), %%rax, %%r12\n\t"
+        "adcq %%rax, %%r11\n\t"
+        "adcq $0, %%r12\n\t"
+        "movq %%r8, 0(%[t])\n\t"
+        "movl $0, %%r14d\n\t" // adcx has no immediate form
+        "movq 8(%[b]), %%rdx\n\t" // row 1: a * b[1] at t[1..5], low halves on the carry flag and high halves on the overflow flag
+        "xorl %%r13d, %%r13d\n\t" // clears both flags
+        "mulxq 0(%[a]), %%rax, %%rbx\n\t"
+        "adcxq %%rax, %%r9\n\t"
+        "adoxq %%rbx, %%r10\n\t"
+        "mulxq 8(%[a]), %%rax, %%rbx\n\t"
+        "adcxq %%rax, %%r10\n\t"
+        "adoxq %%rbx, %%r11\n\t"
+        "mulxq 16(%[a]), %%rax, %%rbx\n\t"
+        "adcxq %%rax, %%r11\n\t"
+        "adoxq %%rbx, %%r12\n\t"
+        "mulxq 24(%[a]), %%rax, %%rbx\n\t"
+        "adcxq %%rax, %%r12\n\t"
+        "adoxq %%rbx, %%r13\n\t"
+        "adcxq %%r14, %%r13\n\t"
+        "movq %%r9, 8(%[t])\n\t"
+        "movq 16(%[b]), %%rdx\n\t" // row 2: a * b[2] at t[2..6], low halves on the carry flag and high halves on the overflow flag
+        "xorl %%r8d, %%r8d\n\t" // clears both flags
+        "mulxq 0(%[a]), %%rax, %%rbx\n\t"
+        "adcxq %%rax, %%r10\n\t"
+        "adoxq %%rbx, %%r11\n\t"
+        "mulxq 8(%[a]), %%rax, %%rbx\n\t"
+        "adcxq %%rax, %%r11\n\t"
+        "adoxq %%rbx, %%r12\n\t"
+        "mulxq 16(%[a]), %%rax, %%rbx\n\t"
+        "adcxq %%rax, %%r12\n\t"
+        "adoxq %%rbx, %%r13\n\t"
+        "mulxq 24(%[a]), %%rax, %%rbx\n\t"
+        "adcxq %%rax, %%r13\n\t"
+        "adoxq %%rbx, %%r8\n\t"
+        "adcxq %%r14, %%r8\n\t"
+        "movq %%r10, 16(%[t])\n\t"
+        "movq 24(%[b]), %%rdx\n\t" // row 3: a * b[3] at t[3..7], low halves on the carry flag and high halves on the overflow flag
+        "xorl %%r9d, %%r9d\n\t" // clears both flags
+        "mulxq 0(%[a]), %%rax, %%rbx\n\t"
+        "adcxq %%rax, %%r11\n\t"
+        "adoxq %%rbx, %%r12\n\t"
+        "mulxq 8(%[a]), %%rax, %%rbx\n\t"
+        "adcxq %%rax, %%r12\n\t"
+        "adoxq %%rbx, %%r13\n\t"
+        "mulxq 16(%[a]), %%rax, %%rbx\n\t"
+        "adcxq %%rax, %%r13\n\t"
+        "adoxq %%rbx, %%r8\n\t"
+        "mulxq 24(%[a]), %%rax, %%rbx\n\t"
+        "adcxq %%rax, %%r8\n\t"
+        "adoxq %%rbx, %%r9\n\t"
+        "adcxq %%r14, %%r9\n\t"
+        "movq %%r11, 24(%[t])\n\t"
+        "movq %%r12, 32(%[t])\n\t"
+        "movq %%r13, 40(%[t])\n\t"
+        "movq %%r8, 48(%[t])\n\t"
+        "movq %%r9, 56(%[t])\n\t"
+        :
+        : [a] "r"(a), [b] "r"(b), [t] "r"(t)
+        : "rax", "rbx", "rdx", "r8", "r9", "r10", "r11", "r12", "r13", "r14", "cc", "memory");
+
+    memcpy(res, t, sizeof(t));
+}
+
+void sqr_4x4_mulx_uint64_arr(uint64_t *res, const uint64_t *a) // res = a * a for 4 limb a, hand scheduled BMI2/ADX kernel, the 6 cross products are added with interleaved carry chains as in mul_4x4_mulx_uint64_arr, doubled, and the diagonal squares added on one carry chain, res holds 8 limbs and may alias a, requires mul_4x4_has_mulx()
+{
+    uint64_t t[8];
+
+    __asm__(
+        "movq 0(%[a]), %%rdx\n\t" // row 0: a[0] * a[1..3] at t[1..4]
+        "mulxq 8(%[a]), %%r9, %%r10\n\t"
+        "mulxq 16(%[a]), %%rax, %%r11\n\t"
+        "addq %%rax, %%r10\n\t"
+        "mulxq 24(%[a]), %%rax, %%r12\n\t"
+        "adcq %%rax, %%r11\n\t"
+        "adcq $0, %%r12\n\t"
+        "movq 8(%[a]), %%rdx\n\t" // row 1: a[1] * a[2..3] at t[3..5], on the carry and overflow flags
+        "xorl %%r13d, %%r13d\n\t"
+        "mulxq 16(%[a]), %%rax, %%rbx\n\t"
+        "adcxq %%rax, %%r11\n\t"
+        "adoxq %%rbx, %%r12\n\t"
+        "mulxq 24(%[a]), %%rax, %%rbx\n\t"
+        "adcxq %%rax, %%r12\n\t"
+        "adoxq %%rbx, %%r13\n\t"
+        "movl $0, %%ecx\n\t"
+        "adcxq %%rcx, %%r13\n\t"
+        "movq 16(%[a]), %%rdx\n\t" // row 2: a[2] * a[3] at t[5..6]
+        "mulxq 24(%[a]), %%rax, %%r14\n\t"
+        "addq %%rax, %%r13\n\t"
+        "adcq $0, %%r14\n\t"
+        "xorl %%r15d, %%r15d\n\t" // double the cross products into t[1..7]
+        "addq %%r9, %%r9\n\t"
+        "adcq %%r10, %%r10\n\t"
+        "adcq %%r11, %%r11\n\t"
+        "adcq %%r12, %%r12\n\t"
+        "adcq %%r13, %%r13\n\t"
+        "adcq %%r14, %%r14\n\t"
+        "adcq %%r15, %%r15\n\t"
+        "movq 0(%[a]), %%rdx\n\t" // add the squares a[i]^2 on the diagonal, mulx leaves the carry flag alone
+        "mulxq %%rdx, %%r8, %%rax\n\t"
+        "addq %%rax, %%r9\n\t"
+        "movq 8(%[a]), %%rdx\n\t"
+        "mulxq %%rdx, %%rax, %%rbx\n\t"
+        "adcq %%rax, %%r10\n\t"
+        "adcq %%rbx, %%r11\n\t"
+        "movq 16(%[a]), %%rdx\n\t"
+        "mulxq %%rdx, %%rax, %%rbx\n\t"
+        "adcq %%rax, %%r12\n\t"
+        "adcq %%rbx, %%r13\n\t"
+        "movq 24(%[a]), %%rdx\n\t"
+        "mulxq %%rdx, %%rax, %%rbx\n\t"
+        "adcq %%rax, %%r14\n\t"
+        "adcq %%rbx, %%r15\n\t"
+        "movq %%r8, 0(%[t])\n\t"
+        "movq %%r9, 8(%[t])\n\t"
+        "movq %%r10, 16(%[t])\n\t"
+        "movq %%r11, 24(%[t])\n\t"
+        "movq %%r12, 32(%[t])\n\t"
+        "movq %%r13, 40(%[t])\n\t"
+        "movq %%r14, 48(%[t])\n\t"
+        "movq %%r15, 56(%[t])\n\t"
+        :
+        : [a] "r"(a), [t] "r"(t)
+        : "rax", "rbx", "rcx", "rdx", "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15", "cc", "memory");
+
+    memcpy(res, t, sizeof(t));
+}
+#endif
+
+bool mul_4x4_has_mulx(void) // return true if the processor supports the BMI2 (mulx) and ADX (adcx and adox) instructions, read from cpuid leaf 7, always false if the kernels are not compiled in
+{
+#if U256_MULX
+    unsigned int eax, ebx, ecx, edx;
+
+    if (__get_cpuid_max(0, NULL) < 7) return false;
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return (ebx & (1 << 8)) != 0 && (ebx & (1 << 19)) != 0; // BMI2 and ADX
+#else
+    return false;
+#endif
+}
+
+bool mul_4x4_self_check(void) // run the portable and the BMI2/ADX kernels on the same vectors, carry edge cases and pseudorandom limbs, return true if every product and square agrees, or if the BMI2/ADX kernels are unavailable
+{
+#if U256_MULX
+    uint64_t a[4], b[4], r1[8], r2[8], x = 0x243F6A8885A308D3ULL;
+    uint32_t i, j;
+
+    if (mul_4x4_has_mulx() == false) return true;
+
+    for (i = 0; i < 64; i++) {
+        for (j = 0; j < 4; j++) {
+            x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+            a[j] = i < 8 ? (i & 1 ? ~0ULL : 0) ^ (i & 2 ? 1ULL << 63 : 0) ^ (i & 4 ? j : 0) : x; // 0, all ones and nearby values first, to exercise every carry
+            b[j] = i < 8 ? ~0ULL - (i & 6) : x ^ (x >> 29);
+        }
+        mul_4x4_uint64_arr(r1, a, b);
+        mul_4x4_mulx_uint64_arr(r2, a, b);
+        if (memcmp(r1, r2, sizeof(r1)) != 0) return false;
+        sqr_4x4_uint64_arr(r1, a);
+        sqr_4x4_mulx_uint64_arr(r2, a);
+        if (memcmp(r1, r2, sizeof(r1)) != 0) return false;
+    }
+#endif
+    return true;
+}
+
+void mul_4x4_select(void) // point mul_4x4 and sqr_4x4 at the BMI2/ADX kernels if the processor supports them and they pass mul_4x4_self_check, otherwise at the portable kernels
+{
+#if U256_MULX
+    if (mul_4x4_has_mulx() == true && mul_4x4_self_check() == true) {
+        mul_4x4 = mul_4x4_mulx_uint64_arr;
+        sqr_4x4 = sqr_4x4_mulx_uint64_arr;
+        return;
+    }
+#endif
+    mul_4x4 = mul_4x4_uint64_arr;
+    sqr_4x4 = sqr_4x4_uint64_arr;
+}
+
+void mul_4x4_first(uint64_t *res, const uint64_t *a, const uint64_t *b) // initial value of mul_4x4, selects the kernels on first use and then multiplies
+{
+    mul_4x4_select();
+    mul_4x4(res, a, b);
+}
+
+void sqr_4x4_first(uint64_t *res, const uint64_t *a) // initial value of sqr_4x4, selects the kernels on first use and then squares
+{
+    mul_4x4_select();
+    sqr_4x4(res, a);
+}
+
+void u256_set_ui64(u256_t *res, uint64_t val) // res = val
+{
+    res->d[0] = val;
+    res->d[1] = 0;
+    res->d[2] = 0;
+    res->d[3] = 0;
+}
+
+void u256_set_bnz(u256_t *res, const bnz_t *a) // res = |a|, bytes above the 32nd are ignored
+{
+    bnz_get_limbs(res->d, 4, a);
+}
+
+void u256_get_bnz(bnz_t *res, const u256_t *a) // res = a, trimmed
+{
+    bnz_set_limbs(res, a->d, 4);
+}
+
+void u256_set_bytes(u256_t *res, const uint8_t *bytes) // res = 32 bytes in big endian order, e.g. a hash or HMAC output
+{
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        res->d[3 - i] = (uint64_t)bytes[8 * i] << 56 | (uint64_t)bytes[8 * i + 1] << 48 | (uint64_t)bytes[8 * i + 2] << 40 | (uint64_t)bytes[8 * i + 3] << 32 |
+                        (uint64_t)bytes[8 * i + 4] << 24 | (uint64_t)bytes[8 * i + 5] << 16 | (uint64_t)bytes[8 * i + 6] << 8 | (uint64_t)bytes[8 * i + 7];
+    }
+}
+
+void u256_get_bytes(uint8_t *bytes, const u256_t *a) // write a as 32 bytes in big endian order
+{
+    int i, j;
+
+    for (i = 0; i < 4; i++) {
+        for (j = 0; j < 8; j++) {
+            bytes[8 * i + j] = (uint8_t)(a->d[3 - i] >> (56 - 8 * j));
+        }
+    }
+}
+
+int32_t u256_cmp(const u256_t *a, const u256_t *b) // return -1 if a < b, 0 if a == b, and 1 if a > b
+{
+    return cmp_uint64_arr(a->d, b->d, 4);
+}
+
+bool u256_is_zero(const u256_t *a)
+{
+    return (a->d[0] | a->d[1] | a->d[2] | a->d[3]) == 0;
+}
+
+bool u256_is_one(const u256_t *a)
+{
+    return a->d[0] == 1 && (a->d[1] | a->d[2] | a->d[3]) == 0;
+}
+
+bool u256_bit_set(const u256_t *a, uint32_t bit) // return true if bit number bit (counting from the lsb) of a is set
+{
+    return (a->d[bit / 64] >> (bit % 64)) & 1;
+}
+
+uint64_t u256_add(u256_t *res, const u256_t *a, const u256_t *b) // res = a + b mod 2^256, return the carry, res may alias a or b
+{
+    return add_uint64_arr(res->d, a->d, b->d, 4);
+}
+
+uint64_t u256_sub(u256_t *res, const u256_t *a, const u256_t *b) // res = a - b mod 2^256, return the borrow, res may alias a or b
+{
+    return sub_uint64_arr(res->d, a->d, b->d, 4);
+}
+
+void u256_shift_r1(u256_t *res, const u256_t *a, uint64_t top) // res = (top * 2^256 + a) / 2 for top = 0 or 1, i.e. a right shift that brings back a carry bit, res may alias a
+{
+    res->d[0] = (a->d[0] >> 1) | (a->d[1] << 63);
+    res->d[1] = (a->d[1] >> 1) | (a->d[2] << 63);
+    res->d[2] = (a->d[2] >> 1) | (a->d[3] << 63);
+    res->d[3] = (a->d[3] >> 1) | (top << 63);
+}
+
+void u256_mul(u512_t *res, const u256_t *a, const u256_t *b) // res = a * b, res holds the full 512 bit product
+{
+    mul_4x4(res->d, a->d, b->d);
+}
+void u256_sqr(u512_t *res, const u256_t *a) // res = a * a, res holds the full 512 bit product
+{
+    sqr_4x4(res->d, a->d);
+}
+
+
+void u256_divide(u256_t *q, u256_t *r, const u256_t *a, const u256_t *b) // q = a / b and r = a % b, q and r are set to zero if b == 0
+{
+    u256_t qq, rr;
+    size_t a_len = 4, b_len = 4;
+
+    while (b_len > 0 && b->d[b_len - 1] == 0) b_len--;
+    while (a_len > 0 && a->d[a_len - 1] == 0) a_len--;
+
+    u256_set_ui64(&qq, 0);
+    u256_set_ui64(&rr, 0);
+
+    if (b_len == 0) { // division by zero
+        *q = qq;
+        *r = rr;
+        return;
+    }
+
+    if (a_len < b_len) { // a < b
+        rr = *a;
+    } else {
+        divide_uint64_arr(qq.d, rr.d, a->d, a_len, b->d, b_len);
+    }
+
+    *q = qq;
+    *r = rr;
+}
+
+void u512_mod_u256(u256_t *res, const u512_t *a, const u256_t *m) // res = a mod m, m != 0
+{
+    uint64_t q[8];
+    u256_t rr;
+    size_t m_len = 4;
+
+    while (m_len > 0 && m->d[m_len - 1] == 0) m_len--;
+
+    u256_set_ui64(&rr, 0);
+    divide_uint64_arr(q, rr.d, a->d, 8, m->d, m_len);
+
+    *res = rr;
+}
+
+void u256_mod(u256_t *res, const u256_t *a, const u256_t *m) // res = a mod m
+{
+    u256_t q;
+
+    if (u256_cmp(a, m) == -1) {
+        *res = *a;
+    } else if (m->d[3] >> 63) { // m > 2^255, so a < 2m and a single subtraction is sufficient
+        u256_sub(res, a, m);
+    } else {
+        u256_divide(&q, res, a, m);
+    }
+}
+
+void u256_add_mod(u256_t *res, const u256_t *a, const u256_t *b, const u256_t *m) // res = (a + b) mod m for a, b < m
+{
+    uint64_t carry = u256_add(res, a, b);
+
+    if (carry || u256_cmp(res, m) >= 0) u256_sub(res, res, m);
+}
+
+void u256_sub_mod(u256_t *res, const u256_t *a, const u256_t *b, const u256_t *m) // res = (a - b) mod m for a, b < m
+{
+    if (u256_sub(res, a, b)) u256_add(res, res, m);
+}
+
+void u256_mul_mod(u256_t *res, const u256_t *a, const u256_t *b, const u256_t *m) // res = (a * b) mod m
+{
+    u512_t t;
+
+    u256_mul(&t, a, b);
+    u512_mod_u256(res, &t, m);
+}
+
+void u256_inv_mod(u256_t *res, const u256_t *a, const u256_t *m) // res = modular multiplicative inverse of a mod m for odd m, binary extended Euclidean algorithm, res = 0 if a == 0
+{
+    u256_t u, v, x1, x2;
+    uint64_t carry;
+
+    u256_mod(&u, a, m);
+
+    if (u256_is_zero(&u) == true) {
+        u256_set_ui64(res, 0);
+        return;
+    }
+
+    v = *m;
+    u256_set_ui64(&x1, 1);
+    u256_set_ui64(&x2, 0);
+
+    // invariants: x1 * a = u mod m and x2 * a = v mod m
+    while (u256_is_one(&u) == false && u256_is_one(&v) == false) {
+        if (u256_is_zero(&u) == true) { // gcd(a, m) > 1, no inverse exists
+            u256_set_ui64(res, 0);
+            return;
+        }
+        while ((u.d[0] & 1) == 0) { // halve u, and halve x1 mod m
+            u256_shift_r1(&u, &u, 0);
+            carry = (x1.d[0] & 1) ? u256_add(&x1, &x1, m) : 0; // x1 + m is even if x1 is odd, since m is odd
+            u256_shift_r1(&x1, &x1, carry);
+        }
+        while ((v.d[0] & 1) == 0) { // halve v, and halve x2 mod m
+            u256_shift_r1(&v, &v, 0);
+            carry = (x2.d[0] & 1) ? u256_add(&x2, &x2, m) : 0;
+            u256_shift_r1(&x2, &x2, carry);
+        }
+        if (u256_cmp(&u, &v) >= 0) {
+            u256_sub(&u, &u, &v);
+            u256_sub_mod(&x1, &x1, &x2, m);
+        } else {
+            u256_sub(&v, &v, &u);
+            u256_sub_mod(&x2, &x2, &x1, m);
+        }
+    }
+
+    if (u256_is_one(&u) == true) {
+        *res = x1;
+    } else {
+        *res = x2;
+    }
+}
+
+/* SAFEGCD DEFINES */
+
+#define S62_M 0x3FFFFFFFFFFFFFFFULL // 62 bit limb mask
+
+typedef __int128 int128_t; // gcc extension, holds the full signed product of two 64 bit limbs
+
+typedef struct {
+    int64_t v[5]; // signed 62 bit limbs, least significant limb first, value = v[0] + v[1] * 2^62 + v[2] * 2^124 + v[3] * 2^186 + v[4] * 2^248
+} s62_t; // signed 256 bit integer for the safegcd modular inverse, held on the stack
+
+typedef struct {
+    s62_t m; // modulus, with limbs chosen to be small or zero where possible
+    uint64_t m_inv; // m^(-1) mod 2^62
+} s62_mod_t; // odd modulus for s62_inv
+
+typedef struct {
+    int64_t u, v, q, r; // [[u, v], [q, r]], scaled by 2^62
+} s62_trans_t; // transition matrix of 59 divsteps
+
+/*
+
+s62_inv computes a modular inverse with the "safegcd" algorithm of Bernstein and Yang ("Fast constant-time gcd computation
+and modular inversion", 2019), following the 62 bit limb implementation in libsecp256k1. Each "divstep" replaces (f, g) with
+(g, (g - f) / 2) or (f, (g + (g & 1) * f) / 2) depending on the sign of a counter delta and the parity of g. Only the low 64
+bits of f and g are needed to decide 59 divsteps, so each batch is computed on single words (s62_divsteps_59) and returned
+as a 2x2 matrix, which is then applied to the full f and g (s62_update_fg) and to the Bezout coefficients d and e, kept mod m
+(s62_update_de). For a 256 bit modulus, 590 divsteps (10 batches) always reach g = 0 and f = +/-1, with d = +/-(1 / x) mod m.
+There are no divisions and no branches on the value being inverted, so every inversion takes the same time.
+
+*/
+
+/* SAFEGCD GLOBAL VARIABLES */
+
+const s62_mod_t s62_mod_p = {{{-0x1000003D1LL, 0, 0, 0, 256}}, 0x27C7F6E22DDACACFULL}; // secp256k1.p = -0x1000003D1 + 256 * 2^248
+const s62_mod_t s62_mod_n = {{{0x3FD25E8CD0364141LL, 0x2ABB739ABD2280EELL, -0x15LL, 0, 256}}, 0x34F20099AA774EC1ULL}; // secp256k1.n
+
+/* SAFEGCD FUNCTIONS */
+
+void s62_set_u256(s62_t *, const u256_t *);
+void s62_get_u256(u256_t *, const s62_t *);
+int64_t s62_divsteps_59(int64_t, uint64_t, uint64_t, s62_trans_t *);
+void s62_update_de(s62_t *, s62_t *, const s62_trans_t *, const s62_mod_t *);
+void s62_update_fg(s62_t *, s62_t *, const s62_trans_t *);
+void s62_normalize(s62_t *, int64_t, const s62_mod_t *);
+void s62_inv(s62_t *, const s62_mod_t *);
+
+void s62_set_u256(s62_t *res, const u256_t *a) // res = a, split into 62 bit limbs
+{
+    res->v[0] = (int64_t)(a->d[0] & S62_M);
+    res->v[1] = (int64_t)((a->d[0] >> 62 | a->d[1] << 2) & S62_M);
+    res->v[2] = (int64_t)((a->d[1] >> 60 | a->d[2] << 4) & S62_M);
+    res->v[3] = (int64_t)((a->d[2] >> 58 | a->d[3] << 6) & S62_M);
+    res->v[4] = (int64_t)(a->d[3] >> 56);
+}
+
+void s62_get_u256(u256_t *res, const s62_t *a) // res = a, where a is normalized, i.e. every limb is in [0, 2^62)
+{
+    res->d[0] = (uint64_t)a->v[0] | (uint64_t)a->v[1] << 62;
+    res->d[1] = (uint64_t)a->v[1] >> 2 | (uint64_t)a->v[2] << 60;
+    res->d[2] = (uint64_t)a->v[2] >> 4 | (uint64_t)a->v[3] << 58;
+    res->d[3] = (uint64_t)a->v[3] >> 6 | (uint64_t)a->v[4] << 56;
+}
+
+int64_t s62_divsteps_59(int64_t zeta, uint64_t f0, uint64_t g0, s62_trans_t *t) // perform 59 divsteps on the low words f0 and g0, with zeta = -(delta + 1/2), return the new zeta and the transition matrix scaled by 2^62, in constant time
+{
+    uint64_t u = 8, v = 0, q = 0, r = 8; // the matrix starts as the identity scaled by 2^3, since 59 doublings bring it to 2^62
+    uint64_t mask1, mask2, f = f0, g = g0, x, y, z;
+    volatile uint64_t c1, c2; // volatile, so that the compiler does not turn the masks back into branches
+    int i;
+
+    for (i = 3; i < 62; i++) {
+        c1 = (uint64_t)(zeta >> 63); // all ones if zeta < 0, i.e. delta > 0
+        mask1 = c1;
+        c2 = g & 1;
+        mask2 = -c2; // all ones if g is odd
+        x = (f ^ mask1) - mask1; // x = -f if delta > 0, else f
+        y = (u ^ mask1) - mask1;
+        z = (v ^ mask1) - mask1;
+        g += x & mask2; // if g is odd, g = g - f or g = g + f
+        q += y & mask2;
+        r += z & mask2;
+        mask1 &= mask2; // swap if delta > 0 and g is odd
+        zeta = (zeta ^ (int64_t)mask1) - 1; // zeta = -zeta - 2 on a swap, else zeta - 1
+        f += g & mask1; // on a swap, f = g - f + f = g, the old g
+        u += q & mask1;
+        v += r & mask1;
+        g >>= 1; // g is now even
+        u <<= 1;
+        v <<= 1;
+    }
+    t->u = (int64_t)u;
+    t->v = (int64_t)v;
+    t->q = (int64_t)q;
+    t->r = (int64_t)r;
+
+    return zeta;
+}
+
+void s62_update_de(s62_t *d, s62_t *e, const s62_trans_t *t, const s62_mod_t *mod) // [d, e] = t * [d, e] / 2^62 mod m, adding multiples of m to make the sums divisible by 2^62, d and e stay in (-2 m, m)
+{
+    const int64_t d0 = d->v[0], d1 = d->v[1], d2 = d->v[2], d3 = d->v[3], d4 = d->v[4];
+    const int64_t e0 = e->v[0], e1 = e->v[1], e2 = e->v[2], e3 = e->v[3], e4 = e->v[4];
+    const int64_t u = t->u, v = t->v, q = t->q, r = t->r;
+    int64_t md, me, sd, se;
+    int128_t cd, ce;
+
+    sd = d4 >> 63; // all ones if d < 0
+    se = e4 >> 63;
+    md = (u & sd) + (v & se); // [md, me] = [u, q] if d < 0, plus [v, r] if e < 0, keeping the result above -2 m
+    me = (q & sd) + (r & se);
+
+    cd = (int128_t)u * d0 + (int128_t)v * e0;
+    ce = (int128_t)q * d0 + (int128_t)r * e0;
+    md -= (int64_t)((mod->m_inv * (uint64_t)cd + (uint64_t)md) & S62_M); // choose md so that the low 62 bits of t * [d, e] + m * [md, me] are zero
+    me -= (int64_t)((mod->m_inv * (uint64_t)ce + (uint64_t)me) & S62_M);
+    cd += (int128_t)mod->m.v[0] * md;
+    ce += (int128_t)mod->m.v[0] * me;
+    cd >>= 62; // the low 62 bits are zero, and are discarded
+    ce >>= 62;
+
+    cd += (int128_t)u * d1 + (int128_t)v * e1;
+    ce += (int128_t)q * d1 + (int128_t)r * e1;
+    if (mod->m.v[1]) {
+        cd += (int128_t)mod->m.v[1] * md;
+        ce += (int128_t)mod->m.v[1] * me;
+    }
+    d->v[0] = (int64_t)((uint64_t)cd & S62_M);
+    e->v[0] = (int64_t)((uint64_t)ce & S62_M);
+    cd >>= 62;
+    ce >>= 62;
+
+    cd += (int128_t)u * d2 + (int128_t)v * e2;
+    ce += (int128_t)q * d2 + (int128_t)r * e2;
+    if (mod->m.v[2]) {
+        cd += (int128_t)mod->m.v[2] * md;
+        ce += (int128_t)mod->m.v[2] * me;
+    }
+    d->v[1] = (int64_t)((uint64_t)cd & S62_M);
+    e->v[1] = (int64_t)((uint64_t)ce & S62_M);
+    cd >>= 62;
+    ce >>= 62;
+
+    cd += (int128_t)u * d3 + (int128_t)v * e3;
+    ce += (int128_t)q * d3 + (int128_t)r * e3;
+    if (mod->m.v[3]) {
+        cd += (int128_t)mod->m.v[3] * md;
+        ce += (int128_t)mod->m.v[3] * me;
+    }
+    d->v[2] = (int64_t)((uint64_t)cd & S62_M);
+    e->v[2] = (int64_t)((uint64_t)ce & S62_M);
+    cd >>= 62;
+    ce >>= 62;
+
+    cd += (int128_t)u * d4 + (int128_t)v * e4;
+    ce += (int128_t)q * d4 + (int128_t)r * e4;
+    cd += (int128_t)mod->m.v[4] * md;
+    ce += (int128_t)mod->m.v[4] * me;
+    d->v[3] = (int64_t)((uint64_t)cd & S62_M);
+    e->v[3] = (int64_t)((uint64_t)ce & S62_M);
+    cd >>= 62;
+    ce >>= 62;
+
+    d->v[4] = (int64_t)cd;
+    e->v[4] = (int64_t)ce;
+}
+
+void s62_update_fg(s62_t *f, s62_t *g, const s62_trans_t *t) // [f, g] = t * [f, g] / 2^62, the division is exact
+{
+    const int64_t f0 = f->v[0], f1 = f->v[1], f2 = f->v[2], f3 = f->v[3], f4 = f->v[4];
+    const int64_t g0 = g->v[0], g1 = g->v[1], g2 = g->v[2], g3 = g->v[3], g4 = g->v[4];
+    const int64_t u = t->u, v = t->v, q = t->q, r = t->r;
+    int128_t cf, cg;
+
+    cf = (int128_t)u * f0 + (int128_t)v * g0;
+    cg = (int128_t)q * f0 + (int128_t)r * g0;
+    cf >>= 62; // the low 62 bits are zero, and are discarded
+    cg >>= 62;
+
+    cf += (int128_t)u * f1 + (int128_t)v * g1;
+    cg += (int128_t)q * f1 + (int128_t)r * g1;
+    f->v[0] = (int64_t)((uint64_t)cf & S62_M);
+    g->v[0] = (int64_t)((uint64_t)cg & S62_M);
+    cf >>= 62;
+    cg >>= 62;
+
+    cf += (int128_t)u * f2 + (int128_t)v * g2;
+    cg += (int128_t)q * f2 + (int128_t)r * g2;
+    f->v[1] = (int64_t)((uint64_t)cf & S62_M);
+    g->v[1] = (int64_t)((uint64_t)cg & S62_M);
+    cf >>= 62;
+    cg >>= 62;
+
+    cf += (int128_t)u * f3 + (int128_t)v * g3;
+    cg += (int128_t)q * f3 + (int128_t)r * g3;
+    f->v[2] = (int64_t)((uint64_t)cf & S62_M);
+    g->v[2] = (int64_t)((uint64_t)cg & S62_M);
+    cf >>= 62;
+    cg >>= 62;
+
+    cf += (int128_t)u * f4 + (int128_t)v * g4;
+    cg += (int128_t)q * f4 + (int128_t)r * g4;
+    f->v[3] = (int64_t)((uint64_t)cf & S62_M);
+    g->v[3] = (int64_t)((uint64_t)cg & S62_M);
+    cf >>= 62;
+    cg >>= 62;
+
+    f->v[4] = (int64_t)cf;
+    g->v[4] = (int64_t)cg;
+}
+
+void s62_normalize(s62_t *r, int64_t sign, const s62_mod_t *mod) // r = r mod m, negated if sign < 0, for r in (-2 m, m), leaving every limb in [0, 2^62), in constant time
+{
+    const int64_t M62 = (int64_t)S62_M;
+    int64_t r0 = r->v[0], r1 = r->v[1], r2 = r->v[2], r3 = r->v[3], r4 = r->v[4];
+    volatile int64_t cond_add, cond_negate;
+
+    cond_add = r4 >> 63; // add m if r < 0, bringing r into (-m, m)
+    r0 += mod->m.v[0] & cond_add;
+    r1 += mod->m.v[1] & cond_add;
+    r2 += mod->m.v[2] & cond_add;
+    r3 += mod->m.v[3] & cond_add;
+    r4 += mod->m.v[4] & cond_add;
+    cond_negate = sign >> 63; // negate if sign < 0
+    r0 = (r0 ^ cond_negate) - cond_negate;
+    r1 = (r1 ^ cond_negate) - cond_negate;
+    r2 = (r2 ^ cond_negate) - cond_negate;
+    r3 = (r3 ^ cond_negate) - cond_negate;
+    r4 = (r4 ^ cond_negate) - cond_negate;
+    r1 += r0 >> 62; // propagate carries, bringing the low limbs into [0, 2^62)
+    r0 &= M62;
+    r2 += r1 >> 62;
+    r1 &= M62;
+    r3 += r2 >> 62;
+    r2 &= M62;
+    r4 += r3 >> 62;
+    r3 &= M62;
+
+    cond_add = r4 >> 63; // add m again if r < 0, bringing r into [0, m)
+    r0 += mod->m.v[0] & cond_add;
+    r1 += mod->m.v[1] & cond_add;
+    r2 += mod->m.v[2] & cond_add;
+    r3 += mod->m.v[3] & cond_add;
+    r4 += mod->m.v[4] & cond_add;
+    r1 += r0 >> 62;
+    r0 &= M62;
+    r2 += r1 >> 62;
+    r1 &= M62;
+    r3 += r2 >> 62;
+    r2 &= M62;
+    r4 += r3 >> 62;
+    r3 &= M62;
+
+    r->v[0] = r0;
+    r->v[1] = r1;
+    r->v[2] = r2;
+    r->v[3] = r3;
+    r->v[4] = r4;
+}
+
+void s62_inv(s62_t *x, const s62_mod_t *mod) // x = x^(-1) mod m in place, for 0 <= x < m and a 256 bit odd modulus m, 10 batches of 59 divsteps, x = 0 if x = 0
+{
+    s62_t d = {{0, 0, 0, 0, 0}}, e = {{1, 0, 0, 0, 0}}, f = mod->m, g = *x;
+    s62_trans_t t;
+    int64_t zeta = -1; // zeta = -(delta + 1/2), with delta starting at 1/2
+    int i;
+
+    for (i = 0; i < 10; i++) {
+        zeta = s62_divsteps_59(zeta, (uint64_t)f.v[0], (uint64_t)g.v[0], &t);
+        s62_update_de(&d, &e, &t, mod);
+        s62_update_fg(&f, &g, &t);
+    }
+
+    s62_normalize(&d, f.v[4], mod); // f = +/-1 (or +/-gcd(x, m)), and d = f / x mod m, so the sign of f gives the sign of the inverse
+    *x = d;
+}
+
+/* FE DEFINES */
+
+#define FE_M 0xFFFFFFFFFFFFFULL // 52 bit limb mask
+#define FE_R 0x1000003D10ULL // 2^260 mod secp256k1.p, i.e. (2^256 mod secp256k1.p) << 4
+
+typedef struct {
+    uint64_t n[5]; // 52 bit limbs, least significant limb first, value = n[0] + n[1] * 2^52 + n[2] * 2^104 + n[3] * 2^156 + n[4] * 2^208
+} fe_t; // element of the secp256k1 field GF(secp256k1.p), held on the stack
+
+/*
+
+The spare 12 bits at the top of each 64 bit limb allow additions and small multiples to be accumulated without carrying or
+reducing. The "magnitude" of an fe_t bounds how far it can be from fully reduced: a magnitude m value has limbs of at most
+2 * m * (2^52 - 1) (2 * m * (2^48 - 1) for the top limb). fe_mul returns magnitude 1 and requires inputs of magnitude 8 or
+less; fe_add returns the sum of the input magnitudes; fe_negate(r, a, m) requires a to have magnitude m or less and returns
+magnitude m + 1. A value is only fully reduced mod secp256k1.p (fe_normalize) when it is compared or converted to a u256_t.
+
+*/
+
+#define FE4_M 0x3FFFFFFULL // 26 bit limb mask
+
+typedef struct {
+    uint64_t n[10][4]; // n[i][lane], 26 bit limbs of four independent field elements, least significant limb first, value of a lane = n[0][lane] + n[1][lane] * 2^26 + ... + n[9][lane] * 2^234
+} fe4_t; // four elements of the secp256k1 field side by side, one 256 bit vector per limb
+
+/*
+
+An fe4_t holds four field elements with each limb of the four in one 256 bit AVX2 vector, so that a single _mm256_mul_epu32
+multiplies the same limb pair of all four elements (32 x 32 -> 64 bit, which is why the limbs are 26 rather than 52 bits).
+The fe4 functions keep every result "weakly normalized": limbs 0 to 8 below 2^27 and limb 9 below 2^23, a value below
+2^261 that is not necessarily reduced mod secp256k1.p. The slack of one bit per limb lets the carries be taken side by side,
+each limb keeping its low 26 bits and passing the rest up at once, instead of rippling from limb 0 to limb 9, which would
+make the carries rather than the products the length of fe4_mul. There is no magnitude to track, every fe4_add and fe4_sub
+makes one such pass straight away, which costs little next to fe4_mul and keeps the point formulas free of bookkeeping.
+
+*/
+
+/* FE GLOBAL VARIABLES */
+
+const u256_t fe_p_minus_2 = {{0xFFFFFFFEFFFFFC2D, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF}}; // secp256k1.p - 2, exponent for the modular multiplicative inverse
+const u256_t fe_p_plus_1_div_4 = {{0xFFFFFFFFBFFFFF0C, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x3FFFFFFFFFFFFFFF}}; // (secp256k1.p + 1) / 4, exponent for the square root
+const uint64_t fe4_4p[10] = {0xFFFF0BC, 0xFFFFEFC, 0xFFFFFFC, 0xFFFFFFC, 0xFFFFFFC, 0xFFFFFFC, 0xFFFFFFC, 0xFFFFFFC, 0xFFFFFFC, 0xFFFFFC}; // 4 secp256k1.p limb by limb in 26 bit limbs, each above the largest weakly normalized limb, added before a subtraction
+
+/* FE FUNCTIONS */
+
+void fe_set_ui64(fe_t *, uint64_t);
+void fe_set_u256(fe_t *, const u256_t *);
+void fe_get_u256(u256_t *, const fe_t *);
+void fe_set_bnz(fe_t *, const bnz_t *);
+void fe_get_bnz(bnz_t *, const fe_t *);
+
+void fe_normalize_weak(fe_t *);
+void fe_normalize(fe_t *);
+bool fe_is_zero(const fe_t *);
+bool fe_is_odd(const fe_t *);
+bool fe_equal(const fe_t *, const fe_t *);
+
+void fe_add(fe_t *, const fe_t *, const fe_t *);
+void fe_negate(fe_t *, const fe_t *, uint32_t);
+void fe_sub(fe_t *, const fe_t *, const fe_t *, uint32_t);
+void fe_mul_int(fe_t *, const fe_t *, uint32_t);
+void fe_mul(fe_t *, const fe_t *, const fe_t *);
+void fe_sqr(fe_t *, const fe_t *);
+void fe_pow(fe_t *, const fe_t *, const u256_t *);
+void fe_sqr_n(fe_t *, const fe_t *, uint32_t);
+void fe_chain_x223(fe_t *, fe_t *, fe_t *, const fe_t *);
+void fe_inv(fe_t *, const fe_t *);
+void fe_inv_chain(fe_t *, const fe_t *);
+void fe_batch_inv(fe_t *, const fe_t *, size_t);
+void fe_sqrt(fe_t *, const fe_t *);
+
+void fe4_set_u256(fe4_t *, const u256_t *, uint32_t);
+void fe4_get_u256(u256_t *, const fe4_t *, uint32_t);
+void fe4_normalize_weak(fe4_t *);
+void fe4_add(fe4_t *, const fe4_t *, const fe4_t *);
+void fe4_sub(fe4_t *, const fe4_t *, const fe4_t *);
+void fe4_mul(fe4_t *, const fe4_t *, const fe4_t *);
+void fe4_sqr(fe4_t *, const fe4_t *);
+
+void fe_set_ui64(fe_t *res, uint64_t val) // res = val
+{
+    res->n[0] = val & FE_M;
+    res->n[1] = val >> 52;
+    res->n[2] = 0;
+    res->n[3] = 0;
+    res->n[4] = 0;
+}
+
+void fe_set_u256(fe_t *res, const u256_t *a) // res = a, magnitude 1, a need not be less than secp256k1.p
+{
+    res->n[0] = a->d[0] & FE_M;
+    res->n[1] = (a->d[0] >> 52 | a->d[1] << 12) & FE_M;
+    res->n[2] = (a->d[1] >> 40 | a->d[2] << 24) & FE_M;
+    res->n[3] = (a->d[2] >> 28 | a->d[3] << 36) & FE_M;
+    res->n[4] = a->d[3] >> 16;
+}
+
+void fe_get_u256(u256_t *res, const fe_t *a) // res = a mod secp256k1.p
+{
+    fe_t t = *a;
+
+    fe_normalize(&t);
+
+    res->d[0] = t.n[0] | t.n[1] << 52;
+    res->d[1] = t.n[1] >> 12 | t.n[2] << 40;
+    res->d[2] = t.n[2] >> 24 | t.n[3] << 28;
+    res->d[3] = t.n[3] >> 36 | t.n[4] << 16;
+}
+
+void fe_set_bnz(fe_t *res, const bnz_t *a) // res = |a|, bytes above the 32nd are ignored
+{
+    u256_t t;
+
+    u256_set_bnz(&t, a);
+    fe_set_u256(res, &t);
+}
+
+void fe_get_bnz(bnz_t *res, const fe_t *a) // res = a mod secp256k1.p
+{
+    u256_t t;
+
+    fe_get_u256(&t, a);
+    u256_get_bnz(res, &t);
+}
+
+void fe_normalize_weak(fe_t *a) // reduce a to magnitude 1 without fully reducing it mod secp256k1.p
+{
+    uint64_t t0 = a->n[0], t1 = a->n[1], t2 = a->n[2], t3 = a->n[3], t4 = a->n[4];
+    uint64_t x = t4 >> 48; // bits at and above 2^256
+
+    t4 &= 0x0FFFFFFFFFFFFULL;
+    t0 += x * 0x1000003D1ULL; // 2^256 = 0x1000003D1 mod secp256k1.p
+    t1 += t0 >> 52; t0 &= FE_M;
+    t2 += t1 >> 52; t1 &= FE_M;
+    t3 += t2 >> 52; t2 &= FE_M;
+    t4 += t3 >> 52; t3 &= FE_M;
+
+    a->n[0] = t0; a->n[1] = t1; a->n[2] = t2; a->n[3] = t3; a->n[4] = t4;
+}
+
+void fe_normalize(fe_t *a) // fully reduce a mod secp256k1.p
+{
+    uint64_t t0, t1, t2, t3, t4, x;
+
+    fe_normalize_weak(a); // a < 2^256 + small multiple of secp256k1.p
+
+    t0 = a->n[0]; t1 = a->n[1]; t2 = a->n[2]; t3 = a->n[3]; t4 = a->n[4];
+
+    x = (t4 >> 48) | ((t4 == 0x0FFFFFFFFFFFFULL) & ((t3 & t2 & t1) == FE_M) & (t0 >= 0xFFFFEFFFFFC2FULL)); // 1 if a >= secp256k1.p
+    t0 += x * 0x1000003D1ULL; // subtract secp256k1.p by adding 2^256 - secp256k1.p and discarding bit 256
+    t1 += t0 >> 52; t0 &= FE_M;
+    t2 += t1 >> 52; t1 &= FE_M;
+    t3 += t2 >> 52; t2 &= FE_M;
+    t4 += t3 >> 52; t3 &= FE_M;
+    t4 &= 0x0FFFFFFFFFFFFULL;
+
+    a->n[0] = t0; a->n[1] = t1; a->n[2] = t2; a->n[3] = t3; a->n[4] = t4;
+}
+
+bool fe_is_zero(const fe_t *a) // return true if a = 0 mod secp256k1.p
+{
+    fe_t t = *a;
+
+    fe_normalize(&t);
+
+    return (t.n[0] | t.n[1] | t.n[2] | t.n[3] | t.n[4]) == 0;
+}
+
+bool fe_is_odd(const fe_t *a) // return true if a mod secp256k1.p is odd
+{
+    fe_t t = *a;
+
+    fe_normalize(&t);
+
+    return t.n[0] & 1;
+}
+
+bool fe_equal(const fe_t *a, const fe_t *b) // return true if a = b mod secp256k1.p
+{
+    fe_t t = *a, u = *b;
+
+    fe_normalize(&t);
+    fe_normalize(&u);
+
+    return ((t.n[0] ^ u.n[0]) | (t.n[1] ^ u.n[1]) | (t.n[2] ^ u.n[2]) | (t.n[3] ^ u.n[3]) | (t.n[4] ^ u.n[4])) == 0;
+}
+
+void fe_add(fe_t *res, const fe_t *a, const fe_t *b) // res = a + b, magnitudes add, no reduction
+{
+    res->n[0] = a->n[0] + b->n[0];
+    res->n[1] = a->n[1] + b->n[1];
+    res->n[2] = a->n[2] + b->n[2];
+    res->n[3] = a->n[3] + b->n[3];
+    res->n[4] = a->n[4] + b->n[4];
+}
+
+void fe_negate(fe_t *res, const fe_t *a, uint32_t m) // res = -a, a has magnitude m or less, res has magnitude m + 1
+{
+    res->n[0] = 0xFFFFEFFFFFC2FULL * 2 * (m + 1) - a->n[0]; // 2 * (m + 1) * secp256k1.p - a, limb by limb
+    res->n[1] = 0xFFFFFFFFFFFFFULL * 2 * (m + 1) - a->n[1];
+    res->n[2] = 0xFFFFFFFFFFFFFULL * 2 * (m + 1) - a->n[2];
+    res->n[3] = 0xFFFFFFFFFFFFFULL * 2 * (m + 1) - a->n[3];
+    res->n[4] = 0x0FFFFFFFFFFFFULL * 2 * (m + 1) - a->n[4];
+}
+
+void fe_sub(fe_t *res, const fe_t *a, const fe_t *b, uint32_t m) // res = a - b, b has magnitude m or less, res has the magnitude of a plus m + 1
+{
+    fe_t t;
+
+    fe_negate(&t, b, m);
+    fe_add(res, a, &t);
+}
+
+void fe_mul_int(fe_t *res, const fe_t *a, uint32_t k) // res = k * a, the magnitude is multiplied by k
+{
+    res->n[0] = a->n[0] * k;
+    res->n[1] = a->n[1] * k;
+    res->n[2] = a->n[2] * k;
+    res->n[3] = a->n[3] * k;
+    res->n[4] = a->n[4] * k;
+}
+
+void fe_mul(fe_t *res, const fe_t *a, const fe_t *b) // res = a * b mod secp256k1.p, inputs of magnitude 8 or less, res has magnitude 1, res may alias a or b
+{
+    /*
+    The 10 limb product is folded back into 5 limbs as it is accumulated, using 2^260 = FE_R mod secp256k1.p, so that no
+    division is required. [... x y z] is shorthand for ... + x * 2^104 + y * 2^52 + z, and px is the sum of the limb
+    products a[i] * b[j] with i + j = x. This is the column ordering used by the Bitcoin core secp256k1 library.
+    */
+
+    uint128_t c, d;
+    uint64_t t3, t4, tx, u0;
+    uint64_t a0 = a->n[0], a1 = a->n[1], a2 = a->n[2], a3 = a->n[3], a4 = a->n[4];
+    uint64_t b0 = b->n[0], b1 = b->n[1], b2 = b->n[2], b3 = b->n[3], b4 = b->n[4];
+
+    d = (uint128_t)a0 * b3 + (uint128_t)a1 * b2 + (uint128_t)a2 * b1 + (uint128_t)a3 * b0; // [d 0 0 0] = [p3 0 0 0]
+    c = (uint128_t)a4 * b4; // [c 0 0 0 0 d 0 0 0] = [p8 0 0 0 0 p3 0 0 0]
+    d += (uint128_t)FE_R * (uint64_t)c; c >>= 64; // [(c << 12) 0 0 0 0 0 d 0 0 0] = [p8 0 0 0 0 p3 0 0 0]
+    t3 = (uint64_t)d & FE_M; d >>= 52; // [(c << 12) 0 0 0 0 d t3 0 0 0]
+
+    d += (uint128_t)a0 * b4 + (uint128_t)a1 * b3 + (uint128_t)a2 * b2 + (uint128_t)a3 * b1 + (uint128_t)a4 * b0; // [(c << 12) 0 0 0 0 d t3 0 0 0] = [p8 0 0 0 p4 p3 0 0 0]
+    d += (uint128_t)(FE_R << 12) * (uint64_t)c; // [d t3 0 0 0] = [p8 0 0 0 p4 p3 0 0 0]
+    t4 = (uint64_t)d & FE_M; d >>= 52; // [d t4 t3 0 0 0]
+    tx = t4 >> 48; t4 &= (FE_M >> 4); // [d t4 + (tx << 48) t3 0 0 0]
+
+    c = (uint128_t)a0 * b0; // [d t4 + (tx << 48) t3 0 0 c] = [p8 0 0 0 p4 p3 0 0 p0]
+    d += (uint128_t)a1 * b4 + (uint128_t)a2 * b3 + (uint128_t)a3 * b2 + (uint128_t)a4 * b1; // [d t4 + (tx << 48) t3 0 0 c] = [p8 0 0 p5 p4 p3 0 0 p0]
+    u0 = (uint64_t)d & FE_M; d >>= 52; // [d u0 t4 + (tx << 48) t3 0 0 c]
+    u0 = (u0 << 4) | tx; // [d 0 t4 + (u0 << 48) t3 0 0 c]
+    c += (uint128_t)u0 * (FE_R >> 4); // [d 0 t4 t3 0 0 c]
+    res->n[0] = (uint64_t)c & FE_M; c >>= 52; // [d 0 t4 t3 0 c r0]
+
+    c += (uint128_t)a0 * b1 + (uint128_t)a1 * b0; // [d 0 t4 t3 0 c r0] = [p8 0 0 p5 p4 p3 0 p1 p0]
+    d += (uint128_t)a2 * b4 + (uint128_t)a3 * b3 + (uint128_t)a4 * b2; // [d 0 t4 t3 0 c r0] = [p8 0 p6 p5 p4 p3 0 p1 p0]
+    c += (uint128_t)((uint64_t)d & FE_M) * FE_R; d >>= 52; // [d 0 0 t4 t3 0 c r0]
+    res->n[1] = (uint64_t)c & FE_M; c >>= 52; // [d 0 0 t4 t3 c r1 r0]
+
+    c += (uint128_t)a0 * b2 + (uint128_t)a1 * b1 + (uint128_t)a2 * b0; // [d 0 0 t4 t3 c r1 r0] = [p8 0 p6 p5 p4 p3 p2 p1 p0]
+    d += (uint128_t)a3 * b4 + (uint128_t)a4 * b3; // [d 0 0 t4 t3 c r1 r0] = [p8 p7 p6 p5 p4 p3 p2 p1 p0]
+    c += (uint128_t)FE_R * (uint64_t)d; d >>= 64; // [(d << 12) 0 0 0 t4 t3 c r1 r0]
+    res->n[2] = (uint64_t)c & FE_M; c >>= 52; // [(d << 12) 0 0 0 t4 t3 + c r2 r1 r0]
+
+    c += (uint128_t)(FE_R << 12) * (uint64_t)d + t3; // [t4 c r2 r1 r0]
+    res->n[3] = (uint64_t)c & FE_M; c >>= 52; // [t4 + c r3 r2 r1 r0]
+    res->n[4] = (uint64_t)c + t4; // [r4 r3 r2 r1 r0]
+}
+void fe_sqr(fe_t *res, const fe_t *a) // res = a * a mod secp256k1.p, as fe_mul but computing each cross product once, input of magnitude 8 or less, res has magnitude 1, res may alias a
+{
+    uint128_t c, d;
+    uint64_t t3, t4, tx, u0;
+    uint64_t a0 = a->n[0], a1 = a->n[1], a2 = a->n[2], a3 = a->n[3], a4 = a->n[4];
+
+    d = (uint128_t)(a0 * 2) * a3 + (uint128_t)(a1 * 2) * a2; // [d 0 0 0] = [p3 0 0 0]
+    c = (uint128_t)a4 * a4; // [c 0 0 0 0 d 0 0 0] = [p8 0 0 0 0 p3 0 0 0]
+    d += (uint128_t)FE_R * (uint64_t)c; c >>= 64; // [(c << 12) 0 0 0 0 0 d 0 0 0] = [p8 0 0 0 0 p3 0 0 0]
+    t3 = (uint64_t)d & FE_M; d >>= 52; // [(c << 12) 0 0 0 0 d t3 0 0 0]
+
+    a4 *= 2;
+    d += (uint128_t)a0 * a4 + (uint128_t)(a1 * 2) * a3 + (uint128_t)a2 * a2; // [(c << 12) 0 0 0 0 d t3 0 0 0] = [p8 0 0 0 p4 p3 0 0 0]
+    d += (uint128_t)(FE_R << 12) * (uint64_t)c; // [d t3 0 0 0] = [p8 0 0 0 p4 p3 0 0 0]
+    t4 = (uint64_t)d & FE_M; d >>= 52; // [d t4 t3 0 0 0]
+    tx = t4 >> 48; t4 &= (FE_M >> 4); // [d t4 + (tx << 48) t3 0 0 0]
+
+    c = (uint128_t)a0 * a0; // [d t4 + (tx << 48) t3 0 0 c] = [p8 0 0 0 p4 p3 0 0 p0]
+    d += (uint128_t)a1 * a4 + (uint128_t)(a2 * 2) * a3; // [d t4 + (tx << 48) t3 0 0 c] = [p8 0 0 p5 p4 p3 0 0 p0]
+    u0 = (uint64_t)d & FE_M; d >>= 52; // [d u0 t4 + (tx << 48) t3 0 0 c]
+    u0 = (u0 << 4) | tx; // [d 0 t4 + (u0 << 48) t3 0 0 c]
+    c += (uint128_t)u0 * (FE_R >> 4); // [d 0 t4 t3 0 0 c]
+    res->n[0] = (uint64_t)c & FE_M; c >>= 52; // [d 0 t4 t3 0 c r0]
+
+    a0 *= 2;
+    c += (uint128_t)a0 * a1; // [d 0 t4 t3 0 c r0] = [p8 0 0 p5 p4 p3 0 p1 p0]
+    d += (uint128_t)a2 * a4 + (uint128_t)a3 * a3; // [d 0 t4 t3 0 c r0] = [p8 0 p6 p5 p4 p3 0 p1 p0]
+    c += (uint128_t)((uint64_t)d & FE_M) * FE_R; d >>= 52; // [d 0 0 t4 t3 0 c r0]
+    res->n[1] = (uint64_t)c & FE_M; c >>= 52; // [d 0 0 t4 t3 c r1 r0]
+
+    c += (uint128_t)a0 * a2 + (uint128_t)a1 * a1; // [d 0 0 t4 t3 c r1 r0] = [p8 0 p6 p5 p4 p3 p2 p1 p0]
+    d += (uint128_t)a3 * a4; // [d 0 0 t4 t3 c r1 r0] = [p8 p7 p6 p5 p4 p3 p2 p1 p0]
+    c += (uint128_t)FE_R * (uint64_t)d; d >>= 64; // [(d << 12) 0 0 0 t4 t3 c r1 r0]
+    res->n[2] = (uint64_t)c & FE_M; c >>= 52; // [(d << 12) 0 0 0 t4 t3 + c r2 r1 r0]
+
+    c += (uint128_t)(FE_R << 12) * (uint64_t)d + t3; // [t4 c r2 r1 r0]
+    res->n[3] = (uint64_t)c & FE_M; c >>= 52; // [t4 + c r3 r2 r1 r0]
+    res->n[4] = (uint64_t)c + t4; // [r4 r3 r2 r1 r0]
+}
+
+
+void fe_pow(fe_t *res, const fe_t *a, const u256_t *e) // res = a^e mod secp256k1.p, left to right square and multiply
+{
+    fe_t t, base = *a;
+    int32_t i;
+
+    fe_set_ui64(&t, 1);
+
+    for (i = 255; i >= 0; i--) {
+        fe_sqr(&t, &t);
+        if (u256_bit_set(e, i) == true) fe_mul(&t, &t, &base);
+    }
+
+    *res = t;
+}
+
+void fe_sqr_n(fe_t *res, const fe_t *a, uint32_t n) // res = a^(2^n), a run of n squarings, n > 0
+{
+    uint32_t i;
+
+    fe_sqr(res, a);
+    for (i = 1; i < n; i++) {
+        fe_sqr(res, res);
+    }
+}
+
+void fe_chain_x223(fe_t *x2, fe_t *x22, fe_t *x223, const fe_t *a) // x2 = a^(2^2 - 1), x22 = a^(2^22 - 1), x223 = a^(2^223 - 1), the common head of the addition chains for secp256k1.p - 2 and (secp256k1.p + 1) / 4, 222 squarings and 11 multiplications
+{
+    fe_t x3, x6, x9, x11, x44, x88, x176, x220; // xk = a^(2^k - 1), i.e. k one bits
+
+    fe_sqr(x2, a);
+    fe_mul(x2, x2, a);
+    fe_sqr(&x3, x2);
+    fe_mul(&x3, &x3, a);
+    fe_sqr_n(&x6, &x3, 3);
+    fe_mul(&x6, &x6, &x3);
+    fe_sqr_n(&x9, &x6, 3);
+    fe_mul(&x9, &x9, &x3);
+    fe_sqr_n(&x11, &x9, 2);
+    fe_mul(&x11, &x11, x2);
+    fe_sqr_n(x22, &x11, 11);
+    fe_mul(x22, x22, &x11);
+    fe_sqr_n(&x44, x22, 22);
+    fe_mul(&x44, &x44, x22);
+    fe_sqr_n(&x88, &x44, 44);
+    fe_mul(&x88, &x88, &x44);
+    fe_sqr_n(&x176, &x88, 88);
+    fe_mul(&x176, &x176, &x88);
+    fe_sqr_n(&x220, &x176, 44);
+    fe_mul(&x220, &x220, &x44);
+    fe_sqr_n(x223, &x220, 3);
+    fe_mul(x223, x223, &x3);
+}
+
+void fe_inv(fe_t *res, const fe_t *a) // res = modular multiplicative inverse of a, constant time safegcd, res = 0 if a = 0
+{
+    u256_t t;
+    s62_t s;
+
+    fe_get_u256(&t, a); // fully reduced
+    s62_set_u256(&s, &t);
+    s62_inv(&s, &s62_mod_p);
+    s62_get_u256(&t, &s);
+    fe_set_u256(res, &t);
+}
+
+void fe_inv_chain(fe_t *res, const fe_t *a) // res = a^(secp256k1.p - 2), the modular multiplicative inverse of a by Fermat's little theorem, with a fixed addition chain of 255 squarings and 15 multiplications, res = 0 if a = 0
+{
+    fe_t x2, x22, t;
+
+    fe_chain_x223(&x2, &x22, &t, a); // secp256k1.p - 2 = [223 ones] 0 [22 ones] 0000 1 0 11 0 1 in binary
+    fe_sqr_n(&t, &t, 23);
+    fe_mul(&t, &t, &x22);
+    fe_sqr_n(&t, &t, 5);
+    fe_mul(&t, &t, a);
+    fe_sqr_n(&t, &t, 3);
+    fe_mul(&t, &t, &x2);
+    fe_sqr_n(&t, &t, 2);
+    fe_mul(res, &t, a);
+}
+
+void fe_batch_inv(fe_t *res, const fe_t *a, size_t n) // res[i] = modular multiplicative inverse of a[i] for i < n, Montgomery's trick of one fe_inv and 3 (n - 1) fe_mul, res[i] = 0 if a[i] = 0, res must not alias a
+{
+    size_t i;
+    bool started = false;
+    fe_t acc, inv, t;
+
+    fe_set_ui64(&acc, 0);
+
+    for (i = 0; i < n; i++) { // res[i] = product of the non-zero a[j] for j < i, acc = product for j <= i
+        res[i] = acc;
+        if (fe_is_zero(&a[i]) == false) {
+            if (started == false) {
+                acc = a[i];
+                fe_normalize_weak(&acc);
+                fe_set_ui64(&res[i], 1);
+                started = true;
+            } else {
+                fe_mul(&acc, &acc, &a[i]);
+            }
+        }
+    }
+
+    fe_inv(&inv, &acc); // inv = 1 / (a[0] * ... * a[n - 1]), the only inversion, zero if every a[i] is zero
+
+    for (i = n; i-- > 0;) { // inv = 1 / (a[0] * ... * a[i]), res[i] = inv * (a[0] * ... * a[i - 1])
+        if (fe_is_zero(&a[i]) == true) {
+            fe_set_ui64(&res[i], 0);
+        } else {
+            fe_mul(&t, &res[i], &inv);
+            fe_mul(&inv, &inv, &a[i]);
+            res[i] = t;
+        }
+    }
+}
+
+void fe_sqrt(fe_t *res, const fe_t *a) // res = a^((secp256k1.p + 1) / 4), the square root of a if a is a quadratic residue mod secp256k1.p, with a fixed addition chain of 253 squarings and 13 multiplications
+{
+    fe_t x2, x22, t;
+
+    fe_chain_x223(&x2, &x22, &t, a); // (secp256k1.p + 1) / 4 = [223 ones] 0 [22 ones] 0000 11 00 in binary
+    fe_sqr_n(&t, &t, 23);
+    fe_mul(&t, &t, &x22);
+    fe_sqr_n(&t, &t, 6);
+    fe_mul(&t, &t, &x2);
+    fe_sqr_n(res, &t, 2);
+}
+
+void fe4_set_u256(fe4_t *res, const u256_t *a, uint32_t lane) // lane of res = a, weakly normalized, a need not be less than secp256k1.p, the other lanes are unchanged
+{
+    uint32_t i, bit;
+    uint64_t t;
+
+#pragma GCC unroll 10 // constant shifts once unrolled
+    for (i = 0; i < 10; i++) {
+        bit = 26 * i;
+        t = a->d[bit / 64] >> (bit % 64);
+        if (bit % 64 > 38 && bit / 64 < 3) { // the limb straddles two words
+            t |= a->d[bit / 64 + 1] << (64 - bit % 64);
+        }
+        res->n[i][lane] = t & FE4_M; // limb 9 takes the top 22 bits
+    }
+}
+
+void fe4_get_u256(u256_t *res, const fe4_t *a, uint32_t lane) // res = lane of a, a weakly normalized, reduced below 2^256 but not necessarily below secp256k1.p, as fe_set_u256 accepts
+{
+    uint64_t n[10], t;
+    uint32_t i, j, bit;
+
+    for (i = 0; i < 10; i++) {
+        n[i] = a->n[i][lane];
+    }
+    for (j = 0; j < 2; j++) { // a weakly normalized value is below 2^261, the first fold leaves it below 2^256 + 2^38 and the second below 2^256
+        for (i = 0; i < 9; i++) {
+            n[i + 1] += n[i] >> 26;
+            n[i] &= FE4_M;
+        }
+        t = n[9] >> 22; // bits 256 and above, 2^256 = 2^32 + 0x3D1 mod secp256k1.p
+        n[9] &= 0x3FFFFF;
+        n[0] += t * 0x3D1;
+        n[1] += t << 6;
+    }
+    for (i = 0; i < 9; i++) {
+        n[i + 1] += n[i] >> 26;
+        n[i] &= FE4_M;
+    }
+
+    memset(res->d, 0, sizeof(res->d));
+    for (i = 0; i < 10; i++) {
+        bit = 26 * i;
+        res->d[bit / 64] |= n[i] << (bit % 64);
+        if (bit % 64 > 38 && bit / 64 < 3) {
+            res->d[bit / 64 + 1] |= n[i] >> (64 - bit % 64);
+        }
+    }
+}
+
+void fe4_normalize_weak(fe4_t *a) // one carry pass over every lane of a, each limb keeps its low 26 bits (22 for limb 9) and passes the rest up, the bits above 2^256 fold back into limbs 0 and 1, limbs below 2^29 on entry, weakly normalized on return
+{
+    uint32_t i;
+#if defined(__AVX2__)
+    const __m256i m = _mm256_set1_epi64x(FE4_M), m22 = _mm256_set1_epi64x(0x3FFFFF), k = _mm256_set1_epi64x(0x3D1);
+    __m256i c[10], h[10];
+
+#pragma GCC unroll 10
+    for (i = 0; i < 10; i++) { // the carries are taken side by side rather than rippled, so the pass is a handful of instructions deep
+        c[i] = _mm256_loadu_si256((const __m256i *)a->n[i]);
+        h[i] = _mm256_srli_epi64(c[i], i == 9 ? 22 : 26);
+        c[i] = _mm256_and_si256(c[i], i == 9 ? m22 : m);
+    }
+#pragma GCC unroll 9
+    for (i = 1; i < 10; i++) {
+        c[i] = _mm256_add_epi64(c[i], h[i - 1]);
+    }
+    c[0] = _mm256_add_epi64(c[0], _mm256_mul_epu32(h[9], k)); // bits 256 and above, 2^256 = 2^32 + 0x3D1 mod secp256k1.p
+    c[1] = _mm256_add_epi64(c[1], _mm256_slli_epi64(h[9], 6));
+#pragma GCC unroll 10
+    for (i = 0; i < 10; i++) {
+        _mm256_storeu_si256((__m256i *)a->n[i], c[i]);
+    }
+#else
+    uint32_t l;
+    uint64_t h[10];
+
+    for (l = 0; l < 4; l++) {
+        for (i = 0; i < 10; i++) { // the carries are taken side by side rather than rippled, as in the AVX2 version
+            h[i] = a->n[i][l] >> (i == 9 ? 22 : 26);
+            a->n[i][l] &= i == 9 ? 0x3FFFFF : FE4_M;
+        }
+        for (i = 1; i < 10; i++) {
+            a->n[i][l] += h[i - 1];
+        }
+        a->n[0][l] += h[9] * 0x3D1; // bits 256 and above, 2^256 = 2^32 + 0x3D1 mod secp256k1.p
+        a->n[1][l] += h[9] << 6;
+    }
+#endif
+}
+
+void fe4_add(fe4_t *res, const fe4_t *a, const fe4_t *b) // res = a + b lane by lane, weakly normalized inputs and result
+{
+    uint32_t i, l;
+
+    for (i = 0; i < 10; i++) {
+        for (l = 0; l < 4; l++) {
+            res->n[i][l] = a->n[i][l] + b->n[i][l];
+        }
+    }
+    fe4_normalize_weak(res);
+}
+
+void fe4_sub(fe4_t *res, const fe4_t *a, const fe4_t *b) // res = a - b lane by lane, computed as a + 4 secp256k1.p - b so that no limb goes negative, weakly normalized inputs and result
+{
+    uint32_t i, l;
+
+    for (i = 0; i < 10; i++) {
+        for (l = 0; l < 4; l++) {
+            res->n[i][l] = a->n[i][l] + fe4_4p[i] - b->n[i][l];
+        }
+    }
+    fe4_normalize_weak(res);
+}
+
+void fe4_mul(fe4_t *res, const fe4_t *a, const fe4_t *b) // res = a * b mod secp256k1.p lane by lane, 100 32 x 32 bit products per lane, weakly normalized inputs and result, res may alias a or b
+{
+    uint32_t i, j, k;
+#if defined(__AVX2__)
+    const __m256i m = _mm256_set1_epi64x(FE4_M), m22 = _mm256_set1_epi64x(0x3FFFFF), k3d1 = _mm256_set1_epi64x(0x3D1), r0 = _mm256_set1_epi64x(0x3D10), r0_10 = _mm256_set1_epi64x(0x3D10 << 10);
+    __m256i x[10], y[10], c[20], h[20];
+
+    // the loops are unrolled in full so that the limbs and columns stay in registers and the loop counters disappear, which halves the time taken
+#pragma GCC unroll 10
+    for (i = 0; i < 10; i++) {
+        x[i] = _mm256_loadu_si256((const __m256i *)a->n[i]);
+        y[i] = _mm256_loadu_si256((const __m256i *)b->n[i]);
+        c[i] = c[i + 10] = _mm256_setzero_si256();
+    }
+    if (a == b) { // squaring, 55 products, each cross product taken once against a doubled limb (below 2^28)
+#pragma GCC unroll 10
+        for (i = 0; i < 10; i++) {
+            c[2 * i] = _mm256_add_epi64(c[2 * i], _mm256_mul_epu32(x[i], x[i]));
+            y[i] = _mm256_slli_epi64(x[i], 1);
+#pragma GCC unroll 9
+            for (j = i + 1; j < 10; j++) {
+                c[i + j] = _mm256_add_epi64(c[i + j], _mm256_mul_epu32(y[i], x[j]));
+            }
+        }
+    } else {
+#pragma GCC unroll 10
+        for (i = 0; i < 10; i++) { // product columns, each a sum of at most 10 products below 2^54
+#pragma GCC unroll 10
+            for (j = 0; j < 10; j++) {
+                c[i + j] = _mm256_add_epi64(c[i + j], _mm256_mul_epu32(x[i], y[j]));
+            }
+        }
+    }
+#pragma GCC unroll 19
+    for (k = 0; k < 19; k++) { // one side by side carry pass brings every column below 2^32, as _mm256_mul_epu32 needs
+        h[k] = _mm256_srli_epi64(c[k], 26);
+        c[k] = _mm256_and_si256(c[k], m);
+    }
+    c[19] = h[18]; // the carry out of the top column
+#pragma GCC unroll 19
+    for (k = 1; k < 19; k++) {
+        c[k] = _mm256_add_epi64(c[k], h[k - 1]);
+    }
+#pragma GCC unroll 9
+    for (i = 0; i < 9; i++) { // fold limbs 10 to 18 down with 2^260 = 0x3D10 + 2^10 * 2^26 mod secp256k1.p
+        c[i] = _mm256_add_epi64(c[i], _mm256_mul_epu32(c[i + 10], r0));
+        c[i + 1] = _mm256_add_epi64(c[i + 1], _mm256_slli_epi64(c[i + 10], 10));
+    }
+    c[9] = _mm256_add_epi64(c[9], _mm256_mul_epu32(c[19], r0)); // limb 19, whose 2^10 part lands on 2^520 and is folded a second time
+    c[0] = _mm256_add_epi64(c[0], _mm256_mul_epu32(c[19], r0_10));
+    c[1] = _mm256_add_epi64(c[1], _mm256_slli_epi64(c[19], 20));
+#pragma GCC unroll 2
+    for (j = 0; j < 2; j++) { // two passes as in fe4_normalize_weak, the first leaves limbs below 2^34, the second below 2^27
+#pragma GCC unroll 9
+        for (i = 0; i < 9; i++) {
+            h[i] = _mm256_srli_epi64(c[i], 26);
+            c[i] = _mm256_and_si256(c[i], m);
+        }
+        h[9] = _mm256_srli_epi64(c[9], 22);
+        c[9] = _mm256_and_si256(c[9], m22);
+#pragma GCC unroll 9
+        for (i = 1; i < 10; i++) {
+            c[i] = _mm256_add_epi64(c[i], h[i - 1]);
+        }
+        c[0] = _mm256_add_epi64(c[0], _mm256_mul_epu32(h[9], k3d1));
+        c[1] = _mm256_add_epi64(c[1], _mm256_slli_epi64(h[9], 6));
+    }
+#pragma GCC unroll 10
+    for (i = 0; i < 10; i++) { // a and b have been read in full, so res may alias them
+        _mm256_storeu_si256((__m256i *)res->n[i], c[i]);
+    }
+#else
+    uint32_t l;
+    uint64_t c[20], h[20], acc;
+
+    for (l = 0; l < 4; l++) {
+        for (k = 0; k < 19; k++) { // product columns, each a sum of at most 10 products below 2^54
+            acc = 0;
+            for (i = k < 10 ? 0 : k - 9; i <= k && i < 10; i++) {
+                acc += a->n[i][l] * b->n[k - i][l];
+            }
+            h[k] = acc >> 26; // one side by side carry pass, as in the AVX2 version
+            c[k] = acc & FE4_M;
+        }
+        c[19] = h[18]; // the carry out of the top column
+        for (k = 1; k < 19; k++) {
+            c[k] += h[k - 1];
+        }
+        for (i = 0; i < 9; i++) { // fold limbs 10 to 18 down with 2^260 = 0x3D10 + 2^10 * 2^26 mod secp256k1.p
+            c[i] += c[i + 10] * 0x3D10;
+            c[i + 1] += c[i + 10] << 10;
+        }
+        c[9] += c[19] * 0x3D10; // limb 19, whose 2^10 part lands on 2^520 and is folded a second time
+        c[0] += c[19] * (0x3D10 << 10);
+        c[1] += c[19] << 20;
+        for (j = 0; j < 2; j++) { // two passes as in fe4_normalize_weak, the first leaves limbs below 2^34, the second below 2^27
+            for (i = 0; i < 9; i++) {
+                h[i] = c[i] >> 26;
+                c[i] &= FE4_M;
+            }
+            h[9] = c[9] >> 22;
+            c[9] &= 0x3FFFFF;
+            for (i = 1; i < 10; i++) {
+                c[i] += h[i - 1];
+            }
+            c[0] += h[9] * 0x3D1;
+            c[1] += h[9] << 6;
+        }
+        for (i = 0; i < 10; i++) { // lane l of a and b has been read in full, so res may alias them
+            res->n[i][l] = c[i];
+        }
+    }
+#endif
+}
+
+void fe4_sqr(fe4_t *res, const fe4_t *a) // res = a * a mod secp256k1.p lane by lane, weakly normalized input and result, res may alias a, fe4_mul sees a == b and takes 55 products rather than 100 with AVX2
+{
+    fe4_mul(res, a, a);
+}
+
+/* SCALAR DEFINES */
+
+typedef struct {
+    uint64_t d[4]; // 64 bit limbs, least significant limb first, always fully reduced i.e. less than secp256k1.n
+} sc_t; // integer mod secp256k1.n (a private key, nonce, or signature component), held on the stack
+
+/* SCALAR GLOBAL VARIABLES */
+
+const uint64_t sc_n[4] = {0xBFD25E8CD0364141ULL, 0xBAAEDCE6AF48A03BULL, 0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFFULL}; // secp256k1.n
+const uint64_t sc_n_c[3] = {0x402DA1732FC9BEBFULL, 0x4551231950B75FC4ULL, 1}; // 2^256 - secp256k1.n, 129 bits
+const uint64_t sc_n_half[4] = {0xDFE92F46681B20A0ULL, 0x5D576E7357A4501DULL, 0xFFFFFFFFFFFFFFFFULL, 0x7FFFFFFFFFFFFFFFULL}; // floor(secp256k1.n / 2)
+const uint8_t sc_inv_chain_steps[26][2] = { // low 128 bits of secp256k1.n - 2 as 4 bit windows, {squarings, odd power of a to multiply by}, the first run includes the final 0 bit of the high 128 bits
+    {5, 11}, {3, 5}, {4, 5}, {4, 7}, {5, 13}, {2, 3}, {5, 7}, {6, 13}, {5, 11}, {4, 13}, {3, 1}, {6, 5}, {10, 7},
+    {4, 7}, {5, 15}, {4, 15}, {5, 9}, {6, 11}, {4, 13}, {5, 3}, {6, 13}, {10, 13}, {4, 9}, {9, 9}, {4, 15}, {1, 1}
+};
+
+/* SCALAR FUNCTIONS */
+
+void sc_set_ui64(sc_t *, uint64_t);
+void sc_set_u256(sc_t *, const u256_t *);
+void sc_get_u256(u256_t *, const sc_t *);
+void sc_set_bytes(sc_t *, const uint8_t *);
+void sc_get_bytes(uint8_t *, const sc_t *);
+void sc_set_bnz(sc_t *, const bnz_t *);
+void sc_get_bnz(bnz_t *, const sc_t *);
+
+bool sc_is_zero(const sc_t *);
+bool sc_is_high(const sc_t *);
+bool sc_equal(const sc_t *, const sc_t *);
+
+void sc_reduce(sc_t *, uint64_t);
+void sc_reduce_512(sc_t *, const uint64_t *);
+void sc_add(sc_t *, const sc_t *, const sc_t *);
+void sc_negate(sc_t *, const sc_t *);
+void sc_mul(sc_t *, const sc_t *, const sc_t *);
+void sc_sqr(sc_t *, const sc_t *);
+void sc_sqr_n(sc_t *, const sc_t *, uint32_t);
+void sc_inv(sc_t *, const sc_t *);
+void sc_inv_chain(sc_t *, const sc_t *);
+void sc_batch_inv(sc_t *, const sc_t *, size_t);
+
+void sc_set_ui64(sc_t *res, uint64_t val) // res = val
+{
+    res->d[0] = val;
+    res->d[1] = 0;
+    res->d[2] = 0;
+    res->d[3] = 0;
+}
+
+void sc_set_u256(sc_t *res, const u256_t *a) // res = a mod secp256k1.n
+{
+    memcpy(res->d, a->d, sizeof(res->d));
+    sc_reduce(res, 0);
+}
+
+void sc_get_u256(u256_t *res, const sc_t *a)
+{
+    memcpy(res->d, a->d, sizeof(res->d));
+}
+
+void sc_set_bytes(sc_t *res, const uint8_t *bytes) // res = 32 big endian bytes mod secp256k1.n
+{
+    u256_t t;
+
+    u256_set_bytes(&t, bytes);
+    sc_set_u256(res, &t);
+}
+
+void sc_get_bytes(uint8_t *bytes, const sc_t *a) // write a as 32 bytes in big endian order
+{
+    u256_t t;
+
+    sc_get_u256(&t, a);
+    u256_get_bytes(bytes, &t);
+}
+
+void sc_set_bnz(sc_t *res, const bnz_t *a) // res = |a| mod secp256k1.n, bytes above the 32nd are ignored
+{
+    u256_t t;
+
+    u256_set_bnz(&t, a);
+    sc_set_u256(res, &t);
+}
+
+void sc_get_bnz(bnz_t *res, const sc_t *a) // res = a, trimmed
+{
+    bnz_set_limbs(res, a->d, 4);
+}
+
+bool sc_is_zero(const sc_t *a)
+{
+    return (a->d[0] | a->d[1] | a->d[2] | a->d[3]) == 0;
+}
+
+bool sc_is_high(const sc_t *a) // return true if a > floor(secp256k1.n / 2)
+{
+    return cmp_uint64_arr(a->d, sc_n_half, 4) == 1;
+}
+
+bool sc_equal(const sc_t *a, const sc_t *b)
+{
+    return cmp_uint64_arr(a->d, b->d, 4) == 0;
+}
+
+void sc_reduce(sc_t *a, uint64_t overflow) // reduce overflow * 2^256 + a, which must be less than 2 * secp256k1.n, to a mod secp256k1.n
+{
+    if (overflow || cmp_uint64_arr(a->d, sc_n, 4) >= 0) sub_uint64_arr(a->d, a->d, sc_n, 4); // any borrow cancels the overflow bit
+}
+
+void sc_reduce_512(sc_t *res, const uint64_t *a) // res = a mod secp256k1.n for a 512 bit a (8 limbs), folding the high limbs back in using 2^256 = 2^256 - secp256k1.n mod secp256k1.n
+{
+    uint64_t m[7], p[6], carry;
+    int i;
+
+    // 512 bits -> 386 bits: m = a[0..3] + a[4..7] * sc_n_c
+    mul_uint64_arr(m, a + 4, 4, sc_n_c, 3);
+    carry = add_uint64_arr(m, m, a, 4);
+    for (i = 4; i < 7 && carry; i++) {
+        m[i] += carry;
+        carry = m[i] == 0;
+    }
+
+    // 386 bits -> 259 bits: p = m[0..3] + m[4..6] * sc_n_c
+    mul_uint64_arr(p, m + 4, 3, sc_n_c, 3);
+    carry = add_uint64_arr(p, p, m, 4);
+    p[4] += carry; // p[5] is zero, the sum is less than 2^260
+
+    // 259 bits -> 256 bits plus an overflow bit: res = p[0..3] + p[4] * sc_n_c
+    mul_uint64_arr(m, p + 4, 1, sc_n_c, 3); // m[0..3] = p[4] * sc_n_c, less than 2^132
+    carry = add_uint64_arr(res->d, p, m, 4);
+
+    sc_reduce(res, carry);
+}
+
+void sc_add(sc_t *res, const sc_t *a, const sc_t *b) // res = (a + b) mod secp256k1.n, res may alias a or b
+{
+    uint64_t carry = add_uint64_arr(res->d, a->d, b->d, 4);
+
+    sc_reduce(res, carry);
+}
+
+void sc_negate(sc_t *res, const sc_t *a) // res = (secp256k1.n - a) mod secp256k1.n
+{
+    if (sc_is_zero(a) == true) {
+        sc_set_ui64(res, 0);
+    } else {
+        sub_uint64_arr(res->d, sc_n, a->d, 4);
+    }
+}
+
+void sc_mul(sc_t *res, const sc_t *a, const sc_t *b) // res = (a * b) mod secp256k1.n, res may alias a or b
+{
+    uint64_t t[8];
+
+    mul_4x4(t, a->d, b->d);
+    sc_reduce_512(res, t);
+}
+
+void sc_sqr(sc_t *res, const sc_t *a) // res = (a * a) mod secp256k1.n, res may alias a
+{
+    uint64_t t[8];
+
+    sqr_4x4(t, a->d);
+    sc_reduce_512(res, t);
+}
+
+void sc_sqr_n(sc_t *res, const sc_t *a, uint32_t n) // res = a^(2^n) mod secp256k1.n, a run of n squarings, n > 0
+{
+    uint32_t i;
+
+    sc_sqr(res, a);
+    for (i = 1; i < n; i++) {
+        sc_sqr(res, res);
+    }
+}
+
+void sc_inv(sc_t *res, const sc_t *a) // res = modular multiplicative inverse of a mod secp256k1.n, constant time safegcd, res = 0 if a = 0
+{
+    u256_t t;
+    s62_t s;
+
+    memcpy(t.d, a->d, sizeof(t.d));
+    s62_set_u256(&s, &t);
+    s62_inv(&s, &s62_mod_n);
+    s62_get_u256(&t, &s);
+    memcpy(res->d, t.d, sizeof(res->d));
+}
+
+void sc_inv_chain(sc_t *res, const sc_t *a) // res = a^(secp256k1.n - 2) mod secp256k1.n, the modular multiplicative inverse of a by Fermat's little theorem, with a fixed addition chain of 254 squarings and 41 multiplications, res = 0 if a = 0
+{
+    sc_t pow[8], a2, x6, x8, x14, x28, x56, t; // pow[i] = a^(2 i + 1), so pow[1] = a^3 = x2 and pow[3] = a^7 = x3, xk = a^(2^k - 1)
+    int i;
+
+    pow[0] = *a;
+    sc_sqr(&a2, a);
+    for (i = 1; i < 8; i++) {
+        sc_mul(&pow[i], &pow[i - 1], &a2);
+    }
+
+    sc_sqr_n(&x6, &pow[3], 3); // the high 128 bits of secp256k1.n - 2 are 127 ones followed by a 0
+    sc_mul(&x6, &x6, &pow[3]);
+    sc_sqr_n(&x8, &x6, 2);
+    sc_mul(&x8, &x8, &pow[1]);
+    sc_sqr_n(&x14, &x8, 6);
+    sc_mul(&x14, &x14, &x6);
+    sc_sqr_n(&x28, &x14, 14);
+    sc_mul(&x28, &x28, &x14);
+    sc_sqr_n(&x56, &x28, 28);
+    sc_mul(&x56, &x56, &x28);
+    sc_sqr_n(&t, &x56, 56);
+    sc_mul(&t, &t, &x56); // x112
+    sc_sqr_n(&t, &t, 14);
+    sc_mul(&t, &t, &x14); // x126
+    sc_sqr(&t, &t);
+    sc_mul(&t, &t, a); // x127
+
+    for (i = 0; i < 26; i++) {
+        sc_sqr_n(&t, &t, sc_inv_chain_steps[i][0]);
+        sc_mul(&t, &t, &pow[sc_inv_chain_steps[i][1] / 2]);
+    }
+
+    *res = t;
+}
+
+void sc_batch_inv(sc_t *res, const sc_t *a, size_t n) // res[i] = modular multiplicative inverse of a[i] mod secp256k1.n for i < n, Montgomery's trick of one sc_inv and 3 (n - 1) sc_mul, res[i] = 0 if a[i] = 0, res must not alias a
+{
+    size_t i;
+    bool started = false;
+    sc_t acc, inv, t;
+
+    sc_set_ui64(&acc, 0);
+
+    for (i = 0; i < n; i++) { // res[i] = product of the non-zero a[j] for j < i, acc = product for j <= i
+        res[i] = acc;
+        if (sc_is_zero(&a[i]) == false) {
+            if (started == false) {
+                acc = a[i];
+                sc_set_ui64(&res[i], 1);
+                started = true;
+            } else {
+                sc_mul(&acc, &acc, &a[i]);
+            }
+        }
+    }
+
+    sc_inv(&inv, &acc); // inv = 1 / (a[0] * ... * a[n - 1]), the only inversion, zero if every a[i] is zero
+
+    for (i = n; i-- > 0;) { // inv = 1 / (a[0] * ... * a[i]), res[i] = inv * (a[0] * ... * a[i - 1])
+        if (sc_is_zero(&a[i]) == true) {
+            sc_set_ui64(&res[i], 0);
+        } else {
+            sc_mul(&t, &res[i], &inv);
+            sc_mul(&inv, &inv, &a[i]);
+            res[i] = t;
+        }
+    }
+}
+
+/* SECP256K1 DEFINES */
+
+typedef struct {
+    bnz_t x;
+    bnz_t y;
+} APT; // standard affine xy point
+
+typedef struct {
+    u256_t x;
+    u256_t y;
+} APT256; // fixed width affine xy point
+
+typedef struct {
+    fe_t x;
+    fe_t y;
+    fe_t z;
+} JPTFE; // extended Jacobian xyz point of field elements
+
+typedef struct {
+    fe4_t x;
+    fe4_t y;
+    fe4_t z;
+} JPTFE4; // four extended Jacobian xyz points side by side, for secp256k1_jacobian_point_addition_x4
+
+typedef struct {
+    bnz_t p; // prime
+    bnz_t a; // 0
+    bnz_t b; // 7
+    APT G; // generator point
+    APT256 G_doublings_mod_p[256]; // xy coordinates of 256 consecutive doublings of the secp256k1 generator point mod secp256k1.p i.e. secp256k1.G * 2^n mod secp256k1.p for n = 0 to 255
+    bnz_t n; // order
+    bnz_t h; // 1
+    u256_t p_u256; // prime as a fixed width integer
+    u256_t n_u256; // order as a fixed width integer
+} SECP256K1;
+
+/* SECP256K1 GLOBAL VARIABLES */
+
+uint8_t g_doublings_data[16384] = {152, 23, 248, 22, 91, 129, 242, 89, 217, 40, 206, 45, 219, 252, 155, 2, 7, 11, 135, 206, 149, 98, 160, 85, 172, 187, 220, 249, 126, 102, 190, 121, 184, 212, 16, 251, 143, 208, 71, 156, 25, 84, 133, 166, 72, 180, 23, 253, 168, 8, 17, 14, 252, 251, 164, 93, 101, 196, 163, 38, 119, 218, 58, 72, 229, 158, 112, 92, 185, 9, 172, 171, 167, 60, 239, 140, 75, 142, 119, 92, 216, 124, 192, 149, 110, 64, 69, 48, 109, 125, 237, 65, 148, 127, 4, 198, 42, 229, 207, 80, 169, 49, 100, 35, 225, 208, 102, 50, 101, 50, 246, 247, 238, 234, 108, 70, 25, 132, 197, 163, 57, 195, 61, 166, 254, 104, 225, 26, 19, 205, 196, 232, 171, 148, 250, 116, 132, 117, 224, 14, 144, 19, 108, 204, 4, 20, 11, 147, 4, 73, 30, 88, 243, 128, 13, 193, 241, 219, 147, 228, 34, 153, 115, 71, 220, 123, 233, 207, 64, 254, 189, 191, 51, 174, 103, 217, 72, 20, 165, 142, 9, 226, 66, 86, 183, 85, 212, 160, 62, 153, 237, 81, 1, 42, 10, 225, 243, 78, 120, 103, 138, 136, 175, 229, 5, 221, 27, 10, 47, 60, 15, 183, 63, 132, 243, 175, 29, 53, 202, 92, 225, 229, 1, 47, 4, 233, 189, 108, 183, 44, 218, 181, 23, 118, 91, 186, 214, 19, 226, 194, 180, 19, 45, 19, 42, 8, 61, 41, 73, 153, 83, 65, 167, 168, 77, 92, 10, 236, 109, 42, 158, 232, 78, 196, 233, 90, 122, 184, 105, 19, 163, 178, 151, 62, 194, 33, 188, 170, 17, 48, 197, 158, 158, 181, 147, 206, 15, 230, 33, 104, 97, 105, 206, 44, 243, 225, 11, 63, 210, 68, 30, 137, 150, 18, 16, 55, 121, 245, 52, 159, 185, 157, 146, 149, 229, 153, 115, 80, 227, 247, 101, 62, 20, 7, 212, 219, 208, 117, 29, 166, 4, 153, 184, 252, 207, 218, 206, 120, 243, 226, 84, 224, 182, 71, 45, 162, 181, 79, 215, 153, 1, 211, 185, 106, 16, 36, 31, 255, 179, 5, 150, 129, 237, 100, 195, 12, 118, 31, 101, 128, 131, 233, 201, 222, 214, 179, 195, 213, 227, 10, 157, 141, 3, 149, 139, 239, 116, 248, 230, 24, 121, 227, 129, 253, 186, 205, 29, 111, 76, 252, 60, 130, 50, 248, 234, 81, 16, 11, 183, 234, 22, 45, 84, 193, 35, 191, 159, 29, 131, 102, 254, 126, 195, 77, 120, 47, 30, 129, 84, 252, 34, 197, 228, 146, 83, 186, 160, 40, 217, 122, 115, 3, 48, 195, 111, 134, 179, 92, 78, 162, 105, 103, 69, 119, 112, 100, 85, 86, 83, 0, 215, 92, 245, 188, 28, 103, 209, 247, 9, 61, 108, 105, 6, 122, 63, 3, 228, 59, 255, 52, 26, 47, 204, 115, 122, 6, 145, 132, 129, 182, 248, 232, 195, 22, 223, 85, 140, 9, 50, 152, 216, 25, 102, 63, 85, 108, 35, 58, 98, 17, 157, 93, 8, 21, 245, 213, 63, 226, 70, 6, 161, 28, 172, 213, 171, 156, 195, 216, 56, 226, 45, 23, 62, 110, 42, 234, 217, 9, 198, 18, 50, 38, 130, 130, 175, 108, 226, 246, 175, 110, 27, 211, 190, 23, 123, 47, 172, 19, 214, 98, 206, 10, 182, 48, 232, 86, 130, 94, 228, 223, 87, 133, 9, 168, 248, 17, 77, 162, 52, 239, 0, 44, 110, 146, 208, 89, 225, 217, 104, 201, 219, 10, 213, 24, 249, 156, 122, 133, 90, 144, 243, 159, 167, 135, 178, 112, 83, 70, 244, 135, 56, 179, 32, 251, 248, 162, 16, 122, 211, 21, 178, 9, 142, 88, 193, 194, 238, 253, 218, 139, 175, 164, 130, 192, 104, 131, 179, 49, 229, 53, 31, 19, 133, 226, 178, 1, 185, 213, 136, 176, 19, 200, 205, 110, 236, 170, 64, 98, 173, 102, 143, 161, 100, 214, 119, 189, 60, 226, 184, 235, 31, 36, 109, 2, 80, 39, 111, 230, 179, 171, 175, 181, 12, 189, 15, 253, 80, 205, 248, 29, 152, 19, 189, 32, 196, 214, 211, 248, 148, 255, 217, 120, 51, 81, 113, 4, 146, 155, 6, 99, 203, 237, 13, 222, 35, 244, 133, 139, 49, 252, 217, 248, 216, 131, 41, 204, 228, 252, 121, 250, 114, 161, 78, 219, 27, 93, 3, 49, 184, 247, 102, 6, 51, 112, 123, 110, 197, 150, 153, 30, 235, 121, 86, 38, 162, 56, 148, 185, 75, 121, 46, 158, 55, 121, 103, 130, 67, 40, 57, 183, 229, 81, 181, 229, 252, 115, 237, 34, 34, 253, 51, 56, 185, 224, 109, 132, 252, 198, 198, 156, 249, 114, 90, 134, 139, 114, 159, 21, 94, 23, 149, 214, 254, 233, 254, 111, 250, 110, 92, 52, 36, 221, 90, 149, 181, 172, 94, 31, 247, 31, 165, 151, 239, 164, 235, 121, 60, 158, 13, 110, 80, 211, 214, 71, 188, 70, 158, 4, 120, 206, 27, 18, 218, 198, 181, 254, 253, 48, 33, 198, 57, 225, 200, 188, 255, 165, 215, 50, 255, 3, 63, 1, 58, 66, 52, 138, 84, 139, 109, 110, 35, 209, 158, 0, 79, 82, 195, 142, 13, 114, 199, 179, 246, 186, 123, 159, 23, 161, 112, 217, 225, 225, 15, 224, 26, 185, 74, 130, 22, 132, 247, 246, 45, 48, 65, 39, 62, 59, 47, 102, 223, 73, 118, 135, 214, 188, 122, 122, 144, 8, 5, 185, 31, 172, 69, 106, 29, 17, 208, 233, 8, 33, 212, 17, 161, 169, 76, 202, 218, 150, 137, 0, 112, 240, 82, 89, 6, 255, 219, 72, 13, 185, 251, 175, 142, 71, 28, 145, 150, 6, 117, 215, 206, 27, 224, 221, 94, 171, 86, 78, 247, 94, 138, 182, 144, 114, 255, 220, 185, 188, 190, 93, 121, 173, 184, 200, 199, 122, 201, 109, 74, 74, 109, 214, 141, 167, 104, 143, 191, 178, 172, 66, 71, 66, 219, 12, 233, 29, 87, 244, 192, 57, 247, 249, 62, 148, 114, 30, 99, 22, 176, 17, 153, 82, 64, 70, 255, 131, 143, 173, 107, 82, 254, 47, 85, 85, 126, 28, 68, 83, 224, 46, 38, 182, 5, 172, 206, 153, 156, 12, 176, 71, 212, 144, 61, 54, 233, 157, 238, 59, 127, 60, 0, 98, 203, 158, 25, 8, 144, 168, 185, 69, 49, 54, 243, 151, 83, 68, 59, 149, 33, 34, 115, 252, 173, 115, 226, 4, 65, 197, 146, 175, 92, 42, 113, 210, 157, 181, 223, 46, 1, 251, 98, 11, 191, 2, 59, 201, 198, 115, 57, 85, 155, 126, 154, 237, 102, 152, 27, 76, 32, 224, 143, 198, 253, 243, 196, 114, 173, 177, 62, 228, 215, 234, 82, 198, 156, 230, 86, 206, 83, 183, 188, 127, 15, 138, 190, 32, 211, 146, 247, 193, 209, 243, 170, 190, 140, 242, 200, 224, 53, 241, 40, 26, 188, 237, 51, 50, 78, 181, 128, 7, 60, 47, 154, 82, 43, 177, 131, 186, 119, 56, 8, 164, 185, 84, 178, 240, 77, 83, 43, 177, 144, 239, 209, 110, 87, 231, 1, 32, 226, 179, 97, 147, 214, 131, 191, 184, 121, 188, 239, 254, 18, 246, 233, 64, 58, 211, 64, 121, 90, 219, 211, 140, 185, 3, 66, 69, 10, 136, 13, 110, 111, 200, 86, 47, 26, 62, 78, 58, 181, 192, 140, 210, 65, 198, 4, 168, 122, 150, 70, 109, 250, 149, 206, 67, 169, 54, 247, 156, 168, 140, 241, 26, 232, 71, 96, 193, 66, 40, 236, 61, 208, 166, 47, 43, 37, 131, 190, 149, 12, 248, 253, 223, 85, 154, 247, 105, 27, 205, 91, 161, 129, 167, 228, 67, 136, 99, 69, 183, 181, 68, 98, 140, 190, 194, 243, 93, 22, 95, 75, 139, 54, 253, 212, 95, 198, 240, 239, 179, 86, 238, 98, 97, 84, 54, 227, 249, 4, 218, 176, 58, 129, 215, 251, 179, 180, 8, 211, 104, 111, 10, 173, 74, 190, 228, 85, 71, 113, 38, 63, 187, 122, 153, 124, 65, 238, 100, 175, 113, 16, 97, 60, 200, 126, 124, 225, 140, 113, 145, 50, 225, 228, 92, 12, 237, 47, 244, 123, 160, 110, 250, 249, 99, 177, 218, 61, 118, 37, 57, 217, 73, 128, 166, 126, 90, 127, 173, 61, 191, 189, 69, 35, 188, 199, 159, 26, 34, 171, 200, 206, 7, 200, 230, 182, 212, 206, 82, 5, 110, 86, 84, 50, 229, 232, 250, 241, 131, 63, 92, 177, 179, 148, 230, 76, 196, 19, 176, 236, 250, 112, 80, 21, 171, 217, 223, 129, 137, 46, 46, 94, 184, 134, 178, 50, 156, 61, 177, 47, 236, 198, 2, 46, 252, 87, 203, 158, 14, 233, 181, 9, 204, 247, 177, 209, 154, 174, 78, 246, 7, 62, 205, 35, 79, 130, 221, 178, 179, 253, 202, 203, 55, 11, 26, 115, 200, 242, 210, 202, 45, 19, 138, 187, 9, 128, 28, 129, 195, 39, 6, 19, 100, 83, 45, 117, 244, 64, 168, 84, 15, 133, 62, 134, 79, 40, 221, 249, 182, 185, 227, 238, 175, 178, 178, 91, 148, 218, 252, 50, 82, 146, 21, 97, 203, 123, 231, 192, 166, 255, 219, 0, 183, 199, 72, 213, 11, 192, 113, 247, 107, 109, 153, 219, 229, 166, 186, 60, 114, 95, 159, 179, 158, 157, 6, 220, 1, 72, 73, 121, 55, 101, 160, 96, 38, 110, 77, 130, 136, 116, 19, 33, 169, 152, 196, 92, 89, 181, 103, 232, 150, 213, 48, 160, 12, 214, 131, 211, 31, 7, 73, 152, 7, 67, 10, 36, 45, 198, 163, 115, 87, 196, 125, 61, 52, 77, 116, 123, 67, 134, 167, 239, 87, 158, 47, 176, 116, 66, 180, 122, 176, 74, 151, 233, 229, 42, 109, 155, 104, 236, 3, 222, 40, 201, 39, 54, 137, 24, 133, 180, 209, 11, 219, 18, 215, 213, 77, 88, 12, 119, 199, 175, 127, 42, 1, 123, 50, 126, 87, 128, 16, 185, 108, 34, 213, 156, 126, 223, 162, 66, 188, 40, 106, 67, 189, 75, 38, 17, 171, 4, 119, 147, 39, 18, 230, 141, 141, 123, 113, 67, 130, 17, 106, 34, 190, 51, 76, 226, 92, 247, 212, 180, 147, 224, 78, 169, 111, 124, 216, 232, 56, 36, 75, 216, 107, 242, 43, 157, 236, 189, 213, 31, 198, 139, 167, 157, 167, 54, 98, 5, 92, 200, 218, 187, 210, 64, 189, 36, 101, 76, 169, 244, 97, 134, 241, 219, 200, 226, 194, 43, 155, 227, 160, 96, 60, 93, 126, 58, 158, 1, 5, 149, 33, 121, 253, 128, 98, 249, 146, 217, 31, 32, 181, 250, 215, 125, 14, 202, 62, 83, 154, 131, 25, 169, 55, 18, 150, 71, 9, 181, 211, 194, 18, 200, 238, 95, 186, 152, 191, 190, 147, 212, 164, 191, 238, 153, 137, 222, 225, 218, 79, 253, 221, 18, 247, 17, 167, 195, 205, 228, 154, 157, 8, 120, 241, 218, 126, 238, 105, 242, 240, 14, 151, 163, 140, 154, 93, 253, 151, 210, 71, 8, 233, 190, 118, 214, 102, 103, 143, 192, 75, 234, 196, 95, 73, 24, 193, 49, 96, 28, 166, 253, 123, 169, 167, 215, 74, 28, 56, 197, 63, 73, 125, 24, 227, 172, 147, 0, 156, 147, 219, 50, 16, 69, 240, 204, 94, 145, 9, 167, 95, 62, 143, 228, 238, 142, 35, 59, 245, 106, 147, 76, 69, 222, 46, 66, 112, 141, 68, 178, 8, 221, 239, 95, 208, 241, 156, 71, 140, 83, 217, 49, 8, 225, 204, 59, 198, 173, 5, 205, 185, 239, 225, 151, 55, 145, 168, 51, 210, 159, 173, 198, 212, 162, 167, 68, 50, 78, 70, 35, 113, 71, 254, 31, 76, 21, 176, 231, 155, 175, 216, 48, 69, 203, 14, 164, 153, 235, 41, 179, 238, 63, 211, 24, 123, 212, 51, 159, 65, 229, 199, 168, 117, 244, 154, 94, 35, 172, 197, 16, 112, 105, 162, 177, 249, 24, 83, 45, 249, 145, 254, 238, 110, 114, 44, 101, 236, 227, 209, 64, 43, 31, 164, 232, 5, 180, 235, 58, 217, 114, 87, 25, 164, 237, 75, 235, 207, 76, 244, 176, 141, 164, 57, 91, 131, 215, 239, 191, 3, 60, 155, 162, 21, 18, 159, 69, 222, 123, 155, 160, 208, 145, 39, 103, 113, 110, 105, 218, 68, 15, 16, 9, 90, 198, 43, 214, 92, 189, 15, 172, 149, 81, 255, 24, 74, 255, 183, 102, 6, 9, 12, 48, 243, 200, 46, 119, 11, 160, 146, 49, 225, 217, 205, 6, 247, 77, 30, 79, 40, 5, 75, 8, 8, 125, 35, 249, 200, 217, 216, 153, 65, 76, 43, 255, 93, 65, 168, 113, 199, 181, 206, 242, 137, 9, 140, 152, 250, 114, 93, 163, 197, 106, 115, 170, 17, 101, 21, 245, 107, 222, 96, 108, 150, 220, 185, 44, 23, 210, 255, 52, 32, 67, 79, 4, 189, 77, 251, 253, 191, 71, 220, 51, 60, 230, 177, 27, 188, 149, 188, 57, 133, 82, 156, 37, 192, 98, 50, 116, 129, 164, 196, 4, 103, 38, 94, 60, 21, 143, 251, 149, 176, 73, 217, 221, 69, 10, 9, 19, 38, 84, 172, 137, 19, 222, 29, 83, 205, 188, 180, 217, 17, 250, 22, 24, 98, 224, 197, 157, 122, 162, 108, 154, 98, 178, 75, 139, 27, 250, 184, 184, 167, 55, 119, 88, 44, 160, 101, 132, 112, 40, 167, 240, 201, 12, 90, 117, 81, 93, 215, 63, 51, 71, 231, 214, 246, 70, 105, 26, 150, 141, 159, 154, 150, 26, 110, 170, 118, 131, 200, 129, 37, 76, 128, 3, 54, 196, 76, 17, 12, 7, 69, 1, 254, 175, 242, 45, 253, 52, 229, 230, 205, 138, 44, 133, 179, 243, 100, 68, 141, 127, 167, 23, 192, 4, 74, 122, 34, 201, 29, 27, 237, 199, 98, 226, 27, 3, 225, 13, 160, 86, 148, 242, 24, 79, 164, 121, 237, 28, 158, 65, 221, 146, 242, 90, 83, 151, 101, 23, 164, 182, 107, 94, 64, 64, 137, 146, 97, 112, 157, 86, 131, 92, 169, 54, 126, 226, 132, 87, 216, 148, 222, 197, 106, 138, 2, 201, 178, 41, 15, 205, 93, 249, 185, 234, 137, 128, 76, 34, 63, 185, 244, 211, 31, 0, 190, 185, 97, 88, 189, 154, 96, 21, 73, 52, 241, 126, 195, 144, 238, 14, 164, 167, 246, 229, 176, 223, 98, 41, 6, 236, 146, 122, 166, 138, 14, 22, 123, 225, 47, 214, 32, 108, 105, 126, 249, 18, 133, 30, 213, 176, 8, 91, 2, 234, 34, 150, 177, 54, 82, 229, 252, 161, 172, 209, 9, 68, 76, 160, 124, 197, 80, 224, 52, 229, 181, 18, 146, 238, 224, 233, 111, 126, 194, 216, 224, 44, 105, 86, 62, 198, 240, 1, 81, 143, 24, 83, 17, 194, 127, 186, 117, 4, 125, 125, 233, 98, 149, 195, 191, 147, 58, 139, 81, 231, 205, 33, 56, 121, 173, 162, 24, 158, 43, 76, 69, 204, 89, 108, 198, 86, 89, 95, 247, 156, 198, 195, 126, 151, 85, 89, 177, 221, 96, 10, 240, 178, 12, 193, 170, 206, 243, 164, 190, 207, 15, 179, 191, 226, 47, 89, 217, 109, 105, 148, 144, 141, 104, 94, 45, 245, 106, 29, 164, 102, 178, 248, 92, 236, 215, 59, 20, 159, 131, 194, 10, 83, 91, 213, 70, 174, 108, 234, 254, 136, 0, 9, 24, 191, 222, 85, 49, 45, 68, 65, 204, 87, 137, 28, 152, 92, 205, 62, 191, 18, 78, 110, 176, 186, 225, 220, 151, 108, 107, 124, 229, 8, 43, 117, 238, 10, 4, 164, 10, 135, 161, 49, 179, 224, 202, 30, 20, 121, 225, 178, 157, 175, 97, 50, 197, 225, 135, 219, 26, 98, 11, 0, 77, 234, 44, 48, 72, 31, 133, 114, 62, 58, 41, 199, 25, 241, 245, 125, 203, 204, 114, 217, 130, 85, 130, 109, 203, 85, 210, 224, 24, 143, 91, 13, 106, 239, 88, 92, 71, 253, 98, 153, 248, 119, 27, 31, 62, 64, 160, 87, 214, 40, 113, 113, 20, 33, 38, 170, 214, 93, 160, 61, 32, 202, 112, 245, 113, 14, 66, 93, 211, 114, 154, 100, 248, 125, 62, 54, 195, 0, 93, 68, 242, 141, 91, 201, 91, 52, 87, 85, 210, 13, 136, 220, 149, 91, 65, 66, 235, 89, 131, 255, 67, 96, 176, 72, 96, 81, 118, 94, 198, 29, 130, 180, 70, 20, 160, 29, 194, 181, 130, 210, 183, 83, 210, 123, 159, 98, 179, 183, 162, 194, 254, 134, 254, 236, 127, 57, 162, 53, 56, 111, 4, 53, 8, 209, 16, 201, 41, 30, 247, 163, 55, 169, 87, 45, 18, 149, 22, 148, 56, 48, 105, 177, 108, 236, 193, 139, 151, 250, 51, 222, 131, 133, 128, 125, 101, 237, 254, 60, 202, 255, 230, 75, 190, 103, 179, 220, 156, 4, 145, 29, 169, 103, 218, 29, 190, 104, 122, 226, 168, 158, 126, 161, 64, 247, 8, 197, 173, 199, 222, 229, 128, 151, 236, 247, 99, 244, 65, 188, 66, 22, 72, 53, 170, 172, 155, 201, 65, 231, 31, 130, 204, 227, 94, 131, 90, 234, 204, 53, 159, 189, 139, 113, 216, 0, 175, 250, 12, 12, 124, 88, 239, 161, 95, 54, 205, 186, 77, 35, 182, 142, 51, 248, 16, 190, 96, 95, 83, 192, 159, 160, 132, 195, 12, 157, 41, 56, 232, 89, 253, 220, 127, 46, 137, 81, 138, 14, 84, 195, 22, 218, 24, 226, 180, 186, 168, 237, 135, 80, 96, 104, 82, 241, 133, 76, 15, 89, 194, 65, 255, 216, 23, 143, 230, 238, 155, 80, 129, 196, 255, 209, 19, 25, 28, 25, 219, 157, 65, 219, 224, 39, 209, 91, 109, 32, 1, 173, 164, 189, 88, 183, 177, 55, 147, 203, 206, 29, 150, 145, 169, 31, 57, 8, 96, 184, 109, 233, 162, 202, 64, 59, 19, 255, 219, 41, 206, 22, 217, 201, 60, 59, 83, 176, 69, 156, 199, 89, 118, 0, 96, 108, 239, 156, 79, 155, 33, 199, 107, 59, 141, 167, 1, 223, 39, 101, 87, 144, 62, 197, 138, 79, 57, 110, 42, 55, 192, 128, 65, 164, 245, 234, 239, 89, 217, 5, 198, 217, 36, 192, 183, 55, 26, 204, 92, 84, 87, 159, 6, 17, 187, 247, 208, 8, 236, 81, 33, 242, 94, 147, 0, 224, 166, 221, 76, 51, 11, 170, 79, 144, 83, 200, 113, 39, 2, 107, 9, 203, 157, 105, 52, 68, 225, 129, 153, 153, 19, 28, 60, 13, 194, 202, 236, 201, 136, 109, 16, 128, 188, 208, 135, 192, 91, 169, 124, 164, 56, 31, 15, 205, 87, 173, 133, 15, 173, 170, 231, 110, 42, 93, 153, 22, 99, 25, 145, 249, 60, 117, 70, 65, 157, 175, 117, 165, 1, 183, 205, 235, 119, 46, 223, 197, 103, 166, 126, 77, 159, 93, 60, 185, 189, 152, 134, 187, 225, 82, 252, 85, 204, 195, 13, 178, 138, 203, 241, 56, 48, 91, 86, 21, 227, 85, 215, 9, 227, 110, 12, 194, 211, 131, 26, 166, 211, 214, 85, 97, 183, 193, 245, 113, 202, 57, 212, 33, 118, 67, 224, 240, 245, 130, 204, 46, 221, 175, 48, 132, 103, 10, 228, 215, 62, 191, 97, 191, 165, 26, 16, 247, 13, 22, 137, 33, 246, 43, 5, 90, 190, 98, 78, 159, 107, 51, 45, 54, 245, 217, 129, 231, 203, 66, 118, 34, 70, 33, 201, 203, 71, 227, 164, 12, 151, 109, 243, 167, 87, 154, 110, 11, 108, 11, 111, 80, 143, 63, 36, 250, 135, 12, 125, 72, 48, 175, 142, 187, 67, 93, 146, 207, 72, 104, 51, 28, 79, 66, 197, 48, 149, 113, 97, 250, 42, 93, 149, 159, 70, 71, 96, 216, 58, 244, 89, 249, 239, 202, 139, 155, 58, 4, 58, 181, 121, 103, 144, 202, 100, 119, 202, 156, 113, 167, 131, 89, 211, 11, 205, 123, 142, 42, 55, 96, 132, 126, 4, 16, 234, 179, 104, 253, 71, 46, 142, 232, 121, 69, 81, 169, 12, 66, 16, 3, 148, 179, 164, 61, 42, 11, 119, 183, 16, 81, 3, 63, 241, 139, 128, 210, 119, 231, 137, 3, 61, 141, 91, 193, 59, 223, 80, 105, 153, 25, 243, 80, 195, 157, 114, 94, 25, 170, 91, 179, 51, 24, 116, 141, 203, 204, 3, 197, 43, 112, 155, 136, 188, 239, 96, 101, 170, 188, 82, 141, 36, 54, 64, 70, 249, 135, 191, 10, 100, 133, 1, 138, 165, 54, 187, 20, 68, 178, 199, 29, 215, 166, 188, 215, 202, 9, 225, 246, 86, 34, 126, 31, 7, 210, 58, 184, 92, 149, 63, 201, 34, 174, 238, 77, 55, 74, 115, 175, 141, 169, 190, 117, 120, 33, 67, 229, 0, 99, 214, 40, 56, 41, 247, 6, 248, 6, 44, 3, 22, 153, 79, 205, 79, 182, 101, 17, 23, 22, 214, 231, 106, 173, 100, 138, 94, 12, 159, 42, 182, 242, 186, 77, 148, 220, 176, 174, 149, 115, 224, 70, 124, 229, 234, 58, 127, 156, 192, 128, 35, 26, 188, 27, 22, 72, 190, 153, 0, 86, 103, 132, 143, 20, 146, 175, 147, 154, 176, 9, 213, 239, 138, 89, 241, 106, 149, 100, 52, 25, 134, 142, 111, 98, 56, 196, 153, 21, 30, 132, 10, 105, 230, 151, 131, 241, 244, 167, 113, 222, 27, 184, 137, 134, 129, 208, 230, 33, 255, 205, 193, 52, 237, 94, 56, 83, 84, 46, 84, 229, 143, 69, 192, 140, 220, 134, 32, 236, 78, 48, 107, 87, 244, 235, 233, 25, 222, 1, 103, 245, 35, 234, 232, 195, 235, 59, 40, 124, 130, 242, 120, 112, 162, 131, 220, 226, 28, 252, 190, 66, 38, 200, 71, 209, 103, 95, 77, 19, 190, 86, 4, 128, 84, 175, 61, 8, 34, 246, 246, 2, 161, 170, 32, 181, 32, 91, 209, 246, 27, 50, 72, 116, 202, 87, 230, 231, 206, 103, 179, 21, 87, 44, 175, 15, 58, 231, 125, 129, 78, 205, 27, 182, 220, 90, 113, 9, 50, 137, 157, 54, 111, 140, 125, 206, 195, 145, 205, 85, 194, 31, 61, 60, 203, 112, 189, 226, 61, 149, 143, 24, 229, 38, 251, 243, 104, 186, 88, 59, 202, 219, 73, 84, 171, 183, 184, 49, 203, 210, 22, 105, 23, 208, 25, 167, 70, 232, 88, 77, 163, 18, 16, 129, 40, 225, 243, 30, 140, 120, 96, 117, 219, 68, 237, 215, 209, 139, 14, 6, 55, 140, 209, 183, 234, 60, 118, 188, 198, 245, 40, 45, 19, 185, 17, 89, 34, 145, 137, 241, 14, 143, 142, 34, 66, 92, 99, 17, 158, 239, 253, 132, 156, 150, 54, 250, 54, 177, 89, 53, 118, 184, 39, 155, 172, 201, 124, 152, 77, 139, 218, 167, 195, 250, 195, 134, 237, 6, 198, 201, 251, 71, 89, 74, 248, 221, 15, 24, 250, 61, 65, 164, 115, 124, 99, 145, 241, 236, 3, 184, 217, 249, 6, 96, 33, 132, 58, 96, 144, 104, 216, 2, 16, 40, 92, 47, 221, 164, 126, 212, 196, 69, 14, 163, 226, 184, 105, 186, 89, 48, 96, 142, 198, 128, 124, 45, 215, 127, 75, 116, 34, 157, 92, 23, 218, 228, 167, 229, 69, 23, 218, 57, 41, 72, 132, 194, 54, 220, 28, 28, 65, 43, 37, 234, 238, 134, 174, 188, 56, 238, 78, 122, 203, 52, 35, 40, 247, 114, 20, 85, 17, 146, 141, 233, 240, 159, 88, 206, 10, 171, 98, 249, 2, 115, 112, 201, 147, 233, 25, 144, 146, 22, 124, 38, 116, 20, 122, 238, 242, 54, 207, 117, 190, 24, 135, 72, 44, 220, 86, 140, 47, 29, 230, 85, 255, 191, 11, 249, 201, 72, 34, 87, 162, 62, 136, 18, 138, 157, 54, 226, 43, 218, 53, 2, 117, 99, 225, 24, 186, 53, 180, 85, 187, 6, 165, 215, 238, 33, 45, 105, 148, 5, 250, 227, 100, 9, 181, 75, 172, 13, 253, 118, 111, 28, 221, 119, 8, 159, 169, 208, 133, 64, 217, 72, 27, 193, 74, 7, 68, 92, 224, 22, 110, 26, 225, 200, 191, 130, 6, 139, 191, 127, 118, 111, 140, 49, 56, 225, 198, 173, 23, 36, 175, 240, 150, 37, 94, 173, 225, 48, 212, 162, 135, 91, 6, 214, 135, 189, 230, 208, 66, 231, 224, 183, 19, 83, 94, 15, 219, 99, 209, 116, 247, 203, 110, 77, 16, 124, 20, 162, 130, 37, 78, 60, 36, 1, 212, 34, 51, 160, 178, 40, 108, 233, 162, 243, 36, 246, 58, 135, 162, 62, 246, 5, 40, 183, 249, 218, 77, 188, 25, 176, 191, 245, 78, 102, 233, 151, 7, 231, 86, 98, 228, 173, 192, 50, 109, 105, 252, 41, 207, 219, 234, 200, 221, 76, 13, 213, 12, 200, 4, 27, 243, 14, 18, 174, 189, 206, 80, 2, 32, 38, 141, 12, 71, 38, 15, 185, 168, 224, 216, 58, 139, 103, 114, 78, 251, 74, 29, 186, 54, 238, 195, 45, 111, 31, 211, 55, 244, 91, 113, 180, 59, 237, 235, 51, 230, 22, 21, 62, 100, 100, 145, 139, 156, 45, 7, 13, 147, 212, 142, 59, 208, 148, 245, 161, 104, 64, 206, 169, 190, 174, 110, 118, 192, 56, 18, 5, 120, 123, 199, 40, 183, 205, 5, 40, 2, 116, 204, 45, 37, 70, 9, 23, 220, 195, 209, 226, 121, 201, 214, 89, 19, 39, 187, 45, 176, 157, 138, 102, 122, 142, 120, 82, 21, 176, 25, 22, 194, 14, 43, 40, 215, 220, 205, 185, 17, 106, 138, 117, 234, 178, 231, 21, 156, 203, 112, 7, 91, 29, 39, 39, 151, 60, 224, 88, 114, 141, 122, 78, 130, 138, 80, 227, 101, 160, 226, 127, 135, 172, 73, 153, 208, 87, 228, 145, 244, 231, 52, 88, 164, 58, 93, 131, 171, 52, 129, 210, 116, 29, 114, 151, 51, 100, 247, 154, 63, 27, 116, 104, 88, 102, 137, 13, 119, 209, 43, 218, 183, 224, 45, 125, 44, 103, 133, 166, 19, 3, 121, 79, 9, 227, 200, 68, 143, 41, 197, 252, 23, 127, 231, 229, 194, 98, 250, 155, 4, 116, 99, 235, 178, 67, 91, 155, 27, 72, 124, 37, 252, 23, 31, 188, 144, 139, 153, 150, 109, 46, 223, 70, 234, 137, 59, 31, 166, 200, 21, 18, 134, 193, 54, 192, 158, 15, 116, 107, 207, 76, 83, 118, 110, 232, 207, 110, 127, 28, 215, 221, 40, 221, 191, 119, 210, 227, 10, 85, 67, 213, 50, 221, 227, 42, 70, 219, 45, 139, 156, 176, 92, 113, 213, 182, 232, 190, 232, 35, 9, 23, 199, 210, 200, 251, 236, 71, 13, 2, 121, 237, 170, 248, 24, 32, 20, 30, 8, 243, 183, 135, 238, 92, 31, 29, 169, 193, 68, 6, 65, 170, 22, 61, 0, 37, 178, 140, 98, 159, 86, 0, 248, 178, 211, 218, 221, 200, 137, 113, 90, 225, 142, 223, 226, 78, 50, 138, 116, 116, 207, 132, 89, 37, 28, 26, 170, 16, 31, 246, 190, 69, 174, 53, 7, 60, 56, 212, 226, 221, 20, 162, 193, 53, 142, 12, 217, 35, 140, 92, 193, 0, 176, 204, 57, 216, 140, 164, 196, 162, 21, 176, 80, 45, 119, 191, 71, 186, 215, 95, 226, 69, 111, 220, 200, 53, 34, 82, 40, 216, 84, 169, 43, 10, 42, 200, 96, 175, 89, 217, 255, 50, 136, 102, 15, 198, 38, 146, 15, 177, 19, 148, 145, 241, 201, 6, 107, 164, 136, 25, 155, 128, 191, 72, 9, 137, 229, 200, 216, 136, 127, 203, 212, 190, 210, 124, 201, 8, 255, 77, 109, 140, 65, 195, 209, 197, 116, 107, 220, 70, 102, 203, 109, 133, 98, 165, 83, 10, 0, 139, 126, 69, 176, 110, 57, 81, 94, 130, 30, 51, 193, 22, 239, 182, 240, 145, 98, 198, 228, 92, 13, 54, 89, 46, 55, 127, 44, 149, 38, 90, 112, 239, 5, 31, 64, 61, 140, 49, 103, 61, 101, 143, 57, 190, 222, 34, 132, 104, 45, 61, 137, 188, 98, 136, 166, 0, 88, 76, 234, 19, 245, 150, 79, 19, 118, 137, 88, 2, 241, 233, 176, 214, 114, 101, 25, 33, 245, 67, 242, 31, 19, 139, 190, 242, 190, 189, 197, 35, 252, 230, 88, 46, 198, 126, 249, 76, 209, 212, 126, 39, 130, 62, 28, 115, 99, 53, 133, 251, 188, 197, 31, 20, 83, 103, 103, 61, 140, 103, 161, 177, 69, 125, 130, 151, 67, 187, 140, 24, 11, 128, 248, 134, 54, 151, 222, 7, 8, 32, 3, 28, 184, 176, 34, 102, 113, 154, 50, 131, 22, 116, 92, 236, 14, 82, 96, 116, 16, 36, 33, 39, 31, 54, 182, 215, 1, 166, 61, 206, 141, 116, 13, 46, 36, 17, 74, 245, 156, 155, 107, 50, 53, 140, 89, 33, 154, 192, 212, 229, 171, 232, 216, 143, 243, 25, 216, 236, 204, 42, 117, 105, 252, 77, 228, 176, 241, 168, 115, 40, 240, 224, 124, 6, 79, 195, 1, 24, 70, 127, 206, 96, 98, 23, 174, 180, 178, 149, 78, 168, 193, 152, 193, 81, 128, 35, 146, 210, 236, 247, 30, 106, 119, 73, 144, 240, 167, 113, 181, 165, 111, 43, 168, 45, 188, 45, 124, 71, 61, 111, 116, 102, 7, 126, 210, 170, 150, 81, 92, 230, 22, 19, 26, 79, 232, 155, 64, 200, 222, 115, 26, 173, 72, 71, 218, 216, 133, 112, 221, 209, 199, 111, 129, 121, 32, 166, 213, 196, 51, 32, 160, 176, 148, 188, 199, 239, 49, 101, 83, 107, 88, 144, 102, 92, 102, 83, 139, 148, 88, 217, 128, 11, 108, 45, 49, 80, 72, 240, 71, 220, 15, 16, 126, 30, 77, 238, 227, 62, 204, 233, 146, 8, 140, 150, 75, 236, 231, 102, 113, 42, 142, 80, 159, 178, 214, 42, 31, 198, 73, 154, 52, 6, 215, 136, 182, 151, 82, 72, 157, 106, 113, 155, 210, 237, 44, 89, 190, 44, 174, 169, 11, 219, 234, 190, 97, 69, 44, 61, 250, 33, 153, 15, 217, 89, 19, 232, 178, 74, 238, 80, 137, 143, 215, 236, 102, 131, 220, 142, 245, 191, 66, 88, 199, 155, 118, 95, 104, 217, 176, 255, 11, 146, 213, 173, 115, 120, 123, 118, 119, 161, 65, 71, 93, 63, 247, 206, 228, 220, 200, 186, 131, 231, 47, 54, 23, 248, 75, 45, 250, 55, 32, 141, 204, 83, 41, 67, 220, 191, 117, 245, 200, 62, 4, 3, 65, 191, 75, 65, 72, 131, 61, 212, 216, 193, 175, 224, 125, 3, 229, 218, 91, 117, 29, 132, 220, 229, 224, 16, 31, 72, 236, 3, 91, 95, 189, 221, 11, 153, 251, 9, 141, 249, 249, 181, 211, 148, 170, 75, 83, 113, 69, 239, 52, 61, 158, 199, 200, 99, 140, 219, 45, 42, 121, 124, 33, 171, 195, 62, 27, 214, 210, 247, 108, 11, 244, 148, 84, 253, 103, 164, 13, 224, 165, 76, 219, 122, 47, 206, 197, 85, 184, 172, 0, 9, 121, 254, 220, 96, 91, 210, 67, 191, 153, 254, 38, 23, 66, 85, 133, 96, 229, 245, 229, 143, 9, 82, 18, 185, 215, 96, 113, 115, 230, 42, 87, 119, 68, 46, 253, 74, 109, 196, 251, 155, 28, 187, 244, 25, 53, 64, 43, 58, 239, 245, 21, 148, 169, 100, 194, 237, 75, 172, 119, 163, 115, 221, 77, 15, 89, 173, 22, 154, 137, 182, 246, 246, 36, 15, 241, 226, 185, 75, 248, 129, 174, 76, 230, 208, 130, 23, 15, 84, 106, 182, 101, 196, 216, 43, 19, 12, 95, 112, 13, 117, 76, 248, 53, 249, 152, 224, 221, 142, 125, 252, 209, 79, 158, 159, 78, 111, 181, 45, 16, 0, 2, 174, 252, 162, 70, 84, 168, 204, 203, 99, 41, 212, 33, 29, 45, 88, 240, 173, 17, 220, 211, 86, 168, 204, 41, 52, 229, 232, 50, 37, 231, 252, 228, 10, 106, 134, 37, 183, 197, 166, 198, 209, 219, 232, 231, 180, 113, 23, 143, 94, 144, 234, 245, 173, 7, 162, 244, 176, 114, 99, 224, 221, 49, 238, 78, 249, 52, 112, 178, 112, 72, 16, 135, 119, 74, 72, 215, 140, 72, 90, 173, 178, 123, 162, 18, 254, 140, 225, 188, 116, 137, 144, 122, 62, 255, 210, 62, 228, 174, 9, 254, 60, 237, 198, 78, 219, 191, 94, 4, 60, 63, 173, 79, 48, 189, 141, 156, 143, 107, 4, 162, 76, 19, 172, 14, 136, 9, 33, 125, 32, 6, 114, 225, 118, 19, 242, 183, 150, 246, 25, 172, 153, 23, 177, 242, 59, 16, 191, 69, 66, 155, 53, 121, 190, 13, 99, 73, 220, 164, 191, 223, 228, 6, 103, 71, 23, 91, 200, 4, 120, 138, 148, 245, 31, 180, 219, 122, 157, 17, 146, 131, 25, 234, 31, 115, 144, 133, 120, 214, 6, 84, 59, 189, 107, 205, 123, 202, 124, 160, 201, 221, 196, 241, 6, 98, 170, 19, 28, 210, 198, 245, 14, 148, 196, 99, 80, 157, 200, 168, 234, 40, 179, 249, 143, 228, 64, 251, 117, 114, 26, 176, 153, 85, 32, 166, 177, 199, 75, 29, 183, 18, 15, 33, 191, 74, 151, 64, 160, 217, 203, 252, 48, 105, 78, 106, 233, 142, 95, 171, 221, 207, 26, 197, 172, 228, 19, 155, 15, 9, 120, 109, 95, 135, 219, 252, 48, 218, 234, 1, 71, 185, 148, 174, 2, 127, 84, 151, 85, 208, 8, 105, 173, 64, 133, 245, 163, 226, 221, 11, 177, 4, 34, 224, 12, 220, 249, 187, 208, 88, 83, 212, 213, 92, 113, 122, 60, 33, 242, 88, 180, 52, 117, 194, 242, 223, 237, 126, 106, 243, 245, 80, 72, 187, 144, 161, 91, 36, 6, 173, 19, 112, 80, 98, 228, 90, 11, 173, 109, 75, 172, 127, 200, 14, 94, 137, 147, 137, 240, 124, 46, 98, 116, 185, 26, 13, 14, 72, 35, 131, 237, 159, 174, 102, 127, 154, 180, 50, 129, 84, 94, 28, 239, 212, 194, 95, 61, 123, 93, 85, 76, 50, 254, 38, 235, 172, 222, 163, 211, 42, 76, 29, 250, 89, 185, 43, 143, 70, 127, 131, 15, 246, 252, 79, 188, 29, 83, 212, 161, 203, 15, 226, 112, 201, 213, 254, 25, 28, 144, 31, 206, 199, 187, 16, 66, 233, 246, 222, 141, 102, 197, 2, 6, 109, 39, 70, 226, 184, 134, 150, 9, 48, 135, 175, 153, 188, 225, 255, 251, 173, 139, 73, 153, 237, 13, 87, 135, 34, 41, 74, 184, 117, 76, 212, 36, 127, 15, 14, 29, 0, 47, 82, 19, 239, 20, 97, 153, 216, 120, 220, 172, 224, 80, 104, 99, 145, 49, 28, 33, 235, 101, 78, 79, 194, 166, 167, 236, 104, 234, 239, 21, 68, 188, 115, 159, 65, 40, 193, 113, 135, 132, 179, 159, 149, 19, 228, 23, 154, 113, 163, 7, 3, 21, 218, 20, 60, 88, 157, 134, 71, 184, 170, 60, 213, 251, 8, 59, 58, 204, 240, 221, 44, 198, 173, 112, 140, 131, 226, 135, 154, 65, 165, 82, 147, 187, 141, 78, 179, 244, 122, 42, 39, 124, 78, 230, 170, 220, 23, 24, 148, 179, 224, 51, 221, 247, 191, 20, 150, 11, 83, 27, 104, 239, 109, 159, 208, 111, 225, 24, 11, 157, 108, 118, 156, 116, 23, 77, 27, 110, 124, 110, 30, 130, 226, 144, 135, 239, 27, 90, 242, 17, 155, 156, 93, 56, 78, 159, 38, 138, 38, 143, 136, 150, 38, 176, 23, 144, 137, 43, 171, 20, 216, 218, 235, 154, 0, 18, 178, 50, 249, 192, 27, 229, 228, 250, 139, 53, 54, 131, 121, 69, 187, 240, 52, 179, 181, 218, 44, 174, 67, 47, 113, 95, 126, 161, 53, 38, 175, 168, 131, 181, 145, 191, 245, 49, 40, 14, 127, 34, 99, 142, 114, 244, 168, 212, 95, 144, 110, 247, 68, 246, 103, 229, 96, 113, 112, 94, 203, 138, 214, 152, 97, 211, 247, 136, 20, 14, 94, 120, 207, 134, 181, 183, 222, 90, 240, 4, 93, 68, 102, 143, 214, 51, 184, 98, 167, 137, 59, 237, 99, 2, 193, 141, 107, 238, 18, 48, 201, 13, 147, 18, 71, 139, 150, 84, 160, 128, 250, 85, 37, 101, 147, 108, 135, 127, 50, 1, 51, 32, 185, 89, 217, 159, 156, 254, 125, 189, 254, 112, 80, 83, 117, 185, 151, 25, 94, 37, 105, 153, 176, 38, 64, 82, 179, 234, 4, 212, 178, 182, 39, 251, 64, 40, 126, 66, 50, 118, 5, 67, 190, 178, 61, 110, 199, 165, 106, 104, 97, 173, 56, 242, 16, 27, 139, 119, 190, 61, 78, 167, 254, 111, 185, 60, 242, 183, 61, 29, 112, 119, 123, 63, 151, 107, 89, 107, 18, 147, 175, 182, 204, 222, 116, 246, 124, 41, 19, 11, 155, 219, 104, 5, 110, 228, 86, 151, 31, 150, 124, 217, 143, 72, 48, 55, 222, 229, 14, 87, 187, 14, 205, 232, 80, 216, 3, 14, 24, 255, 128, 66, 48, 200, 65, 148, 237, 174, 191, 58, 63, 249, 9, 14, 255, 139, 233, 77, 254, 116, 55, 242, 9, 30, 145, 19, 139, 18, 118, 161, 175, 25, 250, 139, 254, 158, 158, 190, 61, 25, 241, 28, 213, 51, 208, 186, 21, 48, 77, 171, 79, 216, 189, 16, 91, 81, 135, 180, 36, 246, 211, 254, 201, 63, 124, 122, 230, 142, 105, 217, 41, 57, 99, 5, 117, 5, 116, 136, 60, 150, 194, 167, 147, 14, 148, 156, 184, 111, 201, 241, 4, 84, 18, 122, 39, 69, 43, 200, 125, 81, 44, 208, 127, 145, 36, 66, 127, 83, 68, 124, 70, 255, 12, 6, 134, 74, 62, 69, 253, 49, 10, 88, 51, 189, 183, 63, 111, 109, 147, 19, 80, 208, 87, 107, 18, 132, 239, 163, 157, 25, 31, 163, 175, 71, 147, 243, 11, 195, 186, 72, 225, 176, 63, 191, 162, 235, 163, 196, 227, 194, 98, 22, 6, 19, 220, 167, 193, 57, 222, 189, 23, 68, 42, 192, 82, 41, 67, 96, 183, 121, 225, 68, 21, 211, 104, 153, 89, 13, 87, 162, 16, 14, 207, 119, 246, 19, 65, 230, 118, 1, 172, 1, 25, 45, 117, 177, 180, 50, 32, 109, 181, 210, 51, 42, 94, 211, 240, 129, 6, 215, 102, 112, 87, 207, 149, 78, 238, 141, 223, 13, 201, 165, 135, 17, 58, 168, 153, 249, 28, 105, 174, 41, 44, 98, 87, 93, 0, 16, 200, 97, 129, 216, 201, 135, 238, 59, 199, 82, 158, 14, 83, 138, 112, 192, 185, 61, 71, 155, 241, 164, 88, 138, 62, 53, 109, 60, 167, 205, 62, 40, 56, 109, 187, 220, 86, 150, 250, 151, 168, 249, 225, 17, 72, 136, 155, 190, 245, 228, 205, 198, 22, 27, 46, 158, 181, 178, 134, 109, 75, 55, 159, 207, 98, 228, 149, 131, 100, 189, 25, 226, 59, 139, 196, 79, 3, 207, 25, 242, 26, 50, 111, 43, 83, 145, 10, 12, 28, 15, 63, 201, 209, 145, 239, 71, 25, 24, 171, 104, 190, 180, 195, 102, 180, 90, 161, 6, 43, 227, 40, 232, 243, 124, 209, 9, 194, 171, 227, 25, 34, 234, 75, 3, 189, 147, 238, 118, 245, 151, 131, 47, 156, 113, 124, 13, 95, 203, 120, 160, 68, 108, 175, 234, 186, 81, 23, 96, 208, 173, 184, 53, 212, 160, 124, 234, 42, 54, 236, 223, 70, 178, 60, 21, 115, 158, 175, 48, 75, 93, 232, 111, 9, 132, 7, 145, 184, 203, 43, 36, 80, 177, 58, 238, 203, 38, 223, 67, 198, 124, 143, 154, 143, 63, 116, 170, 27, 40, 232, 225, 171, 178, 3, 107, 197, 56, 199, 195, 132, 154, 105, 217, 53, 231, 23, 233, 207, 128, 120, 239, 78, 49, 130, 187, 187, 191, 172, 46, 143, 113, 127, 83, 210, 26, 149, 120, 181, 63, 137, 27, 171, 98, 70, 120, 176, 170, 221, 228, 201, 184, 73, 234, 151, 113, 100, 148, 170, 231, 146, 105, 42, 179, 53, 116, 3, 124, 205, 94, 132, 120, 85, 17, 53, 111, 5, 243, 24, 109, 49, 222, 100, 93, 106, 116, 167, 83, 246, 83, 64, 42, 29, 165, 208, 166, 206, 195, 226, 109, 139, 151, 7, 29, 230, 41, 108, 139, 148, 184, 105, 248, 148, 96, 153, 227, 252, 84, 35, 241, 34, 205, 236, 12, 29, 188, 163, 191, 74, 204, 100, 163, 136, 56, 56, 243, 71, 249, 126, 83, 14, 18, 225, 222, 30, 168, 148, 249, 136, 149, 73, 187, 24, 113, 108, 65, 91, 103, 72, 14, 25, 55, 41, 3, 15, 141, 154, 202, 72, 219, 74, 255, 5, 143, 108, 26, 168, 104, 247, 190, 252, 214, 112, 245, 20, 246, 213, 165, 198, 201, 180, 102, 228, 207, 184, 65, 174, 52, 31, 192, 192, 101, 16, 53, 172, 115, 255, 78, 252, 133, 91, 209, 112, 209, 67, 188, 205, 206, 184, 117, 64, 11, 122, 147, 124, 92, 127, 53, 228, 190, 245, 132, 11, 75, 193, 246, 136, 101, 159, 46, 55, 20, 80, 146, 58, 95, 46, 215, 209, 119, 40, 151, 124, 99, 199, 100, 226, 129, 91, 182, 72, 101, 98, 149, 216, 31, 153, 125, 93, 215, 62, 54, 121, 225, 103, 176, 43, 99, 141, 66, 3, 235, 64, 195, 24, 8, 198, 142, 114, 174, 126, 188, 242, 56, 170, 191, 254, 36, 132, 7, 119, 75, 89, 91, 186, 63, 12, 196, 14, 122, 175, 236, 3, 103, 162, 3, 32, 98, 67, 58, 138, 78, 4, 113, 137, 239, 110, 19, 253, 241, 221, 113, 198, 239, 238, 97, 205, 168, 223, 42, 138, 247, 177, 242, 124, 165, 239, 197, 181, 145, 209, 161, 103, 204, 82, 198, 243, 52, 168, 141, 33, 60, 203, 177, 141, 236, 132, 29, 95, 74, 2, 63, 212, 160, 3, 112, 27, 134, 159, 81, 103, 83, 202, 156, 14, 20, 141, 99, 217, 157, 142, 158, 217, 167, 55, 134, 107, 227, 41, 138, 216, 92, 118, 200, 255, 248, 254, 134, 98, 110, 186, 206, 27, 50, 187, 69, 169, 167, 163, 192, 28, 173, 25, 220, 54, 114, 81, 56, 60, 141, 246, 70, 253, 54, 230, 64, 4, 30, 53, 3, 210, 145, 145, 176, 229, 84, 138, 189, 161, 23, 131, 25, 154, 97, 241, 253, 3, 148, 151, 203, 252, 240, 103, 172, 121, 43, 35, 231, 144, 158, 146, 155, 91, 117, 115, 133, 60, 125, 12, 71, 254, 195, 18, 92, 110, 192, 2, 141, 64, 3, 110, 103, 79, 86, 10, 21, 73, 221, 78, 232, 147, 54, 199, 255, 206, 97, 135, 30, 87, 51, 100, 15, 235, 24, 117, 149, 42, 3, 148, 218, 184, 231, 246, 253, 78, 231, 228, 136, 20, 81, 59, 255, 149, 77, 88, 204, 146, 176, 8, 40, 118, 201, 156, 201, 215, 228, 161, 5, 72, 164, 223, 4, 40, 106, 114, 175, 197, 20, 244, 19, 212, 230, 246, 91, 178, 92, 62, 154, 70, 249, 32, 182, 138, 105, 203, 242, 83, 206, 197, 140, 237, 5, 209, 54, 109, 125, 252, 249, 19, 26, 73, 112, 197, 53, 138, 16, 180, 54, 153, 197, 220, 41, 0, 197, 149, 108, 198, 216, 114, 158, 102, 119, 227, 52, 92, 186, 228, 153, 219, 64, 165, 12, 163, 226, 134, 34, 129, 75, 83, 192, 9, 19, 235, 227, 176, 240, 102, 250, 131, 104, 208, 12, 172, 211, 12, 225, 189, 182, 58, 163, 120, 218, 27, 227, 63, 135, 230, 67, 192, 105, 227, 176, 55, 209, 56, 156, 233, 19, 106, 169, 23, 49, 252, 215, 113, 232, 155, 7, 98, 202, 186, 218, 72, 16, 159, 39, 191, 119, 119, 186, 211, 221, 115, 243, 212, 47, 186, 226, 188, 7, 157, 157, 6, 186, 253, 240, 86, 173, 241, 227, 52, 102, 121, 1, 207, 6, 161, 36, 190, 249, 232, 98, 72, 215, 207, 216, 118, 37, 83, 242, 39, 121, 90, 115, 116, 222, 86, 137, 11, 178, 207, 182, 226, 142, 77, 93, 223, 192, 227, 120, 23, 161, 241, 146, 167, 86, 81, 251, 239, 25, 32, 171, 127, 93, 71, 185, 218, 138, 125, 58, 179, 31, 68, 20, 234, 15, 232, 120, 236, 201, 106, 27, 41, 180, 252, 169, 46, 50, 175, 128, 94, 21, 45, 71, 148, 202, 163, 140, 118, 137, 30, 119, 0, 142, 99, 127, 222, 209, 238, 88, 205, 131, 15, 139, 231, 176, 45, 22, 249, 210, 119, 56, 204, 45, 18, 55, 122, 254, 30, 237, 196, 26, 152, 101, 18, 164, 142, 240, 161, 12, 68, 75, 63, 138, 184, 105, 192, 123, 176, 96, 162, 192, 105, 66, 77, 30, 162, 2, 47, 78, 157, 220, 84, 137, 175, 34, 225, 94, 205, 210, 176, 200, 166, 16, 139, 153, 18, 39, 218, 27, 232, 217, 41, 178, 193, 188, 14, 199, 155, 129, 7, 169, 211, 41, 248, 247, 197, 28, 108, 150, 43, 175, 203, 148, 246, 81, 94, 240, 0, 23, 139, 120, 246, 71, 42, 60, 24, 195, 100, 108, 235, 42, 216, 70, 204, 250, 95, 60, 99, 61, 240, 190, 97, 186, 62, 166, 64, 253, 83, 213, 141, 53, 19, 90, 249, 20, 100, 139, 192, 149, 246, 171, 71, 80, 89, 162, 57, 244, 212, 182, 80, 72, 104, 86, 53, 42, 134, 110, 139, 237, 229, 155, 62, 211, 218, 3, 216, 208, 131, 51, 24, 90, 60, 172, 36, 161, 159, 235, 244, 45, 188, 16, 13, 180, 28, 209, 14, 145, 8, 94, 234, 112, 96, 225, 196, 188, 123, 192, 221, 21, 105, 253, 30, 3, 130, 161, 242, 67, 117, 86, 29, 229, 72, 186, 19, 67, 112, 205, 223, 123, 105, 1, 163, 161, 126, 23, 30, 4, 26, 13, 12, 19, 26, 161, 192, 247, 219, 53, 23, 155, 15, 212, 37, 250, 9, 24, 8, 245, 228, 103, 251, 28, 249, 112, 115, 174, 165, 75, 242, 22, 3, 66, 17, 216, 181, 52, 76, 0, 101, 57, 180, 116, 255, 11, 158, 65, 210, 232, 243, 73, 240, 121, 255, 156, 229, 225, 39, 179, 69, 58, 136, 238, 191, 165, 132, 247, 99, 250, 154, 166, 161, 72, 223, 5, 223, 121, 252, 60, 94, 27, 238, 9, 226, 4, 200, 166, 38, 11, 49, 174, 215, 174, 156, 92, 23, 105, 153, 79, 251, 251, 132, 222, 173, 57, 90, 79, 126, 45, 137, 195, 142, 88, 22, 238, 74, 134, 246, 165, 231, 18, 199, 148, 98, 21, 70, 170, 72, 209, 132, 55, 230, 12, 75, 84, 142, 13, 56, 229, 217, 29, 49, 130, 75, 237, 101, 179, 99, 99, 81, 7, 65, 100, 73, 3, 219, 166, 68, 254, 225, 67, 27, 121, 93, 39, 88, 111, 93, 200, 178, 252, 117, 134, 107, 66, 13, 92, 6, 93, 35, 179, 164, 4, 5, 252, 11, 66, 133, 75, 70, 26, 141, 172, 88, 5, 79, 93, 52, 151, 113, 66, 55, 146, 201, 166, 148, 127, 236, 184, 63, 69, 243, 52, 108, 122, 70, 85, 25, 212, 78, 176, 63, 62, 198, 122, 171, 255, 127, 48, 17, 11, 51, 204, 8, 226, 141, 103, 18, 5, 157, 63, 70, 54, 185, 214, 137, 179, 133, 173, 144, 80, 241, 110, 203, 72, 77, 29, 153, 77, 137, 130, 21, 190, 250, 174, 57, 184, 34, 114, 66, 217, 203, 253, 175, 97, 130, 163, 32, 54, 122, 80, 14, 81, 1, 220, 167, 237, 176, 24, 40, 173, 123, 112, 70, 230, 91, 18, 126, 61, 94, 66, 72, 21, 29, 75, 244, 119, 64, 201, 248, 14, 212, 44, 126, 199, 30, 114, 32, 57, 197, 59, 154, 44, 8, 238, 174, 64, 238, 155, 136, 93, 249, 30, 50, 139, 26, 166, 130, 179, 250, 220, 42, 8, 117, 91, 144, 151, 229, 69, 19, 228, 58, 16, 14, 249, 60, 133, 219, 249, 107, 99, 156, 167, 82, 239, 209, 187, 117, 201, 33, 206, 218, 190, 149, 33, 245, 70, 161, 10, 119, 90, 244, 106, 103, 117, 118, 176, 148, 240, 33, 178, 165, 103, 234, 64, 27, 179, 219, 210, 93, 233, 154, 176, 254, 83, 176, 10, 155, 169, 165, 68, 84, 228, 76, 252, 83, 187, 12, 226, 196, 204, 254, 30, 66, 222, 219, 20, 129, 90, 178, 218, 249, 251, 188, 185, 147, 25, 207, 161, 117, 76, 210, 87, 74, 221, 135, 105, 36, 147, 203, 36, 229, 241, 153, 244, 147, 117, 191, 138, 167, 229, 16, 24, 125, 203, 207, 209, 193, 77, 232, 45, 29, 254, 88, 218, 192, 196, 158, 76, 68, 123, 27, 53, 163, 62, 114, 120, 86, 140, 232, 46, 22, 31, 152, 173, 193, 57, 146, 51, 95, 59, 246, 210, 185, 104, 143, 130, 255, 31, 80, 121, 191, 60, 242, 253, 11, 81, 149, 254, 44, 234, 187, 93, 33, 190, 182, 194, 144, 29, 222, 134, 57, 6, 186, 45, 159, 42, 102, 118, 112, 242, 76, 248, 125, 132, 230, 174, 126, 98, 231, 173, 88, 152, 216, 89, 175, 217, 127, 231, 235, 175, 252, 88, 129, 78, 120, 253, 174, 73, 77, 30, 120, 170, 3, 98, 182, 144, 107, 70, 216, 244, 125, 26, 45, 15, 110, 240, 166, 156, 53, 16, 242, 35, 231, 53, 209, 13, 161, 89, 252, 50, 205, 38, 32, 182, 41, 87, 203, 219, 232, 78, 29, 157, 136, 224, 61, 42, 141, 167, 90, 92, 31, 158, 97, 214, 55, 133, 111, 213, 133, 158, 83, 100, 117, 243, 12, 206, 218, 250, 200, 114, 65, 51, 159, 183, 84, 217, 172, 74, 104, 37, 41, 114, 74, 82, 223, 49, 82, 198, 179, 73, 55, 65, 133, 214, 193, 120, 162, 180, 87, 205, 218, 100, 83, 43, 8, 244, 31, 95, 26, 246, 120, 200, 204, 217, 26, 48, 255, 70, 103, 121, 39, 223, 217, 122, 145, 10, 33, 49, 34, 123, 12, 253, 19, 39, 127, 252, 11, 242, 175, 26, 230, 137, 55, 125, 115, 214, 248, 129, 190, 57, 122, 123, 229, 181, 80, 84, 27, 14, 103, 17, 30, 35, 83, 80, 253, 134, 102, 62, 30, 104, 3, 101, 232, 72, 31, 9, 54, 140, 25, 249, 159, 249, 95, 214, 133, 175, 118, 1, 251, 243, 228, 188, 115, 235, 111, 87, 56, 44, 130, 201, 209, 81, 201, 78, 231, 199, 108, 40, 183, 2, 234, 208, 166, 97, 22, 28, 79, 239, 208, 58, 99, 99, 30, 47, 175, 205, 59, 35, 226, 254, 59, 149, 114, 161, 91, 130, 26, 83, 136, 47, 54, 219, 171, 16, 65, 198, 30, 224, 115, 103, 104, 183, 203, 48, 75, 183, 181, 38, 61, 70, 61, 3, 104, 117, 133, 52, 228, 129, 60, 223, 31, 169, 196, 195, 119, 87, 44, 158, 111, 155, 98, 187, 101, 2, 53, 198, 116, 159, 5, 115, 166, 41, 156, 254, 47, 25, 250, 224, 80, 80, 113, 17, 236, 23, 72, 70, 23, 11, 178, 21, 205, 13, 112, 225, 122, 170, 52, 180, 203, 12, 7, 124, 34, 66, 150, 218, 183, 69, 248, 213, 10, 79, 94, 212, 65, 173, 223, 181, 56, 35, 73, 45, 86, 23, 189, 218, 180, 10, 32, 26, 74, 192, 18, 222, 6, 225, 134, 71, 77, 233, 16, 70, 135, 197, 218, 156, 109, 76, 36, 87, 117, 30, 123, 109, 208, 28, 44, 16, 156, 109, 5, 120, 244, 254, 97, 83, 202, 230, 108, 167, 105, 215, 146, 171, 9, 246, 126, 193, 38, 76, 105, 104, 16, 224, 149, 128, 230, 70, 57, 62, 243, 16, 230, 9, 127, 158, 226, 234, 32, 174, 110, 251, 22, 7, 29, 78, 13, 47, 79, 3, 199, 102, 66, 90, 164, 55, 21, 150, 235, 49, 243, 235, 24, 155, 250, 0, 140, 75, 65, 2, 103, 198, 164, 210, 231, 84, 108, 227, 129, 250, 218, 250, 194, 116, 201, 54, 55, 58, 52, 220, 169, 161, 33, 165, 254, 103, 114, 164, 239, 95, 218, 138, 193, 176, 154, 76, 232, 179, 47, 18, 41, 127, 41, 126, 253, 239, 225, 107, 99, 249, 91, 187, 168, 111, 180, 162, 109, 23, 192, 207, 36, 107, 88, 138, 151, 57, 97, 250, 104, 242, 20, 248, 164, 161, 156, 149, 237, 39, 169, 237, 93, 77, 113, 104, 152, 166, 97, 156, 7, 187, 143, 255, 235, 162, 157, 103, 148, 149, 24, 3, 241, 237, 87, 240, 199, 127, 214, 221, 22, 198, 46, 41, 161, 114, 237, 45, 234, 130, 188, 185, 212, 88, 125, 74, 0, 38, 254, 159, 119, 132, 244, 119, 72, 138, 162, 63, 150, 148, 180, 195, 113, 59, 27, 199, 126, 20, 216, 177, 230, 117, 203, 2, 103, 183, 197, 138, 185, 101, 75, 124, 200, 173, 78, 243, 204, 169, 178, 7, 30, 138, 128, 248, 150, 73, 206, 102, 192, 226, 197, 118, 252, 199, 1, 208, 203, 196, 105, 125, 238, 90, 169, 54, 209, 78, 244, 232, 35, 229, 66, 233, 186, 153, 137, 62, 195, 226, 46, 15, 3, 191, 42, 25, 26, 130, 19, 164, 193, 110, 98, 200, 236, 65, 62, 203, 96, 252, 221, 127, 153, 192, 146, 139, 48, 79, 8, 61, 20, 211, 142, 233, 169, 192, 206, 16, 62, 159, 130, 212, 157, 230, 108, 162, 231, 81, 253, 44, 207, 33, 148, 138, 14, 226, 131, 14, 66, 192, 178, 166, 208, 24, 187, 175, 26, 106, 0, 27, 71, 75, 152, 167, 15, 48, 142, 117, 42, 97, 232, 74, 123, 145, 91, 126, 217, 169, 47, 227, 214, 228, 53, 60, 32, 245, 137, 32, 119, 182, 191, 56, 13, 208, 248, 107, 3, 186, 250, 202, 245, 156, 35, 130, 13, 156, 35, 156, 204, 243, 5, 47, 85, 156, 42, 59, 155, 21, 57, 8, 100, 4, 153, 255, 123, 129, 109, 42, 2, 138, 59, 232, 25, 81, 150, 42, 189, 215, 76, 253, 132, 32, 152, 76, 73, 156, 80, 158, 143, 66, 5, 232, 215, 86, 81, 223, 18, 31, 63, 182, 206, 36, 144, 56, 233, 36, 104, 120, 94, 183, 226, 253, 254, 254, 11, 119, 198, 206, 16, 113, 141, 241, 170, 113, 246, 186, 122, 40, 249, 149, 101, 114, 35, 135, 104, 72, 134, 139, 171, 221, 124, 174, 65, 45, 207, 111, 142, 198, 83, 18, 77, 14, 159, 55, 12, 45, 216, 0, 105, 17, 237, 107, 37, 41, 120, 216, 89, 69, 38, 115, 228, 29, 0, 69, 75, 246, 201, 230, 241, 202, 57, 175, 49, 134, 122, 215, 114, 64, 3, 55, 198, 123, 239, 44, 81, 211, 38, 25, 189, 229, 121, 239, 128, 107, 222, 179, 158, 242, 60, 79, 66, 121, 125, 150, 203, 203, 113, 197, 189, 188, 35, 194, 64, 53, 210, 200, 46, 102, 227, 14, 158, 69, 182, 69, 186, 113, 26, 182, 240, 11, 243, 47, 91, 227, 72, 109, 174, 179, 196, 179, 29, 102, 229, 22, 223, 218, 225, 109, 224, 243, 6, 109, 135, 124, 6, 31, 181, 62, 3, 117, 243, 62, 37, 17, 194, 121, 190, 118, 5, 137, 182, 147, 21, 244, 1, 115, 111, 211, 228, 136, 60, 130, 217, 240, 232, 216, 229, 217, 162, 98, 90, 150, 189, 213, 121, 73, 245, 240, 217, 70, 220, 9, 229, 240, 238, 254, 216, 87, 106, 177, 171, 4, 62, 30, 134, 183, 233, 193, 77, 100, 94, 21, 15, 72, 118, 166, 55, 23, 1, 163, 168, 79, 190, 102, 171, 221, 224, 186, 33, 115, 15, 107, 197, 61, 140, 188, 125, 247, 39, 202, 169, 151, 50, 27, 86, 60, 51, 63, 31, 174, 240, 202, 27, 130, 65, 93, 135, 4, 208, 2, 108, 36, 210, 151, 209, 212, 20, 251, 120, 86, 51, 187, 244, 124, 36, 238, 214, 41, 198, 75, 109, 224, 206, 81, 127, 132, 142, 71, 31, 89, 231, 207, 17, 86, 16, 186, 94, 242, 215, 134, 6, 128, 113, 251, 104, 93, 134, 1, 26, 45, 130, 31, 174, 157, 60, 199, 4, 11, 88, 141, 154, 7, 12, 27, 80, 39, 84, 115, 115, 54, 150, 221, 98, 52, 210, 18, 205, 232, 67, 105, 73, 91, 15, 218, 222, 165, 197, 115, 126, 198, 31, 111, 29, 35, 6, 143, 17, 170, 52, 50, 121, 64, 184, 11, 40, 200, 128, 138, 214, 32, 49, 19, 107, 38, 132, 76, 41, 90, 41, 69, 120, 143, 123, 14, 91, 139, 226, 176, 119, 145, 31, 75, 12, 208, 134, 181, 244, 255, 169, 139, 219, 253, 182, 18, 164, 44, 34, 218, 139, 130, 43, 112, 111, 60, 5, 237, 172, 60, 55, 82, 55, 251, 142, 47, 64, 190, 64, 122, 103, 156, 64, 106, 241, 218, 82, 160, 236, 119, 174, 141, 38, 164, 188, 158, 36, 89, 6, 84, 22, 78, 14, 227, 116, 90, 167, 166, 215, 153, 39, 83, 20, 23, 49, 65, 42, 228, 212, 109, 50, 110, 11, 26, 92, 50, 152, 237, 107, 47, 79, 159, 184, 77, 248, 118, 153, 105, 127, 227, 251, 66, 111, 118, 171, 6, 181, 84, 65, 28, 237, 93, 7, 149, 146, 133, 108, 212, 45, 226, 209, 217, 169, 78, 65, 246, 95, 2, 97, 77, 228, 198, 148, 136, 152, 197, 67, 80, 7, 173, 35, 70, 2, 127, 63, 166, 167, 81, 76, 223, 125, 114, 252, 73, 110, 232, 147, 234, 86, 89, 11, 77, 141, 10, 8, 193, 149, 204, 105, 39, 101, 60, 183, 123, 64, 42, 234, 100, 81, 126, 89, 229, 84, 229, 198, 228, 114, 13, 26, 234, 193, 182, 197, 147, 88, 83, 75, 157, 202, 116, 113, 16, 219, 103, 154, 93, 61, 141, 194, 15, 152, 149, 64, 234, 156, 68, 115, 185, 174, 18, 150, 176, 48, 122, 144, 112, 2, 220, 82, 66, 128, 92, 246, 125, 237, 74, 50, 132, 124, 171, 150, 175, 36, 114, 150, 67, 40, 51, 126, 12, 59, 33, 25, 79, 31, 236, 90, 195, 192, 48, 241, 47, 31, 182, 116, 87, 54, 138, 100, 73, 151, 145, 178, 129, 131, 243, 168, 31, 219, 224, 141, 74, 62, 43, 247, 3, 114, 13, 136, 129, 38, 211, 40, 2, 73, 111, 162, 30, 51, 201, 50, 227, 181, 144, 242, 176, 151, 30, 99, 9, 171, 57, 174, 189, 74, 138, 38, 184, 219, 243, 182, 2, 47, 90, 105, 181, 156, 32, 52, 43, 39, 205, 215, 228, 149, 151, 123, 82, 34, 28, 30, 142, 107, 132, 225, 182, 97, 193, 105, 28, 107, 236, 15, 167, 246, 2, 74, 133, 55, 152, 59, 59, 47, 41, 235, 254, 160, 83, 174, 47, 157, 126, 91, 111, 28, 17, 9, 117, 29, 19, 87, 91, 131, 69, 241, 74, 99, 150, 22, 128, 190, 238, 150, 90, 194, 67, 140, 221, 63, 48, 137, 87, 157, 163, 174, 53, 237, 209, 25, 127, 69, 113, 77, 225, 251, 73, 0, 49, 212, 32, 230, 242, 94, 59, 223, 1, 58, 90, 166, 3, 135, 230, 2, 141, 74, 212, 218, 202, 211, 174, 79, 2, 29, 134, 134, 118, 44, 237, 144, 141, 61, 244, 184, 111, 92, 255, 12, 148, 160, 142, 121, 150, 76, 5, 253, 115, 211, 139, 142, 136, 202, 209, 168, 59, 20, 196, 238, 220, 229, 254, 229, 219, 223, 81, 109, 31, 230, 205, 25, 73, 193, 249, 77, 93, 13, 209, 202, 6, 172, 235, 146, 1, 73, 136, 194, 205, 6, 213, 181, 212, 133, 29, 58, 194, 116, 9, 5, 40, 135, 45, 9, 81, 236, 53, 0, 4, 158, 164, 29, 252, 176, 198, 192, 112, 141, 122, 229, 84, 69, 222, 233, 136, 112, 184, 228, 212, 23, 83, 210, 140, 153, 204, 210, 216, 202, 50, 237, 224, 185, 29, 124, 209, 32, 49, 182, 125, 171, 159, 180, 172, 159, 218, 82, 11, 210, 89, 88, 55, 202, 65, 165, 4, 2, 3, 29, 95, 239, 159, 18, 85, 248, 131, 232, 212, 24, 116, 203, 22, 64, 195, 99, 203, 109, 195, 40, 110, 54, 112, 28, 17, 228, 73, 128, 241, 96, 99, 77, 114, 171, 33, 232, 223, 45, 133, 89, 106, 12, 78, 237, 239, 35, 236, 20, 198, 25, 59, 139, 89, 207, 22, 84, 17, 212, 208, 103, 227, 60, 245, 99, 248, 203, 239, 173, 46, 116, 65, 180, 238, 89, 255, 251, 233, 6, 56, 175, 71, 165, 20, 47, 167, 147, 150, 188, 47, 69, 85, 244, 18, 210, 26, 229, 148, 137, 13, 63, 190, 173, 236, 207, 59, 54, 101, 140, 149, 61, 209, 58, 44, 94, 32, 30, 11, 110, 122, 132, 14, 203, 229, 69, 196, 61, 140, 242, 35, 108, 215, 251, 205, 152, 31, 172, 200, 153, 252, 203, 8, 3, 127, 77, 5, 137, 52, 82, 33, 96, 198, 28, 156, 138, 237, 250, 112, 72, 71, 74, 168, 25, 57, 156, 157, 89, 252, 212, 3, 94, 126, 190, 230, 200, 100, 108, 247, 38, 83, 144, 65, 230, 96, 242, 75, 4, 79, 88, 87, 221, 77, 74, 15, 79, 184, 221, 236, 9, 74, 105, 123, 251, 94, 67, 240, 53, 133, 62, 165, 38, 211, 12, 164, 42, 201, 213, 105, 252, 66, 10, 15, 216, 85, 98, 50, 5, 60, 46, 126, 50, 199, 136, 129, 134, 52, 37, 81, 102, 123, 112, 60, 165, 72, 224, 171, 193, 47, 184, 64, 226, 218, 189, 181, 111, 108, 101, 145, 248, 31, 0, 230, 124, 156, 171, 162, 25, 95, 32, 52, 137, 144, 161, 22, 3, 113, 51, 164, 221, 36, 62, 126, 251, 21, 174, 135, 21, 164, 207, 76, 162, 226, 232, 124, 38, 54, 136, 182, 30, 192, 178, 115, 122, 194, 181, 3, 230, 9, 110, 89, 32, 238, 59, 43, 43, 175, 76, 27, 93, 111, 12, 206, 131, 201, 70, 194, 179, 199, 138, 102, 57, 13, 91, 95, 91, 61, 56, 146, 175, 172, 18, 162, 50, 0, 23, 139, 163, 240, 178, 194, 115, 133, 93, 172, 154, 84, 167, 239, 234, 135, 146, 113, 145, 12, 250, 223, 22, 113, 83, 21, 81, 107, 93, 43, 125, 148, 193, 112, 29, 90, 51, 21, 36, 28, 13, 185, 209, 23, 189, 229, 89, 169, 32, 33, 56, 33, 90, 204, 212, 145, 139, 58, 73, 225, 145, 187, 6, 142, 29, 40, 95, 224, 141, 223, 47, 209, 29, 11, 23, 87, 96, 168, 162, 133, 35, 147, 190, 153, 232, 101, 76, 226, 62, 188, 82, 81, 70, 98, 242, 29, 247, 218, 162, 217, 173, 7, 72, 106, 106, 178, 240, 26, 154, 92, 84, 253, 130, 93, 202, 153, 24, 102, 142, 162, 212, 141, 63, 19, 124, 223, 133, 220, 70, 10, 17, 148, 3, 100, 224, 82, 124, 103, 253, 115, 103, 174, 177, 126, 148, 52, 240, 199, 232, 152, 207, 198, 161, 245, 128, 215, 234, 107, 36, 43, 221, 201, 37, 15, 15, 47, 101, 151, 205, 216, 182, 78, 68, 33, 240, 134, 11, 107, 97, 60, 55, 80, 128, 70, 16, 56, 228, 116, 3, 194, 135, 12, 206, 170, 121, 124, 35, 101, 229, 124, 209, 148, 109, 248, 224, 90, 50, 191, 181, 204, 121, 107, 59, 91, 196, 95, 17, 192, 188, 128, 154, 44, 154, 200, 241, 50, 232, 145, 122, 244, 188, 10, 115, 115, 28, 87, 12, 3, 110, 218, 2, 44, 119, 208, 138, 3, 214, 202, 8, 249, 125, 39, 76, 79, 111, 105, 61, 25, 30, 153, 206, 65, 80, 36, 159, 171, 21, 202, 66, 147, 119, 52, 140, 250, 137, 104, 131, 167, 190, 6, 129, 166, 133, 110, 214, 238, 0, 184, 252, 209, 228, 124, 100, 201, 87, 28, 200, 38, 239, 210, 104, 102, 66, 185, 236, 62, 151, 166, 177, 18, 223, 212, 167, 251, 240, 206, 128, 24, 163, 141, 81, 164, 57, 20, 66, 17, 132, 160, 35, 142, 223, 118, 165, 200, 142, 178, 225, 26, 225, 139, 238, 243, 217, 20, 245, 167, 16, 46, 67, 44, 216, 140, 229, 175, 151, 43, 201, 178, 64, 102, 231, 32, 191, 166, 64, 150, 72, 112, 218, 91, 114, 197, 206, 141, 251, 172, 201, 99, 160, 59, 111, 174, 27, 231, 123, 134, 32, 101, 84, 59, 90, 59, 239, 98, 204, 93, 158, 53, 200, 130, 202, 157, 118, 242, 72, 18, 245, 48, 96, 24, 93, 96, 121, 34, 97, 199, 84, 33, 58, 253, 165, 62, 95, 146, 219, 45, 209, 237, 111, 160, 126, 191, 68, 135, 213, 62, 149, 51, 88, 239, 92, 160, 37, 54, 227, 32, 59, 240, 118, 249, 233, 214, 248, 173, 69, 135, 91, 55, 8, 222, 167, 170, 171, 188, 155, 83, 5, 76, 224, 162, 90, 188, 254, 192, 71, 90, 100, 154, 142, 136, 52, 179, 160, 4, 33, 229, 165, 173, 87, 176, 150, 61, 166, 251, 22, 217, 74, 16, 250, 248, 169, 163, 228, 73, 233, 253, 101, 128, 230, 203, 244, 207, 1, 172, 53, 60, 193, 201, 128, 144, 104, 142, 101, 102, 194, 20, 120, 136, 160, 43, 245, 174, 86, 136, 19, 97, 235, 223, 236, 143, 107, 171, 39, 70, 178, 112, 129, 121, 15, 171, 218, 231, 84, 56, 89, 232, 231, 113, 173, 88, 190, 137, 56, 118, 143, 32, 58, 154, 207, 245, 209, 48, 187, 56, 140, 222, 41, 150, 254, 5, 10, 227, 195, 222, 40, 140, 167, 120, 119, 172, 67, 159, 253, 193, 63, 81, 59, 86, 172, 36, 255, 17, 132, 179, 135, 0, 88, 255, 242, 18, 142, 9, 247, 47, 178, 165, 181, 154, 109, 98, 52, 121, 232, 115, 16, 37, 28, 234, 167, 167, 238, 4, 225, 90, 106, 241, 44, 147, 227, 15, 127, 45, 72, 47, 99, 209, 6, 160, 92, 107, 121, 185, 231, 152, 157, 168, 186, 137, 16, 231, 56, 243, 138, 169, 237, 37, 191, 181, 156, 202, 193, 124, 115, 42, 16, 66, 223, 47, 158, 22, 25, 140, 152, 184, 18, 15, 143, 98, 242, 43, 114, 93, 134, 25, 233, 174, 242, 170, 61, 66, 101, 115, 154, 224, 75, 162, 21, 201, 194, 3, 98, 135, 80, 24, 240, 27, 7, 52, 195, 161, 69, 189, 92, 124, 181, 187, 128, 28, 35, 106, 156, 143, 9, 226, 76, 8, 28, 188, 0, 54, 227, 74, 207, 77, 80, 93, 161, 122, 82, 225, 32, 150, 163, 223, 118, 99, 111, 120, 19, 18, 80, 200, 17, 25, 91, 158, 195, 3, 76, 89, 46, 163, 51, 104, 229, 155, 203, 58, 52, 24, 2, 181, 152, 105, 80, 246, 153, 1, 94, 236, 201, 67, 47, 164, 153, 50, 68, 192, 191, 47, 96, 253, 36, 63, 175, 190, 80, 10, 151, 72, 29, 168, 190, 172, 3, 217, 6, 156, 218, 158, 176, 92, 126, 173, 229, 116, 98, 249, 213, 46, 253, 122, 14, 211, 159, 114, 99, 68, 168, 55, 230, 94, 149, 40, 9, 31, 9, 205, 91, 147, 14, 24, 197, 63, 216, 168, 168, 239, 38, 61, 172, 238, 149, 58, 9, 19, 138, 183, 39, 168, 66, 63, 61, 0, 33, 86, 194, 158, 221, 89, 15, 166, 71, 16, 35, 231, 240, 88, 91, 197, 233, 229, 124, 214, 138, 177, 76, 176, 99, 209, 218, 80, 211, 113, 55, 238, 189, 137, 79, 73, 176, 86, 1, 50, 174, 22, 16, 92, 223, 56, 102, 80, 130, 72, 30, 71, 178, 59, 4, 76, 175, 75, 92, 105, 31, 122, 34, 213, 82, 121, 202, 151, 17, 240, 255, 76, 49, 156, 82, 191, 69, 162, 121, 240, 104, 182, 148, 201, 196, 195, 162, 172, 107, 57, 12, 168, 197, 227, 202, 4, 131, 158, 203, 29, 156, 152, 59, 118, 224, 52, 195, 36, 10, 94, 1, 140, 209, 178, 65, 23, 137, 8, 255, 205, 88, 114, 18, 106, 14, 184, 30, 128, 210, 199, 98, 194, 44, 141, 80, 194, 255, 249, 21, 140, 197, 72, 112, 212, 238, 11, 142, 197, 13, 115, 16, 164, 242, 140, 60, 189, 105, 156, 248, 176, 73, 243, 226, 79, 192, 212, 224, 216, 123, 52, 126, 179, 189, 156, 224, 232, 75, 52, 66, 186, 21, 2, 118, 236, 10, 134, 129, 55, 114, 130, 15, 40, 47, 235, 31, 81, 39, 216, 99, 81, 231, 170, 39, 69, 53, 173, 7, 169, 180, 69, 86, 133, 178, 227, 160, 243, 100, 144, 57, 9, 177, 109, 236, 243, 254, 208, 133, 98, 249, 177, 78, 162, 55, 194, 130, 21, 51, 119, 104, 233, 81, 135, 62, 102, 245, 44, 88, 110, 73, 157, 226, 11, 140, 163, 19, 132, 100, 3, 31, 222, 202, 95, 29, 20, 109, 53, 86, 247, 31, 113, 9, 224, 130, 180, 104, 4, 223, 17, 205, 207, 166, 7, 246, 244, 196, 164, 25, 75, 15, 121, 107, 255, 211, 56, 195, 111, 248, 255, 182, 10, 107, 226, 123, 180, 165, 63, 168, 203, 9, 174, 156, 31, 102, 150, 242, 62, 235, 249, 47, 27, 152, 58, 208, 203, 224, 163, 227, 171, 205, 12, 187, 224, 139, 151, 133, 222, 121, 36, 61, 254, 248, 196, 172, 103, 195, 98, 193, 211, 190, 126, 45, 44, 155, 20, 65, 168, 51, 144, 51, 152, 46, 233, 112, 36, 15, 73, 239, 5, 120, 236, 179, 40, 207, 2, 153, 155, 92, 65, 43, 84, 48, 124, 219, 146, 91, 13, 201, 252, 211, 243, 227, 40, 221, 221, 248, 235, 156, 194, 5, 130, 155, 74, 102, 186, 167, 114, 40, 254, 61, 236, 250, 157, 132, 124, 78, 250, 212, 250, 209, 77, 112, 243, 80, 60, 52, 34, 237, 38, 115, 243, 239, 49, 113, 211, 186, 24, 120, 139, 133, 14, 247, 115, 84, 254, 253, 72, 163, 20, 151, 225, 143, 126, 8, 38, 69, 130, 4, 84, 143, 48, 32, 218, 130, 136, 109, 251, 253, 93, 184, 152, 23, 4, 182, 201, 193, 151, 206, 238, 151, 206, 13, 43, 255, 7, 153, 194, 240, 1, 30, 149, 44, 235, 44, 14, 185, 111, 237, 183, 199, 54, 121, 208, 84, 220, 196, 244, 138, 24, 186, 36, 245, 254, 19, 61, 73, 239, 248, 73, 49, 175, 169, 211, 59, 88, 180, 56, 230, 78, 92, 235, 61, 34, 187, 177, 236, 187, 158, 226, 120, 159, 108, 54, 95, 188, 219, 130, 41, 72, 162, 199, 22, 176, 38, 231, 86, 132, 237, 227, 18, 148, 185, 93, 9, 157, 188, 181, 199, 57, 83, 250, 185, 10, 34, 102, 175, 233, 91, 27, 166, 27, 68, 128, 35, 97, 159, 40, 133, 88, 118, 225, 128, 69, 31, 1, 96, 88, 219, 151, 4, 89, 235, 54, 180, 246, 192, 240, 42, 4, 229, 40, 26, 37, 175, 82, 132, 106, 96, 95, 176, 174, 103, 238, 70, 91, 231, 179, 4, 237, 240, 118, 137, 154, 50, 120, 124, 171, 157, 197, 150, 121, 154, 119, 85, 167, 48, 30, 98, 57, 14, 239, 46, 36, 131, 93, 152, 183, 94, 221, 46, 20, 32, 63, 189, 192, 12, 37, 29, 96, 48, 95, 83, 233, 131, 139, 12, 222, 136, 246, 159, 235, 123, 191, 190, 77, 19, 135, 185, 55, 210, 202, 170, 84, 200, 253, 126, 241, 227, 80, 184, 199, 218, 95, 6, 119, 112, 204, 13, 65, 226, 86, 248, 44, 94, 14, 120, 40, 221, 214, 140, 20, 238, 241, 87, 43, 33, 27, 48, 230, 178, 210, 158, 234, 128, 232, 177, 228, 187, 127, 130, 236, 147, 194, 174, 139, 182, 5, 214, 102, 49, 144, 134, 49, 166, 247, 127, 104, 18, 29, 125, 198, 242, 190, 113, 11, 123, 114, 60, 146, 156, 15, 198, 93, 129, 177, 12, 183, 68, 110, 239, 97, 116, 184, 24, 146, 10, 71, 96, 54, 107, 110, 87, 141, 124, 45, 62, 151, 107, 229, 220, 167, 18, 127, 183, 197, 219, 87, 142, 188, 210, 163, 107, 109, 129, 68, 26, 249, 240, 66, 76, 101, 46, 204, 115, 179, 239, 12, 63, 196, 172, 134, 79, 177, 133, 111, 75, 236, 101, 85, 196, 210, 218, 229, 15, 151, 197, 119, 73, 223, 216, 88, 216, 86, 249, 121, 203, 178, 8, 179, 71, 18, 191, 24, 48, 148, 59, 151, 72, 233, 7, 237, 250, 117, 144, 135, 59, 184, 119, 4, 88, 150, 53, 27, 81, 241, 90, 68, 1, 58, 187, 55, 100, 27, 220, 60, 79, 104, 117, 31, 118, 250, 113, 253, 187, 66, 215, 212, 164, 212, 39, 69, 91, 38, 90, 119, 11, 23, 76, 112, 138, 114, 114, 105, 109, 156, 85, 181, 142, 142, 37, 49, 233, 7, 51, 77, 23, 211, 208, 155, 61, 243, 53, 94, 187, 225, 108, 148, 179, 64, 75, 149, 156, 22, 180, 94, 232, 224, 222, 63, 76, 54, 51, 30, 251, 179, 226, 32, 33, 250, 88, 59, 127, 170, 249, 71, 127, 206, 253, 88, 122, 33, 229, 230, 76, 227, 74, 190, 231, 186, 189, 81, 31, 242, 73, 166, 234, 61, 217, 90, 186, 5, 83, 122, 212, 89, 126, 63, 241, 101, 185, 166, 1, 90, 170, 121, 152, 248, 128, 154, 198, 58, 176, 187, 91, 237, 121, 50, 190, 168, 176, 201, 31, 204, 193, 219, 83, 180, 61, 95, 112, 92, 123, 51, 158, 234, 121, 34, 0, 165, 62, 98, 194, 238, 151, 185, 190, 179, 157, 219, 58, 218, 189, 91, 240, 117, 121, 174, 97, 204, 102, 2, 135, 249, 200, 217, 170, 246, 95, 9, 124, 224, 77, 119, 60, 113, 78, 231, 174, 109, 45, 78, 55, 249, 134, 174, 144, 12, 158, 78, 5, 175, 124, 62, 150, 86, 255, 253, 254, 105, 252, 197, 86, 94, 149, 16, 126, 187, 156, 142, 66, 172, 83, 158, 18, 93, 200, 137, 30, 205, 253, 46, 130, 27, 224, 179, 22, 253, 50, 162, 178, 63, 24, 18, 183, 21, 33, 218, 178, 41, 154, 238, 138, 149, 203, 94, 65, 218, 184, 85, 232, 213, 67, 34, 146, 17, 71, 137, 18, 125, 38, 86, 199, 86, 9, 225, 174, 182, 236, 133, 91, 72, 148, 246, 200, 148, 68, 20, 96, 189, 75, 78, 243, 144, 5, 80, 173, 75, 42, 63, 126, 194, 85, 57, 84, 91, 230, 50, 145, 253, 225, 139, 158, 70, 230, 129, 246, 105, 214, 181, 139, 79, 210, 52, 218, 45, 99, 35, 30, 64, 55, 161, 201, 240, 216, 182, 65, 229, 46, 244, 236, 109, 223, 145, 147, 157, 22, 207, 197, 67, 45, 164, 228, 20, 148, 186, 222, 49, 113, 127, 58, 241, 228, 216, 168, 223, 238, 134, 232, 76, 211, 138, 251, 204, 153, 252, 38, 53, 199, 209, 22, 231, 146, 159, 77, 187, 98, 143, 62, 163, 46, 63, 48, 42, 77, 174, 247, 98, 197, 83, 5, 77, 239, 196, 86, 248, 172, 240, 62, 141, 177, 207, 132, 251, 81, 100, 253, 17, 9, 44, 19, 134, 144, 173, 208, 63, 232, 0, 210, 146, 180, 42, 250, 204, 68, 195, 27, 92, 122, 254, 182, 120, 21, 135, 177, 178, 206, 69, 231, 107, 105, 254, 213, 185, 31, 29, 250, 161, 199, 243, 220, 213, 226, 66, 0, 187, 219, 158, 111, 160, 129, 110, 113, 188, 134, 64, 178, 124, 32, 238, 30, 123, 51, 41, 116, 14, 103, 69, 187, 78, 105, 253, 10, 46, 6, 2, 122, 95, 201, 97, 36, 209, 150, 177, 210, 156, 38, 246, 174, 25, 189, 44, 101, 213, 192, 148, 239, 25, 15, 212, 8, 121, 37, 87, 124, 1, 252, 192, 225, 17, 33, 110, 52, 44, 171, 101, 212, 20, 235, 169, 168, 62, 163, 14, 204, 230, 47, 69, 175, 151, 229, 171, 222, 67, 245, 19, 97, 38, 79, 7, 246, 99, 230, 251, 181, 3, 210, 61, 178, 47, 138, 28, 113, 59, 122, 144, 249, 25, 191, 0, 67, 157, 59, 23, 71, 73, 234, 143, 168, 118, 53, 181, 146, 107, 43, 53, 171, 173, 15, 22, 84, 217, 189, 12, 54, 239, 15, 200, 30, 253, 206, 7, 193, 28, 220, 28, 103, 123, 160, 149, 98, 127, 231, 70, 1, 94, 191, 171, 167, 88, 73, 58, 47, 13, 52, 181, 86, 55, 233, 239, 174, 228, 249, 79, 65, 93, 128, 174, 13, 86, 144, 216, 235, 246, 98, 132, 142, 187, 144, 252, 68, 3, 170, 238, 203, 198, 75, 240, 25, 53, 234, 231, 91, 187, 189, 224, 71, 120, 176, 48, 64, 9, 163, 25, 33, 48, 198, 153, 14, 254, 183, 90, 101, 15, 137, 127, 71, 5, 230, 56, 246, 195, 46, 243, 50, 184, 123, 219, 77, 95, 84, 251, 227, 145, 57, 133, 159, 100, 40, 0, 213, 92, 127, 223, 152, 134, 252, 19, 8, 101, 78, 174, 110, 17, 153, 240, 88, 110, 45, 91, 46, 88, 115, 236, 189, 2, 67, 23, 45, 6, 228, 126, 80, 102, 128, 99, 20, 118, 255, 98, 13, 26, 17, 254, 175, 42, 0, 7, 126, 44, 142, 154, 204, 6, 22, 60, 65, 193, 161, 193, 76, 26, 141, 61, 130, 15, 203, 96, 216, 79, 192, 188, 51, 182, 144, 151, 178, 185, 228, 249, 176, 180, 13, 61, 223, 196, 102, 32, 108, 231, 206, 113, 193, 2, 204, 80, 51, 240, 227, 253, 6, 185, 176, 203, 65, 109, 222, 58, 132, 241, 43, 232, 73, 190, 66, 102, 54, 40, 89, 219, 157, 136, 186, 88, 125, 113, 144, 52, 206, 139, 250, 13, 104, 244, 10, 176, 145, 47, 12, 103, 4, 140, 119, 106, 20, 208, 239, 131, 61, 72, 151, 178, 208, 209, 94, 126, 47, 29, 151, 170, 10, 135, 178, 212, 249, 39, 152, 102, 221, 138, 2, 84, 51, 236, 224, 24, 179, 172, 92, 222, 121, 85, 54, 178, 17, 25, 38, 203, 126, 60, 152, 252, 238, 207, 20, 205, 11, 92, 11, 103, 229, 36, 126, 89, 138, 206, 240, 78, 87, 5, 72, 90, 199, 166, 174, 89, 174, 140, 0, 16, 239, 123, 10, 38, 26, 69, 120, 155, 86, 160, 173, 214, 59, 199, 25, 31, 40, 48, 153, 185, 9, 211, 102, 9, 38, 116, 45, 140, 128, 69, 134, 255, 174, 193, 112, 167, 16, 93, 131, 140, 185, 151, 147, 144, 93, 248, 249, 139, 157, 121, 126, 217, 211, 82, 46, 60, 131, 80, 184, 222, 189, 238, 196, 141, 190, 17, 135, 228, 181, 211, 58, 64, 93, 39, 137, 170, 106, 94, 201, 186, 118, 99, 180, 219, 141, 75, 109, 140, 150, 147, 251, 64, 0, 18, 76, 73, 143, 207, 120, 190, 178, 10, 238, 187, 44, 120, 78, 151, 123, 152, 24, 179, 136, 50, 101, 170, 177, 81, 172, 145, 232, 42, 230, 217, 131, 195, 60, 98, 157, 144, 29, 10, 16, 59, 168, 99, 45, 142, 170, 132, 38, 113, 13, 129, 96, 28, 7, 214, 126, 249, 238, 128, 49, 121, 168, 118, 109, 119, 185, 40, 154, 32, 18, 0, 141, 18, 123, 160, 26, 187, 206, 58, 126, 240, 229, 34, 29, 246, 192, 80, 250, 17, 40, 79, 63, 125, 141, 205, 56, 59, 33, 122, 165, 147, 50, 104, 94, 138, 166, 129, 34, 135, 210, 44, 183, 169, 235, 151, 35, 146, 198, 132, 107, 72, 80, 127, 24, 35, 190, 197, 89, 212, 134, 131, 68, 210, 40, 35, 231, 54, 8, 233, 2, 254, 64, 1, 120, 224, 116, 144, 97, 238, 78, 150, 99, 248, 157, 48, 137, 77, 40, 58, 56, 132, 108, 222, 77, 147, 11, 88, 61, 201, 251, 75, 195, 177, 249, 159, 163, 65, 207, 137, 107, 58, 251, 108, 59, 101, 42, 219, 186, 30, 186, 20, 248, 49, 218, 203, 211, 42, 241, 215, 175, 117, 159, 252, 240, 221, 105, 20, 45, 226, 183, 21, 77, 91, 226, 60, 90, 29, 127, 50, 29, 207, 112, 177, 216, 142, 254, 37, 216, 195, 139, 226, 62, 175, 153, 63, 191, 191, 109, 58, 135, 99, 95, 224, 146, 91, 18, 52, 139, 208, 68, 159, 74, 117, 51, 167, 22, 0, 250, 168, 105, 110, 203, 219, 133, 255, 65, 222, 240, 52, 190, 16, 105, 218, 62, 249, 152, 175, 5, 230, 92, 5, 1, 211, 137, 52, 95, 208, 192, 198, 204, 46, 163, 191, 177, 60, 171, 88, 108, 199, 49, 208, 107, 165, 123, 254, 107, 34, 236, 155, 207, 221, 76, 194, 126, 6, 95, 43, 211, 83, 14, 34, 165, 187, 213, 181, 138, 40, 26, 66, 232, 136, 125, 107, 191, 165, 177, 17, 26, 114, 202, 208, 97, 29, 218, 241, 54, 216, 26, 15, 186, 95, 101, 138, 180, 121, 210, 153, 56, 167, 102, 41, 30, 201, 97, 97, 118, 192, 121, 108, 48, 153, 124, 90, 245, 87, 129, 105, 195, 211, 44, 210, 16, 194, 179, 52, 233, 248, 225, 131, 84, 96, 35, 58, 40, 193, 29, 246, 213, 133, 223, 68, 196, 244, 78, 11, 224, 123, 156, 21, 149, 50, 162, 235, 63, 238, 41, 189, 156, 118, 22, 58, 21, 49, 62, 72, 1, 228, 92, 69, 109, 162, 82, 32, 13, 178, 116, 222, 192, 32, 146, 227, 201, 184, 123, 45, 217, 188, 118, 142, 23, 65, 5, 167, 6, 221, 116, 145, 196, 204, 56, 178, 100, 86, 181, 59, 38, 37, 40, 244, 131, 205, 15, 173, 169, 74, 223, 251, 85, 109, 232, 244, 123, 98, 241, 205, 174, 190, 173, 131, 182, 253, 229, 45, 35, 216, 209, 206, 251, 197, 234, 207, 193, 11, 108, 241, 100, 107, 178, 68, 153, 243, 92, 153, 109, 71, 245, 40, 207, 237, 183, 157, 229, 17, 37, 198, 164, 205, 212, 16, 240, 88, 27, 127, 64, 117, 113, 213, 52, 66, 178, 250, 126, 110, 66, 42, 29, 71, 116, 183, 232, 31, 176, 110, 200, 76, 19, 1, 52, 109, 243, 80, 213, 227, 68, 67, 85, 180, 67, 19, 78, 6, 13, 97, 176, 115, 42, 6, 30, 111, 68, 224, 29, 49, 21, 102, 65, 253, 232, 152, 255, 21, 114, 144, 6, 151, 12, 255, 130, 226, 168, 12, 204, 244, 17, 49, 199, 247, 206, 214, 107, 221, 80, 62, 154, 103, 139, 136, 21, 37, 91, 60, 127, 251, 171, 9, 28, 184, 141, 91, 53, 151, 127, 161, 83, 118, 127, 234, 185, 94, 193, 193, 103, 61, 117, 170, 158, 190, 239, 99, 110, 166, 94, 128, 111, 135, 203, 203, 174, 127, 226, 231, 242, 198, 202, 86, 229, 197, 254, 208, 10, 193, 104, 160, 3, 129, 104, 229, 58, 232, 129, 80, 52, 42, 164, 217, 101, 219, 76, 25, 111, 170, 226, 229, 22, 212, 247, 61, 0, 36, 134, 176, 74, 159, 204, 17, 203, 56, 66, 41, 103, 183, 74, 37, 67, 142, 229, 50, 89, 188, 239, 6, 210, 55, 238, 70, 222, 223, 230, 59, 185, 22, 34, 14, 101, 72, 117, 221, 215, 127, 82, 234, 229, 28, 59, 32, 146, 143, 184, 247, 72, 47, 143, 73, 57, 145, 190, 183, 179, 39, 135, 9, 225, 220, 72, 53, 16, 225, 176, 211, 17, 242, 156, 20, 227, 80, 226, 130, 96, 201, 122, 252, 12, 164, 102, 61, 130, 166, 217, 156, 8, 78, 60, 234, 174, 25, 58, 146, 101, 191, 226, 151, 230, 127, 217, 66, 225, 121, 149, 55, 77, 118, 21, 202, 123, 117, 128, 180, 145, 225, 159, 102, 190, 251, 67, 124, 73, 25, 131, 222, 130, 243, 34, 192, 8, 37, 81, 250, 177, 89, 93, 177, 202, 19, 105, 110, 229, 57, 45, 135, 133, 162, 201, 185, 83, 74, 23, 115, 250, 154, 7, 172, 19, 218, 131, 67, 133, 185, 140, 29, 58, 107, 100, 230, 249, 71, 44, 95, 21, 180, 87, 22, 156, 252, 171, 55, 220, 201, 204, 115, 210, 13, 132, 111, 163, 93, 95, 17, 1, 69, 14, 14, 40, 61, 213, 163, 46, 185, 241, 30, 7, 199, 48, 182, 107, 148, 150, 231, 226, 230, 32, 147, 181, 70, 187, 21, 253, 124, 192, 60, 105, 168, 61, 121, 201, 30, 129, 85, 70, 135, 151, 173, 161, 11, 74, 228, 89, 21, 79, 254, 122, 173, 211, 116, 118, 7, 26, 48, 79, 181, 231, 163, 76, 194, 108, 19, 104, 174, 53, 112, 219, 113, 126, 160, 128, 2, 168, 219, 81, 163, 215, 36, 168, 12, 142, 152, 237, 183, 18, 236, 203, 132, 11, 41, 16, 249, 210, 25, 4, 246, 207, 87, 207, 98, 218, 36, 157, 86, 220, 65, 45, 25, 89, 7, 86, 236, 4, 65, 36, 25, 168, 94, 252, 106, 233, 175, 180, 33, 163, 33, 88, 219, 175, 193, 102, 61, 62, 85, 99, 250, 197, 209, 130, 201, 81, 218, 80, 187, 247, 174, 101, 81, 212, 161, 14, 100, 188, 75, 199, 196, 187, 31, 220, 207, 177, 93, 72, 230, 221, 59, 198, 27, 49, 38, 165, 52, 3, 227, 59, 204, 147, 186, 183, 117, 148, 240, 223, 79, 136, 61, 139, 145, 228, 48, 231, 57, 224, 219, 140, 1, 245, 237, 87, 62, 61, 92, 120, 67, 25, 152, 150, 147, 149, 253, 242, 36, 117, 248, 171, 184, 233, 133, 147, 112, 200, 100, 63, 101, 156, 132, 214, 156, 75, 106, 56, 160, 139, 221, 49, 195, 136, 40, 85, 126, 46, 59, 245, 200, 11, 148, 90, 39, 7, 199, 71, 23, 57, 107, 34, 2, 215, 94, 217, 115, 221, 167, 44, 227, 175, 222, 167, 13, 255, 5, 20, 238, 203, 69, 127, 200, 120, 178, 230, 34, 41, 40, 247, 38, 129, 246, 244, 159, 13, 207, 148, 130, 155, 104, 62, 31, 181, 2, 249, 117, 78, 79, 31, 33, 246, 221, 17, 179, 20, 139, 200, 119, 243, 156, 27, 215, 251, 174, 190, 227, 61, 224, 82, 162, 11, 250, 11, 88, 221, 172, 245, 170, 143, 210, 186, 213, 173, 141, 195, 214, 73, 243, 130, 249, 2, 137, 155, 155, 102, 231, 225, 212, 82, 79, 129, 89, 131, 79, 67, 78, 151, 165, 195, 61, 218, 244, 60, 196, 233, 121, 9, 124, 13, 10, 64, 246, 245, 150, 140, 90, 188, 20, 179, 41, 74, 210, 206, 65, 255, 61, 223, 169, 63, 20, 23, 23, 168, 43, 67, 242, 83, 162, 54, 123, 83, 12, 233, 247, 249, 69, 184, 232, 201, 245, 164, 213, 75, 222, 7, 27, 145, 224, 227, 212, 204, 183, 121, 240, 193, 251, 239, 82, 189, 81, 177, 130, 157, 12, 52, 81, 187, 45, 186, 31, 86, 61, 164, 160, 204, 143, 154, 16, 59, 21, 161, 69, 214, 86, 30, 64, 174, 80, 58, 166, 210, 5, 148, 248, 220, 116, 33, 20, 212, 82, 202, 132, 244, 10, 117, 15, 167, 32, 130, 148, 178, 88, 238, 90, 86, 183, 252, 67, 100, 251, 134, 45, 232, 95, 218, 114, 202, 172, 75, 108, 124, 73, 19, 196, 54, 107, 205, 185, 34, 249, 37, 55, 3, 2, 114, 188, 35, 94, 82, 0, 97, 167, 131, 241, 186, 207, 160, 242, 168, 40, 230, 124, 55, 97, 147, 115, 202, 197, 54, 35, 142, 209, 177, 105, 221, 88, 189, 136, 86, 51, 77, 203, 156, 190, 159, 172, 222, 67, 57, 108, 197, 88, 202, 90, 250, 95, 106, 183, 86, 45, 208, 219, 90, 253, 246, 72, 110, 144, 50, 147, 143, 35, 64, 132, 227, 167, 248, 174, 247, 241, 66, 244, 172, 127, 98, 31, 67, 3, 208, 220, 168, 132, 1, 195, 238, 207, 63, 171, 195, 189, 43, 68, 124, 121, 218, 255, 213, 68, 11, 59, 78, 89, 68, 146, 17, 87, 148, 172, 31, 140, 167, 199, 163, 37, 250, 242, 122, 31, 187, 221, 13, 159, 226, 162, 197, 54, 144, 1, 16, 203, 71, 181, 223, 158, 253, 101, 204, 13, 94, 32, 250, 220, 49, 192, 229, 48, 9, 175, 34, 204, 100, 200, 157, 206, 137, 131, 139, 8, 71, 15, 186, 169, 210, 204, 154, 115, 224, 23, 86, 180, 249, 54, 52, 123, 49, 57, 56, 189, 189, 172, 107, 134, 220, 207, 215, 150, 120, 238, 144, 184, 30, 71, 53, 35, 126, 88, 100, 137, 101, 175, 159, 94, 158, 41, 88, 179, 234, 58, 19, 57, 10, 185, 133, 161, 153, 194, 71, 100, 221, 150, 174, 226, 2, 105, 191, 213, 205, 159, 217, 13, 72, 132, 67, 140, 216, 188, 68, 239, 242, 145, 42, 162, 182, 224, 148, 18, 12, 47, 201, 84, 139, 242, 44, 15, 148, 223, 66, 177, 214, 102, 184, 168, 175, 76, 12, 71, 155, 101, 14, 214, 134, 29, 75, 128, 34, 229, 36, 172, 215, 154, 234, 215, 120, 162, 137, 112, 235, 106, 66, 179, 176, 20, 25, 108, 13, 178, 29, 168, 205, 41, 210, 85, 228, 79, 237, 228, 42, 213, 226, 135, 186, 2, 97, 100, 209, 217, 196, 158, 129, 222, 133, 144, 184, 43, 236, 160, 244, 156, 98, 77, 156, 233, 160, 152, 250, 126, 232, 75, 54, 162, 51, 198, 64, 9, 101, 240, 102, 47, 51, 161, 19, 224, 97, 118, 193, 236, 204, 15, 157, 176, 35, 203, 14, 166, 56, 207, 190, 80, 15, 100, 80, 0, 229, 5, 89, 84, 94, 239, 117, 157, 211, 206, 150, 226, 137, 227, 167, 196, 113, 98, 219, 13, 114, 1, 31, 123, 99, 199, 255, 98, 74, 8, 43, 111, 120, 170, 16, 248, 146, 162, 224, 243, 10, 186, 243, 122, 115, 219, 250, 19, 19, 88, 228, 69, 221, 134, 108, 141, 53, 253, 231, 80, 162, 206, 166, 10, 47, 4, 222, 73, 229, 211, 70, 165, 179, 133, 216, 228, 228, 224, 189, 129, 132, 126, 5, 121, 151, 181, 177, 100, 109, 85, 46, 38, 43, 196, 121, 10, 144, 202, 178, 236, 156, 243, 91, 162, 132, 221, 4, 84, 186, 140, 123, 238, 56, 20, 241, 233, 108, 82, 51, 68, 229, 221, 97, 149, 41, 5, 214, 46, 57, 191, 146, 212, 209, 108, 60, 212, 159, 139, 58, 56, 189, 80, 164, 41, 150, 145, 163, 74, 162, 196, 114, 57, 202, 141, 175, 86, 92, 62, 89, 37, 185, 77, 246, 206, 32, 210, 239, 107, 87, 215, 182, 95, 12, 40, 155, 67, 191, 195, 108, 202, 38, 150, 141, 211, 131, 131, 225, 135, 225, 71, 215, 119, 20, 223, 147, 200, 124, 218, 48, 23, 235, 136, 70, 30, 239, 71, 28, 59, 183, 163, 219, 79, 165, 118, 93, 195, 250, 90, 127, 117, 9, 82, 162, 34, 115, 9, 5, 200, 188, 75, 214, 87, 10, 169, 34, 73, 41, 203, 21, 67, 88, 224, 147, 143, 211, 146, 33, 110, 156, 159, 137, 118, 182, 59, 42, 91, 208, 247, 254, 162, 7, 32, 137, 249, 17, 3, 24, 64, 219, 178, 22, 254, 237, 173, 5, 148, 226, 61, 121, 1, 61, 126, 34, 110, 196, 0, 81, 61, 91, 210, 208, 5, 75, 170, 79, 215, 148, 54, 219, 165, 252, 241, 2, 105, 238, 107, 102, 175, 108, 63, 48, 214, 188, 48, 206, 177, 196, 211, 254, 252, 127, 99, 244, 23, 232, 154, 151, 182, 98, 170, 2, 129, 167, 87, 74, 70, 19, 39, 204, 110, 127, 144, 90, 73, 63, 225, 66, 9, 29, 168, 0, 243, 72, 202, 176, 204, 83, 52, 67, 126, 239, 128, 69, 97, 4, 144, 21, 190, 105, 174, 132, 80, 6, 198, 73, 88, 199, 119, 229, 171, 206, 125, 190, 130, 145, 209, 18, 254, 133, 140, 200, 5, 236, 98, 83, 36, 50, 245, 248, 60, 235, 128, 148, 107, 249, 255, 193, 103, 111, 166, 210, 219, 231, 197, 69, 43, 245, 161, 164, 220, 239, 220, 99, 254, 67, 0, 215, 217, 34, 130, 199, 51, 200, 208, 165, 233, 194, 188, 188, 229, 248, 217, 1, 162, 132, 249, 252, 118, 165, 178, 25, 69, 24, 242, 96, 122, 79, 151, 153, 45, 9, 125, 166, 241, 189, 123, 255, 98, 133, 1, 247, 180, 205, 97, 100, 98, 229, 97, 11, 40, 166, 170, 123, 191, 134, 74, 229, 11, 168, 170, 161, 101, 171, 43, 144, 149, 64, 113, 231, 39, 59, 23, 252, 229, 189, 42, 166, 125, 71, 150, 65, 59, 140, 180, 131, 68, 182, 103, 226, 91, 205, 41, 236, 196, 221, 110, 106, 133, 104, 182, 218, 187, 7, 42, 214, 24, 97, 58, 115, 176, 147, 242, 34, 29, 51, 74, 123, 159, 193, 73, 253, 182, 19, 251, 161, 121, 79, 241, 61, 163, 119, 102, 243, 131, 45, 13, 58, 218, 202, 136, 133, 242, 226, 237, 204, 217, 12, 122, 201, 29, 204, 11, 67, 239, 154, 46, 254, 19, 183, 245, 157, 74, 188, 193, 51, 31, 88, 102, 214, 88, 215, 22, 123, 84, 250, 251, 169, 232, 166, 202, 152, 183, 244, 173, 55, 57, 56, 6, 92, 120, 110, 202, 129, 58, 13, 25, 235, 252, 243, 69, 229, 45, 40, 9, 196, 133, 247, 33, 178, 137, 46, 180, 186, 231, 108, 98, 199, 197, 171, 192, 204, 206, 17, 94, 61, 67, 218, 100, 204, 245, 166, 32, 113, 78, 104, 119, 178, 39, 146, 45, 252, 119, 142, 33, 229, 149, 175, 196, 189, 235, 29, 48, 16, 168, 33, 211, 219, 152, 228, 42, 105, 207, 90, 92, 39, 222, 84, 6, 126, 32, 114, 138, 131, 196, 188, 253, 110, 193, 129, 105, 17, 28, 28, 236, 199, 232, 233, 30, 142, 30, 3, 122, 102, 111, 177, 78, 168, 194, 156, 176, 115, 191, 197, 39, 152, 100, 112, 59, 116, 214, 144, 2, 151, 208, 217, 61, 53, 91, 70, 91, 127, 126, 173, 182, 136, 244, 129, 255, 215, 187, 146, 21, 169, 199, 63, 54, 191, 201, 233, 115, 127, 101, 98, 216, 0, 62, 93, 21, 97, 141, 168, 7, 134, 135, 169, 29, 171, 29, 3, 187, 123, 90, 73, 109, 92, 173, 100, 25, 240, 208, 57, 34, 124, 21, 130, 124, 62, 6, 28, 214, 149, 136, 213, 171, 161, 129, 209, 170, 76, 50, 229, 15, 179, 74, 149, 163, 114, 148, 10, 227, 101, 75, 105, 46, 163, 82, 148, 116, 140, 61, 210, 192, 139, 41, 248, 123, 169, 40, 140, 130, 148, 239, 203, 115, 220, 113, 158, 69, 185, 28, 69, 240, 132, 231, 122, 235, 192, 124, 31, 243, 237, 143, 55, 147, 81, 48, 163, 99, 4, 163, 64, 226, 216, 17, 118, 31, 32, 251, 93, 77, 252, 73, 222, 232, 15, 19, 200, 162, 13, 127, 4, 166, 213, 190, 150, 241, 162, 56, 42, 135, 193, 26, 171, 91, 209, 41, 196, 243, 129, 165, 1, 95, 84, 30, 62, 211, 147, 239, 247, 182, 66, 106, 219, 57, 95, 170, 233, 161, 23, 77, 50, 122, 163, 244, 19, 250, 179, 81, 38, 100, 238, 106, 34, 52, 244, 45, 119, 101, 179, 161, 142, 239, 49, 63, 37, 7, 166, 3, 55, 45, 248, 238, 91, 155, 254, 100, 37, 45, 18, 229, 1, 163, 230, 130, 219, 110, 129, 121, 107, 171, 125, 243, 20, 95, 146, 3, 18, 174, 20, 250, 149, 144, 56, 120, 6, 166, 247, 217, 138, 104, 0, 24, 174, 211, 227, 120, 177, 3, 49, 189, 32, 108, 213, 163, 126, 26, 192, 13, 195, 192, 197, 198, 191, 12, 91, 172, 255, 54, 97, 61, 255, 119, 96, 140, 24, 110, 187, 166, 112, 230, 245, 1, 64, 242, 118, 118, 84, 193, 173, 150, 221, 44, 55, 208, 64, 14, 0, 228, 132, 190, 57, 50, 19, 224, 202, 172, 31, 17, 186, 196, 72, 55, 179, 75, 90, 12, 53, 139, 60, 210, 31, 7, 79, 206, 148, 221, 193, 168, 39, 149, 19, 102, 150, 234, 8, 69, 185, 98, 14, 163, 52, 175, 85, 233, 248, 240, 156, 190, 131, 183, 53, 215, 197, 149, 251, 12, 124, 78, 226, 130, 39, 238, 200, 187, 250, 14, 98, 50, 182, 144, 161, 29, 19, 147, 162, 185, 90, 171, 164, 35, 42, 207, 99, 130, 157, 85, 21, 243, 109, 166, 243, 217, 12, 34, 118, 113, 99, 95, 194, 207, 144, 149, 252, 214, 243, 235, 110, 29, 122, 2, 158, 255, 4, 159, 10, 152, 215, 9, 56, 144, 73, 144, 152, 115, 40, 77, 233, 237, 79, 21, 83, 97, 213, 102, 212, 183, 179, 204, 226, 77, 139, 151, 49, 220, 85, 123, 12, 76, 84, 136, 86, 42, 216, 130, 62, 171, 107, 206, 60, 254, 141, 158, 42, 115, 99, 231, 82, 82, 207, 108, 249, 130, 33, 160, 23, 236, 234, 1, 94, 207, 150, 139, 96, 173, 181, 199, 186, 31, 101, 110, 193, 165, 237, 223, 1, 132, 227, 139, 63, 4, 50, 189, 232, 195, 182, 29, 163, 173, 10, 236, 113, 114, 240, 222, 79, 201, 214, 26, 37, 27, 62, 230, 43, 164, 144, 55, 178, 14, 136, 25, 235, 61, 71, 10, 209, 88, 203, 158, 20, 244, 4, 240, 23, 69, 249, 129, 170, 136, 15, 213, 232, 219, 94, 213, 25, 73, 105, 107, 252};
+
+/* SECP256K1 FUNCTIONS */
+
+void secp256k1_init(SECP256K1 *);
+void secp256k1_populate_G_doublings_mod_p(APT256 *);
+void secp256k1_free(SECP256K1);
+void secp256k1_reduce_p(u256_t *, const u512_t *); // r = a mod secp256k1.p without division
+void secp256k1_point_addition(const SECP256K1, const APT *, const APT *, APT *); // r = (p + q) mod secp256k1.p
+void secp256k1_point_doubling(const SECP256K1, const APT *, APT *); // r = 2p mod secp256k1.p
+void secp256k1_scalar_multiplication(const SECP256K1, const APT *, const bnz_t *, APT *); // r = q * m mod secp256k1.p
+void get_affine_from_jacobian(const SECP256K1 *, const JPTFE *, APT256 *);
+void get_affine_from_jacobian_batch(const JPTFE *, APT256 *, size_t);
+void secp256k1_jacobian_point_addition(const SECP256K1 *, const JPTFE *, const APT256 *, JPTFE *);
+void secp256k1_jacobian_scalar_multiplication(const SECP256K1, const bnz_t *, APT *);
+void secp256k1_jacobian_scalar_multiplication_u256(const SECP256K1 *, const u256_t *, APT256 *);
+void secp256k1_jacobian_scalar_multiplication_jptfe(const SECP256K1 *, const u256_t *, JPTFE *);
+void secp256k1_jacobian_point_addition_x4(const JPTFE4 *, const APT256 *const *, JPTFE4 *, uint32_t);
+void secp256k1_jacobian_scalar_multiplication_jptfe_x4(const SECP256K1 *, const u256_t *, JPTFE *);
+void secp256k1_jacobian_scalar_multiplication_u256_batch(const SECP256K1 *, const u256_t *, APT256 *, size_t);
+bool secp256k1_valid_point(const SECP256K1, const APT);
+
+void secp256k1_init(SECP256K1 *secp256k1) // initiate secp256k1 curve, y^2 = (x^3 + 7) mod secp256k1.p, in place because the curve parameters may hold their digits inline
+{
+    const char *secp256k1_p = "115792089237316195423570985008687907853269984665640564039457584007908834671663"; // prime, base 10
+    const char *secp256k1_G_x = "55066263022277343669578718895168534326250603453777594175500187360389116729240"; // generator x, base 10
+    const char *secp256k1_G_y = "32670510020758816978083085130507043184471273380659243275938904335757337482424"; // generator y, base 10
+    const char *secp256k1_n = "115792089237316195423570985008687907852837564279074904382605163141518161494337"; // order, base 10
+
+    bnz_init(&secp256k1->p);
+    bnz_init(&secp256k1->a);
+    bnz_init(&secp256k1->b);
+    bnz_init(&secp256k1->G.x);
+    bnz_init(&secp256k1->G.y);
+    bnz_init(&secp256k1->n);
+    bnz_init(&secp256k1->h);
+
+    bnz_set_str(&secp256k1->p, secp256k1_p, 10); // prime
+    bnz_set_i32(&secp256k1->a, 0);
+    bnz_set_i32(&secp256k1->b, 7);
+    bnz_set_str(&secp256k1->G.x, secp256k1_G_x, 10); // generator x
+    bnz_set_str(&secp256k1->G.y, secp256k1_G_y, 10); // generator y
+    bnz_set_str(&secp256k1->n, secp256k1_n, 10); // order
+    bnz_set_i32(&secp256k1->h, 1); // included for completeness, but not used in any functions
+
+    u256_set_bnz(&secp256k1->p_u256, &secp256k1->p);
+    u256_set_bnz(&secp256k1->n_u256, &secp256k1->n);
+
+    secp256k1_populate_G_doublings_mod_p(secp256k1->G_doublings_mod_p);
+}
+
+void secp256k1_populate_G_doublings_mod_p(APT256 *G_doublings_mod_p)
+{
+    int i, j;
+
+    for (i = 0; i < 256; i++) { // populate the fixed width G_doublings_mod_p array with data from the g_doublings_data array, 32 little endian bytes each for x and y
+        u256_set_ui64(&G_doublings_mod_p[i].x, 0);
+        u256_set_ui64(&G_doublings_mod_p[i].y, 0);
+        for (j = 0; j < 32; j++) {
+            G_doublings_mod_p[i].x.d[j / 8] |= (uint64_t)g_doublings_data[i * 64 + j] << (8 * (j % 8));
+            G_doublings_mod_p[i].y.d[j / 8] |= (uint64_t)g_doublings_data[i * 64 + 32 + j] << (8 * (j % 8));
+        }
+    }
+}
+
+void secp256k1_free(SECP256K1 secp256k1) // free secp256k1 curve
+{
+    bnz_free(&secp256k1.p);
+    bnz_free(&secp256k1.a);
+    bnz_free(&secp256k1.b);
+    bnz_free(&secp256k1.G.x);
+    bnz_free(&secp256k1.G.y);
+    bnz_free(&secp256k1.n);
+    bnz_free(&secp256k1.h);
+}
+
+void secp256k1_reduce_p(u256_t *res, const u512_t *a) // res = a mod secp256k1.p, folding the high half back in using 2^256 = 2^32 + 977 mod secp256k1.p
+{
+    const uint64_t k = 0x1000003D1ULL; // 2^32 + 977 = 2^256 - secp256k1.p
+    const u256_t p = {{0xFFFFFFFEFFFFFC2FULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL}};
+    uint128_t t;
+    uint64_t carry = 0;
+    int i;
+
+    for (i = 0; i < 4; i++) { // res = lo + hi * k, carry < 2^34 holds bits 256 and above
+        t = (uint128_t)a->d[i + 4] * k + a->d[i] + carry;
+        res->d[i] = (uint64_t)t;
+        carry = (uint64_t)(t >> 64);
+    }
+
+    t = (uint128_t)carry * k + res->d[0]; // fold carry * 2^256 back in as carry * k
+    res->d[0] = (uint64_t)t;
+    carry = (uint64_t)(t >> 64);
+    for (i = 1; i < 4; i++) {
+        t = (uint128_t)res->d[i] + carry;
+        res->d[i] = (uint64_t)t;
+        carry = (uint64_t)(t >> 64);
+    }
+
+    if (carry) { // the sum wrapped past 2^256, so res is now small and adding k cannot wrap again
+        t = (uint128_t)res->d[0] + k;
+        res->d[0] = (uint64_t)t;
+        carry = (uint64_t)(t >> 64);
+        for (i = 1; i < 4 && carry; i++) {
+            res->d[i]++;
+            carry = res->d[i] == 0;
+        }
+    }
+
+    if (u256_cmp(res, &p) >= 0) u256_sub(res, res, &p); // res < 2^256 < 2 * secp256k1.p
+}
+
+void secp256k1_point_doubling(const SECP256K1 secp256k1, const APT *p, APT *r) // r = 2p mod secp256k1.p
+{
+    fe_t x, y, slope, tmp, rx, ry;
+
+    (void)secp256k1; // unused since the move to fe_t, whose arithmetic is always mod secp256k1.p
+
+    fe_set_bnz(&x, &p->x);
+    fe_set_bnz(&y, &p->y);
+
+    if (fe_is_zero(&y) == false) {
+        fe_mul_int(&tmp, &y, 2);
+        fe_inv(&tmp, &tmp); // tmp = 1 / 2y
+        fe_sqr(&slope, &x);
+        fe_mul_int(&slope, &slope, 3); // slope = 3x^2 + secp256k1.a, where secp256k1.a = 0
+        fe_mul(&slope, &slope, &tmp);
+        fe_sqr(&rx, &slope);
+        fe_negate(&tmp, &x, 1);
+        fe_mul_int(&tmp, &tmp, 2);
+        fe_add(&rx, &rx, &tmp); // rx = slope^2 - 2x
+        fe_negate(&tmp, &rx, 5);
+        fe_add(&tmp, &tmp, &x); // tmp = x - rx
+        fe_mul(&ry, &slope, &tmp);
+        fe_negate(&tmp, &y, 1);
+        fe_add(&ry, &ry, &tmp); // ry = slope * (x - rx) - y
+    } else {
+        fe_set_ui64(&rx, 0);
+        fe_set_ui64(&ry, 0);
+    }
+
+    fe_get_bnz(&r->x, &rx);
+    fe_get_bnz(&r->y, &ry);
+}
+
+void secp256k1_point_addition(const SECP256K1 secp256k1, const APT *p, const APT *q, APT *r) // r = (p + q) mod secp256k1.p
+{
+    fe_t px, py, qx, qy, slope, tmp, rx, ry;
+
+    fe_set_bnz(&px, &p->x);
+    fe_set_bnz(&py, &p->y);
+    fe_set_bnz(&qx, &q->x);
+    fe_set_bnz(&qy, &q->y);
+
+    if (fe_is_zero(&px) == true && fe_is_zero(&py) == true) {
+        fe_get_bnz(&r->x, &qx);
+        fe_get_bnz(&r->y, &qy);
+        return;
+    }
+
+    if (fe_is_zero(&qx) == true && fe_is_zero(&qy) == true) {
+        fe_get_bnz(&r->x, &px);
+        fe_get_bnz(&r->y, &py);
+        return;
+    }
+
+    if (fe_equal(&px, &qx) == true) {
+        fe_negate(&tmp, &qy, 1);
+        if (fe_equal(&py, &tmp) == true) { // q = -p
+            bnz_set_i32(&r->x, 0);
+            bnz_set_i32(&r->y, 0);
+        } else { // q = p
+            secp256k1_point_doubling(secp256k1, p, r);
+        }
+        return;
+    }
+
+    fe_negate(&tmp, &qx, 1);
+    fe_add(&tmp, &tmp, &px);
+    fe_inv(&tmp, &tmp); // tmp = 1 / (px - qx)
+    fe_negate(&slope, &qy, 1);
+    fe_add(&slope, &slope, &py);
+    fe_mul(&slope, &slope, &tmp); // slope = (py - qy) / (px - qx)
+    fe_sqr(&rx, &slope);
+    fe_negate(&tmp, &px, 1);
+    fe_add(&rx, &rx, &tmp);
+    fe_negate(&tmp, &qx, 1);
+    fe_add(&rx, &rx, &tmp); // rx = slope^2 - px - qx
+    fe_negate(&tmp, &rx, 5);
+    fe_add(&tmp, &tmp, &px); // tmp = px - rx
+    fe_mul(&ry, &slope, &tmp);
+    fe_negate(&tmp, &py, 1);
+    fe_add(&ry, &ry, &tmp); // ry = slope * (px - rx) - py
+
+    fe_get_bnz(&r->x, &rx);
+    fe_get_bnz(&r->y, &ry);
+}
+
+void secp256k1_scalar_multiplication(const SECP256K1 secp256k1, const APT *q, const bnz_t *m, APT *r) // r = q * m mod secp256k1.p
+{
+    uint32_t i, doublings = 0;
+    bit_iter_t it;
+
+    APT qq;
+    
+    bnz_init(&qq.x);
+    bnz_init(&qq.y);
+
+    bnz_set_bnz(&qq.x, &q->x);
+    bnz_set_bnz(&qq.y, &q->y);
+
+    bnz_set_i32(&r->x, 0);
+    bnz_set_i32(&r->y, 0);
+
+    bit_iter_init(&it, m->digits, m->size);
+    while (bit_iter_next_set(&it, &i) == true) { // qq = q * 2^i for each set bit i of m, with no doublings past the highest set bit
+        for (; doublings < i; doublings++) {
+            secp256k1_point_doubling(secp256k1, &qq, &qq);
+        }
+        secp256k1_point_addition(secp256k1, &qq, r, r);
+    }
+
+    bnz_free(&qq.x);
+    bnz_free(&qq.y);
+}
+
+void get_affine_from_jacobian(const SECP256K1 *secp256k1, const JPTFE *jpt, APT256 *apt)
+{
+    fe_t z_inv, z_inv_2, z_inv_3, t;
+
+    (void)secp256k1; // unused, fe_inv works mod secp256k1.p
+
+    fe_inv(&z_inv, &jpt->z); // z_inv = modular_multiplicative_inverse(jpt.z)
+    fe_sqr(&z_inv_2, &z_inv); // z_inv_2 = z_inv^2
+    fe_mul(&z_inv_3, &z_inv_2, &z_inv); // z_inv_3 = z_inv^3
+
+    fe_mul(&t, &jpt->x, &z_inv_2); // apt.x = jpt.x / jpt.z^2
+    fe_get_u256(&apt->x, &t);
+    fe_mul(&t, &jpt->y, &z_inv_3); // apt.y = jpt.y / jpt.z^3
+    fe_get_u256(&apt->y, &t);
+}
+
+void get_affine_from_jacobian_batch(const JPTFE *jpt, APT256 *apt, size_t n) // apt[i] = get_affine_from_jacobian(jpt[i]) for i < n, with one fe_batch_inv of the z coordinates in place of n fe_inv
+{
+    size_t i;
+    fe_t *z = NULL, *z_inv = NULL, z_inv_2, z_inv_3, t;
+
+    z = (fe_t *)bnz_scratch_alloc(2 * n * (sizeof(fe_t) / sizeof(uint64_t)));
+    if (!z) {
+        return;
+    }
+    z_inv = z + n;
+
+    for (i = 0; i < n; i++) {
+        z[i] = jpt[i].z;
+    }
+    fe_batch_inv(z_inv, z, n);
+
+    for (i = 0; i < n; i++) {
+        fe_sqr(&z_inv_2, &z_inv[i]); // z_inv_2 = z_inv^2
+        fe_mul(&z_inv_3, &z_inv_2, &z_inv[i]); // z_inv_3 = z_inv^3
+        fe_mul(&t, &jpt[i].x, &z_inv_2); // apt.x = jpt.x / jpt.z^2
+        fe_get_u256(&apt[i].x, &t);
+        fe_mul(&t, &jpt[i].y, &z_inv_3); // apt.y = jpt.y / jpt.z^3
+        fe_get_u256(&apt[i].y, &t);
+    }
+
+    bnz_scratch_free((uint64_t *)z);
+}
+
+void secp256k1_jacobian_point_addition(const SECP256K1 *secp256k1, const JPTFE *p, const APT256 *q, JPTFE *r) // r = (p + q) mod secp256k1.p
+{
+    /*
+    The "madd-2004-hmv" addition formulas:
+    Assumptions: Z2=1.
+    Cost: 8M + 3S + 6add + 1*2.
+    Source: 2004 Hankerson Menezes Vanstone, page 91.
+    Explicit formulas:
+        T1 = Z1^2
+        T2 = T1*Z1
+        T1 = T1*X2
+        T2 = T2*Y2
+        T1 = T1-X1
+        T2 = T2-Y1
+        Z3 = Z1*T1
+        T3 = T1^2
+        T4 = T3*T1
+        T3 = T3*X1
+        T1 = 2*T3
+        X3 = T2^2
+        X3 = X3-T1
+        X3 = X3-T4
+        T3 = T3-X3
+        T3 = T3*T2
+        T4 = T4*Y1
+        Y3 = T3-T4
+    */
+
+    fe_t x2, y2, t1, t2, t3, t4, x3, y3, z3, neg;
+
+    (void)secp256k1; // unused, the fe_t formulas need no curve constants
+
+    if (fe_is_zero(&p->x) == true && fe_is_zero(&p->y) == true && fe_is_zero(&p->z) == true) { // if this is the first addition, set r.x = q.x, r.y = q.y and r.z = 1 and return
+        fe_set_u256(&r->x, &q->x);
+        fe_set_u256(&r->y, &q->y);
+        fe_set_ui64(&r->z, 1);
+        return;
+    }
+
+    // p has magnitude 1 (the output of this function), so subtractions negate with m = 1 unless noted
+    fe_set_u256(&x2, &q->x);
+    fe_set_u256(&y2, &q->y);
+
+    fe_sqr(&t1, &p->z); // T1 = Z1^2
+    fe_mul(&t2, &t1, &p->z); // T2 = T1*Z1
+    fe_mul(&t1, &t1, &x2); // T1 = T1*X2
+    fe_mul(&t2, &t2, &y2); // T2 = T2*Y2
+    fe_sub(&t1, &t1, &p->x, 1); // T1 = T1-X1, magnitude 3
+    fe_sub(&t2, &t2, &p->y, 1); // T2 = T2-Y1, magnitude 3
+    fe_mul(&z3, &p->z, &t1); // Z3 = Z1*T1
+    fe_sqr(&t3, &t1); // T3 = T1^2
+    fe_mul(&t4, &t3, &t1); // T4 = T3*T1
+    fe_mul(&t3, &t3, &p->x); // T3 = T3*X1
+    fe_mul_int(&t1, &t3, 2); // T1 = 2*T3, magnitude 2
+    fe_sqr(&x3, &t2); // X3 = T2^2
+    fe_sub(&x3, &x3, &t1, 2); // X3 = X3-T1, magnitude 4
+    fe_sub(&x3, &x3, &t4, 1); // X3 = X3-T4, magnitude 6
+    fe_sub(&t3, &t3, &x3, 6); // T3 = T3-X3, magnitude 8
+    fe_mul(&t3, &t3, &t2); // T3 = T3*T2
+    fe_mul(&t4, &t4, &p->y); // T4 = T4*Y1
+    fe_negate(&neg, &t4, 1);
+    fe_add(&y3, &t3, &neg); // Y3 = T3-T4, magnitude 3
+
+    fe_normalize_weak(&x3); // return to magnitude 1 for the next addition
+    fe_normalize_weak(&y3);
+
+    r->x = x3; // r is written last, as r may alias p
+    r->y = y3;
+    r->z = z3;
+}
+
+void secp256k1_jacobian_scalar_multiplication(const SECP256K1 secp256k1, const bnz_t *m, APT *r) // r = (secp256k1.G * m) mod secp256k1.p
+{
+    u256_t mm;
+    APT256 rr;
+
+    u256_set_bnz(&mm, m); // fixed width copy of m
+    secp256k1_jacobian_scalar_multiplication_u256(&secp256k1, &mm, &rr);
+
+    u256_get_bnz(&r->x, &rr.x);
+    u256_get_bnz(&r->y, &rr.y);
+}
+
+void secp256k1_jacobian_scalar_multiplication_u256(const SECP256K1 *secp256k1, const u256_t *m, APT256 *r) // r = (secp256k1.G * m) mod secp256k1.p, no heap allocations
+{
+    JPTFE tmp; // running total
+
+    secp256k1_jacobian_scalar_multiplication_jptfe(secp256k1, m, &tmp);
+    get_affine_from_jacobian(secp256k1, &tmp, r); // convert final JPTFE into the corresponding APT256 via the formulae: APT.x = JPT.x / JPT.z^2 and APT.y = JPT.y / JPT.z^3
+}
+
+void secp256k1_jacobian_scalar_multiplication_jptfe(const SECP256K1 *secp256k1, const u256_t *m, JPTFE *r) // r = (secp256k1.G * m) mod secp256k1.p, left in Jacobian coordinates
+{
+    uint32_t i;
+    bit_iter_t it;
+
+    fe_set_ui64(&r->x, 0);
+    fe_set_ui64(&r->y, 0);
+    fe_set_ui64(&r->z, 0);
+
+    bit_iter_init(&it, (const uint8_t *)m->d, sizeof(m->d)); // the limbs of a u256_t are little endian words, so on a little endian machine its bytes are in little endian order
+    while (bit_iter_next_set(&it, &i) == true) { // from lsb to msb, visiting only the set bits
+        secp256k1_jacobian_point_addition(secp256k1, r, &secp256k1->G_doublings_mod_p[i], r); // add the Secp256k1 doubling value corresponding to the set bit to the running total
+    }
+}
+
+void secp256k1_jacobian_point_addition_x4(const JPTFE4 *p, const APT256 *const *q, JPTFE4 *r, uint32_t lanes) // lane by lane r = (p + q[lane]) mod secp256k1.p for each lane whose bit is set in lanes, the other lanes of r are copies of p and their q[lane] is not read, the madd-2004-hmv formulas of secp256k1_jacobian_point_addition on four points at once, r may alias p
+{
+    fe4_t x2, y2, t1, t2, t3, t4, x3, y3, z3;
+    const u256_t zero = {{0, 0, 0, 0}};
+    uint64_t any[4] = {0, 0, 0, 0}, keep[4], first[4], add[4]; // per lane masks of all ones or all zeros
+    uint32_t i, l;
+
+    for (i = 0; i < 10; i++) {
+        for (l = 0; l < 4; l++) {
+            any[l] |= p->x.n[i][l] | p->y.n[i][l] | p->z.n[i][l];
+        }
+    }
+    for (l = 0; l < 4; l++) {
+        keep[l] = (lanes >> l & 1) ? 0 : ~0ULL; // lanes left as they are
+        first[l] = any[l] == 0 ? ~keep[l] : 0; // lanes at infinity, whose first addition sets them to q
+        add[l] = ~(keep[l] | first[l]);
+        fe4_set_u256(&x2, keep[l] ? &zero : &q[l]->x, l);
+        fe4_set_u256(&y2, keep[l] ? &zero : &q[l]->y, l);
+    }
+
+    fe4_sqr(&t1, &p->z); // T1 = Z1^2
+    fe4_mul(&t2, &t1, &p->z); // T2 = T1*Z1
+    fe4_mul(&t1, &t1, &x2); // T1 = T1*X2
+    fe4_mul(&t2, &t2, &y2); // T2 = T2*Y2
+    fe4_sub(&t1, &t1, &p->x); // T1 = T1-X1
+    fe4_sub(&t2, &t2, &p->y); // T2 = T2-Y1
+    fe4_mul(&z3, &p->z, &t1); // Z3 = Z1*T1
+    fe4_sqr(&t3, &t1); // T3 = T1^2
+    fe4_mul(&t4, &t3, &t1); // T4 = T3*T1
+    fe4_mul(&t3, &t3, &p->x); // T3 = T3*X1
+    fe4_add(&t1, &t3, &t3); // T1 = 2*T3
+    fe4_sqr(&x3, &t2); // X3 = T2^2
+    fe4_sub(&x3, &x3, &t1); // X3 = X3-T1
+    fe4_sub(&x3, &x3, &t4); // X3 = X3-T4
+    fe4_sub(&t3, &t3, &x3); // T3 = T3-X3
+    fe4_mul(&t3, &t3, &t2); // T3 = T3*T2
+    fe4_mul(&t4, &t4, &p->y); // T4 = T4*Y1
+    fe4_sub(&y3, &t3, &t4); // Y3 = T3-T4
+
+    for (i = 0; i < 10; i++) { // r is written last, with masks rather than branches, as r may alias p
+        for (l = 0; l < 4; l++) {
+            r->x.n[i][l] = (p->x.n[i][l] & keep[l]) | (x2.n[i][l] & first[l]) | (x3.n[i][l] & add[l]);
+            r->y.n[i][l] = (p->y.n[i][l] & keep[l]) | (y2.n[i][l] & first[l]) | (y3.n[i][l] & add[l]);
+            r->z.n[i][l] = (p->z.n[i][l] & keep[l]) | ((i == 0) & first[l]) | (z3.n[i][l] & add[l]);
+        }
+    }
+}
+
+void secp256k1_jacobian_scalar_multiplication_jptfe_x4(const SECP256K1 *secp256k1, const u256_t *m, JPTFE *r) // r[lane] = (secp256k1.G * m[lane]) mod secp256k1.p for four scalars at once, left in Jacobian coordinates, each lane adds the doublings for its own set bits and drops out when they run out
+{
+    JPTFE4 acc;
+    bit_iter_t it[4];
+    const APT256 *q[4];
+    uint32_t l, i, lanes;
+    u256_t t;
+
+    memset(&acc, 0, sizeof(acc)); // every lane at infinity
+    for (l = 0; l < 4; l++) {
+        bit_iter_init(&it[l], (const uint8_t *)m[l].d, sizeof(m[l].d));
+    }
+
+    for (;;) {
+        lanes = 0;
+        for (l = 0; l < 4; l++) {
+            if (bit_iter_next_set(&it[l], &i) == true) { // an exhausted iterator keeps returning false
+                q[l] = &secp256k1->G_doublings_mod_p[i];
+                lanes |= 1u << l;
+            }
+        }
+        if (lanes == 0) {
+            break;
+        }
+        secp256k1_jacobian_point_addition_x4(&acc, q, &acc, lanes);
+    }
+
+    for (l = 0; l < 4; l++) {
+        fe4_get_u256(&t, &acc.x, l);
+        fe_set_u256(&r[l].x, &t);
+        fe4_get_u256(&t, &acc.y, l);
+        fe_set_u256(&r[l].y, &t);
+        fe4_get_u256(&t, &acc.z, l);
+        fe_set_u256(&r[l].z, &t);
+    }
+}
+
+void secp256k1_jacobian_scalar_multiplication_u256_batch(const SECP256K1 *secp256k1, const u256_t *m, APT256 *r, size_t n) // r[i] = (secp256k1.G * m[i]) mod secp256k1.p for i < n, sharing one inversion between the n conversions to affine coordinates
+{
+    size_t i;
+    JPTFE *tmp = NULL;
+
+    tmp = (JPTFE *)bnz_scratch_alloc(n * (sizeof(JPTFE) / sizeof(uint64_t)));
+    if (!tmp) {
+        return;
+    }
+
+    i = 0;
+#if defined(__AVX2__)
+    for (; i + 4 <= n; i += 4) { // four keys at a time across the AVX2 lanes, without AVX2 the fe4 functions fall back to one lane at a time and are slower than the single key path
+        secp256k1_jacobian_scalar_multiplication_jptfe_x4(secp256k1, &m[i], &tmp[i]);
+    }
+#endif
+    for (; i < n; i++) {
+        secp256k1_jacobian_scalar_multiplication_jptfe(secp256k1, &m[i], &tmp[i]);
+    }
+    get_affine_from_jacobian_batch(tmp, r, n);
+
+    bnz_scratch_free((uint64_t *)tmp);
+}
+
+bool secp256k1_valid_point(const SECP256K1 secp256k1, const APT apt) // check that a given xy point is on Secp256k1 by confirming that y^2 mod Secp256k1.p = x^3 + 7 mod Secp256k1.p, with 0 <= x, y < Secp256k1.p
+{
+    u256_t x, y, lhs, rhs, seven; // left hand side and right hand side of the equation
+    u512_t t;
+
+    if (apt.x.sign != 0 || apt.y.sign != 0 || bnz_cmp_bnz(&apt.x, &secp256k1.p) >= 0 || bnz_cmp_bnz(&apt.y, &secp256k1.p) >= 0) { // coordinates must be field elements
+        return false;
+    }
+
+    u256_set_bnz(&x, &apt.x);
+    u256_set_bnz(&y, &apt.y);
+    u256_set_ui64(&seven, 7);
+
+    u256_sqr(&t, &y); // lhs = y^2
+    secp256k1_reduce_p(&lhs, &t); // lhs = y^2 mod Secp256k1.p
+
+    u256_sqr(&t, &x); // rhs = x^2
+    secp256k1_reduce_p(&rhs, &t);
+    u256_mul(&t, &rhs, &x); // rhs = x^3
+    secp256k1_reduce_p(&rhs, &t);
+    u256_add_mod(&rhs, &rhs, &seven, &secp256k1.p_u256); // rhs = x^3 + 7 mod Secp256k1.p
+
+    if (u256_cmp(&lhs, &rhs) == 0) { // lhs == rhs
+        return true;
+    } else { // lhs != rhs
+        return false;
+    }
+}
+
+/* BITCOIN GLOBAL VARIABLES */
+
+const char bip39_wds[2048][9] = {"abandon", "ability", "able", "about", "above", "absent", "absorb", "abstract", "absurd", "abuse", "access", "accident", "account", "accuse", "achieve", "acid", "acoustic", "acquire", "across", "act", "action", "actor", "actress", "actual", "adapt", "add", "addict", "address", "adjust", "admit", "adult", "advance", "advice", "aerobic", "affair", "afford", "afraid", "again", "age", "agent", "agree", "ahead", "aim", "air", "airport", "aisle", "alarm", "album", "alcohol", "alert", "alien", "all", "alley", "allow", "almost", "alone", "alpha", "already", "also", "alter", "always", "amateur", "amazing", "among", "amount", "amused", "analyst", "anchor", "ancient", "anger", "angle", "angry", "animal", "ankle", "announce", "annual", "another", "answer", "antenna", "antique", "anxiety", "any", "apart", "apology", "appear", "apple", "approve", "april", "arch", "arctic", "area", "arena", "argue", "arm", "armed", "armor", "army", "around", "arrange", "arrest", "arrive", "arrow", "art", "artefact", "artist", "artwork", "ask", "aspect", "assault", "asset", "assist", "assume", "asthma", "athlete", "atom", "attack", "attend", "attitude", "attract", "auction", "audit", "august", "aunt", "author", "auto", "autumn", "average", "avocado", "avoid", "awake", "aware", "away", "awesome", "awful", "awkward", "axis", "baby", "bachelor", "bacon", "badge", "bag", "balance", "balcony", "ball", "bamboo", "banana", "banner", "bar", "barely", "bargain", "barrel", "base", "basic", "basket", "battle", "beach", "bean", "beauty", "because", "become", "beef", "before", "begin", "behave", "behind", "believe", "below", "belt", "bench", "benefit", "best", "betray", "better", "between", "beyond", "bicycle", "bid", "bike", "bind", "biology", "bird", "birth", "bitter", "black", "blade", "blame", "blanket", "blast", "bleak", "bless", "blind", "blood", "blossom", "blouse", "blue", "blur", "blush", "board", "boat", "body", "boil", "bomb", "bone", "bonus", "book", "boost", "border", "boring", "borrow", "boss", "bottom", "bounce", "box", "boy", "bracket", "brain", "brand", "brass", "brave", "bread", "breeze", "brick", "bridge", "brief", "bright", "bring", "brisk", "broccoli", "broken", "bronze", "broom", "brother", "brown", "brush", "bubble", "buddy", "budget", "buffalo", "build", "bulb", "bulk", "bullet", "bundle", "bunker", "burden", "burger", "burst", "bus", "business", "busy", "butter", "buyer", "buzz", "cabbage", "cabin", "cable", "cactus", "cage", "cake", "call", "calm", "camera", "camp", "can", "canal", "cancel", "candy", "cannon", "canoe", "canvas", "canyon", "capable", "capital", "captain", "car", "carbon", "card", "cargo", "carpet", "carry", "cart", "case", "cash", "casino", "castle", "casual", "cat", "catalog", "catch", "category", "cattle", "caught", "cause", "caution", "cave", "ceiling", "celery", "cement", "census", "century", "cereal", "certain", "chair", "chalk", "champion", "change", "chaos", "chapter", "charge", "chase", "chat", "cheap", "check", "cheese", "chef", "cherry", "chest", "chicken", "chief", "child", "chimney", "choice", "choose", "chronic", "chuckle", "chunk", "churn", "cigar", "cinnamon", "circle", "citizen", "city", "civil", "claim", "clap", "clarify", "claw", "clay", "clean", "clerk", "clever", "click", "client", "cliff", "climb", "clinic", "clip", "clock", "clog", "close", "cloth", "cloud", "clown", "club", "clump", "cluster", "clutch", "coach", "coast", "coconut", "code", "coffee", "coil", "coin", "collect", "color", "column", "combine", "come", "comfort", "comic", "common", "company", "concert", "conduct", "confirm", "congress", "connect", "consider", "control", "convince", "cook", "cool", "copper", "copy", "coral", "core", "corn", "correct", "cost", "cotton", "couch", "country", "couple", "course", "cousin", "cover", "coyote", "crack", "cradle", "craft", "cram", "crane", "crash", "crater", "crawl", "crazy", "cream", "credit", "creek", "crew", "cricket", "crime", "crisp", "critic", "crop", "cross", "crouch", "crowd", "crucial", "cruel", "cruise", "crumble", "crunch", "crush", "cry", "crystal", "cube", "culture", "cup", "cupboard", "curious", "current", "curtain", "curve", "cushion", "custom", "cute", "cycle", "dad", "damage", "damp", "dance", "danger", "daring", "dash", "daughter", "dawn", "day", "deal", "debate", "debris", "decade", "december", "decide", "decline", "decorate", "decrease", "deer", "defense", "define", "defy", "degree", "delay", "deliver", "demand", "demise", "denial", "dentist", "deny", "depart", "depend", "deposit", "depth", "deputy", "derive", "describe", "desert", "design", "desk", "despair", "destroy", "detail", "detect", "develop", "device", "devote", "diagram", "dial", "diamond", "diary", "dice", "diesel", "diet", "differ", "digital", "dignity", "dilemma", "dinner", "dinosaur", "direct", "dirt", "disagree", "discover", "disease", "dish", "dismiss", "disorder", "display", "distance", "divert", "divide", "divorce", "dizzy", "doctor", "document", "dog", "doll", "dolphin", "domain", "donate", "donkey", "donor", "door", "dose", "double", "dove", "draft", "dragon", "drama", "drastic", "draw", "dream", "dress", "drift", "drill", "drink", "drip", "drive", "drop", "drum", "dry", "duck", "dumb", "dune", "during", "dust", "dutch", "duty", "dwarf", "dynamic", "eager", "eagle", "early", "earn", "earth", "easily", "east", "easy", "echo", "ecology", "economy", "edge", "edit", "educate", "effort", "egg", "eight", "either", "elbow", "elder", "electric", "elegant", "element", "elephant", "elevator", "elite", "else", "embark", "embody", "embrace", "emerge", "emotion", "employ", "empower", "empty", "enable", "enact", "end", "endless", "endorse", "enemy", "energy", "enforce", "engage", "engine", "enhance", "enjoy", "enlist", "enough", "enrich", "enroll", "ensure", "enter", "entire", "entry", "envelope", "episode", "equal", "equip", "era", "erase", "erode", "erosion", "error", "erupt", "escape", "essay", "essence", "estate", "eternal", "ethics", "evidence", "evil", "evoke", "evolve", "exact", "example", "excess", "exchange", "excite", "exclude", "excuse", "execute", "exercise", "exhaust", "exhibit", "exile", "exist", "exit", "exotic", "expand", "expect", "expire", "explain", "expose", "express", "extend", "extra", "eye", "eyebrow", "fabric", "face", "faculty", "fade", "faint", "faith", "fall", "false", "fame", "family", "famous", "fan", "fancy", "fantasy", "farm", "fashion", "fat", "fatal", "father", "fatigue", "fault", "favorite", "feature", "february", "federal", "fee", "feed", "feel", "female", "fence", "festival", "fetch", "fever", "few", "fiber", "fiction", "field", "figure", "file", "film", "filter", "final", "find", "fine", "finger", "finish", "fire", "firm", "first", "fiscal", "fish", "fit", "fitness", "fix", "flag", "flame", "flash", "flat", "flavor", "flee", "flight", "flip", "float", "flock", "floor", "flower", "fluid", "flush", "fly", "foam", "focus", "fog", "foil", "fold", "follow", "food", "foot", "force", "forest", "forget", "fork", "fortune", "forum", "forward", "fossil", "foster", "found", "fox", "fragile", "frame", "frequent", "fresh", "friend", "fringe", "frog", "front", "frost", "frown", "frozen", "fruit", "fuel", "fun", "funny", "furnace", "fury", "future", "gadget", "gain", "galaxy", "gallery", "game", "gap", "garage", "garbage", "garden", "garlic", "garment", "gas", "gasp", "gate", "gather", "gauge", "gaze", "general", "genius", "genre", "gentle", "genuine", "gesture", "ghost", "giant", "gift", "giggle", "ginger", "giraffe", "girl", "give", "glad", "glance", "glare", "glass", "glide", "glimpse", "globe", "gloom", "glory", "glove", "glow", "glue", "goat", "goddess", "gold", "good", "goose", "gorilla", "gospel", "gossip", "govern", "gown", "grab", "grace", "grain", "grant", "grape", "grass", "gravity", "great", "green", "grid", "grief", "grit", "grocery", "group", "grow", "grunt", "guard", "guess", "guide", "guilt", "guitar", "gun", "gym", "habit", "hair", "half", "hammer", "hamster", "hand", "happy", "harbor", "hard", "harsh", "harvest", "hat", "have", "hawk", "hazard", "head", "health", "heart", "heavy", "hedgehog", "height", "hello", "helmet", "help", "hen", "hero", "hidden", "high", "hill", "hint", "hip", "hire", "history", "hobby", "hockey", "hold", "hole", "holiday", "hollow", "home", "honey", "hood", "hope", "horn", "horror", "horse", "hospital", "host", "hotel", "hour", "hover", "hub", "huge", "human", "humble", "humor", "hundred", "hungry", "hunt", "hurdle", "hurry", "hurt", "husband", "hybrid", "ice", "icon", "idea", "identify", "idle", "ignore", "ill", "illegal", "illness", "image", "imitate", "immense", "immune", "impact", "impose", "improve", "impulse", "inch", "include", "income", "increase", "index", "indicate", "indoor", "industry", "infant", "inflict", "inform", "inhale", "inherit", "initial", "inject", "injury", "inmate", "inner", "innocent", "input", "inquiry", "insane", "insect", "inside", "inspire", "install", "intact", "interest", "into", "invest", "invite", "involve", "iron", "island", "isolate", "issue", "item", "ivory", "jacket", "jaguar", "jar", "jazz", "jealous", "jeans", "jelly", "jewel", "job", "join", "joke", "journey", "joy", "judge", "juice", "jump", "jungle", "junior", "junk", "just", "kangaroo", "keen", "keep", "ketchup", "key", "kick", "kid", "kidney", "kind", "kingdom", "kiss", "kit", "kitchen", "kite", "kitten", "kiwi", "knee", "knife", "knock", "know", "lab", "label", "labor", "ladder", "lady", "lake", "lamp", "language", "laptop", "large", "later", "latin", "laugh", "laundry", "lava", "law", "lawn", "lawsuit", "layer", "lazy", "leader", "leaf", "learn", "leave", "lecture", "left", "leg", "legal", "legend", "leisure", "lemon", "lend", "length", "lens", "leopard", "lesson", "letter", "level", "liar", "liberty", "library", "license", "life", "lift", "light", "like", "limb", "limit", "link", "lion", "liquid", "list", "little", "live", "lizard", "load", "loan", "lobster", "local", "lock", "logic", "lonely", "long", "loop", "lottery", "loud", "lounge", "love", "loyal", "lucky", "luggage", "lumber", "lunar", "lunch", "luxury", "lyrics", "machine", "mad", "magic", "magnet", "maid", "mail", "main", "major", "make", "mammal", "man", "manage", "mandate", "mango", "mansion", "manual", "maple", "marble", "march", "margin", "marine", "market", "marriage", "mask", "mass", "master", "match", "material", "math", "matrix", "matter", "maximum", "maze", "meadow", "mean", "measure", "meat", "mechanic", "medal", "media", "melody", "melt", "member", "memory", "mention", "menu", "mercy", "merge", "merit", "merry", "mesh", "message", "metal", "method", "middle", "midnight", "milk", "million", "mimic", "mind", "minimum", "minor", "minute", "miracle", "mirror", "misery", "miss", "mistake", "mix", "mixed", "mixture", "mobile", "model", "modify", "mom", "moment", "monitor", "monkey", "monster", "month", "moon", "moral", "more", "morning", "mosquito", "mother", "motion", "motor", "mountain", "mouse", "move", "movie", "much", "muffin", "mule", "multiply", "muscle", "museum", "mushroom", "music", "must", "mutual", "myself", "mystery", "myth", "naive", "name", "napkin", "narrow", "nasty", "nation", "nature", "near", "neck", "need", "negative", "neglect", "neither", "nephew", "nerve", "nest", "net", "network", "neutral", "never", "news", "next", "nice", "night", "noble", "noise", "nominee", "noodle", "normal", "north", "nose", "notable", "note", "nothing", "notice", "novel", "now", "nuclear", "number", "nurse", "nut", "oak", "obey", "object", "oblige", "obscure", "observe", "obtain", "obvious", "occur", "ocean", "october", "odor", "off", "offer", "office", "often", "oil", "okay", "old", "olive", "olympic", "omit", "once", "one", "onion", "online", "only", "open", "opera", "opinion", "oppose", "option", "orange", "orbit", "orchard", "order", "ordinary", "organ", "orient", "original", "orphan", "ostrich", "other", "outdoor", "outer", "output", "outside", "oval", "oven", "over", "own", "owner", "oxygen", "oyster", "ozone", "pact", "paddle", "page", "pair", "palace", "palm", "panda", "panel", "panic", "panther", "paper", "parade", "parent", "park", "parrot", "party", "pass", "patch", "path", "patient", "patrol", "pattern", "pause", "pave", "payment", "peace", "peanut", "pear", "peasant", "pelican", "pen", "penalty", "pencil", "people", "pepper", "perfect", "permit", "person", "pet", "phone", "photo", "phrase", "physical", "piano", "picnic", "picture", "piece", "pig", "pigeon", "pill", "pilot", "pink", "pioneer", "pipe", "pistol", "pitch", "pizza", "place", "planet", "plastic", "plate", "play", "please", "pledge", "pluck", "plug", "plunge", "poem", "poet", "point", "polar", "pole", "police", "pond", "pony", "pool", "popular", "portion", "position", "possible", "post", "potato", "pottery", "poverty", "powder", "power", "practice", "praise", "predict", "prefer", "prepare", "present", "pretty", "prevent", "price", "pride", "primary", "print", "priority", "prison", "private", "prize", "problem", "process", "produce", "profit", "program", "project", "promote", "proof", "property", "prosper", "protect", "proud", "provide", "public", "pudding", "pull", "pulp", "pulse", "pumpkin", "punch", "pupil", "puppy", "purchase", "purity", "purpose", "purse", "push", "put", "puzzle", "pyramid", "quality", "quantum", "quarter", "question", "quick", "quit", "quiz", "quote", "rabbit", "raccoon", "race", "rack", "radar", "radio", "rail", "rain", "raise", "rally", "ramp", "ranch", "random", "range", "rapid", "rare", "rate", "rather", "raven", "raw", "razor", "ready", "real", "reason", "rebel", "rebuild", "recall", "receive", "recipe", "record", "recycle", "reduce", "reflect", "reform", "refuse", "region", "regret", "regular", "reject", "relax", "release", "relief", "rely", "remain", "remember", "remind", "remove", "render", "renew", "rent", "reopen", "repair", "repeat", "replace", "report", "require", "rescue", "resemble", "resist", "resource", "response", "result", "retire", "retreat", "return", "reunion", "reveal", "review", "reward", "rhythm", "rib", "ribbon", "rice", "rich", "ride", "ridge", "rifle", "right", "rigid", "ring", "riot", "ripple", "risk", "ritual", "rival", "river", "road", "roast", "robot", "robust", "rocket", "romance", "roof", "rookie", "room", "rose", "rotate", "rough", "round", "route", "royal", "rubber", "rude", "rug", "rule", "run", "runway", "rural", "sad", "saddle", "sadness", "safe", "sail", "salad", "salmon", "salon", "salt", "salute", "same", "sample", "sand", "satisfy", "satoshi", "sauce", "sausage", "save", "say", "scale", "scan", "scare", "scatter", "scene", "scheme", "school", "science", "scissors", "scorpion", "scout", "scrap", "screen", "script", "scrub", "sea", "search", "season", "seat", "second", "secret", "section", "security", "seed", "seek", "segment", "select", "sell", "seminar", "senior", "sense", "sentence", "series", "service", "session", "settle", "setup", "seven", "shadow", "shaft", "shallow", "share", "shed", "shell", "sheriff", "shield", "shift", "shine", "ship", "shiver", "shock", "shoe", "shoot", "shop", "short", "shoulder", "shove", "shrimp", "shrug", "shuffle", "shy", "sibling", "sick", "side", "siege", "sight", "sign", "silent", "silk", "silly", "silver", "similar", "simple", "since", "sing", "siren", "sister", "situate", "six", "size", "skate", "sketch", "ski", "skill", "skin", "skirt", "skull", "slab", "slam", "sleep", "slender", "slice", "slide", "slight", "slim", "slogan", "slot", "slow", "slush", "small", "smart", "smile", "smoke", "smooth", "snack", "snake", "snap", "sniff", "snow", "soap", "soccer", "social", "sock", "soda", "soft", "solar", "soldier", "solid", "solution", "solve", "someone", "song", "soon", "sorry", "sort", "soul", "sound", "soup", "source", "south", "space", "spare", "spatial", "spawn", "speak", "special", "speed", "spell", "spend", "sphere", "spice", "spider", "spike", "spin", "spirit", "split", "spoil", "sponsor", "spoon", "sport", "spot", "spray", "spread", "spring", "spy", "square", "squeeze", "squirrel", "stable", "stadium", "staff", "stage", "stairs", "stamp", "stand", "start", "state", "stay", "steak", "steel", "stem", "step", "stereo", "stick", "still", "sting", "stock", "stomach", "stone", "stool", "story", "stove", "strategy", "street", "strike", "strong", "struggle", "student", "stuff", "stumble", "style", "subject", "submit", "subway", "success", "such", "sudden", "suffer", "sugar", "suggest", "suit", "summer", "sun", "sunny", "sunset", "super", "supply", "supreme", "sure", "surface", "surge", "surprise", "surround", "survey", "suspect", "sustain", "swallow", "swamp", "swap", "swarm", "swear", "sweet", "swift", "swim", "swing", "switch", "sword", "symbol", "symptom", "syrup", "system", "table", "tackle", "tag", "tail", "talent", "talk", "tank", "tape", "target", "task", "taste", "tattoo", "taxi", "teach", "team", "tell", "ten", "tenant", "tennis", "tent", "term", "test", "text", "thank", "that", "theme", "then", "theory", "there", "they", "thing", "this", "thought", "three", "thrive", "throw", "thumb", "thunder", "ticket", "tide", "tiger", "tilt", "timber", "time", "tiny", "tip", "tired", "tissue", "title", "toast", "tobacco", "today", "toddler", "toe", "together", "toilet", "token", "tomato", "tomorrow", "tone", "tongue", "tonight", "tool", "tooth", "top", "topic", "topple", "torch", "tornado", "tortoise", "toss", "total", "tourist", "toward", "tower", "town", "toy", "track", "trade", "traffic", "tragic", "train", "transfer", "trap", "trash", "travel", "tray", "treat", "tree", "trend", "trial", "tribe", "trick", "trigger", "trim", "trip", "trophy", "trouble", "truck", "true", "truly", "trumpet", "trust", "truth", "try", "tube", "tuition", "tumble", "tuna", "tunnel", "turkey", "turn", "turtle", "twelve", "twenty", "twice", "twin", "twist", "two", "type", "typical", "ugly", "umbrella", "unable", "unaware", "uncle", "uncover", "under", "undo", "unfair", "unfold", "unhappy", "uniform", "unique", "unit", "universe", "unknown", "unlock", "until", "unusual", "unveil", "update", "upgrade", "uphold", "upon", "upper", "upset", "urban", "urge", "usage", "use", "used", "useful", "useless", "usual", "utility", "vacant", "vacuum", "vague", "valid", "valley", "valve", "van", "vanish", "vapor", "various", "vast", "vault", "vehicle", "velvet", "vendor", "venture", "venue", "verb", "verify", "version", "very", "vessel", "veteran", "viable", "vibrant", "vicious", "victory", "video", "view", "village", "vintage", "violin", "virtual", "virus", "visa", "visit", "visual", "vital", "vivid", "vocal", "voice", "void", "volcano", "volume", "vote", "voyage", "wage", "wagon", "wait", "walk", "wall", "walnut", "want", "warfare", "warm", "warrior", "wash", "wasp", "waste", "water", "wave", "way", "wealth", "weapon", "wear", "weasel", "weather", "web", "wedding", "weekend", "weird", "welcome", "west", "wet", "whale", "what", "wheat", "wheel", "when", "where", "whip", "whisper", "wide", "width", "wife", "wild", "will", "win", "window", "wine", "wing", "wink", "winner", "winter", "wire", "wisdom", "wise", "wish", "witness", "wolf", "woman", "wonder", "wood", "wool", "word", "work", "world", "worry", "worth", "wrap", "wreck", "wrestle", "wrist", "write", "wrong", "yard", "year", "yellow", "you", "young", "youth", "zebra", "zero", "zone", "zoo"};
+
+/* BITCOIN FUNCTIONS */
+
+void get_ripemd160(bnz_t *, const uint8_t *);
+void get_sha256(bnz_t *, const uint8_t *);
+void get_sha512(bnz_t *, const uint8_t *);
+void get_ripemd160_sha256(bnz_t *, const bnz_t *, size_t);
+void get_sha256_sha256(bnz_t *, const bnz_t *, size_t);
+bool is_valid_private_key(const SECP256K1, const bnz_t *);
+void bnz_256_bit_rnd(bnz_t *);
+void entropy_checksum(bnz_t *);
+void get_bip39_word_ids_bnz(bnz_t *, uint32_t *);
+void get_bip39_word_ids_str(bnz_t *, bnz_t *, uint8_t *, char *);
 uint8_t *get_mnemonic_phrase(uint32_t *);
 uint8_t *get_salt(const char *);
 void get_seed_from_mnemonic_phrase(bnz_t *, const char *, const char *);
 void get_master_keys(bnz_t *, bnz_t *, const bnz_t *);
 void get_child_normal(const SECP256K1, bnz_t *, bnz_t *, const bnz_t *, const bnz_t *, const bnz_t *, uint32_t);
 void get_child_hardened(const SECP256K1, bnz_t *, bnz_t *, const bnz_t *, const bnz_t *, uint32_t);
+void get_child_normal_u256(sc_t *, u256_t *, const sc_t *, const u256_t *, const uint8_t *, uint32_t);
+void get_child_hardened_u256(sc_t *, u256_t *, const sc_t *, const u256_t *, uint32_t);
 void get_hdk_intermediate_values(const SECP256K1, const bnz_t *, const bnz_t *, char *);
 void get_public_key_compressed(const SECP256K1, bnz_t *, bnz_t *);
+void get_public_key_compressed_u256(const SECP256K1 *, uint8_t *, const u256_t *);
+void get_public_keys_compressed_u256_batch(const SECP256K1 *, uint8_t *, const u256_t *, size_t);
+void get_public_keys_compressed_batch(const SECP256K1, bnz_t *, const bnz_t *, size_t);
 void get_public_key(const SECP256K1, APT *, bnz_t *, bnz_t *);
 void get_public_key_xy(const SECP256K1, APT *, const bnz_t *);
 void get_random_master_keys(bnz_t *, bnz_t *, bnz_t *);
@@ -2525,336 +6776,1719 @@ void get_wallet_p2pkh_addresses(const SECP256K1, bnz_t *, bnz_t *);
 void get_wallet_p2sh_p2wpkh_addresses(const SECP256K1, bnz_t *, bnz_t *);
 void get_wallet_p2wpkh_addresses(const SECP256K1, bnz_t *, bnz_t *);
 
-void get_ripemd160(bnz_t *res, const uint8_t *a) // res = ripemd160(a) as a bnz_t
+void get_ripemd160(bnz_t *res, const uint8_t *a) // res = ripemd160(a) as a bnz_t
+{
+    bnz_resize(res, 20, false); // prepare res.digits to receive 20 bytes of hash digest
+    ripemd160(a, strlen((const char *)a), res->digits); // res.digits = ripemd160(a), big endian order
+    bnz_reverse_digits(res); // convert res.digits to standard bnz_t little endian order
+}
+
+void get_sha256(bnz_t *res, const uint8_t *a) // res = sha256(a) as a bnz_t
+{
+    bnz_resize(res, 32, false); // prepare res.digits to receive 32 bytes of hash digest
+    sha256(a, (uint64_t)strlen((const char *)a), res->digits); // res.digits = sha256(a), big endian order
+    bnz_reverse_digits(res); // convert res.digits to standard bnz_t little endian order
+}
+
+void get_sha512(bnz_t *res, const uint8_t *a) // res = sha512(a) as a bnz_t
+{
+    bnz_resize(res, 64, false); // prepare res.digits to receive 64 bytes of hash digest
+    sha512(a, (uint64_t)strlen((const char *)a), res->digits); // res.digits = sha512(a), big endian order
+    bnz_reverse_digits(res); // convert res.digits to standard bnz_t little endian order
+}
+
+void get_ripemd160_sha256(bnz_t *res, const bnz_t *a, size_t len) // res = first len bytes of ripemd160(sha256(a.digits)) as a bnz_t
+{
+    uint8_t h1[32], h2[20];
+    bnz_t aa; // aa is a mutable local copy of a 
+    bnz_init(&aa); // initiate aa
+    bnz_set_bnz(&aa, a); // set aa = a, standard little endian order
+    bnz_reverse_digits(&aa); // convert aa.digits to big endian order
+    sha256(aa.digits, aa.size, h1); // h1 = sha256(aa.digits)
+    ripemd160(h1, 32, h2); // h2 = ripemd160(sha256(aa.digits))
+    bnz_resize(res, len, false); // prepare res.digits to receive first len bytes of h2
+    memcpy(res->digits, h2, len); // copy first len bytes of h2 into res.digits, big endian order
+    bnz_reverse_digits(res); // convert res.digits to standard bnz_t little endian order
+    bnz_free(&aa); // free aa resources
+}
+
+void get_sha256_sha256(bnz_t *res, const bnz_t *a, size_t len) // res = first len bytes of sha256(sha256(a.digits)) as a bnz_t
+{
+    uint8_t h1[32], h2[32];
+    bnz_t aa; // aa is a mutable local copy of a
+    bnz_init(&aa); // initiate aa
+    bnz_set_bnz(&aa, a); // set aa = a, standard little endian order
+    bnz_reverse_digits(&aa); // convert aa.digits to big endian order
+    sha256(aa.digits, aa.size, h1); // h1 = sha256(aa.digits)
+    sha256(h1, 32, h2); // h2 = sha256(sha256(aa.digits))
+    bnz_resize(res, len, false); // prepare res.digits to receive the first len bytes of h2
+    memcpy(res->digits, h2, len); // copy first len bytes of h2 into res.digits, big endian order
+    bnz_reverse_digits(res); // convert res.digits to standard bnz_t little endian order
+    bnz_free(&aa); // free aa resources
+}
+
+bool is_valid_private_key(const SECP256K1 secp256k1, const bnz_t *a)
+{
+    if (bnz_cmp_i32(a, 0) == 1 && bnz_cmp_bnz(a, &secp256k1.n) == -1) { // a valid private key is 0 < a < secp256k1.n
+        return true;
+    }
+    return false;
+}
+
+void bnz_256_bit_rnd(bnz_t *rnd) // generate pseudo random 256 bit entropy as a bnz_t
+{
+    uint32_t random;
+    size_t i;
+    bnz_resize(rnd, 32, false);
+    for (i = 0; i < 32; i++) {
+        rand_s(&random); // on non-Windows systems, change this to some other source of cryptographically secure random numbers
+        rnd->digits[i] = random & 255; // rnd->digits[i] = last byte of random
+    }
+}
+
+void entropy_checksum(bnz_t *entropy) // append checksum byte to the lsb end of 256 bits of entropy as a bnz_t
+{
+    uint8_t sha256_digest[32];
+    bnz_t tmp; // tmp = local mutable copy of entropy
+    bnz_init(&tmp); // initiate tmp
+
+    bnz_set_bnz(&tmp, entropy); // copy entropy into tmp
+    bnz_resize(&tmp, 32, true); // ensure that tmp is 32 bytes
+    bnz_reverse_digits(&tmp); // convert tmp.digits to big endian order
+    sha256(tmp.digits, tmp.size, sha256_digest); // sha256_digest = sha256[tmp.digits]
+
+    bnz_concatenate_ui8(&tmp, &tmp, sha256_digest[0], 0); // concatenate first byte of sha256_digest the the lsb end of tmp
+    bnz_reverse_digits(&tmp); // convert tmp.digits to standard little endian order
+    
+    bnz_set_bnz(entropy, &tmp); // copy tmp back into entropy
+    bnz_free(&tmp); // free tmp resources
+}
+
+void get_bip39_word_ids_bnz(bnz_t *entropy_chk, uint32_t *wd_ids) // convert 33 bytes of entropy + checksum as a bnz_t into 24 numbers of 11 bits
+{
+    size_t i;
+    bnz_t tmp;
+    bnz_init(&tmp);
+
+    bnz_set_bnz(&tmp, entropy_chk);
+    bnz_resize(&tmp, 33, true);
+    bnz_reverse_digits(&tmp);
+
+    for (i = 0; i < 3; i++) {
+        wd_ids[(i * 8) + 0] = ((((uint32_t)tmp.digits[(i * 11) + 0]) << 3) & 2040) + ((((uint32_t)tmp.digits[(i * 11) + 1]) >> 5) & 7);
+        wd_ids[(i * 8) + 1] = ((((uint32_t)tmp.digits[(i * 11) + 1]) << 6) & 1984) + ((((uint32_t)tmp.digits[(i * 11) + 2]) >> 2) & 63);
+        wd_ids[(i * 8) + 2] = ((((uint32_t)tmp.digits[(i * 11) + 2]) << 9) & 1536) + ((((uint32_t)tmp.digits[(i * 11) + 3]) << 1) & 510) + ((((uint32_t)tmp.digits[(i * 11) + 4]) >> 7) & 1);
+        wd_ids[(i * 8) + 3] = ((((uint32_t)tmp.digits[(i * 11) + 4]) << 4) & 2032) + ((((uint32_t)tmp.digits[(i * 11) + 5]) >> 4) & 15);
+        wd_ids[(i * 8) + 4] = ((((uint32_t)tmp.digits[(i * 11) + 5]) << 7) & 1920) + ((((uint32_t)tmp.digits[(i * 11) + 6]) >> 1) & 127);
+        wd_ids[(i * 8) + 5] = ((((uint32_t)tmp.digits[(i * 11) + 6]) << 10) & 1024) + ((((uint32_t)tmp.digits[(i * 11) + 7]) << 2) & 2044) + ((((uint32_t)tmp.digits[(i * 11) + 8]) >> 6) & 3);
+        wd_ids[(i * 8) + 6] = ((((uint32_t)tmp.digits[(i * 11) + 8]) << 5) & 2016) + ((((uint32_t)tmp.digits[(i * 11) + 9]) >> 3) & 31);
+        wd_ids[(i * 8) + 7] = ((((uint32_t)tmp.digits[(i * 11) + 9]) << 8) & 1792) + ((((uint32_t)tmp.digits[(i * 11) + 10])));
+    }
+
+    bnz_free(&tmp);
+}
+
+void get_bip39_word_ids_str(bnz_t *entropy_chk, bnz_t *entropy, uint8_t *chk, char *mnemonic_str) // convert 24 words into 32 bytes of entropy + 1 byte of checksum
+{
+    size_t i = 0, j;
+    char sha256_digest[32], *tok = strtok(mnemonic_str, " "); // split mnemonic string into an array of BIP39 words
+    uint32_t wd_ids[24];
+
+    bnz_resize(entropy_chk, 33, false);
+
+    while (tok != NULL) { // traverse array
+        for (j = 0; j < 2048; j++) { // search BIP39 list for matches
+            if (!strcmp(tok, bip39_wds[j])) { // match found
+                wd_ids[i++] = j; // record id
+                break; // exit loop as soon as match found
+            }
+        }
+        tok = strtok(NULL, " "); // next array member
+    }
+
+    for (i = 0; i < 3; i++) {
+        entropy_chk->digits[(i * 11) + 0] = (wd_ids[(i * 8) + 0] >> 3) & 255;
+        entropy_chk->digits[(i * 11) + 1] = (((wd_ids[(i * 8) + 0] & 7) << 5) + (wd_ids[(i * 8) + 1] >> 6)) & 255;
+        entropy_chk->digits[(i * 11) + 2] = (((wd_ids[(i * 8) + 1] & 63) << 2) + (wd_ids[(i * 8) + 2] >> 9)) & 255;
+        entropy_chk->digits[(i * 11) + 3] = (wd_ids[(i * 8) + 2] >> 1) & 255;
+        entropy_chk->digits[(i * 11) + 4] = (((wd_ids[(i * 8) + 2] & 1) << 7) + (wd_ids[(i * 8) + 3] >> 4)) & 255;
+        entropy_chk->digits[(i * 11) + 5] = (((wd_ids[(i * 8) + 3] & 15) << 4) + (wd_ids[(i * 8) + 4] >> 7)) & 255;
+        entropy_chk->digits[(i * 11) + 6] = (((wd_ids[(i * 8) + 4] & 127) << 1) + (wd_ids[(i * 8) + 5] >> 10)) & 255;
+        entropy_chk->digits[(i * 11) + 7] = (wd_ids[(i * 8) + 5] >> 2) & 255;
+        entropy_chk->digits[(i * 11) + 8] = (((wd_ids[(i * 8) + 5] & 3) << 6) + (wd_ids[(i * 8) + 6] >> 5)) & 255;
+        entropy_chk->digits[(i * 11) + 9] = (((wd_ids[(i * 8) + 6] & 31) << 3) + (wd_ids[(i * 8) + 7] >> 8)) & 255;
+        entropy_chk->digits[(i * 11) + 10] = wd_ids[(i * 8) + 7] & 255;
+    }
+
+    bnz_set_bnz(entropy, entropy_chk); // copy 33 bytes of entropy_chk into entropy
+    bnz_resize(entropy, 32, true); // resize entropy to 32 bytes of entropy
+    sha256(entropy->digits, 32, sha256_digest); // get SHA256 hash digest of entropy->digits
+    *chk = sha256_digest[0]; // set chk to first byte of SHA256 hash digest
+    bnz_reverse_digits(entropy); // convert to little
+    bnz_reverse_digits(entropy_chk); // endian order
+}
+
+uint8_t *get_mnemonic_phrase(uint32_t *wd_ids) // generate mnemonic string of 24 words
+{
+    uint8_t *mnemonic_str = NULL;
+    int i, len = 0;
+
+    for (i = 0; i < 24; i++) {
+        len += strlen(bip39_wds[wd_ids[i]]);
+    }
+
+    mnemonic_str = init_uint8_array(len + 24 /* 23 chars for the spaces between the individual mnemonic words + one char for the null terminator */);
+    if (!mnemonic_str) {
+        return NULL;
+    }
+
+    for (i = 0; i < 23; i++) {
+        sprintf(mnemonic_str + strlen(mnemonic_str), "%s ", bip39_wds[wd_ids[i]]);
+    }
+
+    sprintf(mnemonic_str + strlen(mnemonic_str), "%s", bip39_wds[wd_ids[23]]);
+
+    return(mnemonic_str);
+}
+
+uint8_t *get_salt(const char *passphrase) // generate salt string from passphrase
+{
+    uint8_t *salt = NULL;
+
+    salt = init_uint8_array(strlen("mnemonic") + strlen(passphrase) + sizeof(uint32_t)); // initiate salt to hold "mnemonic" concatenated with passphrase and 4 bytes of uint32_t
+    if (!salt) {
+        return NULL;
+    }
+
+    sprintf((char *)salt, "mnemonic%s", passphrase); // set salt = "mnemonic" concatenated with passphrase
+    salt[strlen("mnemonic") + strlen(passphrase) + sizeof(uint32_t) - 1] = 1; // set the value of the last byte of salt to 1
+
+    return salt;
+}
+
+void get_seed_from_mnemonic_phrase(bnz_t *seed, const char *mnemonic, const char *passphrase) // generate 64 byte seed from mnemonic string and optional passphrase
+{
+    uint8_t tmp[64], *salt = NULL;
+    size_t i, j;
+
+    bnz_resize(seed, 64, false); // ensure that seed is 64 bytes
+
+    salt = get_salt(passphrase); // salt = "mnemonic" concatenated with passphrase and the value 1 formatted as a uint32_t, strlen(salt) = strlen("mnemonic") + strlen(passphrase) + sizeof(uint32_t)
+    if (!salt) {
+        return;
+    }
+
+    hmac_sha512(mnemonic, strlen(mnemonic), salt, strlen("mnemonic") + strlen(passphrase) + sizeof(uint32_t), tmp, 64); // tmp = first hmac(mnemonic, salt)
+    memcpy(seed->digits, tmp, 64); // set seed = result of first hmac process
+
+    for (i = 1; i < 2048; i++) { // repeat 2048 times
+        hmac_sha512(mnemonic, strlen(mnemonic), tmp, 64, tmp, 64);  // tmp = hmac(mnemonic, tmp)
+        for (j = 0; j < 64; j++) {
+            seed->digits[j] = tmp[j] ^ seed->digits[j]; // xor each byte of current seed.digits with corresponding byte of current tmp
+        }
+    }
+
+    bnz_reverse_digits(seed); // convert seed.digits to standard little endian order
+
+    free(salt); // free resources
+}
+
+void get_master_keys(bnz_t *master_private_key, bnz_t *master_chain_code, const bnz_t *seed) // generate 32 byte master private key and 32 byte master chain_code
+{
+    uint8_t mac[64];
+
+    bnz_t tmp;
+    bnz_init(&tmp);
+
+    bnz_set_bnz(&tmp, seed); // copy seed to tmp
+
+    bnz_resize(&tmp, 64, true); // ensure that tmp is 64 bytes
+    bnz_reverse_digits(&tmp); // convert tmp.digits to big endian order
+    hmac_sha512("Bitcoin seed", 12, tmp.digits, tmp.size, mac, 64); // generate 64 byte MAC from tmp.digits and the initial key "Bitcoin seed"
+
+    bnz_resize(master_private_key, 32, false); // prepare master_private_key to receive the first 32 bytes of the MAC
+    memcpy(master_private_key->digits, mac, 32); // copy the first 32 bytes of the MAC into master_private_key
+    bnz_reverse_digits(master_private_key); // convert master_private_key.digits to default little endian order
+
+    bnz_resize(master_chain_code, 32, false); // prepare master_chain_code to receive the last 32 bytes of the MAC
+    memcpy(master_chain_code->digits, mac + 32, 32); // copy the last 32 bytes of the MAC into master_chain_code
+    bnz_reverse_digits(master_chain_code); // convert master_chain_code.digits to default little endian order
+
+    bnz_free(&tmp);
+}
+
+void get_child_normal(const SECP256K1 secp256k1, bnz_t *child_private_key, bnz_t *child_chain_code, const bnz_t *parent_private_key, const bnz_t *parent_chain_code, const bnz_t *parent_public_key_compressed, uint32_t index_num)
+{
+    uint8_t public_key_bytes[33];
+    u256_t child_chain, parent_chain;
+    sc_t child_key, parent_key;
+    size_t i;
+
+    BNZ_STATS_SCOPE(__func__);
+    (void)secp256k1; // unused, sc_t keys are always mod secp256k1.n
+
+    sc_set_bnz(&parent_key, parent_private_key);
+    u256_set_bnz(&parent_chain, parent_chain_code);
+
+    for (i = 0; i < 33; i++) { // compressed public key in big endian order, read in place
+        public_key_bytes[32 - i] = i < parent_public_key_compressed->size ? parent_public_key_compressed->digits[i] : 0;
+    }
+
+    get_child_normal_u256(&child_key, &child_chain, &parent_key, &parent_chain, public_key_bytes, index_num);
+
+    sc_get_bnz(child_private_key, &child_key);
+    u256_get_bnz(child_chain_code, &child_chain);
+}
+
+void get_child_hardened(const SECP256K1 secp256k1, bnz_t *child_private_key, bnz_t *child_chain_code, const bnz_t *parent_private_key, const bnz_t *parent_chain_code, uint32_t index_num)
+{
+    u256_t child_chain, parent_chain;
+    sc_t child_key, parent_key;
+
+    BNZ_STATS_SCOPE(__func__);
+    (void)secp256k1; // unused, as in get_child_normal
+
+    sc_set_bnz(&parent_key, parent_private_key);
+    u256_set_bnz(&parent_chain, parent_chain_code);
+
+    get_child_hardened_u256(&child_key, &child_chain, &parent_key, &parent_chain, index_num);
+
+    sc_get_bnz(child_private_key, &child_key);
+    u256_get_bnz(child_chain_code, &child_chain);
+}
+
+void get_child_normal_u256(sc_t *child_private_key, u256_t *child_chain_code, const sc_t *parent_private_key, const u256_t *parent_chain_code, const uint8_t *parent_public_key_compressed, uint32_t index_num) // BIP32 normal child from a 33 byte big endian compressed public key, no heap allocations
+{
+    uint8_t mac[64], key[32], message[37];
+    sc_t tweak;
+
+    u256_get_bytes(key, parent_chain_code); // key = parent chain code
+    memcpy(message, parent_public_key_compressed, 33); // message = parent public key || index, big endian order
+    message[33] = (uint8_t)(index_num >> 24);
+    message[34] = (uint8_t)(index_num >> 16);
+    message[35] = (uint8_t)(index_num >> 8);
+    message[36] = (uint8_t)index_num;
+
+    hmac_sha512(key, 32, message, 37, mac, 64);
+
+    sc_set_bytes(&tweak, mac); // first 32 bytes of the MAC, mod secp256k1.n
+    u256_set_bytes(child_chain_code, mac + 32); // last 32 bytes of the MAC
+
+    sc_add(child_private_key, &tweak, parent_private_key); // child private key = (tweak + parent private key) mod secp256k1.n
+}
+
+void get_child_hardened_u256(sc_t *child_private_key, u256_t *child_chain_code, const sc_t *parent_private_key, const u256_t *parent_chain_code, uint32_t index_num) // BIP32 hardened child, no heap allocations
+{
+    uint8_t mac[64], key[32], message[37];
+    sc_t tweak;
+
+    if (index_num < 2147483648) index_num += 2147483648;
+
+    u256_get_bytes(key, parent_chain_code); // key = parent chain code
+    message[0] = 0; // message = 0x00 || parent private key || index, big endian order
+    sc_get_bytes(message + 1, parent_private_key);
+    message[33] = (uint8_t)(index_num >> 24);
+    message[34] = (uint8_t)(index_num >> 16);
+    message[35] = (uint8_t)(index_num >> 8);
+    message[36] = (uint8_t)index_num;
+
+    hmac_sha512(key, 32, message, 37, mac, 64);
+
+    sc_set_bytes(&tweak, mac); // first 32 bytes of the MAC, mod secp256k1.n
+    u256_set_bytes(child_chain_code, mac + 32); // last 32 bytes of the MAC
+
+    sc_add(child_private_key, &tweak, parent_private_key); // child private key = (tweak + parent private key) mod secp256k1.n
+}
+
+void get_hdk_intermediate_values(const SECP256K1 secp256k1, const bnz_t *master_private_key, const bnz_t *master_chain_code, char *hdk_str)
+{
+    char *tok = strtok(hdk_str, "/"), display_str[32]; // split str into an array of indicies
+    uint32_t index, depth = 0;
+    size_t mark;
+    bnz_arena_t arena, *prev_arena;
+
+    bnz_t parent_private_key, parent_chain_code, parent_public_key_compressed, child_private_key, child_chain_code, child_public_key_compressed;
+
+    bnz_init(&parent_private_key);
+    bnz_init(&parent_chain_code);
+    bnz_init(&parent_public_key_compressed);
+    bnz_init(&child_private_key);
+    bnz_init(&child_chain_code);
+    bnz_init(&child_public_key_compressed);
+
+    bnz_set_bnz(&parent_private_key, master_private_key);
+    bnz_set_bnz(&parent_chain_code, master_chain_code);
+
+    bnz_arena_init(&arena, BNZ_ARENA_BYTES); // bnz_t temporaries of the derivation are drawn from a local arena, or from the heap if it could not be allocated
+    prev_arena = bnz_arena_select(arena.base ? &arena : NULL);
+
+    sprintf(display_str, "m");
+
+    if (strcmp(tok, "m") == 0) {
+        tok = strtok(NULL, "/"); // get first array member
+        while (tok != NULL) { // traverse array
+
+            sprintf(display_str + strlen(display_str), "/"); // update display
+            sprintf(display_str + strlen(display_str), tok); // string
+
+            depth++; // increment depth
+            index = atoi(tok); // extract index from tok, ignoring any "'" indicating hardened child 
+            mark = bnz_arena_mark(bnz_scratch_arena); // scratch space of each level is released at the end of the level
+
+            get_public_key_compressed(secp256k1, &parent_public_key_compressed, &parent_private_key); // get parent compressed public key for calculating normal child 
+
+            if (tok[strlen(tok) - 1] == '\'') { // check for presence of "'" indicating hardened child
+                if (index < 2147483648) index += 2147483648;
+                get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, index); // if last char of tok is "'", get hardened child
+            } else {
+                get_child_normal(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, &parent_public_key_compressed, index); // if last char of tok is not "'", get normal child
+            }
+
+            get_public_key_compressed(secp256k1, &child_public_key_compressed, &child_private_key); // get compressed public key from child private key
+
+            // print results
+            printf("%s\n", display_str);
+            bnz_print(&parent_private_key, 16, "PARENT PRIVATE KEY: ");
+            bnz_print(&parent_chain_code, 16, "PARENT CHAIN CODE: ");
+            bnz_print(&child_private_key, 16, "CHILD PRIVATE KEY: ");
+            bnz_print(&child_chain_code, 16, "CHILD CHAIN CODE: ");
+            printf("\n");
+
+            // prepare next iteration by setting parent private key and parent chain code to current child private key and child chain code
+            bnz_set_bnz(&parent_private_key, &child_private_key);
+            bnz_set_bnz(&parent_chain_code, &child_chain_code);
+
+            bnz_arena_reset(bnz_scratch_arena, mark);
+
+            tok = strtok(NULL, "/"); // next array member
+        }
+    }
+
+    bnz_arena_select(prev_arena);
+    bnz_arena_free(&arena);
+
+    bnz_free(&parent_private_key);
+    bnz_free(&parent_chain_code);
+    bnz_free(&parent_public_key_compressed);
+    bnz_free(&child_private_key);
+    bnz_free(&child_chain_code);
+    bnz_free(&child_public_key_compressed);
+}
+
+void get_public_key_compressed(const SECP256K1 secp256k1, bnz_t *public_key_compressed, bnz_t *private_key)
+{
+    APT public_key;
+
+    BNZ_STATS_SCOPE(__func__);
+
+    bnz_init(&public_key.x);
+    bnz_init(&public_key.y);
+
+    secp256k1_jacobian_scalar_multiplication(secp256k1, private_key, &public_key);
+
+    bnz_resize(&public_key.x, 32, true);
+
+    if (bnz_bit_set(&public_key.y, 0) == false) {
+        bnz_concatenate_ui8(public_key_compressed, &public_key.x, 2, 0);
+    } else { // odd y
+        bnz_concatenate_ui8(public_key_compressed, &public_key.x, 3, 0);
+    }
+    
+    bnz_free(&public_key.x);
+    bnz_free(&public_key.y);
+}
+
+void get_public_key_compressed_u256(const SECP256K1 *secp256k1, uint8_t *public_key_compressed, const u256_t *private_key) // 33 byte big endian compressed public key, no heap allocations
+{
+    APT256 public_key;
+
+    secp256k1_jacobian_scalar_multiplication_u256(secp256k1, private_key, &public_key);
+
+    public_key_compressed[0] = u256_bit_set(&public_key.y, 0) == false ? 2 : 3; // 0x02 for even y, 0x03 for odd y
+    u256_get_bytes(public_key_compressed + 1, &public_key.x);
+}
+
+void get_public_keys_compressed_u256_batch(const SECP256K1 *secp256k1, uint8_t *public_keys_compressed, const u256_t *private_keys, size_t n) // n 33 byte big endian compressed public keys, one after the other, sharing one inversion
+{
+    size_t i;
+    APT256 *public_keys = NULL;
+
+    public_keys = (APT256 *)bnz_scratch_alloc(n * (sizeof(APT256) / sizeof(uint64_t)));
+    if (!public_keys) {
+        return;
+    }
+
+    secp256k1_jacobian_scalar_multiplication_u256_batch(secp256k1, private_keys, public_keys, n);
+
+    for (i = 0; i < n; i++) {
+        public_keys_compressed[33 * i] = u256_bit_set(&public_keys[i].y, 0) == false ? 2 : 3; // 0x02 for even y, 0x03 for odd y
+        u256_get_bytes(public_keys_compressed + 33 * i + 1, &public_keys[i].x);
+    }
+
+    bnz_scratch_free((uint64_t *)public_keys);
+}
+
+void get_public_keys_compressed_batch(const SECP256K1 secp256k1, bnz_t *public_keys_compressed, const bnz_t *private_keys, size_t n) // public_keys_compressed[i] = get_public_key_compressed(private_keys[i]) for i < n, sharing one inversion
+{
+    size_t i;
+    u256_t *keys = NULL;
+    uint8_t *bytes = NULL;
+
+    keys = (u256_t *)bnz_scratch_alloc(n * (sizeof(u256_t) / sizeof(uint64_t)) + (33 * n + 7) / 8);
+    if (!keys) {
+        return;
+    }
+    bytes = (uint8_t *)(keys + n);
+
+    for (i = 0; i < n; i++) {
+        u256_set_bnz(&keys[i], &private_keys[i]);
+    }
+    get_public_keys_compressed_u256_batch(&secp256k1, bytes, keys, n);
+
+    for (i = 0; i < n; i++) {
+        bnz_resize(&public_keys_compressed[i], 33, false);
+        memcpy(public_keys_compressed[i].digits, bytes + 33 * i, 33); // big endian order
+        bnz_reverse_digits(&public_keys_compressed[i]); // convert to standard bnz_t little endian order
+    }
+
+    bnz_scratch_free((uint64_t *)keys);
+}
+
+void get_public_key(const SECP256K1 secp256k1, APT *public_key, bnz_t *public_key_compressed, bnz_t *private_key) // generate public key from private key
+{
+    secp256k1_jacobian_scalar_multiplication(secp256k1, private_key, public_key); // public_key = (secp256k1.G * private_key) mod secp256k1.p
+
+    bnz_resize(&public_key->x, 32, true); // ensure that the compressed public key is 32 bytes long before concatenation with the even y / odd y byte
+
+    if (bnz_bit_set(&public_key->y, 0) == false) { // even y
+        bnz_concatenate_ui8(public_key_compressed, &public_key->x, 2, 0); // prepend 2
+    } else { // odd y
+        bnz_concatenate_ui8(public_key_compressed, &public_key->x, 3, 0); // prepend 3
+    }
+}
+
+void get_public_key_xy(const SECP256K1 secp256k1, APT *public_key, const bnz_t *public_key_compressed) // regenerate public key point on secp256k1 from compressed public key
+{
+    uint8_t typ = public_key_compressed->digits[public_key_compressed->size - 1]; // byte at msb encodes the parity of y: typ = 0x02 for even y, typ = 0x03 for odd y
+    fe_t x, y, y_sq, seven;
+
+    (void)secp256k1; // unused, fe_sqrt works mod secp256k1.p
+
+    /*
+
+    In this function we wish to regenerate the x,y coordinates of a point on secp256k1 from a compressed public key, which is
+    the x coordinate of the point concatenated (at the msb end) with a byte of value 2 or 3, depending on whether the value of
+    y is even (0x02) or odd (0x03).
+
+    Generating the y coordinate of a point on secp256k1, given the corresponding x coordinate, leverages a nice property of secp256k1
+    which is that, given y^2 mod secp256k1.p (easily calculated from x given the formula of secp256k1: y^2 = x^3 + 7), we can
+    calculate y as follows:
+
+        y mod secp256k1.p = (y_sq^((secp256k1.p + 1) / 4)) mod secp256k1.p
+
+    The exponentiation is carried out by fe_sqrt, using a fixed addition chain for (secp256k1.p + 1) / 4.
+
+    */
+
+    bnz_set_bnz(&public_key->x, public_key_compressed); // public_key.x = compressed public key
+    bnz_resize(&public_key->x, public_key->x.size - 1, true); // public_key.x = decompressed public key, byte at msb end removed
+
+    fe_set_bnz(&x, &public_key->x);
+    fe_set_ui64(&seven, 7);
+    fe_sqr(&y_sq, &x); // y_sq = public_key.x^2
+    fe_mul(&y_sq, &y_sq, &x); // y_sq = public_key.x^3
+    fe_add(&y_sq, &y_sq, &seven); // y_sq = public_key.x^3 + 7
+
+    fe_sqrt(&y, &y_sq); // y mod secp256k1.p = (y_sq^((secp256k1.p + 1) / 4)) mod secp256k1.p
+
+    if ((typ == 2 && fe_is_odd(&y) == true) || (typ == 3 && fe_is_odd(&y) == false)) { // mismatched typ and y
+        fe_negate(&y, &y, 1); // y = secp256k1.p - y, negation of y mod p
+    }
+
+    fe_get_bnz(&public_key->y, &y);
+}
+
+void get_random_master_keys(bnz_t *entropy, bnz_t *master_private_key, bnz_t *master_chain_code) // NOT SECURE use random 256 bit entropy to generate master private key and master chain code
+{
+    char *mnemonic = NULL;
+    uint32_t wd_ids[24];
+    bnz_t tmp, seed;
+
+    bnz_init(&tmp);
+    bnz_init(&seed);
+
+    bnz_256_bit_rnd(entropy); // generate 32 bytes of random entropy
+    bnz_set_bnz(&tmp, entropy); // copy entropy into tmp
+
+    entropy_checksum(&tmp); // calculate and append checksum byte to copy of entropy, 33 byte result
+    get_bip39_word_ids_bnz(&tmp, wd_ids); // get the ids of the 24 BIP39 words from the 33 byte tmp
+    mnemonic = get_mnemonic_phrase(wd_ids); // generate mnemonic phrase string from BIP39 word ids
+    get_seed_from_mnemonic_phrase(&seed, mnemonic, ""); // generate 64 byte seed from mnemonic phrase
+    get_master_keys(master_private_key, master_chain_code, &seed); // generate master private key and master chain code from seed
+
+    free(mnemonic);
+    bnz_free(&tmp);
+    bnz_free(&seed);
+}
+
+void get_p2pkh_address(bnz_t *p2pkh, bnz_t *public_key_compressed, uint32_t *p2pkh_leading_zeros) // get p2pkh address from compressed public key
+{
+    bnz_t fingerprint;
+    BNZ_STATS_SCOPE(__func__);
+    bnz_init(&fingerprint);
+    get_ripemd160_sha256(p2pkh, public_key_compressed, 20); // set p2pkh to ripemd160(sha256(public_key_compressed.digits)), p2pkh->size = 20
+    bnz_concat_append_ui8(p2pkh, 0, 0); // concatenate 0 byte to msb end of p2pkh.digits, p2pkh->size = 21
+    get_sha256_sha256(&fingerprint, p2pkh, 4); // set fingerprint to first four bytes of sha256(sha256(p2pkh.digits))
+    bnz_concat_append(p2pkh, &fingerprint, 1); // concatenate fingerprint to lsb end of p2pkh, p2pkh->size = 25
+    bnz_trim(p2pkh); // remove zero value bytes from msb end of p2pkh, p2pkh->size reduces by at least 1
+    (*p2pkh_leading_zeros) = 25 - p2pkh->size; // number of leading zeros = 25 - p2pkh->size after trimming leading zeros
+    bnz_free(&fingerprint); // free fingerprint
+}
+
+void print_p2pkh_address(const bnz_t *p2pkh, const uint8_t *str, uint32_t p2pkh_leading_zeros)
+{
+    uint8_t *full_string = NULL, *p2pkh_base58_str = NULL;
+    uint32_t i, len;
+    bnz_t tmp;
+    bnz_init(&tmp);
+    bnz_set_bnz(&tmp, p2pkh); // tmp = local mutable copy of p2pkh bnz_t with tmp.digits in standard little endian order 
+    bnz_reverse_digits(&tmp); // convert tmp.digits to big endian order
+
+    p2pkh_base58_str = get_base_n_str(&tmp, 58, "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz", &len); // get base58 format string of non-zero integer part of p2pkh
+    if (!p2pkh_base58_str) {
+        return;
+    }
+
+    full_string = init_uint8_array(strlen(str) + strlen(p2pkh_base58_str) + p2pkh_leading_zeros + 1); // prepare full string to receive str, leading zeros, and base58 format non-zero integer part of p2pkh
+    if (!full_string) {
+        return;
+    }
+
+    sprintf(full_string, "%s", str); // add str
+    for (i = 0; i  < p2pkh_leading_zeros; i++) {
+        sprintf(full_string + strlen(full_string), "1"); // add leading zeros in base58 as "1" characters
+    }
+    sprintf(full_string + strlen(full_string), "%s", p2pkh_base58_str); // add non-zero integer part of p2pkh
+
+    printf("%s\n", full_string); // print final string
+
+    free(full_string);
+    free(p2pkh_base58_str);
+    bnz_free(&tmp);
+}
+
+void get_p2sh_p2wpkh_address(bnz_t *p2sh_p2wpkh, bnz_t *public_key_compressed)
+{
+    bnz_t fingerprint, pub_key_hash;
+    BNZ_STATS_SCOPE(__func__);
+    bnz_init(&fingerprint);
+    bnz_init(&pub_key_hash);
+    get_ripemd160_sha256(&pub_key_hash, public_key_compressed, 20); // set pub_key_hash to ripemd160(sha256(public_key_compressed.digits))
+    bnz_concat_append_ui8(&pub_key_hash, 20, 0); // concatenate 0x14 to msb end of pub_key_hash
+    bnz_concat_append_ui8(&pub_key_hash, 0, 0); // concatenate 0x0 to msb end of pub_key_hash
+    get_ripemd160_sha256(p2sh_p2wpkh, &pub_key_hash, 20); // set p2sh_p2wpkh to ripemd160(sha256(pub_key_hash.digits))
+    bnz_concat_append_ui8(p2sh_p2wpkh, 5, 0); // concatenate 5 byte to msb end of p2sh_p2wpkh.digits
+    get_sha256_sha256(&fingerprint, p2sh_p2wpkh, 4); // set fingerprint to first four bytes of sha256(sha256(p2sh_p2wpkh.digits))
+    bnz_concat_append(p2sh_p2wpkh, &fingerprint, 1); // concatenate fingerprint to lsb end of p2sh_p2wpkh
+    bnz_trim(p2sh_p2wpkh); // remove zero value bytes from msb end of p2sh_p2wpkh
+    bnz_free(&fingerprint); // free resources
+}
+
+void get_p2wpkh_address(bnz_t *p2wpkh, const bnz_t *public_key_compressed)
+{
+    const char *bech32_alpha = "qpzry9x8gf2tvdw0s3jn54khce6mua7l", *witness_initial_str = "rrqzrqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq";
+    char witness_program_str[45] = {0}, p2wpkh_str[27] = {0}, chk_str[7] = {0};
+    uint8_t *scriptpubkey_bech32_str = NULL;
+    uint32_t i, len, chk = 1;
+
+    bnz_t tmp;
+    bnz_init(&tmp);
+
+    get_ripemd160_sha256(&tmp, public_key_compressed, 20); // tmp = ripemd160(sha256(public_key_compressed)), 20 bytes, little endian order
+    bnz_reverse_digits(&tmp); // convert tmp.digits to big endian order in preparation for generating the corresponding bech32 format string
+
+    scriptpubkey_bech32_str = get_base_n_str(&tmp, 32, bech32_alpha, &len); // scriptpubkey_bech32_str = tmp.digits in bech32 format, big endian order
+    if (!scriptpubkey_bech32_str) {
+        return;
+    }
+
+    /*
+
+    The witness program comprises four elements: expanded hrp + version + scriptpubkey in bech32 + padding.
+
+    Expanded hrp = "rrqzr", the prefix to witness program.
+
+    Derivation:
+
+    hrp = "bc" = 99 98 in ascii = 01100010 01100011 in binary
+    Expanded hrp = 00011 00011 00000 00010 00011, top 3 bits of 'b' and 'c' in ascii padded left to 5 bits + 5 zero bits separator + bottom 5 bits of 'b' and 'c' in ascii
+    Numerical values of expanded hrp = 3, 3, 0, 2, 3
+    Bech32 encoding of expanded hrp = r, r, q, z, r
+
+    The expanded hrp is followed by a 'q' zero digit representing the segwit version number.
+
+    "qqqqqq" = 6 zero digits in Bech32.
+
+    */
+
+    sprintf((char *)witness_program_str, "%s", (const char *)witness_initial_str); // witness_program_str = "rrqzrq" + 32 zeros to allow for offset in case strlen(scriptpubkey_bech32_str) < 32
+    sprintf((char *)witness_program_str + 38 - strlen((const char *)scriptpubkey_bech32_str), "%sqqqqqq", (const char *)scriptpubkey_bech32_str); // witness_program_str = "rrqzrq" + zero padding if required + scriptpubkey_bech32_str + "qqqqqq"
+
+    //get checksum, occupying 30 bits of uint32_t
+    for (i = 0; i < strlen((const char *)witness_program_str); i++) {
+        chk = p2wpkh_checksum_update(chk, char_32[(uint8_t)witness_program_str[i]]); // dgt = decimal value (0 - 31) corresponding to bech32 character
+    }
+    chk ^= 1; // finalise checksum, xor with 1 means standard segwit
+
+    // convert checksum from 30 bits formatted as uint32_t (big endian order) into 6 x 5 bit digits in bech32, stored as uint8_t array, little endian order
+    for (i = 0; i < 6; i++) {
+        chk_str[i] = bech32_alpha[(chk >> ((5 - i) * 5)) & 31];
+    }
+
+    sprintf(p2wpkh_str, "%s%s", (const char *)scriptpubkey_bech32_str, (const char *)chk_str); // numerical part of address = scriptpubkey_bech32_str (20) + checksum (6)
+
+    bnz_set_str(p2wpkh, (const char *)p2wpkh_str, 32); // convert p2wpkh_str (numerical part of standard segwit address) into standard bnz_t, will be printed with non-bech32 prefix "bc1q"
+
+    // free resources
+    free(scriptpubkey_bech32_str);
+    bnz_free(&tmp);
+}
+
+uint32_t p2wpkh_checksum_update(uint32_t chk, uint8_t dgt)
+{
+    uint8_t top = (chk >> 25); // top = top 5 bits of current chk, formatted as uint8_t
+    uint32_t btm = (chk & 33554431) << 5; // btm = bottom 25 bits of current chk (from bitwise AND with 0x1ffffff) padded with 5 zeros at lsb end, formatted as uint32_t
+    btm ^= dgt; // xor btm with current digit of witness program, formatted as uint8_t
+    if ((top >> 0) & 1) btm ^= 996825010; // if 1st bit of top is set, xor btm with 1st constant (0x3b6a57b2)
+    if ((top >> 1) & 1) btm ^= 642813549; // if 2nd bit of top is set, xor btm with 2nd constant (0x26508e6d)
+    if ((top >> 2) & 1) btm ^= 513874426; // if 3rd bit of top is set, xor btm with 3rd constant (0x1ea119fa)
+    if ((top >> 3) & 1) btm ^= 1027748829; // if 4th bit of top is set, xor btm with 4th constant (0x3d4233dd)
+    if ((top >> 4) & 1) btm ^= 705979059; // if 5th bit of top is set, xor btm with 5th constant (0x2a1462b3)
+    return btm; // return btm, the new value of chk, formatted as uint32_t
+}
+
+void print_p2wpkh_address(const bnz_t *p2wpkh, const uint8_t *str)
+{
+    uint8_t *full_string = NULL, *p2wpkh_bech32_str = NULL;
+    uint32_t len;
+
+    /*
+    
+    Segwit P2WPKH addresses have a prefix "bc1q" which contains non-Bech32 characters
+    and is concatenated with the numercial part of the address.
+    
+    The numerical part is itself a concatenation of the RIPEMD160-SHA256 double
+    hash of the compressed public key encoded in Bech32, and a 6 character checksum,
+    also formatted in Bech32.
+
+    In bitcoin_math, the numerical part is treated as a number and is stored in
+    a standard bnz_t, and the prefix is only added when the Segwit P2WPKH address is
+    printed to the screen.
+
+    However, RIPEMD160 digests (and their Bech32 encodings) can have zeros at the
+    msb end, causing issues with printing when the numerical part is treated as a
+    number because leading zeros are not printed.
+
+    bitcoin_math therefore incorporates this dedicated print function for Segwit
+    P2WPKH addresses which ensures that, where the numerical part of the address
+    has one or more zeros at the msb end, it is padded with 'q' characters
+    (representing zeros in Bech32) before the prefix is appended. 
+    
+    */
+
+    bnz_t tmp;
+    bnz_init(&tmp);
+    bnz_set_bnz(&tmp, p2wpkh); // tmp = local mutable copy of p2wpkh bnz_t with tmp.digits in standard little endian order 
+    bnz_reverse_digits(&tmp); // convert tmp.digits to big endian order
+
+    full_string = init_uint8_array(strlen(str) + 43); // prepare full_string to receive str + 42 characters + null terminator
+    if (!full_string) {
+        return;
+    }
+
+    p2wpkh_bech32_str = get_base_n_str(&tmp, 32, "qpzry9x8gf2tvdw0s3jn54khce6mua7l", &len); // get bech32 string encoding of p2wpkh_bech32_str in big endian order
+    if (!p2wpkh_bech32_str) {
+        free(full_string);
+        return;
+    }
+
+    sprintf(full_string, "%sbc1qqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq", str); // full_string = str + "bc1q" + 38 x 'q' + null terminator
+    sprintf(full_string + strlen(str) + 42 - len, p2wpkh_bech32_str); // concatenate Bech32 string with appropriate offset to ensure 'q' padding at msb end if required
+
+    printf("%s\n", full_string); // print final string
+
+    free(full_string);
+    free(p2wpkh_bech32_str);
+    bnz_free(&tmp);
+}
+
+void get_wallet_p2pkh_addresses(const SECP256K1 secp256k1, bnz_t *master_private_key, bnz_t *master_chain_code)
+{
+    uint32_t i, p2pkh_leading_zeros;
+
+    bnz_t parent_private_key, parent_chain_code, parent_public_key_compressed, child_private_key, child_chain_code, child_private_keys[20], child_public_keys_compressed[20], p2pkh;
+
+    bnz_init(&parent_private_key);
+    bnz_init(&parent_chain_code);
+    bnz_init(&parent_public_key_compressed);
+    bnz_init(&child_private_key);
+    bnz_init(&child_chain_code);
+    for (i = 0; i < 20; i++) {
+        bnz_init(&child_private_keys[i]);
+        bnz_init(&child_public_keys_compressed[i]);
+    }
+    bnz_init(&p2pkh);
+
+    // m/44'
+    bnz_set_bnz(&parent_private_key, master_private_key);
+    bnz_set_bnz(&parent_chain_code, master_chain_code);
+    get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, 44);
+
+    // m/44'/0'
+    bnz_set_bnz(&parent_private_key, &child_private_key);
+    bnz_set_bnz(&parent_chain_code, &child_chain_code);
+    get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, 0);
+
+    // m/44'/0'/0'
+    bnz_set_bnz(&parent_private_key, &child_private_key);
+    bnz_set_bnz(&parent_chain_code, &child_chain_code);
+    get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, 0);
+
+    // m/44'/0'/0'/0
+    bnz_set_bnz(&parent_private_key, &child_private_key);
+    bnz_set_bnz(&parent_chain_code, &child_chain_code);
+    get_public_key_compressed(secp256k1, &parent_public_key_compressed, &parent_private_key);
+    get_child_normal(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, &parent_public_key_compressed, 0);
+
+    // m/44'/0'/0'/0/0 to m/44'/0'/0'/0/19
+    bnz_set_bnz(&parent_private_key, &child_private_key);
+    bnz_set_bnz(&parent_chain_code, &child_chain_code);
+    get_public_key_compressed(secp256k1, &parent_public_key_compressed, &parent_private_key);
+    for (i = 0; i < 20; i++) {
+        get_child_normal(secp256k1, &child_private_keys[i], &child_chain_code, &parent_private_key, &parent_chain_code, &parent_public_key_compressed, i);
+    }
+    get_public_keys_compressed_batch(secp256k1, child_public_keys_compressed, child_private_keys, 20); // one shared inversion for the 20 public keys
+    for (i = 0; i < 20; i++) {
+        get_p2pkh_address(&p2pkh, &child_public_keys_compressed[i], &p2pkh_leading_zeros);
+        printf("m/44'/0'/0'/0/%d: ", i);
+        print_p2pkh_address(&p2pkh, "", p2pkh_leading_zeros);
+    }
+
+    printf("\n");
+
+    bnz_free(&parent_private_key);
+    bnz_free(&parent_chain_code);
+    bnz_free(&parent_public_key_compressed);
+    bnz_free(&child_private_key);
+    bnz_free(&child_chain_code);
+    for (i = 0; i < 20; i++) {
+        bnz_free(&child_private_keys[i]);
+        bnz_free(&child_public_keys_compressed[i]);
+    }
+    bnz_free(&p2pkh);
+}
+
+void get_wallet_p2sh_p2wpkh_addresses(const SECP256K1 secp256k1, bnz_t *master_private_key, bnz_t *master_chain_code)
+{
+    uint32_t i;
+    
+    bnz_t parent_private_key, parent_chain_code, parent_public_key_compressed, child_private_key, child_chain_code, child_private_keys[20], child_public_keys_compressed[20], p2sh_p2wpkh;
+
+    bnz_init(&parent_private_key);
+    bnz_init(&parent_chain_code);
+    bnz_init(&parent_public_key_compressed);
+    bnz_init(&child_private_key);
+    bnz_init(&child_chain_code);
+    for (i = 0; i < 20; i++) {
+        bnz_init(&child_private_keys[i]);
+        bnz_init(&child_public_keys_compressed[i]);
+    }
+    bnz_init(&p2sh_p2wpkh);
+
+    // m/49'
+    bnz_set_bnz(&parent_private_key, master_private_key);
+    bnz_set_bnz(&parent_chain_code, master_chain_code);
+    get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, 49);
+
+    // m/49'/0'
+    bnz_set_bnz(&parent_private_key, &child_private_key);
+    bnz_set_bnz(&parent_chain_code, &child_chain_code);
+    get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, 0);
+
+    // m/49'/0'/0'
+    bnz_set_bnz(&parent_private_key, &child_private_key);
+    bnz_set_bnz(&parent_chain_code, &child_chain_code);
+    get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, 0);
+
+    // m/49'/0'/0'/0
+    bnz_set_bnz(&parent_private_key, &child_private_key);
+    bnz_set_bnz(&parent_chain_code, &child_chain_code);
+    get_public_key_compressed(secp256k1, &parent_public_key_compressed, &parent_private_key);
+    get_child_normal(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, &parent_public_key_compressed, 0);
+
+    // m/49'/0'/0'/0/0 to m/49'/0'/0'/0/19
+    bnz_set_bnz(&parent_private_key, &child_private_key);
+    bnz_set_bnz(&parent_chain_code, &child_chain_code);
+    get_public_key_compressed(secp256k1, &parent_public_key_compressed, &parent_private_key);
+    for (i = 0; i < 20; i++) {
+        get_child_normal(secp256k1, &child_private_keys[i], &child_chain_code, &parent_private_key, &parent_chain_code, &parent_public_key_compressed, i);
+    }
+    get_public_keys_compressed_batch(secp256k1, child_public_keys_compressed, child_private_keys, 20); // one shared inversion for the 20 public keys
+    for (i = 0; i < 20; i++) {
+        get_p2sh_p2wpkh_address(&p2sh_p2wpkh, &child_public_keys_compressed[i]);
+        printf("m/49'/0'/0'/0/%d: ", i);
+        bnz_print(&p2sh_p2wpkh, 58, "");
+    }
+    printf("\n");
+
+    bnz_free(&parent_private_key);
+    bnz_free(&parent_chain_code);
+    bnz_free(&parent_public_key_compressed);
+    bnz_free(&child_private_key);
+    bnz_free(&child_chain_code);
+    for (i = 0; i < 20; i++) {
+        bnz_free(&child_private_keys[i]);
+        bnz_free(&child_public_keys_compressed[i]);
+    }
+    bnz_free(&p2sh_p2wpkh);
+}
+
+void get_wallet_p2wpkh_addresses(const SECP256K1 secp256k1, bnz_t *master_private_key, bnz_t *master_chain_code)
 {
-    bnz_resize(res, 20, false); // prepare res.digits to receive 20 bytes of hash digest
-    ripemd160(a, strlen((const char *)a), res->digits); // res.digits = ripemd160(a), big endian order
-    bnz_reverse_digits(res); // convert res.digits to standard bnz_t little endian order
+    uint32_t i;
+    
+    bnz_t parent_private_key, parent_chain_code, parent_public_key_compressed, child_private_key, child_chain_code, child_private_keys[20], child_public_keys_compressed[20], p2wpkh;
+
+    bnz_init(&parent_private_key);
+    bnz_init(&parent_chain_code);
+    bnz_init(&parent_public_key_compressed);
+    bnz_init(&child_private_key);
+    bnz_init(&child_chain_code);
+    for (i = 0; i < 20; i++) {
+        bnz_init(&child_private_keys[i]);
+        bnz_init(&child_public_keys_compressed[i]);
+    }
+    bnz_init(&p2wpkh);
+
+    // m/84'
+    bnz_set_bnz(&parent_private_key, master_private_key);
+    bnz_set_bnz(&parent_chain_code, master_chain_code);
+    get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, 84);
+
+    // m/84'/0'
+    bnz_set_bnz(&parent_private_key, &child_private_key);
+    bnz_set_bnz(&parent_chain_code, &child_chain_code);
+    get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, 0);
+
+    // m/84'/0'/0'
+    bnz_set_bnz(&parent_private_key, &child_private_key);
+    bnz_set_bnz(&parent_chain_code, &child_chain_code);
+    get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, 0);
+
+    // m/84'/0'/0'/0
+    bnz_set_bnz(&parent_private_key, &child_private_key);
+    bnz_set_bnz(&parent_chain_code, &child_chain_code);
+    get_public_key_compressed(secp256k1, &parent_public_key_compressed, &parent_private_key);
+    get_child_normal(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, &parent_public_key_compressed, 0);
+
+    // m/84'/0'/0'/0/0 to m/84'/0'/0'/0/19
+    bnz_set_bnz(&parent_private_key, &child_private_key);
+    bnz_set_bnz(&parent_chain_code, &child_chain_code);
+    get_public_key_compressed(secp256k1, &parent_public_key_compressed, &parent_private_key);
+    for (i = 0; i < 20; i++) {
+        get_child_normal(secp256k1, &child_private_keys[i], &child_chain_code, &parent_private_key, &parent_chain_code, &parent_public_key_compressed, i);
+    }
+    get_public_keys_compressed_batch(secp256k1, child_public_keys_compressed, child_private_keys, 20); // one shared inversion for the 20 public keys
+    for (i = 0; i < 20; i++) {
+        get_p2wpkh_address(&p2wpkh, &child_public_keys_compressed[i]);
+        printf("m/84'/0'/0'/0/%d: ", i);
+        print_p2wpkh_address(&p2wpkh, "");
+    }
+    printf("\n");
+
+    bnz_free(&parent_private_key);
+    bnz_free(&parent_chain_code);
+    bnz_free(&parent_public_key_compressed);
+    bnz_free(&child_private_key);
+    bnz_free(&child_chain_code);
+    for (i = 0; i < 20; i++) {
+        bnz_free(&child_private_keys[i]);
+        bnz_free(&child_public_keys_compressed[i]);
+    }
+    bnz_free(&p2wpkh);
 }
 
-void get_sha256(bnz_t *res, const uint8_t *a) // res = sha256(a) as a bnz_t
+/* BITCOIN ECDSA FUNCTIONS */
+
+void secp256k1_ecdsa_get_random_nonce(const SECP256K1 *, sc_t *);
+void secp256k1_ecdsa_get_RFC6979_nonce(const SECP256K1 *, const sc_t *, const u256_t *, sc_t *);
+void secp256k1_ecdsa_get_signature_from_r_s(const bnz_t *, const bnz_t *, bnz_t *);
+void secp256k1_ecdsa_get_r_s_from_signature(const bnz_t *, bnz_t *, bnz_t *);
+void secp256k1_ecdsa_sign(const SECP256K1, const bnz_t *, const bnz_t *, bnz_t *, bnz_t *, uint32_t);
+void secp256k1_ecdsa_sign_u256(const SECP256K1 *, const sc_t *, const u256_t *, sc_t *, sc_t *, uint32_t);
+void secp256k1_ecdsa_sign_u256_batch(const SECP256K1 *, const sc_t *, const u256_t *, sc_t *, sc_t *, size_t, uint32_t);
+bool secp256k1_ecdsa_verify_from_signature(const SECP256K1, const bnz_t *, const bnz_t *, const bnz_t *);
+bool secp256k1_ecdsa_verify_from_r_s(const SECP256K1, const bnz_t *, const bnz_t *, const bnz_t *, const bnz_t *);
+
+void secp256k1_ecdsa_get_random_nonce(const SECP256K1 *secp256k1, sc_t *nonce)
 {
-    bnz_resize(res, 32, false); // prepare res.digits to receive 32 bytes of hash digest
-    sha256(a, (uint64_t)strlen((const char *)a), res->digits); // res.digits = sha256(a), big endian order
-    bnz_reverse_digits(res); // convert res.digits to standard bnz_t little endian order
+    uint8_t bytes[32];
+    uint32_t random;
+    size_t i;
+    u256_t t;
+
+    do {
+        for (i = 0; i < 32; i++) {
+            rand_s(&random); // on non-Windows systems, change this to some other source of cryptographically secure random numbers
+            bytes[i] = random & 255;
+        }
+        u256_set_bytes(&t, bytes);
+    } while (u256_is_zero(&t) == true || u256_cmp(&t, &secp256k1->n_u256) >= 0);
+
+    sc_set_u256(nonce, &t);
 }
 
-void get_sha512(bnz_t *res, const uint8_t *a) // res = sha512(a) as a bnz_t
+void secp256k1_ecdsa_get_RFC6979_nonce(const SECP256K1 *secp256k1, const sc_t *private_key, const u256_t *hash, sc_t *nonce) // RFC6979, no heap allocations
 {
-    bnz_resize(res, 64, false); // prepare res.digits to receive 64 bytes of hash digest
-    sha512(a, (uint64_t)strlen((const char *)a), res->digits); // res.digits = sha512(a), big endian order
-    bnz_reverse_digits(res); // convert res.digits to standard bnz_t little endian order
+    uint8_t k[32], v[32], message[97], private_key_bytes[32], hash_bytes[32];
+    u256_t t;
+    sc_t h;
+
+    // (a) hash = SHA256(m), supplied by the caller, and reduced mod secp256k1.n (bits2octets)
+    sc_set_u256(&h, hash);
+    sc_get_bytes(hash_bytes, &h);
+    sc_get_bytes(private_key_bytes, private_key); // int2octets(private_key)
+
+    // (b) V = 0x1 x 32
+    memset(v, 1, 32);
+
+    // (c) K = 0x0 x 32
+    memset(k, 0, 32);
+
+    // (d) K = HMAC_K(V || 0x00 || private_key || hash)
+    memcpy(message, v, 32);
+    message[32] = 0;
+    memcpy(message + 33, private_key_bytes, 32);
+    memcpy(message + 65, hash_bytes, 32);
+    hmac_sha256(k, 32, message, 97, k, 32);
+
+    // (e) V = HMAC_K(V)
+    hmac_sha256(k, 32, v, 32, v, 32);
+
+    // (f) K = HMAC_K(V || 0x01 || private_key || hash)
+    memcpy(message, v, 32);
+    message[32] = 1;
+    hmac_sha256(k, 32, message, 97, k, 32);
+
+    // (g) V = HMAC_K(V)
+    hmac_sha256(k, 32, v, 32, v, 32);
+
+    // (h) V = HMAC_K(V), nonce = V, until 1 <= nonce < secp256k1.n
+    while (1) {
+        hmac_sha256(k, 32, v, 32, v, 32);
+        u256_set_bytes(&t, v);
+
+        if (u256_is_zero(&t) == false && u256_cmp(&t, &secp256k1->n_u256) == -1) break;
+
+        // K = HMAC_K(V || 0x00), V = HMAC_K(V)
+        memcpy(message, v, 32);
+        message[32] = 0;
+        hmac_sha256(k, 32, message, 33, k, 32);
+        hmac_sha256(k, 32, v, 32, v, 32);
+    }
+
+    sc_set_u256(nonce, &t);
 }
 
-void get_ripemd160_sha256(bnz_t *res, const bnz_t *a, size_t len) // res = first len bytes of ripemd160(sha256(a.digits)) as a bnz_t
+void secp256k1_ecdsa_get_signature_from_r_s(const bnz_t *r, const bnz_t *s, bnz_t *signature) // 0x30 [len(signature)] 0x02 [len(r)] [r] 0x02 [len(s)] [s]
 {
-    uint8_t h1[32], h2[20];
-    bnz_t aa; // aa is a mutable local copy of a 
-    bnz_init(&aa); // initiate aa
-    bnz_set_bnz(&aa, a); // set aa = a, standard little endian order
-    bnz_reverse_digits(&aa); // convert aa.digits to big endian order
-    sha256(aa.digits, aa.size, h1); // h1 = sha256(aa.digits)
-    ripemd160(h1, 32, h2); // h2 = ripemd160(sha256(aa.digits))
-    bnz_resize(res, len, false); // prepare res.digits to receive first len bytes of h2
-    memcpy(res->digits, h2, len); // copy first len bytes of h2 into res.digits, big endian order
-    bnz_reverse_digits(res); // convert res.digits to standard bnz_t little endian order
-    bnz_free(&aa); // free aa resources
+    uint8_t len, r_pad = r->digits[r->size - 1] >= 128, s_pad = s->digits[s->size - 1] >= 128; // if the msb of r or s is set, 0x0 is inserted at its msb end so that it is not read as negative
+
+    len = r->size + r_pad + s->size + s_pad + 4; // len = length of the signature after the first two bytes (was len(r) + len(s) + 6, 2 too many)
+
+    bnz_set_ui32(signature, 48); // signature = 0x30, built from the msb end by appending at the lsb end
+    bnz_concat_append_ui8(signature, len, 1); // concatente total length
+
+    bnz_concat_append_ui8(signature, 2, 1); // concatenate 0x02
+    bnz_concat_append_ui8(signature, r->size + r_pad, 1); // concatenate len(r)
+    if (r_pad) bnz_concat_append_ui8(signature, 0, 1);
+    bnz_concat_append(signature, r, 1); // concatenate r
+
+    bnz_concat_append_ui8(signature, 2, 1); // concatenate 0x02
+    bnz_concat_append_ui8(signature, s->size + s_pad, 1); // concatenate len(s)
+    if (s_pad) bnz_concat_append_ui8(signature, 0, 1);
+    bnz_concat_append(signature, s, 1); // concatenate s
 }
 
-void get_sha256_sha256(bnz_t *res, const bnz_t *a, size_t len) // res = first len bytes of sha256(sha256(a.digits)) as a bnz_t
+void secp256k1_ecdsa_get_r_s_from_signature(const bnz_t *signature, bnz_t *r, bnz_t *s)
 {
-    uint8_t h1[32], h2[32];
-    bnz_t aa; // aa is a mutable local copy of a
-    bnz_init(&aa); // initiate aa
-    bnz_set_bnz(&aa, a); // set aa = a, standard little endian order
-    bnz_reverse_digits(&aa); // convert aa.digits to big endian order
-    sha256(aa.digits, aa.size, h1); // h1 = sha256(aa.digits)
-    sha256(h1, 32, h2); // h2 = sha256(sha256(aa.digits))
-    bnz_resize(res, len, false); // prepare res.digits to receive the first len bytes of h2
-    memcpy(res->digits, h2, len); // copy first len bytes of h2 into res.digits, big endian order
-    bnz_reverse_digits(res); // convert res.digits to standard bnz_t little endian order
-    bnz_free(&aa); // free aa resources
+    const uint8_t *sig = signature->digits + signature->size - 1; // sig[-i] is byte i of the signature in big endian order, read in place
+    size_t i, r_len = sig[-3], s_len = sig[-(long)(r_len + 5)]; // byte 3 = len(r), byte len(r) + 5 = len(s), the sequence length in byte 1 is not read
+
+    bnz_resize(r, r_len, false);
+    for (i = 0; i < r_len; i++) {
+        r->digits[i] = sig[-(long)(3 + r_len - i)]; // r occupies bytes 4 to len(r) + 3, big endian order
+    }
+    bnz_trim(r); // delete any leading zeros from the msb end
+
+    bnz_resize(s, s_len, false);
+    for (i = 0; i < s_len; i++) {
+        s->digits[i] = sig[-(long)(r_len + 5 + s_len - i)]; // s occupies bytes len(r) + 6 to len(r) + len(s) + 5, big endian order
+    }
+    bnz_trim(s); // delete any leading zeros from the msb end
 }
 
-bool is_valid_private_key(const SECP256K1 secp256k1, const bnz_t *a)
+void secp256k1_ecdsa_sign(const SECP256K1 secp256k1, const bnz_t *private_key, const bnz_t *hash, bnz_t *r, bnz_t *s, uint32_t nonce_type) // r = x coordinate of (nonce * Secp256k1.G), s = (hash + (r * private_key)) / nonce
 {
-    if (bnz_cmp_i32(a, 0) == 1 && bnz_cmp_bnz(a, &secp256k1.n) == -1) { // a valid private key is 0 < a < secp256k1.n
-        return true;
+    u256_t h;
+    sc_t key, rr, ss;
+
+    BNZ_STATS_SCOPE(__func__);
+
+    sc_set_bnz(&key, private_key);
+    u256_set_bnz(&h, hash);
+
+    secp256k1_ecdsa_sign_u256(&secp256k1, &key, &h, &rr, &ss, nonce_type);
+
+    sc_get_bnz(r, &rr);
+    sc_get_bnz(s, &ss);
+}
+
+void secp256k1_ecdsa_sign_u256(const SECP256K1 *secp256k1, const sc_t *private_key, const u256_t *hash, sc_t *r, sc_t *s, uint32_t nonce_type) // r = x coordinate of (nonce * Secp256k1.G), s = (hash + (r * private_key)) / nonce, no heap allocations
+{
+    u256_t nonce_u256;
+    sc_t nonce, inv_nonce, h;
+    APT256 tmp; // temporary APT256
+
+    if (nonce_type == 0) {
+        secp256k1_ecdsa_get_RFC6979_nonce(secp256k1, private_key, hash, &nonce); // RFC6979 deterministic nonce
+    } else {
+        secp256k1_ecdsa_get_random_nonce(secp256k1, &nonce); // random nonce
     }
-    return false;
+
+    sc_set_u256(&h, hash); // h = hash mod secp256k1.n
+
+    sc_inv(&inv_nonce, &nonce); // set value of inv_nonce to the modular multiplicative inverse of nonce, modulo secp256k1.n the curve order
+    sc_get_u256(&nonce_u256, &nonce);
+    secp256k1_jacobian_scalar_multiplication_u256(secp256k1, &nonce_u256, &tmp); // tmp = nonce * secp256k1.G (generator point)
+
+    sc_set_u256(r, &tmp.x); // r = x coordinate of tmp mod secp256k1.n
+    sc_mul(s, private_key, r); // s = private_key * r mod secp256k1.n
+    sc_add(s, s, &h); // s = s + hash mod secp256k1.n
+    sc_mul(s, s, &inv_nonce); // s = s * inv_nonce mod secp256k1.n
+    if (sc_is_high(s) == true) sc_negate(s, s); // if s > floor(secp256k1.n / 2) ("high s") negate s i.e. s = secp256k1.n - s to ensure "low s"
 }
 
-void bnz_256_bit_rnd(bnz_t *rnd) // generate pseudo random 256 bit entropy as a bnz_t
+void secp256k1_ecdsa_sign_u256_batch(const SECP256K1 *secp256k1, const sc_t *private_keys, const u256_t *hashes, sc_t *r, sc_t *s, size_t n, uint32_t nonce_type) // sign hashes[i] with private_keys[i] for i < n, as secp256k1_ecdsa_sign_u256 does, but with one sc_batch_inv for the n nonces and one fe_batch_inv for the n nonce points
 {
-    uint32_t random;
     size_t i;
-    bnz_resize(rnd, 32, false);
-    for (i = 0; i < 32; i++) {
-        rand_s(&random); // on non-Windows systems, change this to some other source of cryptographically secure random numbers
-        rnd->digits[i] = random & 255; // rnd->digits[i] = last byte of random
+    sc_t *nonces = NULL, *inv_nonces = NULL, h;
+    u256_t *nonces_u256 = NULL;
+    APT256 *tmp = NULL;
+
+    nonces = (sc_t *)bnz_scratch_alloc(n * (2 * sizeof(sc_t) + sizeof(u256_t) + sizeof(APT256)) / sizeof(uint64_t));
+    if (!nonces) {
+        return;
+    }
+    inv_nonces = nonces + n;
+    nonces_u256 = (u256_t *)(inv_nonces + n);
+    tmp = (APT256 *)(nonces_u256 + n);
+
+    for (i = 0; i < n; i++) {
+        if (nonce_type == 0) {
+            secp256k1_ecdsa_get_RFC6979_nonce(secp256k1, &private_keys[i], &hashes[i], &nonces[i]); // RFC6979 deterministic nonce
+        } else {
+            secp256k1_ecdsa_get_random_nonce(secp256k1, &nonces[i]); // random nonce
+        }
+        sc_get_u256(&nonces_u256[i], &nonces[i]);
+    }
+
+    sc_batch_inv(inv_nonces, nonces, n); // inv_nonces[i] = modular multiplicative inverse of nonces[i], modulo secp256k1.n the curve order
+    secp256k1_jacobian_scalar_multiplication_u256_batch(secp256k1, nonces_u256, tmp, n); // tmp[i] = nonces[i] * secp256k1.G (generator point)
+
+    for (i = 0; i < n; i++) {
+        sc_set_u256(&h, &hashes[i]); // h = hash mod secp256k1.n
+        sc_set_u256(&r[i], &tmp[i].x); // r = x coordinate of tmp mod secp256k1.n
+        sc_mul(&s[i], &private_keys[i], &r[i]); // s = private_key * r mod secp256k1.n
+        sc_add(&s[i], &s[i], &h); // s = s + hash mod secp256k1.n
+        sc_mul(&s[i], &s[i], &inv_nonces[i]); // s = s * inv_nonce mod secp256k1.n
+        if (sc_is_high(&s[i]) == true) sc_negate(&s[i], &s[i]); // ensure "low s"
     }
+
+    bnz_scratch_free((uint64_t *)nonces);
 }
 
-void entropy_checksum(bnz_t *entropy) // append checksum byte to the lsb end of 256 bits of entropy as a bnz_t
+bool secp256k1_ecdsa_verify_from_signature(const SECP256K1 secp256k1, const bnz_t *public_key_compressed, const bnz_t *hash, const bnz_t *signature)
 {
-    uint8_t sha256_digest[32];
-    bnz_t tmp; // tmp = local mutable copy of entropy
-    bnz_init(&tmp); // initiate tmp
+    bool verified;
 
-    bnz_set_bnz(&tmp, entropy); // copy entropy into tmp
-    bnz_resize(&tmp, 32, true); // ensure that tmp is 32 bytes
-    bnz_reverse_digits(&tmp); // convert tmp.digits to big endian order
-    sha256(tmp.digits, tmp.size, sha256_digest); // sha256_digest = sha256[tmp.digits]
+    bnz_t r, s;
 
-    bnz_concatenate_ui8(&tmp, &tmp, sha256_digest[0], 0); // concatenate first byte of sha256_digest the the lsb end of tmp
-    bnz_reverse_digits(&tmp); // convert tmp.digits to standard little endian order
-    
-    bnz_set_bnz(entropy, &tmp); // copy tmp back into entropy
-    bnz_free(&tmp); // free tmp resources
+    bnz_init(&r); // variable to hold r extracted from DER format ECDSA signature
+    bnz_init(&s); // variable to hold s extracted from DER format ECDSA signature
+
+    secp256k1_ecdsa_get_r_s_from_signature(signature, &r, &s); // extract r and s from DER format ECDSA signature
+    verified = secp256k1_ecdsa_verify_from_r_s(secp256k1, public_key_compressed, hash, &r, &s); // verify using r and s
+
+    bnz_free(&r);
+    bnz_free(&s);
+
+    return verified;
 }
 
-void get_bip39_word_ids_bnz(bnz_t *entropy_chk, uint32_t *wd_ids) // convert 33 bytes of entropy + checksum as a bnz_t into 24 numbers of 11 bits
+bool secp256k1_ecdsa_verify_from_r_s(const SECP256K1 secp256k1, const bnz_t *public_key_compressed, const bnz_t *hash, const bnz_t *r, const bnz_t *s)
 {
-    size_t i;
-    bnz_t tmp;
-    bnz_init(&tmp);
+    bool verified;
+    
+    u256_t r_u256, s_u256, h_u256;
+    sc_t sc_r, sc_s, sc_h, inv_s, m1, m2, x;
+    bnz_t m;
+    APT public_key_pt, tmp1, tmp2, verification_pt;
 
-    bnz_set_bnz(&tmp, entropy_chk);
-    bnz_resize(&tmp, 33, true);
-    bnz_reverse_digits(&tmp);
+    if (r->sign == 1 || s->sign == 1 || bnz_is_zero(r) == true || bnz_is_zero(s) == true) return false; // r and s must be in the range [1, secp256k1.n - 1]
+    if (bnz_cmp_bnz(r, &secp256k1.n) >= 0 || bnz_cmp_bnz(s, &secp256k1.n) >= 0) return false;
+    u256_set_bnz(&r_u256, r);
+    u256_set_bnz(&s_u256, s);
+    sc_set_u256(&sc_r, &r_u256);
+    sc_set_u256(&sc_s, &s_u256);
+    u256_set_bnz(&h_u256, hash);
+    sc_set_u256(&sc_h, &h_u256); // hash mod secp256k1.n
 
-    for (i = 0; i < 3; i++) {
-        wd_ids[(i * 8) + 0] = ((((uint32_t)tmp.digits[(i * 11) + 0]) << 3) & 2040) + ((((uint32_t)tmp.digits[(i * 11) + 1]) >> 5) & 7);
-        wd_ids[(i * 8) + 1] = ((((uint32_t)tmp.digits[(i * 11) + 1]) << 6) & 1984) + ((((uint32_t)tmp.digits[(i * 11) + 2]) >> 2) & 63);
-        wd_ids[(i * 8) + 2] = ((((uint32_t)tmp.digits[(i * 11) + 2]) << 9) & 1536) + ((((uint32_t)tmp.digits[(i * 11) + 3]) << 1) & 510) + ((((uint32_t)tmp.digits[(i * 11) + 4]) >> 7) & 1);
-        wd_ids[(i * 8) + 3] = ((((uint32_t)tmp.digits[(i * 11) + 4]) << 4) & 2032) + ((((uint32_t)tmp.digits[(i * 11) + 5]) >> 4) & 15);
-        wd_ids[(i * 8) + 4] = ((((uint32_t)tmp.digits[(i * 11) + 5]) << 7) & 1920) + ((((uint32_t)tmp.digits[(i * 11) + 6]) >> 1) & 127);
-        wd_ids[(i * 8) + 5] = ((((uint32_t)tmp.digits[(i * 11) + 6]) << 10) & 1024) + ((((uint32_t)tmp.digits[(i * 11) + 7]) << 2) & 2044) + ((((uint32_t)tmp.digits[(i * 11) + 8]) >> 6) & 3);
-        wd_ids[(i * 8) + 6] = ((((uint32_t)tmp.digits[(i * 11) + 8]) << 5) & 2016) + ((((uint32_t)tmp.digits[(i * 11) + 9]) >> 3) & 31);
-        wd_ids[(i * 8) + 7] = ((((uint32_t)tmp.digits[(i * 11) + 9]) << 8) & 1792) + ((((uint32_t)tmp.digits[(i * 11) + 10])));
-    }
+    bnz_init(&m);
+    bnz_init(&public_key_pt.x);
+    bnz_init(&public_key_pt.y);
+    bnz_init(&tmp1.x);
+    bnz_init(&tmp1.y);
+    bnz_init(&tmp2.x);
+    bnz_init(&tmp2.y);
+    bnz_init(&verification_pt.x);
+    bnz_init(&verification_pt.y);
+
+    get_public_key_xy(secp256k1, &public_key_pt, public_key_compressed); // extract xy coordinates of original public key Secp256k1 point from compressed public key
+
+    sc_inv(&inv_s, &sc_s); // set value of inv_s to the modular multiplicative inverse of s, modulo secp256k1.n the curve order
+
+    sc_mul(&m1, &inv_s, &sc_h); // m1 = inv_s * hash mod secp256k1.n
+    sc_get_bnz(&m, &m1);
+    secp256k1_scalar_multiplication(secp256k1, &secp256k1.G, &m, &tmp1); // tmp1 = m1 * secp256k1.G mod secp256k1.p
+
+    sc_mul(&m2, &inv_s, &sc_r); // m2 = inv_s * r mod secp256k1.n
+    sc_get_bnz(&m, &m2);
+    secp256k1_scalar_multiplication(secp256k1, &public_key_pt, &m, &tmp2); // tmp2 = m2 * public key point mod secp256k1.p
+
+    secp256k1_point_addition(secp256k1, &tmp1, &tmp2, &verification_pt); // verification_pt = tmp1 + tmp2 mod secp256k1.p
+
+    sc_set_bnz(&x, &verification_pt.x); // x = verification_pt.x mod secp256k1.n
+
+    verified = sc_equal(&x, &sc_r); // if verification_pt.x and r are equal, verification has succeded
+
+    bnz_free(&m); // free resources
+    bnz_free(&public_key_pt.x);
+    bnz_free(&public_key_pt.y);
+    bnz_free(&tmp1.x);
+    bnz_free(&tmp1.y);
+    bnz_free(&tmp2.x);
+    bnz_free(&tmp2.y);
+    bnz_free(&verification_pt.x);
+    bnz_free(&verification_pt.y);
 
-    bnz_free(&tmp);
+    return verified; // return verified
 }
 
-void get_bip39_word_ids_str(bnz_t *entropy_chk, bnz_t *entropy, uint8_t *chk, char *mnemonic_str) // convert 24 words into 32 bytes of entropy + 1 byte of checksum
-{
-    size_t i = 0, j;
-    char sha256_digest[32], *tok = strtok(mnemonic_str, " "); // split mnemonic string into an array of BIP39 words
-    uint32_t wd_ids[24];
-
-    bnz_resize(entropy_chk, 33, false);
+/* BENCHMARK FUNCTIONS */
 
-    while (tok != NULL) { // traverse array
-        for (j = 0; j < 2048; j++) { // search BIP39 list for matches
-            if (!strcmp(tok, bip39_wds[j])) { // match found
-                wd_ids[i++] = j; // record id
-                break; // exit loop as soon as match found
-            }
-        }
-        tok = strtok(NULL, " "); // next array member
-    }
+#define BENCHMARK_KEYS 16 // number of distinct private keys cycled through by the benchmarks
 
-    for (i = 0; i < 3; i++) {
-        entropy_chk->digits[(i * 11) + 0] = (wd_ids[(i * 8) + 0] >> 3) & 255;
-        entropy_chk->digits[(i * 11) + 1] = (((wd_ids[(i * 8) + 0] & 7) << 5) + (wd_ids[(i * 8) + 1] >> 6)) & 255;
-        entropy_chk->digits[(i * 11) + 2] = (((wd_ids[(i * 8) + 1] & 63) << 2) + (wd_ids[(i * 8) + 2] >> 9)) & 255;
-        entropy_chk->digits[(i * 11) + 3] = (wd_ids[(i * 8) + 2] >> 1) & 255;
-        entropy_chk->digits[(i * 11) + 4] = (((wd_ids[(i * 8) + 2] & 1) << 7) + (wd_ids[(i * 8) + 3] >> 4)) & 255;
-        entropy_chk->digits[(i * 11) + 5] = (((wd_ids[(i * 8) + 3] & 15) << 4) + (wd_ids[(i * 8) + 4] >> 7)) & 255;
-        entropy_chk->digits[(i * 11) + 6] = (((wd_ids[(i * 8) + 4] & 127) << 1) + (wd_ids[(i * 8) + 5] >> 10)) & 255;
-        entropy_chk->digits[(i * 11) + 7] = (wd_ids[(i * 8) + 5] >> 2) & 255;
-        entropy_chk->digits[(i * 11) + 8] = (((wd_ids[(i * 8) + 5] & 3) << 6) + (wd_ids[(i * 8) + 6] >> 5)) & 255;
-        entropy_chk->digits[(i * 11) + 9] = (((wd_ids[(i * 8) + 6] & 31) << 3) + (wd_ids[(i * 8) + 7] >> 8)) & 255;
-        entropy_chk->digits[(i * 11) + 10] = wd_ids[(i * 8) + 7] & 255;
-    }
+uint64_t benchmark_heap_allocs_start = 0; // value of bnz_heap_allocs when benchmark_start was last called
+uint64_t benchmark_bytes_copied_start = 0; // value of bnz_bytes_copied when benchmark_start was last called
 
-    bnz_set_bnz(entropy, entropy_chk); // copy 33 bytes of entropy_chk into entropy
-    bnz_resize(entropy, 32, true); // resize entropy to 32 bytes of entropy
-    sha256(entropy->digits, 32, sha256_digest); // get SHA256 hash digest of entropy->digits
-    *chk = sha256_digest[0]; // set chk to first byte of SHA256 hash digest
-    bnz_reverse_digits(entropy); // convert to little
-    bnz_reverse_digits(entropy_chk); // endian order
-}
+void get_benchmark_private_key(bnz_t *, uint32_t);
+clock_t benchmark_start(void);
+void print_benchmark_result(const char *, uint32_t, clock_t);
+void benchmark_jacobian_scalar_multiplication(const SECP256K1, uint32_t);
+void benchmark_reduce_p(const SECP256K1, uint32_t);
+void benchmark_sc_mul(const SECP256K1, uint32_t);
+void benchmark_mod_ctx(const SECP256K1, uint32_t);
+void benchmark_multiplication(uint32_t);
+void benchmark_public_key_xy(const SECP256K1, uint32_t);
+void benchmark_bnz_signature(const SECP256K1, bnz_t *, const bnz_t *, const bnz_t *, const bnz_t *, const bnz_t *);
+void benchmark_arena(const SECP256K1, uint32_t);
+void benchmark_derived_address(const SECP256K1, uint32_t);
+void benchmark_word_operations(uint32_t);
+void benchmark_inverse(const SECP256K1, uint32_t);
+void benchmark_batch_inverse(const SECP256K1, uint32_t);
+void get_benchmark_number(bnz_t *, uint32_t, uint32_t);
+void benchmark_mod_pow(uint32_t);
+void benchmark_lehmer_inverse(uint32_t);
+void benchmark_radix_conversion(uint32_t);
+void benchmark_radix_divide_and_conquer(uint32_t);
+void benchmark_radix_power_of_two(uint32_t);
+void benchmark_ntt_multiplication(uint32_t);
+void benchmark_mul_4x4(const SECP256K1, uint32_t);
+void benchmark_fe4(const SECP256K1, uint32_t);
+void benchmark_bnz_stats(const SECP256K1, uint32_t);
 
-uint8_t *get_mnemonic_phrase(uint32_t *wd_ids) // generate mnemonic string of 24 words
+void get_benchmark_private_key(bnz_t *private_key, uint32_t i) // deterministic benchmark private key, private_key = sha256(i), where i is formatted as 4 bytes
 {
-    uint8_t *mnemonic_str = NULL;
-    int i, len = 0;
+    uint8_t msg[4];
 
-    for (i = 0; i < 24; i++) {
-        len += strlen(bip39_wds[wd_ids[i]]);
-    }
+    msg[0] = (i >> 24) & 255;
+    msg[1] = (i >> 16) & 255;
+    msg[2] = (i >> 8) & 255;
+    msg[3] = i & 255;
 
-    mnemonic_str = init_uint8_array(len + 24 /* 23 chars for the spaces between the individual mnemonic words + one char for the null terminator */);
-    if (!mnemonic_str) {
-        return NULL;
-    }
+    bnz_resize(private_key, 32, false); // prepare private_key to receive 32 bytes of hash digest
+    sha256(msg, 4, private_key->digits); // private_key.digits = sha256(i), big endian order
+    bnz_reverse_digits(private_key); // convert private_key.digits to standard little endian order
+}
 
-    for (i = 0; i < 23; i++) {
-        sprintf(mnemonic_str + strlen(mnemonic_str), "%s ", bip39_wds[wd_ids[i]]);
-    }
+clock_t benchmark_start(void) // record bnz_heap_allocs and bnz_bytes_copied and return the processor time at the start of a timed loop
+{
+    benchmark_heap_allocs_start = bnz_heap_allocs;
+    benchmark_bytes_copied_start = bnz_bytes_copied;
 
-    sprintf(mnemonic_str + strlen(mnemonic_str), "%s", bip39_wds[wd_ids[23]]);
+    return clock();
+}
 
-    return(mnemonic_str);
+void print_benchmark_result(const char *label, uint32_t iterations, clock_t start) // print elapsed processor time since start, in total, per iteration, and as iterations per second, and the heap allocations made and bnz_t digit bytes copied since benchmark_start
+{
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    uint64_t allocs = bnz_heap_allocs - benchmark_heap_allocs_start;
+
+    printf("%s\n", label);
+    printf("    iterations: %u\n", iterations);
+    printf("    total: %.3f s\n", seconds);
+    printf("    per iteration: %.3f us\n", 1000000.0 * seconds / iterations);
+    if (seconds > 0) printf("    per second: %.1f\n", iterations / seconds);
+    printf("    heap allocations: %llu before, %llu after, %.1f per iteration\n", (unsigned long long)benchmark_heap_allocs_start, (unsigned long long)bnz_heap_allocs, (double)allocs / iterations);
+    printf("    bytes copied: %.1f per iteration\n", (double)(bnz_bytes_copied - benchmark_bytes_copied_start) / iterations);
 }
 
-uint8_t *get_salt(const char *passphrase) // generate salt string from passphrase
+void benchmark_jacobian_scalar_multiplication(const SECP256K1 secp256k1, uint32_t iterations) // time secp256k1_jacobian_scalar_multiplication, cycling through BENCHMARK_KEYS deterministic private keys
 {
-    uint8_t *salt = NULL;
+    uint32_t i;
+    clock_t start;
+    bnz_t private_keys[BENCHMARK_KEYS];
+    APT public_key;
 
-    salt = init_uint8_array(strlen("mnemonic") + strlen(passphrase) + sizeof(uint32_t)); // initiate salt to hold "mnemonic" concatenated with passphrase and 4 bytes of uint32_t
-    if (!salt) {
-        return NULL;
+    bnz_init(&public_key.x);
+    bnz_init(&public_key.y);
+
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        bnz_init(&private_keys[i]);
+        get_benchmark_private_key(&private_keys[i], i);
     }
 
-    sprintf((char *)salt, "mnemonic%s", passphrase); // set salt = "mnemonic" concatenated with passphrase
-    salt[strlen("mnemonic") + strlen(passphrase) + sizeof(uint32_t) - 1] = 1; // set the value of the last byte of salt to 1
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        secp256k1_jacobian_scalar_multiplication(secp256k1, &private_keys[i % BENCHMARK_KEYS], &public_key);
+    }
+    print_benchmark_result("secp256k1_jacobian_scalar_multiplication", iterations, start);
 
-    return salt;
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        bnz_free(&private_keys[i]);
+    }
+    bnz_free(&public_key.x);
+    bnz_free(&public_key.y);
 }
 
-void get_seed_from_mnemonic_phrase(bnz_t *seed, const char *mnemonic, const char *passphrase) // generate 64 byte seed from mnemonic string and optional passphrase
+void benchmark_reduce_p(const SECP256K1 secp256k1, uint32_t iterations) // time secp256k1_reduce_p against bnz_mod_bnz with modulus secp256k1.p, on 512 bit products of the deterministic private keys
 {
-    uint8_t tmp[64], *salt = NULL;
-    size_t i, j;
+    uint32_t i;
+    uint64_t check = 0;
+    clock_t start;
+    bool match = true;
+    u256_t keys[BENCHMARK_KEYS], res;
+    u512_t products[BENCHMARK_KEYS];
+    bnz_t key, products_bnz[BENCHMARK_KEYS], res_bnz;
 
-    bnz_resize(seed, 64, false); // ensure that seed is 64 bytes
+    bnz_init(&key);
+    bnz_init(&res_bnz);
 
-    salt = get_salt(passphrase); // salt = "mnemonic" concatenated with passphrase and the value 1 formatted as a uint32_t, strlen(salt) = strlen("mnemonic") + strlen(passphrase) + sizeof(uint32_t)
-    if (!salt) {
-        return;
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        get_benchmark_private_key(&key, i);
+        u256_set_bnz(&keys[i], &key);
+    }
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        u256_mul(&products[i], &keys[i], &keys[(i + 1) % BENCHMARK_KEYS]);
+        bnz_init(&products_bnz[i]);
+        bnz_set_limbs(&products_bnz[i], products[i].d, 8);
     }
 
-    hmac_sha512(mnemonic, strlen(mnemonic), salt, strlen("mnemonic") + strlen(passphrase) + sizeof(uint32_t), tmp, 64); // tmp = first hmac(mnemonic, salt)
-    memcpy(seed->digits, tmp, 64); // set seed = result of first hmac process
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        secp256k1_reduce_p(&res, &products[i % BENCHMARK_KEYS]);
+        check ^= res.d[0];
+    }
+    print_benchmark_result("secp256k1_reduce_p", iterations, start);
 
-    for (i = 1; i < 2048; i++) { // repeat 2048 times
-        hmac_sha512(mnemonic, strlen(mnemonic), tmp, 64, tmp, 64);  // tmp = hmac(mnemonic, tmp)
-        for (j = 0; j < 64; j++) {
-            seed->digits[j] = tmp[j] ^ seed->digits[j]; // xor each byte of current seed.digits with corresponding byte of current tmp
-        }
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        bnz_mod_bnz(&res_bnz, &products_bnz[i % BENCHMARK_KEYS], &secp256k1.p);
+        check ^= res_bnz.digits[0];
     }
+    print_benchmark_result("bnz_mod_bnz(..., &secp256k1.p)", iterations, start);
 
-    bnz_reverse_digits(seed); // convert seed.digits to standard little endian order
+    for (i = 0; i < BENCHMARK_KEYS; i++) { // confirm that both paths agree
+        secp256k1_reduce_p(&res, &products[i]);
+        bnz_mod_bnz(&res_bnz, &products_bnz[i], &secp256k1.p);
+        bnz_get_limbs(keys[i].d, 4, &res_bnz);
+        if (u256_cmp(&res, &keys[i]) != 0) match = false;
+    }
+    printf("results %s (check %llu)\n", match == true ? "match" : "DO NOT MATCH", (unsigned long long)(check & 255));
 
-    free(salt); // free resources
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        bnz_free(&products_bnz[i]);
+    }
+    bnz_free(&key);
+    bnz_free(&res_bnz);
 }
 
-void get_master_keys(bnz_t *master_private_key, bnz_t *master_chain_code, const bnz_t *seed) // generate 32 byte master private key and 32 byte master chain_code
+void benchmark_sc_mul(const SECP256K1 secp256k1, uint32_t iterations) // time sc_mul against u256_mul_mod with modulus secp256k1.n, on the deterministic private keys
 {
-    uint8_t mac[64];
+    uint32_t i;
+    uint64_t check = 0;
+    clock_t start;
+    bool match = true;
+    u256_t keys[BENCHMARK_KEYS], res, ref;
+    sc_t scalars[BENCHMARK_KEYS], sc_res;
+    bnz_t key;
 
-    bnz_t tmp;
-    bnz_init(&tmp);
+    bnz_init(&key);
 
-    bnz_set_bnz(&tmp, seed); // copy seed to tmp
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        get_benchmark_private_key(&key, i);
+        sc_set_bnz(&scalars[i], &key);
+        sc_get_u256(&keys[i], &scalars[i]);
+    }
 
-    bnz_resize(&tmp, 64, true); // ensure that tmp is 64 bytes
-    bnz_reverse_digits(&tmp); // convert tmp.digits to big endian order
-    hmac_sha512("Bitcoin seed", 12, tmp.digits, tmp.size, mac, 64); // generate 64 byte MAC from tmp.digits and the initial key "Bitcoin seed"
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        sc_mul(&sc_res, &scalars[i % BENCHMARK_KEYS], &scalars[(i + 1) % BENCHMARK_KEYS]);
+        check ^= sc_res.d[0];
+    }
+    print_benchmark_result("sc_mul", iterations, start);
 
-    bnz_resize(master_private_key, 32, false); // prepare master_private_key to receive the first 32 bytes of the MAC
-    memcpy(master_private_key->digits, mac, 32); // copy the first 32 bytes of the MAC into master_private_key
-    bnz_reverse_digits(master_private_key); // convert master_private_key.digits to default little endian order
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        u256_mul_mod(&res, &keys[i % BENCHMARK_KEYS], &keys[(i + 1) % BENCHMARK_KEYS], &secp256k1.n_u256);
+        check ^= res.d[0];
+    }
+    print_benchmark_result("u256_mul_mod(..., &secp256k1.n_u256)", iterations, start);
 
-    bnz_resize(master_chain_code, 32, false); // prepare master_chain_code to receive the last 32 bytes of the MAC
-    memcpy(master_chain_code->digits, mac + 32, 32); // copy the last 32 bytes of the MAC into master_chain_code
-    bnz_reverse_digits(master_chain_code); // convert master_chain_code.digits to default little endian order
+    for (i = 0; i < BENCHMARK_KEYS; i++) { // confirm that both paths agree
+        sc_mul(&sc_res, &scalars[i], &scalars[(i + 1) % BENCHMARK_KEYS]);
+        sc_get_u256(&res, &sc_res);
+        u256_mul_mod(&ref, &keys[i], &keys[(i + 1) % BENCHMARK_KEYS], &secp256k1.n_u256);
+        if (u256_cmp(&res, &ref) != 0) match = false;
+    }
+    printf("results %s (check %llu)\n", match == true ? "match" : "DO NOT MATCH", (unsigned long long)(check & 255));
 
-    bnz_free(&tmp);
+    bnz_free(&key);
 }
 
-void get_child_normal(const SECP256K1 secp256k1, bnz_t *child_private_key, bnz_t *child_chain_code, const bnz_t *parent_private_key, const bnz_t *parent_chain_code, const bnz_t *parent_public_key_compressed, uint32_t index_num)
+void benchmark_mod_ctx(const SECP256K1 secp256k1, uint32_t iterations) // time bnz_mulmod_ctx against bnz_multiply_bnz and bnz_mod_bnz, and bnz_mod_pow_ctx with an odd (Montgomery) and an even (Barrett) modulus, on the deterministic private keys
 {
-    uint8_t mac[64];
-    bnz_t index, tmp1, tmp2;
-
-    bnz_init(&index);
-    bnz_init(&tmp1);
-    bnz_init(&tmp2);
-
-    bnz_set_ui32(&index, index_num);
-    bnz_set_bnz(&tmp1, parent_chain_code);
-    bnz_set_bnz(&tmp2, parent_public_key_compressed);
+    uint32_t i;
+    uint64_t check = 0;
+    clock_t start;
+    bool match = true;
+    bnz_t keys[BENCHMARK_KEYS], res, ref, exponent, even_modulus;
+    bnz_mod_ctx ctx_p, ctx_even;
+
+    bnz_init(&res);
+    bnz_init(&ref);
+    bnz_init(&exponent);
+    bnz_init(&even_modulus);
+
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        bnz_init(&keys[i]);
+        get_benchmark_private_key(&keys[i], i);
+    }
+    bnz_add_i32(&exponent, &secp256k1.p, -2); // a^(p - 2) mod p is the modular multiplicative inverse of a
+    bnz_multiply_i32(&even_modulus, &secp256k1.p, 2);
+    bnz_mod_ctx_init(&ctx_p, &secp256k1.p);
+    bnz_mod_ctx_init(&ctx_even, &even_modulus);
+
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        bnz_mulmod_ctx(&res, &keys[i % BENCHMARK_KEYS], &keys[(i + 1) % BENCHMARK_KEYS], &ctx_p);
+        check ^= res.digits[0];
+    }
+    print_benchmark_result("bnz_mulmod_ctx(..., secp256k1.p)", iterations, start);
+
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        bnz_multiply_bnz(&res, &keys[i % BENCHMARK_KEYS], &keys[(i + 1) % BENCHMARK_KEYS]);
+        bnz_mod_bnz(&res, &res, &secp256k1.p);
+        check ^= res.digits[0];
+    }
+    print_benchmark_result("bnz_multiply_bnz and bnz_mod_bnz(..., &secp256k1.p)", iterations, start);
+
+    iterations = iterations / 256 + 1; // one exponentiation is roughly 256 squarings and 128 multiplications
+
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        bnz_mod_pow_ctx(&res, &keys[i % BENCHMARK_KEYS], &exponent, &ctx_p);
+        check ^= res.digits[0];
+    }
+    print_benchmark_result("bnz_mod_pow_ctx(..., secp256k1.p - 2, secp256k1.p), Montgomery", iterations, start);
+
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        bnz_mod_pow_ctx(&res, &keys[i % BENCHMARK_KEYS], &exponent, &ctx_even);
+        check ^= res.digits[0];
+    }
+    print_benchmark_result("bnz_mod_pow_ctx(..., secp256k1.p - 2, 2 * secp256k1.p), Barrett", iterations, start);
+
+    for (i = 0; i < BENCHMARK_KEYS; i++) { // confirm that the paths agree, and that a^(p - 2) is the inverse of a
+        bnz_mulmod_ctx(&res, &keys[i], &keys[(i + 1) % BENCHMARK_KEYS], &ctx_p);
+        bnz_multiply_bnz(&ref, &keys[i], &keys[(i + 1) % BENCHMARK_KEYS]);
+        bnz_mod_bnz(&ref, &ref, &secp256k1.p);
+        if (bnz_cmp_bnz(&res, &ref) != 0) match = false;
+        bnz_mod_pow_ctx(&res, &keys[i], &exponent, &ctx_p);
+        bnz_mulmod_ctx(&res, &res, &keys[i], &ctx_p);
+        if (bnz_cmp_i32(&res, 1) != 0) match = false;
+        bnz_mod_pow_ctx(&res, &keys[i], &exponent, &ctx_even);
+        bnz_mod_bnz_ctx(&res, &res, &ctx_p);
+        bnz_mod_pow_ctx(&ref, &keys[i], &exponent, &ctx_p);
+        if (bnz_cmp_bnz(&res, &ref) != 0) match = false;
+    }
+    printf("results %s (check %llu)\n", match == true ? "match" : "DO NOT MATCH", (unsigned long long)(check & 255));
+
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        bnz_free(&keys[i]);
+    }
+    bnz_mod_ctx_free(&ctx_p);
+    bnz_mod_ctx_free(&ctx_even);
+    bnz_free(&res);
+    bnz_free(&ref);
+    bnz_free(&exponent);
+    bnz_free(&even_modulus);
+}
+
+void benchmark_multiplication(uint32_t iterations) // time schoolbook, Karatsuba, Toom-3 and mul_fast_uint64_arr multiplication of balanced operands from 256 bits to 65536 bits, iterations is scaled down by the square of the number of limbs
+{
+    uint64_t *a = NULL, *b = NULL, *res = NULL, *ref = NULL, *ws = NULL, x = 0x243F6A8885A308D3ULL;
+    size_t n, i, max_n = 1024;
+    uint32_t j, reps;
+    clock_t start;
+    double us[4];
+    bool match = true;
+
+    a = init_uint64_array(max_n);
+    b = init_uint64_array(max_n);
+    res = init_uint64_array(2 * max_n);
+    ref = init_uint64_array(2 * max_n);
+    ws = init_uint64_array(MUL_WS_LIMBS(max_n));
+    if (!a || !b || !res || !ref || !ws) {
+        free(a);
+        free(b);
+        free(res);
+        free(ref);
+        free(ws);
+        return;
+    }
 
-    bnz_resize(&index, 4, true);
-    bnz_resize(&tmp1, 32, true);
-    bnz_resize(&tmp2, 33, true);
+    for (i = 0; i < max_n; i++) { // deterministic operands, 64 bit linear congruential generator
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        a[i] = x;
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        b[i] = x;
+    }
 
-    bnz_concatenate_bnz(&tmp2, &tmp2, &index, 1);
+    printf("thresholds: Karatsuba %d limbs, Toom-3 %d limbs, NTT %d limbs\n\n", KARATSUBA_THRESHOLD, TOOM3_THRESHOLD, NTT_THRESHOLD);
+    printf("%8s %8s %14s %14s %14s %14s\n", "bits", "reps", "schoolbook us", "Karatsuba us", "Toom-3 us", "fast us");
 
-    bnz_reverse_digits(&tmp1);
-    bnz_reverse_digits(&tmp2);
+    for (n = 4; n <= max_n; n *= 2) {
+        reps = (uint32_t)(iterations / (n * n)) + 1;
 
-    hmac_sha512(tmp1.digits, tmp1.size, tmp2.digits, tmp2.size, mac, 64);
+        start = benchmark_start();
+        for (j = 0; j < reps; j++) mul_uint64_arr(ref, a, n, b, n);
+        us[0] = 1000000.0 * (clock() - start) / CLOCKS_PER_SEC / reps;
 
-    bnz_resize(child_private_key, 32, false);
-    bnz_resize(child_chain_code, 32, false);
+        start = benchmark_start();
+        for (j = 0; j < reps; j++) mul_karatsuba_uint64_arr(res, a, b, n, ws); // one level of Karatsuba, the halves use mul_balanced_uint64_arr
+        us[1] = 1000000.0 * (clock() - start) / CLOCKS_PER_SEC / reps;
+        if (memcmp(res, ref, 2 * n * sizeof(uint64_t)) != 0) match = false;
 
-    memcpy(child_private_key->digits, mac, 32);
-    memcpy(child_chain_code->digits, mac + 32, 32);
+        start = benchmark_start();
+        for (j = 0; j < reps; j++) mul_toom3_uint64_arr(res, a, b, n, ws); // one level of Toom-3, the thirds use mul_balanced_uint64_arr
+        us[2] = 1000000.0 * (clock() - start) / CLOCKS_PER_SEC / reps;
+        if (memcmp(res, ref, 2 * n * sizeof(uint64_t)) != 0) match = false;
 
-    bnz_reverse_digits(child_private_key);
-    bnz_add_bnz(child_private_key, child_private_key, parent_private_key);
-    bnz_mod_bnz(child_private_key, child_private_key, &secp256k1.n);
+        start = benchmark_start();
+        for (j = 0; j < reps; j++) mul_fast_uint64_arr(res, a, n, b, n);
+        us[3] = 1000000.0 * (clock() - start) / CLOCKS_PER_SEC / reps;
+        if (memcmp(res, ref, 2 * n * sizeof(uint64_t)) != 0) match = false;
 
-    bnz_reverse_digits(child_chain_code);
+        printf("%8zu %8u %14.3f %14.3f %14.3f %14.3f\n", 64 * n, reps, us[0], us[1], us[2], us[3]);
+    }
+    printf("\nresults %s\n", match == true ? "match" : "DO NOT MATCH");
 
-    bnz_free(&index);
-    bnz_free(&tmp1);
-    bnz_free(&tmp2);
+    free(a);
+    free(b);
+    free(res);
+    free(ref);
+    free(ws);
 }
 
-void get_child_hardened(const SECP256K1 secp256k1, bnz_t *child_private_key, bnz_t *child_chain_code, const bnz_t *parent_private_key, const bnz_t *parent_chain_code, uint32_t index_num)
+void benchmark_public_key_xy(const SECP256K1 secp256k1, uint32_t iterations) // time get_public_key_xy, decompressing the public keys of the deterministic private keys, and fe_sqrt against fe_pow with (secp256k1.p + 1) / 4
 {
-    uint8_t mac[64];
-    bnz_t index, tmp1, tmp2;
+    uint32_t i;
+    uint64_t check = 0;
+    clock_t start;
+    bool match = true;
+    bnz_t private_key, public_keys_compressed[BENCHMARK_KEYS];
+    APT public_key, ref;
+    fe_t fe_keys[BENCHMARK_KEYS], fe_res, fe_ref;
 
-    bnz_init(&index);
-    bnz_init(&tmp1);
-    bnz_init(&tmp2);
+    bnz_init(&private_key);
+    bnz_init(&public_key.x);
+    bnz_init(&public_key.y);
+    bnz_init(&ref.x);
+    bnz_init(&ref.y);
 
-    bnz_set_ui32(&index, index_num < 2147483648 ? 2147483648 + index_num : index_num);
-    bnz_set_bnz(&tmp1, parent_chain_code);
-    bnz_set_bnz(&tmp2, parent_private_key);
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        bnz_init(&public_keys_compressed[i]);
+        get_benchmark_private_key(&private_key, i);
+        get_public_key_compressed(secp256k1, &public_keys_compressed[i], &private_key);
+        fe_set_bnz(&fe_keys[i], &private_key);
+    }
 
-    bnz_resize(&index, 4, true);
-    bnz_resize(&tmp1, 32, true);
-    bnz_resize(&tmp2, 32, true);
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        get_public_key_xy(secp256k1, &public_key, &public_keys_compressed[i % BENCHMARK_KEYS]);
+    }
+    print_benchmark_result("get_public_key_xy", iterations, start);
 
-    bnz_concatenate_ui8(&tmp2, &tmp2, 0, 0);
-    bnz_concatenate_bnz(&tmp2, &tmp2, &index, 1);
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        fe_sqrt(&fe_res, &fe_keys[i % BENCHMARK_KEYS]);
+        check ^= fe_res.n[0];
+    }
+    print_benchmark_result("fe_sqrt, addition chain", iterations, start);
 
-    bnz_reverse_digits(&tmp1);
-    bnz_reverse_digits(&tmp2);
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        fe_pow(&fe_res, &fe_keys[i % BENCHMARK_KEYS], &fe_p_plus_1_div_4);
+        check ^= fe_res.n[0];
+    }
+    print_benchmark_result("fe_pow(..., (secp256k1.p + 1) / 4), square and multiply", iterations, start);
 
-    hmac_sha512(tmp1.digits, tmp1.size, tmp2.digits, tmp2.size, mac, 64);
+    for (i = 0; i < BENCHMARK_KEYS; i++) { // confirm that the decompressed points match the scalar multiplication
+        get_benchmark_private_key(&private_key, i);
+        secp256k1_jacobian_scalar_multiplication(secp256k1, &private_key, &ref);
+        get_public_key_xy(secp256k1, &public_key, &public_keys_compressed[i]);
+        if (bnz_cmp_bnz(&public_key.x, &ref.x) != 0 || bnz_cmp_bnz(&public_key.y, &ref.y) != 0) match = false;
+        fe_sqrt(&fe_res, &fe_keys[i]);
+        fe_pow(&fe_ref, &fe_keys[i], &fe_p_plus_1_div_4);
+        if (fe_equal(&fe_res, &fe_ref) == false) match = false;
+    }
+    printf("results %s (check %llu)\n", match == true ? "match" : "DO NOT MATCH", (unsigned long long)(check & 255));
 
-    bnz_resize(child_private_key, 32, false);
-    bnz_resize(child_chain_code, 32, false);
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        bnz_free(&public_keys_compressed[i]);
+    }
+    bnz_free(&private_key);
+    bnz_free(&public_key.x);
+    bnz_free(&public_key.y);
+    bnz_free(&ref.x);
+    bnz_free(&ref.y);
+}
 
-    memcpy(child_private_key->digits, mac, 32);
-    memcpy(child_chain_code->digits, mac + 32, 32);
+void benchmark_bnz_signature(const SECP256K1 secp256k1, bnz_t *s, const bnz_t *private_key, const bnz_t *nonce, const bnz_t *r, const bnz_t *hash) // s = (hash + r * private_key) / nonce mod secp256k1.n with "low s", using bnz_t arithmetic throughout, inside a scope of the selected arena
+{
+    size_t mark = bnz_arena_mark(bnz_scratch_arena); // everything drawn from the arena by the signature is released at once below
+    bnz_t t, inv_nonce;
 
-    bnz_reverse_digits(child_private_key);
-    bnz_add_bnz(child_private_key, child_private_key, parent_private_key);
-    bnz_mod_bnz(child_private_key, child_private_key, &secp256k1.n);
+    bnz_init(&t);
+    bnz_init(&inv_nonce);
+
+    bnz_multiply_bnz(&t, r, private_key);
+    bnz_add_assign(&t, hash);
+    bnz_mod_bnz(&t, &t, &secp256k1.n); // t = hash + r * private_key mod secp256k1.n
+    bnz_modular_multiplicative_inverse(&inv_nonce, nonce, &secp256k1.n); // inv_nonce = 1 / nonce mod secp256k1.n
+    bnz_mul_to(&t, &inv_nonce);
+    bnz_mod_bnz(s, &t, &secp256k1.n);
+    bnz_set_bnz(&t, &secp256k1.n);
+    bnz_sub_assign(&t, s);
+    if (bnz_cmp_bnz(&t, s) < 0) bnz_set_bnz(s, &t); // if secp256k1.n - s < s, s is "high", so replace it with secp256k1.n - s
 
-    bnz_reverse_digits(child_chain_code);
+    bnz_free(&t);
+    bnz_free(&inv_nonce);
 
-    bnz_free(&index);
-    bnz_free(&tmp1);
-    bnz_free(&tmp2);
+    bnz_arena_reset(bnz_scratch_arena, mark);
 }
 
-void get_hdk_intermediate_values(const SECP256K1 secp256k1, const bnz_t *master_private_key, const bnz_t *master_chain_code, char *hdk_str)
+void benchmark_arena(const SECP256K1 secp256k1, uint32_t iterations) // time the bnz_t signature arithmetic of benchmark_bnz_signature with temporaries drawn from the heap, then from an arena
 {
-    char *tok = strtok(hdk_str, "/"), display_str[32]; // split str into an array of indicies
-    uint32_t index, depth = 0;
+    uint32_t i;
+    clock_t start;
+    bool match = true;
+    u256_t h;
+    sc_t key, nonce;
+    bnz_arena_t arena, *prev_arena;
+    bnz_t hash, res, private_keys[BENCHMARK_KEYS], nonces[BENCHMARK_KEYS], r[BENCHMARK_KEYS], s[BENCHMARK_KEYS];
+
+    bnz_init(&hash);
+    bnz_init(&res);
+
+    get_benchmark_private_key(&hash, BENCHMARK_KEYS); // a fixed 32 byte message hash
+    u256_set_bnz(&h, &hash);
+
+    for (i = 0; i < BENCHMARK_KEYS; i++) { // reference signatures and their RFC6979 nonces
+        bnz_init(&private_keys[i]);
+        bnz_init(&nonces[i]);
+        bnz_init(&r[i]);
+        bnz_init(&s[i]);
+        get_benchmark_private_key(&private_keys[i], i);
+        secp256k1_ecdsa_sign(secp256k1, &private_keys[i], &hash, &r[i], &s[i], 0);
+        sc_set_bnz(&key, &private_keys[i]);
+        secp256k1_ecdsa_get_RFC6979_nonce(&secp256k1, &key, &h, &nonce);
+        sc_get_bnz(&nonces[i], &nonce);
+    }
+
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        benchmark_bnz_signature(secp256k1, &res, &private_keys[i % BENCHMARK_KEYS], &nonces[i % BENCHMARK_KEYS], &r[i % BENCHMARK_KEYS], &hash);
+        if (bnz_cmp_bnz(&res, &s[i % BENCHMARK_KEYS]) != 0) match = false;
+    }
+    print_benchmark_result("bnz_t signature arithmetic, heap", iterations, start);
+
+    if (bnz_arena_init(&arena, BNZ_ARENA_BYTES) == false) {
+        printf("arena allocation failed\n");
+    } else {
+        prev_arena = bnz_arena_select(&arena);
+        start = benchmark_start();
+        for (i = 0; i < iterations; i++) {
+            benchmark_bnz_signature(secp256k1, &res, &private_keys[i % BENCHMARK_KEYS], &nonces[i % BENCHMARK_KEYS], &r[i % BENCHMARK_KEYS], &hash);
+            if (bnz_cmp_bnz(&res, &s[i % BENCHMARK_KEYS]) != 0) match = false;
+        }
+        print_benchmark_result("bnz_t signature arithmetic, arena", iterations, start);
+        bnz_arena_select(prev_arena);
+        printf("    arena allocations: %llu, fallbacks to heap: %llu, peak: %zu of %zu bytes\n", (unsigned long long)arena.allocs, (unsigned long long)arena.fallbacks, arena.peak, arena.capacity);
+        bnz_arena_free(&arena);
+    }
 
-    bnz_t parent_private_key, parent_chain_code, parent_public_key_compressed, child_private_key, child_chain_code, child_public_key_compressed;
+    printf("results %s secp256k1_ecdsa_sign\n", match == true ? "match" : "DO NOT MATCH");
+
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        bnz_free(&private_keys[i]);
+        bnz_free(&nonces[i]);
+        bnz_free(&r[i]);
+        bnz_free(&s[i]);
+    }
+    bnz_free(&hash);
+    bnz_free(&res);
+}
+
+void benchmark_derived_address(const SECP256K1 secp256k1, uint32_t iterations) // time the bnz_t path from a BIP32 account key to a derived normal child, its compressed public key, P2PKH and P2SH-P2WPKH addresses, and a DER signature made with the child key
+{
+    uint32_t i, p2pkh_leading_zeros;
+    clock_t start;
+    bool verified = true;
+    bnz_t parent_private_key, parent_chain_code, parent_public_key_compressed, child_private_key, child_chain_code, child_public_key_compressed, p2pkh, p2sh_p2wpkh, hash, r, s, signature;
 
     bnz_init(&parent_private_key);
     bnz_init(&parent_chain_code);
@@ -2862,352 +8496,995 @@ void get_hdk_intermediate_values(const SECP256K1 secp256k1, const bnz_t *master_
     bnz_init(&child_private_key);
     bnz_init(&child_chain_code);
     bnz_init(&child_public_key_compressed);
+    bnz_init(&p2pkh);
+    bnz_init(&p2sh_p2wpkh);
+    bnz_init(&hash);
+    bnz_init(&r);
+    bnz_init(&s);
+    bnz_init(&signature);
 
-    bnz_set_bnz(&parent_private_key, master_private_key);
-    bnz_set_bnz(&parent_chain_code, master_chain_code);
+    get_benchmark_private_key(&parent_private_key, 0); // deterministic parent key, chain code and message hash
+    get_benchmark_private_key(&parent_chain_code, 1);
+    get_benchmark_private_key(&hash, 2);
+    get_public_key_compressed(secp256k1, &parent_public_key_compressed, &parent_private_key);
 
-    sprintf(display_str, "m");
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        get_child_normal(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, &parent_public_key_compressed, i % 1024);
+        get_public_key_compressed(secp256k1, &child_public_key_compressed, &child_private_key);
+        get_p2pkh_address(&p2pkh, &child_public_key_compressed, &p2pkh_leading_zeros);
+        get_p2sh_p2wpkh_address(&p2sh_p2wpkh, &child_public_key_compressed);
+        secp256k1_ecdsa_sign(secp256k1, &child_private_key, &hash, &r, &s, 0);
+        secp256k1_ecdsa_get_signature_from_r_s(&r, &s, &signature);
+    }
+    print_benchmark_result("derived address and signature", iterations, start);
 
-    if (strcmp(tok, "m") == 0) {
-        tok = strtok(NULL, "/"); // get first array member
-        while (tok != NULL) { // traverse array
+    for (i = 0; i < BENCHMARK_KEYS; i++) { // confirm that the signatures made with the derived keys verify
+        get_child_normal(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, &parent_public_key_compressed, i);
+        get_public_key_compressed(secp256k1, &child_public_key_compressed, &child_private_key);
+        secp256k1_ecdsa_sign(secp256k1, &child_private_key, &hash, &r, &s, 0);
+        secp256k1_ecdsa_get_signature_from_r_s(&r, &s, &signature);
+        if (secp256k1_ecdsa_verify_from_signature(secp256k1, &child_public_key_compressed, &hash, &signature) == false) verified = false;
+    }
+    printf("signatures %s\n", verified == true ? "verified" : "NOT VERIFIED");
 
-            sprintf(display_str + strlen(display_str), "/"); // update display
-            sprintf(display_str + strlen(display_str), tok); // string
+    bnz_free(&parent_private_key);
+    bnz_free(&parent_chain_code);
+    bnz_free(&parent_public_key_compressed);
+    bnz_free(&child_private_key);
+    bnz_free(&child_chain_code);
+    bnz_free(&child_public_key_compressed);
+    bnz_free(&p2pkh);
+    bnz_free(&p2sh_p2wpkh);
+    bnz_free(&hash);
+    bnz_free(&r);
+    bnz_free(&s);
+    bnz_free(&signature);
+}
 
-            depth++; // increment depth
-            index = atoi(tok); // extract index from tok, ignoring any "'" indicating hardened child 
+void benchmark_word_operations(uint32_t iterations) // time bnz_add_i32, bnz_multiply_i32 and bnz_cmp_i32 against converting the int32_t to a bnz_t and invoking bnz_add_bnz, bnz_multiply_bnz and bnz_cmp_bnz, on the deterministic private keys and their negations
+{
+    uint32_t i;
+    int32_t j, cmp = 0, words[6] = {0, 1, -1, 2, -2, 12345};
+    uint64_t check = 0;
+    clock_t start;
+    bool match = true;
+    bnz_t keys[BENCHMARK_KEYS], res, ref, bb;
+
+    bnz_init(&res);
+    bnz_init(&ref);
+    bnz_init(&bb);
 
-            get_public_key_compressed(secp256k1, &parent_public_key_compressed, &parent_private_key); // get parent compressed public key for calculating normal child 
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        bnz_init(&keys[i]);
+        get_benchmark_private_key(&keys[i], i);
+        if (i % 2) keys[i].sign = 1; // every other key is negative
+    }
 
-            if (tok[strlen(tok) - 1] == '\'') { // check for presence of "'" indicating hardened child
-                if (index < 2147483648) index += 2147483648;
-                get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, index); // if last char of tok is "'", get hardened child
-            } else {
-                get_child_normal(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, &parent_public_key_compressed, index); // if last char of tok is not "'", get normal child
-            }
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        bnz_add_i32(&res, &keys[i % BENCHMARK_KEYS], -2);
+        check ^= res.digits[0];
+    }
+    print_benchmark_result("bnz_add_i32(..., -2)", iterations, start);
 
-            get_public_key_compressed(secp256k1, &child_public_key_compressed, &child_private_key); // get compressed public key from child private key
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        bnz_set_i32(&bb, -2);
+        bnz_add_bnz(&res, &keys[i % BENCHMARK_KEYS], &bb);
+        check ^= res.digits[0];
+    }
+    print_benchmark_result("bnz_set_i32(-2) and bnz_add_bnz", iterations, start);
 
-            // print results
-            printf("%s\n", display_str);
-            bnz_print(&parent_private_key, 16, "PARENT PRIVATE KEY: ");
-            bnz_print(&parent_chain_code, 16, "PARENT CHAIN CODE: ");
-            bnz_print(&child_private_key, 16, "CHILD PRIVATE KEY: ");
-            bnz_print(&child_chain_code, 16, "CHILD CHAIN CODE: ");
-            printf("\n");
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        bnz_multiply_i32(&res, &keys[i % BENCHMARK_KEYS], 2);
+        check ^= res.digits[0];
+    }
+    print_benchmark_result("bnz_multiply_i32(..., 2)", iterations, start);
 
-            // prepare next iteration by setting parent private key and parent chain code to current child private key and child chain code
-            bnz_set_bnz(&parent_private_key, &child_private_key);
-            bnz_set_bnz(&parent_chain_code, &child_chain_code);
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        bnz_multiply_i32(&res, &keys[i % BENCHMARK_KEYS], 12345);
+        check ^= res.digits[0];
+    }
+    print_benchmark_result("bnz_multiply_i32(..., 12345)", iterations, start);
 
-            tok = strtok(NULL, "/"); // next array member
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        bnz_set_i32(&bb, 12345);
+        bnz_multiply_bnz(&res, &keys[i % BENCHMARK_KEYS], &bb);
+        check ^= res.digits[0];
+    }
+    print_benchmark_result("bnz_set_i32(12345) and bnz_multiply_bnz", iterations, start);
+
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        cmp += bnz_cmp_i32(&keys[i % BENCHMARK_KEYS], 1);
+    }
+    print_benchmark_result("bnz_cmp_i32(..., 1)", iterations, start);
+
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        bnz_set_i32(&bb, 1);
+        cmp += bnz_cmp_bnz(&keys[i % BENCHMARK_KEYS], &bb);
+    }
+    print_benchmark_result("bnz_set_i32(1) and bnz_cmp_bnz", iterations, start);
+
+    for (i = 0; i < 2 * BENCHMARK_KEYS; i++) { // confirm that the word paths agree with the bnz_t paths, for the keys and for small values, which may become zero or change sign
+        if (i >= BENCHMARK_KEYS) bnz_set_i32(&keys[i % BENCHMARK_KEYS], (int32_t)(i % BENCHMARK_KEYS) - 8);
+        for (j = 0; j < 6; j++) {
+            bnz_set_i32(&bb, words[j]);
+            bnz_add_i32(&res, &keys[i % BENCHMARK_KEYS], words[j]);
+            bnz_add_bnz(&ref, &keys[i % BENCHMARK_KEYS], &bb);
+            if (bnz_cmp_bnz(&res, &ref) != 0 && !(bnz_is_zero(&res) == true && bnz_is_zero(&ref) == true)) match = false; // bnz_add_bnz may leave a zero sum negative
+            bnz_multiply_i32(&res, &keys[i % BENCHMARK_KEYS], words[j]);
+            bnz_multiply_bnz(&ref, &keys[i % BENCHMARK_KEYS], &bb);
+            if (bnz_cmp_bnz(&res, &ref) != 0) match = false;
+            if (bnz_cmp_i32(&keys[i % BENCHMARK_KEYS], words[j]) != bnz_cmp_bnz(&keys[i % BENCHMARK_KEYS], &bb)) match = false;
         }
     }
+    printf("results %s (check %llu)\n", match == true ? "match" : "DO NOT MATCH", (unsigned long long)((check + (uint64_t)cmp) & 255));
 
-    bnz_free(&parent_private_key);
-    bnz_free(&parent_chain_code);
-    bnz_free(&parent_public_key_compressed);
-    bnz_free(&child_private_key);
-    bnz_free(&child_chain_code);
-    bnz_free(&child_public_key_compressed);
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        bnz_free(&keys[i]);
+    }
+    bnz_free(&res);
+    bnz_free(&ref);
+    bnz_free(&bb);
 }
 
-void get_public_key_compressed(const SECP256K1 secp256k1, bnz_t *public_key_compressed, bnz_t *private_key)
+void benchmark_inverse(const SECP256K1 secp256k1, uint32_t iterations) // time the safegcd fe_inv and sc_inv against Fermat's little theorem with fe_pow and with the addition chains fe_inv_chain and sc_inv_chain, the binary extended Euclidean u256_inv_mod and bnz_modular_multiplicative_inverse, mod secp256k1.p and secp256k1.n, on the deterministic private keys
 {
-    APT public_key;
+    uint32_t i;
+    uint64_t check = 0;
+    clock_t start;
+    bool match = true;
+    bnz_t keys[BENCHMARK_KEYS], res;
+    fe_t fe_keys[BENCHMARK_KEYS], fe_res, fe_ref;
+    sc_t sc_keys[BENCHMARK_KEYS], sc_res, sc_ref;
+    u256_t u256_keys[BENCHMARK_KEYS], n, u256_res;
+
+    bnz_init(&res);
+    memcpy(n.d, sc_n, sizeof(n.d));
+
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        bnz_init(&keys[i]);
+        get_benchmark_private_key(&keys[i], i);
+        fe_set_bnz(&fe_keys[i], &keys[i]);
+        sc_set_bnz(&sc_keys[i], &keys[i]);
+        u256_set_bnz(&u256_keys[i], &keys[i]);
+    }
+
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        fe_inv(&fe_res, &fe_keys[i % BENCHMARK_KEYS]);
+        check ^= fe_res.n[0];
+    }
+    print_benchmark_result("fe_inv, safegcd mod secp256k1.p", iterations, start);
+
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        fe_pow(&fe_res, &fe_keys[i % BENCHMARK_KEYS], &fe_p_minus_2);
+        check ^= fe_res.n[0];
+    }
+    print_benchmark_result("fe_pow(..., secp256k1.p - 2), Fermat mod secp256k1.p", iterations, start);
+
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        fe_inv_chain(&fe_res, &fe_keys[i % BENCHMARK_KEYS]);
+        check ^= fe_res.n[0];
+    }
+    print_benchmark_result("fe_inv_chain, Fermat addition chain mod secp256k1.p", iterations, start);
+
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        bnz_modular_multiplicative_inverse(&res, &keys[i % BENCHMARK_KEYS], &secp256k1.p);
+        check ^= res.digits[0];
+    }
+    print_benchmark_result("bnz_modular_multiplicative_inverse(..., secp256k1.p)", iterations, start);
+
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        sc_inv(&sc_res, &sc_keys[i % BENCHMARK_KEYS]);
+        check ^= sc_res.d[0];
+    }
+    print_benchmark_result("sc_inv, safegcd mod secp256k1.n", iterations, start);
+
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        u256_inv_mod(&u256_res, &u256_keys[i % BENCHMARK_KEYS], &n);
+        check ^= u256_res.d[0];
+    }
+    print_benchmark_result("u256_inv_mod(..., secp256k1.n), binary extended Euclidean", iterations, start);
+
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        sc_inv_chain(&sc_res, &sc_keys[i % BENCHMARK_KEYS]);
+        check ^= sc_res.d[0];
+    }
+    print_benchmark_result("sc_inv_chain, Fermat addition chain mod secp256k1.n", iterations, start);
+
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        bnz_modular_multiplicative_inverse(&res, &keys[i % BENCHMARK_KEYS], &secp256k1.n);
+        check ^= res.digits[0];
+    }
+    print_benchmark_result("bnz_modular_multiplicative_inverse(..., secp256k1.n)", iterations, start);
+
+    for (i = 0; i < BENCHMARK_KEYS; i++) { // confirm that the paths agree
+        fe_inv(&fe_res, &fe_keys[i]);
+        fe_pow(&fe_ref, &fe_keys[i], &fe_p_minus_2);
+        if (fe_equal(&fe_res, &fe_ref) == false) match = false;
+        fe_inv_chain(&fe_ref, &fe_keys[i]);
+        if (fe_equal(&fe_res, &fe_ref) == false) match = false;
+        bnz_modular_multiplicative_inverse(&res, &keys[i], &secp256k1.p);
+        fe_set_bnz(&fe_ref, &res);
+        if (fe_equal(&fe_res, &fe_ref) == false) match = false;
+        sc_inv(&sc_res, &sc_keys[i]);
+        u256_inv_mod(&u256_res, &u256_keys[i], &n);
+        if (memcmp(sc_res.d, u256_res.d, sizeof(sc_res.d)) != 0) match = false;
+        sc_inv_chain(&sc_ref, &sc_keys[i]);
+        if (sc_equal(&sc_res, &sc_ref) == false) match = false;
+        bnz_modular_multiplicative_inverse(&res, &keys[i], &secp256k1.n);
+        u256_set_bnz(&u256_res, &res);
+        if (memcmp(sc_res.d, u256_res.d, sizeof(sc_res.d)) != 0) match = false;
+    }
+    printf("results %s (check %llu)\n", match == true ? "match" : "DO NOT MATCH", (unsigned long long)(check & 255));
+
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        bnz_free(&keys[i]);
+    }
+    bnz_free(&res);
+}
+
+void benchmark_batch_inverse(const SECP256K1 secp256k1, uint32_t iterations) // time batches of BENCHMARK_KEYS single inversions, public keys and signatures against fe_batch_inv, sc_batch_inv, bnz_batch_inverse, get_public_keys_compressed_u256_batch and secp256k1_ecdsa_sign_u256_batch on the deterministic private keys, one iteration being one batch
+{
+    uint32_t i, j;
+    uint64_t check = 0;
+    clock_t start;
+    bool match = true;
+    bnz_t keys[BENCHMARK_KEYS], res[BENCHMARK_KEYS];
+    fe_t fe_keys[BENCHMARK_KEYS], fe_res[BENCHMARK_KEYS], fe_ref;
+    sc_t sc_keys[BENCHMARK_KEYS], sc_res[BENCHMARK_KEYS], sc_ref, r[BENCHMARK_KEYS], s[BENCHMARK_KEYS], r_ref, s_ref;
+    u256_t u256_keys[BENCHMARK_KEYS], hashes[BENCHMARK_KEYS];
+    uint8_t public_keys[33 * BENCHMARK_KEYS], public_key_ref[33];
+    
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        bnz_init(&keys[i]);
+        bnz_init(&res[i]);
+        get_benchmark_private_key(&keys[i], i);
+        fe_set_bnz(&fe_keys[i], &keys[i]);
+        sc_set_bnz(&sc_keys[i], &keys[i]);
+        u256_set_bnz(&u256_keys[i], &keys[i]);
+        sha256((uint8_t *)&u256_keys[i], sizeof(u256_keys[i]), (uint8_t *)&hashes[i]); // arbitrary message hash
+    }
+
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        for (j = 0; j < BENCHMARK_KEYS; j++) {
+            fe_inv(&fe_res[j], &fe_keys[j]);
+        }
+        check ^= fe_res[i % BENCHMARK_KEYS].n[0];
+    }
+    print_benchmark_result("fe_inv x 16, mod secp256k1.p", iterations, start);
+
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        fe_batch_inv(fe_res, fe_keys, BENCHMARK_KEYS);
+        check ^= fe_res[i % BENCHMARK_KEYS].n[0];
+    }
+    print_benchmark_result("fe_batch_inv of 16, mod secp256k1.p", iterations, start);
+
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        for (j = 0; j < BENCHMARK_KEYS; j++) {
+            sc_inv(&sc_res[j], &sc_keys[j]);
+        }
+        check ^= sc_res[i % BENCHMARK_KEYS].d[0];
+    }
+    print_benchmark_result("sc_inv x 16, mod secp256k1.n", iterations, start);
+
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        sc_batch_inv(sc_res, sc_keys, BENCHMARK_KEYS);
+        check ^= sc_res[i % BENCHMARK_KEYS].d[0];
+    }
+    print_benchmark_result("sc_batch_inv of 16, mod secp256k1.n", iterations, start);
 
-    bnz_init(&public_key.x);
-    bnz_init(&public_key.y);
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        for (j = 0; j < BENCHMARK_KEYS; j++) {
+            bnz_modular_multiplicative_inverse(&res[j], &keys[j], &secp256k1.n);
+        }
+        check ^= res[i % BENCHMARK_KEYS].digits[0];
+    }
+    print_benchmark_result("bnz_modular_multiplicative_inverse(..., secp256k1.n) x 16", iterations, start);
 
-    secp256k1_jacobian_scalar_multiplication(secp256k1, private_key, &public_key);
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        bnz_batch_inverse(res, keys, BENCHMARK_KEYS, &secp256k1.n);
+        check ^= res[i % BENCHMARK_KEYS].digits[0];
+    }
+    print_benchmark_result("bnz_batch_inverse(..., secp256k1.n) of 16", iterations, start);
 
-    bnz_resize(&public_key.x, 32, true);
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        for (j = 0; j < BENCHMARK_KEYS; j++) {
+            get_public_key_compressed_u256(&secp256k1, public_keys + 33 * j, &u256_keys[j]);
+        }
+        check ^= public_keys[33 * (i % BENCHMARK_KEYS) + 1];
+    }
+    print_benchmark_result("get_public_key_compressed_u256 x 16", iterations, start);
 
-    if (bnz_bit_set(&public_key.y, 0) == false) {
-        bnz_concatenate_ui8(public_key_compressed, &public_key.x, 2, 0);
-    } else { // odd y
-        bnz_concatenate_ui8(public_key_compressed, &public_key.x, 3, 0);
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        get_public_keys_compressed_u256_batch(&secp256k1, public_keys, u256_keys, BENCHMARK_KEYS);
+        check ^= public_keys[33 * (i % BENCHMARK_KEYS) + 1];
     }
-    
-    bnz_free(&public_key.x);
-    bnz_free(&public_key.y);
-}
+    print_benchmark_result("get_public_keys_compressed_u256_batch of 16", iterations, start);
 
-void get_public_key(const SECP256K1 secp256k1, APT *public_key, bnz_t *public_key_compressed, bnz_t *private_key) // generate public key from private key
-{
-    secp256k1_jacobian_scalar_multiplication(secp256k1, private_key, public_key); // public_key = (secp256k1.G * private_key) mod secp256k1.p
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        for (j = 0; j < BENCHMARK_KEYS; j++) {
+            secp256k1_ecdsa_sign_u256(&secp256k1, &sc_keys[j], &hashes[j], &r[j], &s[j], 0);
+        }
+        check ^= s[i % BENCHMARK_KEYS].d[0];
+    }
+    print_benchmark_result("secp256k1_ecdsa_sign_u256 x 16", iterations, start);
 
-    bnz_resize(&public_key->x, 32, true); // ensure that the compressed public key is 32 bytes long before concatenation with the even y / odd y byte
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        secp256k1_ecdsa_sign_u256_batch(&secp256k1, sc_keys, hashes, r, s, BENCHMARK_KEYS, 0);
+        check ^= s[i % BENCHMARK_KEYS].d[0];
+    }
+    print_benchmark_result("secp256k1_ecdsa_sign_u256_batch of 16", iterations, start);
 
-    if (bnz_bit_set(&public_key->y, 0) == false) { // even y
-        bnz_concatenate_ui8(public_key_compressed, &public_key->x, 2, 0); // prepend 2
-    } else { // odd y
-        bnz_concatenate_ui8(public_key_compressed, &public_key->x, 3, 0); // prepend 3
+    fe_batch_inv(fe_res, fe_keys, BENCHMARK_KEYS);
+    sc_batch_inv(sc_res, sc_keys, BENCHMARK_KEYS);
+    bnz_batch_inverse(res, keys, BENCHMARK_KEYS, &secp256k1.n);
+    get_public_keys_compressed_u256_batch(&secp256k1, public_keys, u256_keys, BENCHMARK_KEYS);
+    secp256k1_ecdsa_sign_u256_batch(&secp256k1, sc_keys, hashes, r, s, BENCHMARK_KEYS, 0);
+    for (i = 0; i < BENCHMARK_KEYS; i++) { // confirm that the single and batch paths agree
+        fe_inv(&fe_ref, &fe_keys[i]);
+        if (fe_equal(&fe_res[i], &fe_ref) == false) match = false;
+        sc_inv(&sc_ref, &sc_keys[i]);
+        if (sc_equal(&sc_res[i], &sc_ref) == false) match = false;
+        sc_set_bnz(&sc_ref, &res[i]);
+        if (sc_equal(&sc_res[i], &sc_ref) == false) match = false;
+        get_public_key_compressed_u256(&secp256k1, public_key_ref, &u256_keys[i]);
+        if (memcmp(public_keys + 33 * i, public_key_ref, 33) != 0) match = false;
+        secp256k1_ecdsa_sign_u256(&secp256k1, &sc_keys[i], &hashes[i], &r_ref, &s_ref, 0);
+        if (sc_equal(&r[i], &r_ref) == false || sc_equal(&s[i], &s_ref) == false) match = false;
+    }
+    printf("results %s (check %llu)\n", match == true ? "match" : "DO NOT MATCH", (unsigned long long)(check & 255));
+
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        bnz_free(&keys[i]);
+        bnz_free(&res[i]);
     }
 }
 
-void get_public_key_xy(const SECP256K1 secp256k1, APT *public_key, const bnz_t *public_key_compressed) // regenerate public key point on secp256k1 from compressed public key
+void get_benchmark_number(bnz_t *res, uint32_t bits, uint32_t i) // deterministic benchmark number of exactly bits bits (a multiple of 256), res = sha256(i, 0) || sha256(i, 1) || ..., with the top bit set
 {
-    uint8_t typ = public_key_compressed->digits[public_key_compressed->size - 1]; // byte at msb encodes the parity of y: typ = 0x02 for even y, typ = 0x03 for odd y
-    bnz_t exp, y_sq;
-
-    bnz_init(&exp);
-    bnz_init(&y_sq);
-
-    /*
+    uint32_t j, len = bits / 8;
+    uint8_t msg[8];
 
-    In this function we wish to regenerate the x,y coordinates of a point on secp256k1 from a compressed public key, which is
-    the x coordinate of the point concatenated (at the msb end) with a byte of value 2 or 3, depending on whether the value of
-    y is even (0x02) or odd (0x03).
+    bnz_resize(res, len, false);
+    for (j = 0; j < len / 32; j++) {
+        msg[0] = (i >> 24) & 255;
+        msg[1] = (i >> 16) & 255;
+        msg[2] = (i >> 8) & 255;
+        msg[3] = i & 255;
+        msg[4] = (j >> 24) & 255;
+        msg[5] = (j >> 16) & 255;
+        msg[6] = (j >> 8) & 255;
+        msg[7] = j & 255;
+        sha256(msg, 8, res->digits + 32 * j);
+    }
+    res->digits[len - 1] |= 128;
+}
+
+void benchmark_mod_pow(uint32_t iterations) // time bnz_mod_pow_ctx (sliding window) against bnz_mod_pow_window_ctx with a window of 1 bit (square and multiply), with full size exponents and odd moduli of 256, 2048 and 4096 bits and an even modulus of 2048 bits, iterations at 256 bits, iterations / 64 at 2048 bits and iterations / 256 at 4096 bits
+{
+    uint32_t i, j, n, bits[4] = {256, 2048, 4096, 2048};
+    uint64_t check = 0;
+    clock_t start;
+    bool match = true;
+    char label[128];
+    bnz_t base, exponent, modulus, res, ref;
+    bnz_mod_ctx ctx;
+
+    bnz_init(&base);
+    bnz_init(&exponent);
+    bnz_init(&modulus);
+    bnz_init(&res);
+    bnz_init(&ref);
+
+    for (j = 0; j < 4; j++) {
+        n = j == 0 ? iterations : iterations / (bits[j] / 256) / (bits[j] / 256);
+        if (n < 1) n = 1;
+        get_benchmark_number(&base, bits[j], 3 * j);
+        get_benchmark_number(&exponent, bits[j], 3 * j + 1);
+        get_benchmark_number(&modulus, bits[j], 3 * j + 2);
+        if (j < 3) {
+            modulus.digits[0] |= 1; // odd modulus, Montgomery multiplication
+        } else {
+            modulus.digits[0] &= 254; // even modulus, Barrett reduction
+        }
+        bnz_mod_ctx_init(&ctx, &modulus);
 
-    Generating the y coordinate of a point on secp256k1, given the corresponding x coordinate, leverages a nice property of secp256k1
-    which is that, given y^2 mod secp256k1.p (easily calculated from x given the formula of secp256k1: y^2 = x^3 + 7), we can
-    calculate y as follows:
+        start = benchmark_start();
+        for (i = 0; i < n; i++) {
+            base.digits[0] ^= i & 255; // vary the base between iterations
+            bnz_mod_pow_ctx(&res, &base, &exponent, &ctx);
+            check ^= res.digits[0];
+        }
+        sprintf(label, "bnz_mod_pow_ctx, %u bit %s modulus, sliding window of %u bits", bits[j], j < 3 ? "odd" : "even", bnz_mod_pow_window(bits[j]));
+        print_benchmark_result(label, n, start);
+
+        start = benchmark_start();
+        for (i = 0; i < n; i++) {
+            base.digits[0] ^= i & 255;
+            bnz_mod_pow_window_ctx(&res, &base, &exponent, &ctx, 1);
+            check ^= res.digits[0];
+        }
+        sprintf(label, "bnz_mod_pow_window_ctx(..., 1), %u bit %s modulus, square and multiply", bits[j], j < 3 ? "odd" : "even");
+        print_benchmark_result(label, n, start);
 
-        y mod secp256k1.p = (y_sq^((secp256k1.p + 1) / 4)) mod secp256k1.p
+        bnz_mod_pow_ctx(&res, &base, &exponent, &ctx); // confirm that every window width agrees
+        for (i = 1; i <= MOD_POW_MAX_WINDOW; i++) {
+            bnz_mod_pow_window_ctx(&ref, &base, &exponent, &ctx, i);
+            if (bnz_cmp_bnz(&res, &ref) != 0) match = false;
+        }
 
-    In this function we use a pre-calculated value of (secp256k1.p + 1) / 4.
+        bnz_mod_ctx_free(&ctx);
+    }
+    printf("results %s (check %llu)\n", match == true ? "match" : "DO NOT MATCH", (unsigned long long)(check & 255));
 
-    */
-    bnz_set_str(&exp, (const char *)"28948022309329048855892746252171976963317496166410141009864396001977208667916", 10); // (secp256k1.p + 1) / 4
+    bnz_free(&base);
+    bnz_free(&exponent);
+    bnz_free(&modulus);
+    bnz_free(&res);
+    bnz_free(&ref);
+}
 
-    bnz_set_bnz(&public_key->x, public_key_compressed); // public_key.x = compressed public key
-    bnz_resize(&public_key->x, public_key->x.size - 1, true); // public_key.x = decompressed public key, byte at msb end removed
+void benchmark_lehmer_inverse(uint32_t iterations) // time bnz_modular_multiplicative_inverse (Lehmer) against bnz_modular_multiplicative_inverse_euclid with odd moduli of 256, 1024, 2048, 4096 and 8192 bits, iterations at 256 bits, scaled down with the square of the size for the larger moduli
+{
+    uint32_t i, j, n, bits[5] = {256, 1024, 2048, 4096, 8192};
+    uint64_t check = 0;
+    clock_t start;
+    bool match = true;
+    char label[128];
+    bnz_t a, modulus, res, ref;
 
-    bnz_set_bnz(&y_sq, &public_key->x); // y_sq = public_key.x
-    bnz_multiply_bnz(&y_sq, &y_sq, &public_key->x); // y_sq = public_key.x^2
-    bnz_multiply_bnz(&y_sq, &y_sq, &public_key->x); // y_sq = public_key.x^3
-    bnz_add_i32(&y_sq, &y_sq, 7); // y_sq = public_key.x^3 + 7
-    bnz_mod_bnz(&y_sq, &y_sq, &secp256k1.p); // y_sq mod secp256k1.p = (public_key.x^3 + 7) mod secp256k1.p
+    bnz_init(&a);
+    bnz_init(&modulus);
+    bnz_init(&res);
+    bnz_init(&ref);
 
-    bnz_mod_pow(&public_key->y, &y_sq, &exp, &secp256k1.p); // y mod secp256k1.p = (y_sq^((secp256k1.p + 1) / 4)) mod secp256k1.p
+    for (j = 0; j < 5; j++) {
+        n = iterations / (bits[j] / 256) / (bits[j] / 256);
+        if (n < 1) n = 1;
+        get_benchmark_number(&a, bits[j], 2 * j);
+        get_benchmark_number(&modulus, bits[j], 2 * j + 1);
+        modulus.digits[0] |= 1;
+        a.digits[a.size - 1] &= 127; // a < modulus
 
-    if ((typ == 2 && bnz_bit_set(&public_key->y, 0) == true) || (typ == 3 && bnz_bit_set(&public_key->y, 0) == false)) { // mismatched typ and y
-        bnz_subtract_bnz(&public_key->y, &secp256k1.p, &public_key->y); // y = secp256k1.p - y, negation of y mod p
+        start = benchmark_start();
+        for (i = 0; i < n; i++) {
+            a.digits[0] ^= i & 255; // vary a between iterations
+            bnz_modular_multiplicative_inverse(&res, &a, &modulus);
+            check ^= res.digits[0];
+        }
+        sprintf(label, "bnz_modular_multiplicative_inverse, %u bit modulus, Lehmer", bits[j]);
+        print_benchmark_result(label, n, start);
+
+        start = benchmark_start();
+        for (i = 0; i < n; i++) {
+            a.digits[0] ^= i & 255;
+            bnz_modular_multiplicative_inverse_euclid(&res, &a, &modulus);
+            check ^= res.digits[0];
+        }
+        sprintf(label, "bnz_modular_multiplicative_inverse_euclid, %u bit modulus", bits[j]);
+        print_benchmark_result(label, n, start);
+
+        for (i = 0; i < 8; i++) { // confirm that both paths agree
+            a.digits[0] ^= i;
+            bnz_modular_multiplicative_inverse(&res, &a, &modulus);
+            bnz_modular_multiplicative_inverse_euclid(&ref, &a, &modulus);
+            if (bnz_cmp_bnz(&res, &ref) != 0) match = false;
+        }
     }
+    printf("results %s (check %llu)\n", match == true ? "match" : "DO NOT MATCH", (unsigned long long)(check & 255));
 
-    bnz_free(&exp);
-    bnz_free(&y_sq);
+    bnz_free(&a);
+    bnz_free(&modulus);
+    bnz_free(&res);
+    bnz_free(&ref);
 }
 
-void get_random_master_keys(bnz_t *entropy, bnz_t *master_private_key, bnz_t *master_chain_code) // NOT SECURE use random 256 bit entropy to generate master private key and master chain code
+void benchmark_radix_conversion(uint32_t iterations) // time get_base_n_str (division by 58^10 with a precomputed reciprocal) against get_base_n_str_bytewise for Bitcoin base 58 strings of 256, 1024, 4096 and 16384 bit numbers, iterations at 256 bits, scaled down with the square of the size for the larger numbers
 {
-    char *mnemonic = NULL;
-    uint32_t wd_ids[24];
-    bnz_t tmp, seed;
+    uint32_t i, j, n, len, bits[4] = {256, 1024, 4096, 16384};
+    uint64_t check = 0;
+    clock_t start;
+    bool match = true;
+    char label[128];
+    uint8_t *str = NULL, *ref = NULL;
+    const char *alpha = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+    bnz_t a;
 
-    bnz_init(&tmp);
-    bnz_init(&seed);
+    bnz_init(&a);
 
-    bnz_256_bit_rnd(entropy); // generate 32 bytes of random entropy
-    bnz_set_bnz(&tmp, entropy); // copy entropy into tmp
+    for (j = 0; j < 4; j++) {
+        n = iterations / (bits[j] / 256) / (bits[j] / 256);
+        if (n < 1) n = 1;
+        get_benchmark_number(&a, bits[j], j);
 
-    entropy_checksum(&tmp); // calculate and append checksum byte to copy of entropy, 33 byte result
-    get_bip39_word_ids_bnz(&tmp, wd_ids); // get the ids of the 24 BIP39 words from the 33 byte tmp
-    mnemonic = get_mnemonic_phrase(wd_ids); // generate mnemonic phrase string from BIP39 word ids
-    get_seed_from_mnemonic_phrase(&seed, mnemonic, ""); // generate 64 byte seed from mnemonic phrase
-    get_master_keys(master_private_key, master_chain_code, &seed); // generate master private key and master chain code from seed
+        start = benchmark_start();
+        for (i = 0; i < n; i++) {
+            a.digits[a.size - 1] ^= i & 255; // vary the lsb (a is read in big endian order) between iterations
+            str = get_base_n_str(&a, 58, alpha, &len);
+            check ^= str[len - 1];
+            free(str);
+        }
+        sprintf(label, "get_base_n_str, %u bit number, base 58", bits[j]);
+        print_benchmark_result(label, n, start);
+
+        start = benchmark_start();
+        for (i = 0; i < n; i++) {
+            a.digits[a.size - 1] ^= i & 255;
+            str = get_base_n_str_bytewise(&a, 58, alpha, &len);
+            check ^= str[len - 1];
+            free(str);
+        }
+        sprintf(label, "get_base_n_str_bytewise, %u bit number, base 58", bits[j]);
+        print_benchmark_result(label, n, start);
+
+        for (i = 2; i <= 64; i++) { // confirm that both paths agree in every base
+            str = get_base_n_str(&a, i, "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz_+", &len);
+            ref = get_base_n_str_bytewise(&a, i, "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz_+", &len);
+            if (strcmp((const char *)str, (const char *)ref) != 0) match = false;
+            free(str);
+            free(ref);
+        }
+    }
+    printf("results %s (check %llu)\n", match == true ? "match" : "DO NOT MATCH", (unsigned long long)(check & 255));
+
+    bnz_free(&a);
+}
+
+void benchmark_radix_divide_and_conquer(uint32_t iterations) // time decimal conversion of 4096 to 262144 bit numbers, to a string (radix_put_uint64_arr) and back (radix_get_uint64_arr), by divide and conquer against one limb sized chunk of digits at a time (a radix_ctx without powers), iterations at 4096 bits, scaled down with the square of the size for the larger numbers
+{
+    uint32_t i, j, n, bits[4] = {4096, 16384, 65536, 262144};
+    size_t len, digits, x_len;
+    uint8_t *str = NULL, *dgt = NULL, *pos;
+    uint64_t *x = NULL, *y = NULL;
+    clock_t start;
+    bool match = true;
+    char label[128];
+    radix_ctx dc, word;
+    bnz_t a;
+
+    bnz_init(&a);
+
+    for (j = 0; j < 4; j++) {
+        n = iterations / (bits[j] / 4096) / (bits[j] / 4096);
+        if (n < 1) n = 1;
+        get_benchmark_number(&a, bits[j], j);
+        len = bnz_limb_count(&a);
+        digits = (size_t)(a.size * log10((double)256)) + 1;
+        x_len = radix_limbs(digits, 10);
+
+        str = init_uint8_array(digits + 1);
+        dgt = init_uint8_array(digits + 1);
+        x = init_uint64_array(x_len);
+        y = init_uint64_array(x_len);
+        if (!str || !dgt || !x || !y) {
+            free(str);
+            free(dgt);
+            free(x);
+            free(y);
+            break;
+        }
 
-    free(mnemonic);
-    bnz_free(&tmp);
-    bnz_free(&seed);
-}
+        radix_ctx_init(&dc, 10, digits, true);
+        dc.alpha = "0123456789";
+        dc.sink = bnz_sink_buffer;
+        start = benchmark_start();
+        for (i = 0; i < n; i++) {
+            bnz_get_limbs(x, len, &a);
+            pos = str;
+            dc.arg = &pos;
+            dc.started = false;
+            radix_put_uint64_arr(&dc, x, len, digits);
+        }
+        sprintf(label, "radix_put_uint64_arr, %u bit number, base 10, divide and conquer", bits[j]);
+        print_benchmark_result(label, n, start);
+
+        radix_ctx_init(&word, 10, 0, false);
+        word.alpha = "0123456789";
+        word.sink = bnz_sink_buffer;
+        start = benchmark_start();
+        for (i = 0; i < n; i++) {
+            bnz_get_limbs(x, len, &a);
+            pos = dgt;
+            word.arg = &pos;
+            word.started = false;
+            radix_put_uint64_arr(&word, x, len, digits);
+        }
+        sprintf(label, "radix_put_uint64_arr, %u bit number, base 10, one chunk at a time", bits[j]);
+        print_benchmark_result(label, n, start);
+        if (memcmp(str, dgt, digits) != 0) match = false;
 
-void get_p2pkh_address(bnz_t *p2pkh, bnz_t *public_key_compressed, uint32_t *p2pkh_leading_zeros) // get p2pkh address from compressed public key
-{
-    bnz_t fingerprint;
-    bnz_init(&fingerprint);
-    get_ripemd160_sha256(p2pkh, public_key_compressed, 20); // set p2pkh to ripemd160(sha256(public_key_compressed.digits)), p2pkh->size = 20
-    bnz_concatenate_ui8(p2pkh, p2pkh, 0, 0); // concatenate 0 byte to msb end of p2pkh.digits, p2pkh->size = 21
-    get_sha256_sha256(&fingerprint, p2pkh, 4); // set fingerprint to first four bytes of sha256(sha256(p2pkh.digits))
-    bnz_concatenate_bnz(p2pkh, p2pkh, &fingerprint, 1); // concatenate fingerprint to lsb end of p2pkh, p2pkh->size = 25
-    bnz_trim(p2pkh); // remove zero value bytes from msb end of p2pkh, p2pkh->size reduces by at least 1
-    (*p2pkh_leading_zeros) = 25 - p2pkh->size; // number of leading zeros = 25 - p2pkh->size after trimming leading zeros
-    bnz_free(&fingerprint); // free fingerprint
-}
+        for (len = 0; str[len] != 0; len++) str[len] -= '0'; // digit values
+        radix_ctx_free(&dc);
+        radix_ctx_init(&dc, 10, len, false);
 
-void print_p2pkh_address(const bnz_t *p2pkh, const uint8_t *str, uint32_t p2pkh_leading_zeros)
-{
-    uint8_t *full_string = NULL, *p2pkh_base58_str = NULL;
-    uint32_t i, len;
-    bnz_t tmp;
-    bnz_init(&tmp);
-    bnz_set_bnz(&tmp, p2pkh); // tmp = local mutable copy of p2pkh bnz_t with tmp.digits in standard little endian order 
-    bnz_reverse_digits(&tmp); // convert tmp.digits to big endian order
+        start = benchmark_start();
+        for (i = 0; i < n; i++) {
+            radix_get_uint64_arr(&dc, x, x_len, str, len);
+        }
+        sprintf(label, "radix_get_uint64_arr, %u bit number, base 10, divide and conquer", bits[j]);
+        print_benchmark_result(label, n, start);
 
-    p2pkh_base58_str = get_base_n_str(&tmp, 58, "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz", &len); // get base58 format string of non-zero integer part of p2pkh
-    if (!p2pkh_base58_str) {
-        return;
+        start = benchmark_start();
+        for (i = 0; i < n; i++) {
+            radix_get_uint64_arr(&word, y, x_len, str, len);
+        }
+        sprintf(label, "radix_get_uint64_arr, %u bit number, base 10, one chunk at a time", bits[j]);
+        print_benchmark_result(label, n, start);
+        if (cmp_uint64_arr(x, y, x_len) != 0) match = false;
+        bnz_get_limbs(y, x_len, &a);
+        if (cmp_uint64_arr(x, y, x_len) != 0) match = false;
+
+        radix_ctx_free(&word);
+        radix_ctx_free(&dc);
+        free(str);
+        free(dgt);
+        free(x);
+        free(y);
+    }
+    printf("results %s\n", match == true ? "match" : "DO NOT MATCH");
+
+    bnz_free(&a);
+}
+
+void benchmark_radix_power_of_two(uint32_t iterations) // time radix_put_uint64_arr in bases 16, 32 and 64 with bit slicing against division by chunks (the same radix_ctx with bits cleared) for 256 and 4096 bit numbers, and hex_encode_uint8_arr against sprintf for 32 byte keys, iterations at 256 bits, scaled down with the size for 4096 bits
+{
+    uint32_t i, j, b, n, bits[2] = {256, 4096}, bases[3] = {16, 32, 64};
+    size_t len, digits;
+    uint8_t str[1024], ref[1024], *pos;
+    uint64_t x[64];
+    char hex[65], label[128];
+    clock_t start;
+    bool match = true;
+    radix_ctx ctx;
+    bnz_t a;
+
+    bnz_init(&a);
+
+    for (j = 0; j < 2; j++) {
+        n = iterations / (bits[j] / 256);
+        if (n < 1) n = 1;
+        get_benchmark_number(&a, bits[j], j);
+        len = bnz_limb_count(&a);
+        for (b = 0; b < 3; b++) {
+            digits = (bits[j] + __builtin_ctz(bases[b]) - 1) / __builtin_ctz(bases[b]);
+            radix_ctx_init(&ctx, bases[b], digits, true);
+            ctx.alpha = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+            ctx.sink = bnz_sink_buffer;
+            ctx.arg = &pos;
+
+            start = benchmark_start();
+            for (i = 0; i < n; i++) {
+                bnz_get_limbs(x, len, &a);
+                pos = str;
+                ctx.started = false;
+                radix_put_uint64_arr(&ctx, x, len, digits);
+            }
+            sprintf(label, "radix_put_uint64_arr, %u bit number, base %u, bit slicing", bits[j], bases[b]);
+            print_benchmark_result(label, n, start);
+
+            ctx.bits = 0;
+            start = benchmark_start();
+            for (i = 0; i < n; i++) {
+                bnz_get_limbs(x, len, &a);
+                pos = ref;
+                ctx.started = false;
+                radix_put_uint64_arr(&ctx, x, len, digits);
+            }
+            sprintf(label, "radix_put_uint64_arr, %u bit number, base %u, division", bits[j], bases[b]);
+            print_benchmark_result(label, n, start);
+            if (memcmp(str, ref, pos - ref) != 0) match = false;
+
+            radix_ctx_free(&ctx);
+        }
     }
 
-    full_string = init_uint8_array(strlen(str) + strlen(p2pkh_base58_str) + p2pkh_leading_zeros + 1); // prepare full string to receive str, leading zeros, and base58 format non-zero integer part of p2pkh
-    if (!full_string) {
-        return;
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        a.digits[0] ^= i & 255;
+        hex_encode_uint8_arr(hex, a.digits, 32);
     }
+    print_benchmark_result("hex_encode_uint8_arr, 32 bytes", iterations, start);
 
-    sprintf(full_string, "%s", str); // add str
-    for (i = 0; i  < p2pkh_leading_zeros; i++) {
-        sprintf(full_string + strlen(full_string), "1"); // add leading zeros in base58 as "1" characters
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        a.digits[0] ^= i & 255;
+        for (j = 0; j < 32; j++) sprintf(hex + 2 * j, "%02x", a.digits[j]);
     }
-    sprintf(full_string + strlen(full_string), "%s", p2pkh_base58_str); // add non-zero integer part of p2pkh
+    print_benchmark_result("sprintf, 32 bytes", iterations, start);
+    hex_encode_uint8_arr((char *)str, a.digits, 32);
+    if (memcmp(str, hex, 64) != 0) match = false;
 
-    printf("%s\n", full_string); // print final string
+    printf("results %s\n", match == true ? "match" : "DO NOT MATCH");
 
-    free(full_string);
-    free(p2pkh_base58_str);
-    bnz_free(&tmp);
+    bnz_free(&a);
 }
 
-void get_p2sh_p2wpkh_address(bnz_t *p2sh_p2wpkh, bnz_t *public_key_compressed)
+void benchmark_ntt_multiplication(uint32_t iterations) // time Toom-3 against number theoretic transform multiplication (mul_ntt_uint64_arr) and mul_fast_uint64_arr of balanced operands from 65536 bits to 16777216 bits, iterations at 65536 bits, scaled down with the size for the larger operands
 {
-    bnz_t fingerprint, pub_key_hash;
-    bnz_init(&fingerprint);
-    bnz_init(&pub_key_hash);
-    get_ripemd160_sha256(&pub_key_hash, public_key_compressed, 20); // set pub_key_hash to ripemd160(sha256(public_key_compressed.digits))
-    bnz_concatenate_ui8(&pub_key_hash, &pub_key_hash, 20, 0); // concatenate 0x14 to msb end of pub_key_hash
-    bnz_concatenate_ui8(&pub_key_hash, &pub_key_hash, 0, 0); // concatenate 0x0 to msb end of pub_key_hash
-    get_ripemd160_sha256(p2sh_p2wpkh, &pub_key_hash, 20); // set p2sh_p2wpkh to ripemd160(sha256(pub_key_hash.digits))
-    bnz_concatenate_ui8(p2sh_p2wpkh, p2sh_p2wpkh, 5, 0); // concatenate 5 byte to msb end of p2sh_p2wpkh.digits
-    get_sha256_sha256(&fingerprint, p2sh_p2wpkh, 4); // set fingerprint to first four bytes of sha256(sha256(p2sh_p2wpkh.digits))
-    bnz_concatenate_bnz(p2sh_p2wpkh, p2sh_p2wpkh, &fingerprint, 1); // concatenate fingerprint to lsb end of p2sh_p2wpkh
-    bnz_trim(p2sh_p2wpkh); // remove zero value bytes from msb end of p2sh_p2wpkh
-    bnz_free(&fingerprint); // free resources
-}
+    uint64_t *a = NULL, *b = NULL, *res = NULL, *ref = NULL, *ws = NULL, x = 0x243F6A8885A308D3ULL;
+    size_t n, i, max_n = 262144;
+    uint32_t j, reps;
+    clock_t start;
+    double ms[3];
+    bool match = true;
 
-void get_p2wpkh_address(bnz_t *p2wpkh, const bnz_t *public_key_compressed)
-{
-    const char *bech32_alpha = "qpzry9x8gf2tvdw0s3jn54khce6mua7l", *witness_initial_str = "rrqzrqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq";
-    char witness_program_str[45] = {0}, p2wpkh_str[27] = {0}, chk_str[7] = {0};
-    uint8_t *scriptpubkey_bech32_str = NULL;
-    uint32_t i, len, chk = 1;
+    a = init_uint64_array(max_n);
+    b = init_uint64_array(max_n);
+    res = init_uint64_array(2 * max_n);
+    ref = init_uint64_array(2 * max_n);
+    ws = init_uint64_array(MUL_WS_LIMBS(max_n));
+    if (!a || !b || !res || !ref || !ws) {
+        free(a);
+        free(b);
+        free(res);
+        free(ref);
+        free(ws);
+        return;
+    }
 
-    bnz_t tmp;
-    bnz_init(&tmp);
+    for (i = 0; i < max_n; i++) { // deterministic operands, 64 bit linear congruential generator
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        a[i] = x;
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        b[i] = x;
+    }
 
-    get_ripemd160_sha256(&tmp, public_key_compressed, 20); // tmp = ripemd160(sha256(public_key_compressed)), 20 bytes, little endian order
-    bnz_reverse_digits(&tmp); // convert tmp.digits to big endian order in preparation for generating the corresponding bech32 format string
+    printf("threshold: NTT %d limbs (%d bits)\n\n", NTT_THRESHOLD, 64 * NTT_THRESHOLD);
+    printf("%10s %8s %14s %14s %14s\n", "bits", "reps", "Toom-3 ms", "NTT ms", "fast ms");
 
-    scriptpubkey_bech32_str = get_base_n_str(&tmp, 32, bech32_alpha, &len); // scriptpubkey_bech32_str = tmp.digits in bech32 format, big endian order
-    if (!scriptpubkey_bech32_str) {
-        return;
+    for (n = 1024; n <= max_n; n *= 2) {
+        reps = (uint32_t)(iterations / (n / 1024)) + 1;
+
+        start = benchmark_start();
+        for (j = 0; j < reps; j++) mul_toom3_uint64_arr(ref, a, b, n, ws); // Toom-3 all the way down, mul_balanced_uint64_arr never selects NTT
+        ms[0] = 1000.0 * (clock() - start) / CLOCKS_PER_SEC / reps;
+
+        start = benchmark_start();
+        for (j = 0; j < reps; j++) mul_ntt_uint64_arr(res, a, n, b, n);
+        ms[1] = 1000.0 * (clock() - start) / CLOCKS_PER_SEC / reps;
+        if (memcmp(res, ref, 2 * n * sizeof(uint64_t)) != 0) match = false;
+
+        start = benchmark_start();
+        for (j = 0; j < reps; j++) mul_fast_uint64_arr(res, a, n, b, n);
+        ms[2] = 1000.0 * (clock() - start) / CLOCKS_PER_SEC / reps;
+        if (memcmp(res, ref, 2 * n * sizeof(uint64_t)) != 0) match = false;
+
+        printf("%10zu %8u %14.3f %14.3f %14.3f\n", 64 * n, reps, ms[0], ms[1], ms[2]);
     }
+    printf("\nresults %s\n", match == true ? "match" : "DO NOT MATCH");
 
-    /*
+    free(a);
+    free(b);
+    free(res);
+    free(ref);
+    free(ws);
+}
 
-    The witness program comprises four elements: expanded hrp + version + scriptpubkey in bech32 + padding.
+void benchmark_mul_4x4(const SECP256K1 secp256k1, uint32_t iterations) // time the portable and the BMI2/ADX 4 by 4 limb kernels against mul_uint64_arr and sqr_uint64_arr, then sc_mul and secp256k1_ecdsa_sign_u256 with each kernel selected, on the deterministic private keys, iterations / 1000 signatures
+{
+    uint32_t i, k, kernels = 1, signatures = iterations / 1000 + 1;
+    uint64_t check = 0, t[8];
+    clock_t start;
+    bool match = true, mulx = mul_4x4_has_mulx();
+    sc_t scalars[BENCHMARK_KEYS], sc_res, r[2], s[2];
+    u256_t hashes[BENCHMARK_KEYS];
+    bnz_t key;
+    char label[128];
 
-    Expanded hrp = "rrqzr", the prefix to witness program.
+    bnz_init(&key);
 
-    Derivation:
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        get_benchmark_private_key(&key, i);
+        sc_set_bnz(&scalars[i], &key);
+        sha256((uint8_t *)&scalars[i], sizeof(scalars[i]), (uint8_t *)&hashes[i]); // arbitrary message hash
+    }
 
-    hrp = "bc" = 99 98 in ascii = 01100010 01100011 in binary
-    Expanded hrp = 00011 00011 00000 00010 00011, top 3 bits of 'b' and 'c' in ascii padded left to 5 bits + 5 zero bits separator + bottom 5 bits of 'b' and 'c' in ascii
-    Numerical values of expanded hrp = 3, 3, 0, 2, 3
-    Bech32 encoding of expanded hrp = r, r, q, z, r
+    printf("BMI2/ADX kernels: %s, self check %s\n\n", U256_MULX ? (mulx == true ? "supported" : "not supported by this processor") : "not compiled in", mul_4x4_self_check() == true ? "passed" : "FAILED");
 
-    The expanded hrp is followed by a 'q' zero digit representing the segwit version number.
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        mul_uint64_arr(t, scalars[i % BENCHMARK_KEYS].d, 4, scalars[(i + 1) % BENCHMARK_KEYS].d, 4);
+        check ^= t[i & 7];
+    }
+    print_benchmark_result("mul_uint64_arr, 4 by 4 limbs", iterations, start);
 
-    "qqqqqq" = 6 zero digits in Bech32.
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        mul_4x4_uint64_arr(t, scalars[i % BENCHMARK_KEYS].d, scalars[(i + 1) % BENCHMARK_KEYS].d);
+        check ^= t[i & 7];
+    }
+    print_benchmark_result("mul_4x4_uint64_arr (portable)", iterations, start);
 
-    */
+#if U256_MULX
+    if (mulx == true) {
+        start = benchmark_start();
+        for (i = 0; i < iterations; i++) {
+            mul_4x4_mulx_uint64_arr(t, scalars[i % BENCHMARK_KEYS].d, scalars[(i + 1) % BENCHMARK_KEYS].d);
+            check ^= t[i & 7];
+        }
+        print_benchmark_result("mul_4x4_mulx_uint64_arr (BMI2/ADX)", iterations, start);
+        kernels = 2;
+    }
+#endif
 
-    sprintf((char *)witness_program_str, "%s", (const char *)witness_initial_str); // witness_program_str = "rrqzrq" + 32 zeros to allow for offset in case strlen(scriptpubkey_bech32_str) < 32
-    sprintf((char *)witness_program_str + 38 - strlen((const char *)scriptpubkey_bech32_str), "%sqqqqqq", (const char *)scriptpubkey_bech32_str); // witness_program_str = "rrqzrq" + zero padding if required + scriptpubkey_bech32_str + "qqqqqq"
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        sqr_uint64_arr(t, scalars[i % BENCHMARK_KEYS].d, 4);
+        check ^= t[i & 7];
+    }
+    print_benchmark_result("sqr_uint64_arr, 4 limbs", iterations, start);
 
-    //get checksum, occupying 30 bits of uint32_t
-    for (i = 0; i < strlen((const char *)witness_program_str); i++) {
-        chk = p2wpkh_checksum_update(chk, char_32[(uint8_t)witness_program_str[i]]); // dgt = decimal value (0 - 31) corresponding to bech32 character
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        sqr_4x4_uint64_arr(t, scalars[i % BENCHMARK_KEYS].d);
+        check ^= t[i & 7];
     }
-    chk ^= 1; // finalise checksum, xor with 1 means standard segwit
+    print_benchmark_result("sqr_4x4_uint64_arr (portable)", iterations, start);
 
-    // convert checksum from 30 bits formatted as uint32_t (big endian order) into 6 x 5 bit digits in bech32, stored as uint8_t array, little endian order
-    for (i = 0; i < 6; i++) {
-        chk_str[i] = bech32_alpha[(chk >> ((5 - i) * 5)) & 31];
+#if U256_MULX
+    if (mulx == true) {
+        start = benchmark_start();
+        for (i = 0; i < iterations; i++) {
+            sqr_4x4_mulx_uint64_arr(t, scalars[i % BENCHMARK_KEYS].d);
+            check ^= t[i & 7];
+        }
+        print_benchmark_result("sqr_4x4_mulx_uint64_arr (BMI2/ADX)", iterations, start);
     }
+#endif
 
-    sprintf(p2wpkh_str, "%s%s", (const char *)scriptpubkey_bech32_str, (const char *)chk_str); // numerical part of address = scriptpubkey_bech32_str (20) + checksum (6)
+    for (k = 0; k < kernels; k++) { // portable kernels, then the BMI2/ADX kernels if supported
+        mul_4x4 = mul_4x4_uint64_arr;
+        sqr_4x4 = sqr_4x4_uint64_arr;
+#if U256_MULX
+        if (k == 1) {
+            mul_4x4 = mul_4x4_mulx_uint64_arr;
+            sqr_4x4 = sqr_4x4_mulx_uint64_arr;
+        }
+#endif
 
-    bnz_set_str(p2wpkh, (const char *)p2wpkh_str, 32); // convert p2wpkh_str (numerical part of standard segwit address) into standard bnz_t, will be printed with non-bech32 prefix "bc1q"
+        start = benchmark_start();
+        for (i = 0; i < iterations; i++) {
+            sc_mul(&sc_res, &scalars[i % BENCHMARK_KEYS], &scalars[(i + 1) % BENCHMARK_KEYS]);
+            check ^= sc_res.d[0];
+        }
+        sprintf(label, "sc_mul, %s kernel", k == 0 ? "portable" : "BMI2/ADX");
+        print_benchmark_result(label, iterations, start);
 
-    // free resources
-    free(scriptpubkey_bech32_str);
-    bnz_free(&tmp);
-}
+        start = benchmark_start();
+        for (i = 0; i < signatures; i++) {
+            secp256k1_ecdsa_sign_u256(&secp256k1, &scalars[i % BENCHMARK_KEYS], &hashes[i % BENCHMARK_KEYS], &r[k], &s[k], 0);
+            check ^= s[k].d[0];
+        }
+        sprintf(label, "secp256k1_ecdsa_sign_u256, %s kernel", k == 0 ? "portable" : "BMI2/ADX");
+        print_benchmark_result(label, signatures, start);
+    }
+    mul_4x4_select();
 
-uint32_t p2wpkh_checksum_update(uint32_t chk, uint8_t dgt)
-{
-    uint8_t top = (chk >> 25); // top = top 5 bits of current chk, formatted as uint8_t
-    uint32_t btm = (chk & 33554431) << 5; // btm = bottom 25 bits of current chk (from bitwise AND with 0x1ffffff) padded with 5 zeros at lsb end, formatted as uint32_t
-    btm ^= dgt; // xor btm with current digit of witness program, formatted as uint8_t
-    if ((top >> 0) & 1) btm ^= 996825010; // if 1st bit of top is set, xor btm with 1st constant (0x3b6a57b2)
-    if ((top >> 1) & 1) btm ^= 642813549; // if 2nd bit of top is set, xor btm with 2nd constant (0x26508e6d)
-    if ((top >> 2) & 1) btm ^= 513874426; // if 3rd bit of top is set, xor btm with 3rd constant (0x1ea119fa)
-    if ((top >> 3) & 1) btm ^= 1027748829; // if 4th bit of top is set, xor btm with 4th constant (0x3d4233dd)
-    if ((top >> 4) & 1) btm ^= 705979059; // if 5th bit of top is set, xor btm with 5th constant (0x2a1462b3)
-    return btm; // return btm, the new value of chk, formatted as uint32_t
+    if (kernels == 2 && (sc_equal(&r[0], &r[1]) == false || sc_equal(&s[0], &s[1]) == false)) match = false;
+    printf("results %s (check %llu)\n", match == true ? "match" : "DO NOT MATCH", (unsigned long long)(check & 255));
+
+    bnz_free(&key);
 }
 
-void print_p2wpkh_address(const bnz_t *p2wpkh, const uint8_t *str)
+void benchmark_fe4(const SECP256K1 secp256k1, uint32_t iterations) // time fe_mul against fe4_mul and the single key scalar multiplication against the 4 lane one on the deterministic private keys, one iteration being 4 public keys or 100 times 4 field multiplications, then get_public_keys_compressed_u256_batch of 16
 {
-    uint8_t *full_string = NULL, *p2wpkh_bech32_str = NULL;
-    uint32_t len;
-
-    /*
-    
-    Segwit P2WPKH addresses have a prefix "bc1q" which contains non-Bech32 characters
-    and is concatenated with the numercial part of the address.
-    
-    The numerical part is itself a concatenation of the RIPEMD160-SHA256 double
-    hash of the compressed public key encoded in Bech32, and a 6 character checksum,
-    also formatted in Bech32.
+    uint32_t i, j, products = 100 * iterations, batches = iterations / BENCHMARK_KEYS + 1;
+    uint64_t check = 0;
+    clock_t start;
+    bool match = true;
+    bnz_t key;
+    u256_t keys[BENCHMARK_KEYS], t;
+    fe_t fe_keys[4], fe_res[4], fe_ref;
+    fe4_t fe4_keys, fe4_res;
+    JPTFE single[BENCHMARK_KEYS], lanes[BENCHMARK_KEYS];
+    APT256 single_affine, lanes_affine;
+    uint8_t public_keys[33 * BENCHMARK_KEYS];
 
-    In bitcoin_math, the numerical part is treated as a number and is stored in
-    a standard bnz_t, and the prefix is only added when the Segwit P2WPKH address is
-    printed to the screen.
+    bnz_init(&key);
 
-    However, RIPEMD160 digests (and their Bech32 encodings) can have zeros at the
-    msb end, causing issues with printing when the numerical part is treated as a
-    number because leading zeros are not printed.
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        get_benchmark_private_key(&key, i);
+        u256_set_bnz(&keys[i], &key);
+    }
+    for (i = 0; i < 4; i++) {
+        fe_set_u256(&fe_keys[i], &keys[i]);
+        fe_res[i] = fe_keys[i];
+        fe4_set_u256(&fe4_keys, &keys[i], i);
+    }
+    fe4_res = fe4_keys;
 
-    bitcoin_math therefore incorporates this dedicated print function for Segwit
-    P2WPKH addresses which ensures that, where the numerical part of the address
-    has one or more zeros at the msb end, it is padded with 'q' characters
-    (representing zeros in Bech32) before the prefix is appended. 
-    
-    */
+#if defined(__AVX2__)
+    printf("AVX2: compiled in, get_public_keys_compressed_u256_batch derives 4 keys at a time\n\n");
+#else
+    printf("AVX2: not compiled in (build with -mavx2 or -march=native), the fe4 functions run one lane at a time\n\n");
+#endif
 
-    bnz_t tmp;
-    bnz_init(&tmp);
-    bnz_set_bnz(&tmp, p2wpkh); // tmp = local mutable copy of p2wpkh bnz_t with tmp.digits in standard little endian order 
-    bnz_reverse_digits(&tmp); // convert tmp.digits to big endian order
+    start = benchmark_start();
+    for (i = 0; i < products; i++) {
+        for (j = 0; j < 4; j++) {
+            fe_mul(&fe_res[j], &fe_res[j], &fe_keys[j]);
+        }
+    }
+    print_benchmark_result("fe_mul x 4", products, start);
 
-    full_string = init_uint8_array(strlen(str) + 43); // prepare full_string to receive str + 42 characters + null terminator
-    if (!full_string) {
-        return;
+    start = benchmark_start();
+    for (i = 0; i < products; i++) {
+        fe4_mul(&fe4_res, &fe4_res, &fe4_keys);
     }
+    print_benchmark_result("fe4_mul, 4 lanes", products, start);
 
-    p2wpkh_bech32_str = get_base_n_str(&tmp, 32, "qpzry9x8gf2tvdw0s3jn54khce6mua7l", &len); // get bech32 string encoding of p2wpkh_bech32_str in big endian order
-    if (!p2wpkh_bech32_str) {
-        free(full_string);
-        return;
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        for (j = 0; j < 4; j++) {
+            secp256k1_jacobian_scalar_multiplication_jptfe(&secp256k1, &keys[(4 * i + j) % BENCHMARK_KEYS], &single[(4 * i + j) % BENCHMARK_KEYS]);
+        }
+        check ^= single[4 * i % BENCHMARK_KEYS].x.n[0];
     }
+    print_benchmark_result("secp256k1_jacobian_scalar_multiplication_jptfe x 4", iterations, start);
 
-    sprintf(full_string, "%sbc1qqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq", str); // full_string = str + "bc1q" + 38 x 'q' + null terminator
-    sprintf(full_string + strlen(str) + 42 - len, p2wpkh_bech32_str); // concatenate Bech32 string with appropriate offset to ensure 'q' padding at msb end if required
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        secp256k1_jacobian_scalar_multiplication_jptfe_x4(&secp256k1, &keys[4 * i % BENCHMARK_KEYS], &lanes[4 * i % BENCHMARK_KEYS]);
+        check ^= lanes[4 * i % BENCHMARK_KEYS].x.n[0];
+    }
+    print_benchmark_result("secp256k1_jacobian_scalar_multiplication_jptfe_x4", iterations, start);
 
-    printf("%s\n", full_string); // print final string
+    start = benchmark_start();
+    for (i = 0; i < batches; i++) {
+        get_public_keys_compressed_u256_batch(&secp256k1, public_keys, keys, BENCHMARK_KEYS);
+        check ^= public_keys[33 * (i % BENCHMARK_KEYS) + 1];
+    }
+    print_benchmark_result("get_public_keys_compressed_u256_batch of 16", batches, start);
 
-    free(full_string);
-    free(p2wpkh_bech32_str);
-    bnz_free(&tmp);
+    for (i = 0; i < 4; i++) { // confirm that the lanes agree with the single paths
+        fe4_get_u256(&t, &fe4_res, i);
+        fe_set_u256(&fe_ref, &t);
+        if (fe_equal(&fe_res[i], &fe_ref) == false) match = false;
+    }
+    for (i = 0; i < BENCHMARK_KEYS; i += 4) {
+        secp256k1_jacobian_scalar_multiplication_jptfe_x4(&secp256k1, &keys[i], &lanes[i]);
+    }
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        secp256k1_jacobian_scalar_multiplication_jptfe(&secp256k1, &keys[i], &single[i]);
+        get_affine_from_jacobian(&secp256k1, &single[i], &single_affine);
+        get_affine_from_jacobian(&secp256k1, &lanes[i], &lanes_affine);
+        if (memcmp(&single_affine, &lanes_affine, sizeof(APT256)) != 0) match = false;
+    }
+    printf("results %s (check %llu)\n", match == true ? "match" : "DO NOT MATCH", (unsigned long long)(check & 255));
+
+    bnz_free(&key);
 }
 
-void get_wallet_p2pkh_addresses(const SECP256K1 secp256k1, bnz_t *master_private_key, bnz_t *master_chain_code)
+void benchmark_bnz_stats(const SECP256K1 secp256k1, uint32_t iterations) // count the calls, operand bytes and cycles of the bnz_t functions on the path of benchmark 8, a derived normal child, its compressed public key, P2PKH and P2SH-P2WPKH addresses and a DER signature, by scope, needs a build with -DBNZ_STATS=1
 {
     uint32_t i, p2pkh_leading_zeros;
-
-    bnz_t parent_private_key, parent_chain_code, parent_public_key_compressed, child_private_key, child_chain_code, child_public_key_compressed, p2pkh;
+    clock_t start;
+    bnz_t parent_private_key, parent_chain_code, parent_public_key_compressed, child_private_key, child_chain_code, child_public_key_compressed, p2pkh, p2sh_p2wpkh, hash, r, s, signature;
 
     bnz_init(&parent_private_key);
     bnz_init(&parent_chain_code);
@@ -3216,728 +9493,890 @@ void get_wallet_p2pkh_addresses(const SECP256K1 secp256k1, bnz_t *master_private
     bnz_init(&child_chain_code);
     bnz_init(&child_public_key_compressed);
     bnz_init(&p2pkh);
+    bnz_init(&p2sh_p2wpkh);
+    bnz_init(&hash);
+    bnz_init(&r);
+    bnz_init(&s);
+    bnz_init(&signature);
 
-    // m/44'
-    bnz_set_bnz(&parent_private_key, master_private_key);
-    bnz_set_bnz(&parent_chain_code, master_chain_code);
-    get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, 44);
-
-    // m/44'/0'
-    bnz_set_bnz(&parent_private_key, &child_private_key);
-    bnz_set_bnz(&parent_chain_code, &child_chain_code);
-    get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, 0);
-
-    // m/44'/0'/0'
-    bnz_set_bnz(&parent_private_key, &child_private_key);
-    bnz_set_bnz(&parent_chain_code, &child_chain_code);
-    get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, 0);
-
-    // m/44'/0'/0'/0
-    bnz_set_bnz(&parent_private_key, &child_private_key);
-    bnz_set_bnz(&parent_chain_code, &child_chain_code);
+    get_benchmark_private_key(&parent_private_key, 0); // deterministic parent key, chain code and message hash
+    get_benchmark_private_key(&parent_chain_code, 1);
+    get_benchmark_private_key(&hash, 2);
     get_public_key_compressed(secp256k1, &parent_public_key_compressed, &parent_private_key);
-    get_child_normal(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, &parent_public_key_compressed, 0);
 
-    // m/44'/0'/0'/0/0 to m/44'/0'/0'/0/19
-    bnz_set_bnz(&parent_private_key, &child_private_key);
-    bnz_set_bnz(&parent_chain_code, &child_chain_code);
-    get_public_key_compressed(secp256k1, &parent_public_key_compressed, &parent_private_key);
-    for (i = 0; i < 20; i++) {
-        get_child_normal(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, &parent_public_key_compressed, i);
+    bnz_stats_reset(); // count the loop only
+    start = benchmark_start();
+    for (i = 0; i < iterations; i++) {
+        get_child_normal(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, &parent_public_key_compressed, i % 1024);
         get_public_key_compressed(secp256k1, &child_public_key_compressed, &child_private_key);
         get_p2pkh_address(&p2pkh, &child_public_key_compressed, &p2pkh_leading_zeros);
-        printf("m/44'/0'/0'/0/%d: ", i);
-        print_p2pkh_address(&p2pkh, "", p2pkh_leading_zeros);
+        get_p2sh_p2wpkh_address(&p2sh_p2wpkh, &child_public_key_compressed);
+        secp256k1_ecdsa_sign(secp256k1, &child_private_key, &hash, &r, &s, 0);
+        secp256k1_ecdsa_get_signature_from_r_s(&r, &s, &signature);
     }
+    print_benchmark_result("derived address and signature", iterations, start);
 
     printf("\n");
+    bnz_stats_print(stdout);
 
     bnz_free(&parent_private_key);
     bnz_free(&parent_chain_code);
     bnz_free(&parent_public_key_compressed);
     bnz_free(&child_private_key);
     bnz_free(&child_chain_code);
+    bnz_free(&child_public_key_compressed);
     bnz_free(&p2pkh);
+    bnz_free(&p2sh_p2wpkh);
+    bnz_free(&hash);
+    bnz_free(&r);
+    bnz_free(&s);
+    bnz_free(&signature);
 }
 
-void get_wallet_p2sh_p2wpkh_addresses(const SECP256K1 secp256k1, bnz_t *master_private_key, bnz_t *master_chain_code)
-{
-    uint32_t i;
-    
-    bnz_t parent_private_key, parent_chain_code, parent_public_key_compressed, child_private_key, child_chain_code, child_public_key_compressed, p2sh_p2wpkh;
-
-    bnz_init(&parent_private_key);
-    bnz_init(&parent_chain_code);
-    bnz_init(&parent_public_key_compressed);
-    bnz_init(&child_private_key);
-    bnz_init(&child_chain_code);
-    bnz_init(&child_public_key_compressed);
-    bnz_init(&p2sh_p2wpkh);
+/* MENU FUNCTIONS */
 
-    // m/49'
-    bnz_set_bnz(&parent_private_key, master_private_key);
-    bnz_set_bnz(&parent_chain_code, master_chain_code);
-    get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, 49);
+uint32_t get_num_input(uint32_t, uint32_t, uint32_t);
+void get_str_input(char[], int);
+uint32_t get_benchmark_iterations(uint32_t);
+size_t get_file_size(FILE *);
+char *get_file_contents(const char *);
+void get_file_hash(const char *, uint32_t);
+void menu_1_master_keys(const char *);
+void menu_2_child_keys(const char *);
+void menu_2_1_normal_child(const char *);
+void menu_2_2_hardened_child(const char *);
+void menu_2_3_public_child(const char *);
+void menu_2_4_hdk_intermediate_values(const char *);
+void menu_3_base_converter(const char *);
+void menu_4_functions(const char *);
+void menu_4_1_validate_mnemonic_phrase_checksum(const char *);
+void menu_4_2_private_and_public_key_functions(const char *);
+void menu_4_2_1_private_key_to_WIF(const char *);
+void menu_4_2_2_WIF_to_private_key(const char *);
+void menu_4_2_3_public_key_to_address(const char *);
+void menu_4_3_secp256k1_functions(const char *);
+void menu_4_3_1_secp256k1_point_addition(const char *);
+void menu_4_3_2_secp256k1_point_doubling(const char *);
+void menu_4_3_3_secp256k1_scalar_multiplication(const char *);
+void menu_4_4_ecdsa_functions(const char *);
+void menu_4_4_1_ecdsa_sign(const char *);
+void menu_4_4_2_ecdsa_verify_signature(const char *);
+void menu_4_4_3_ecdsa_verify_r_s(const char *);
+void menu_5_file_hash_functions(const char *);
+void menu_6_benchmarks(const char *);
+void menu_6_1_benchmark_jacobian_scalar_multiplication(const char *);
+void menu_6_2_benchmark_reduce_p(const char *);
+void menu_6_3_benchmark_sc_mul(const char *);
+void menu_6_4_benchmark_mod_ctx(const char *);
+void menu_6_5_benchmark_multiplication(const char *);
+void menu_6_6_benchmark_public_key_xy(const char *);
+void menu_6_7_benchmark_arena(const char *);
+void menu_6_8_benchmark_derived_address(const char *);
+void menu_6_9_benchmark_word_operations(const char *);
+void menu_6_10_benchmark_inverse(const char *);
+void menu_6_11_benchmark_batch_inverse(const char *);
+void menu_6_12_benchmark_mod_pow(const char *);
+void menu_6_13_benchmark_lehmer_inverse(const char *);
+void menu_6_14_benchmark_radix_conversion(const char *);
+void menu_6_15_benchmark_radix_divide_and_conquer(const char *);
+void menu_6_16_benchmark_radix_power_of_two(const char *);
+void menu_6_17_benchmark_ntt_multiplication(const char *);
+void menu_6_18_benchmark_mul_4x4(const char *);
+void menu_6_19_benchmark_fe4(const char *);
+void menu_6_20_benchmark_bnz_stats(const char *);
 
-    // m/49'/0'
-    bnz_set_bnz(&parent_private_key, &child_private_key);
-    bnz_set_bnz(&parent_chain_code, &child_chain_code);
-    get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, 0);
+uint32_t get_num_input(uint32_t max_len, uint32_t min, uint32_t max) // get base 10 number between min and max from stdin
+{
+    char str[max_len + 1];
+    int i = 0, ch;
+    uint32_t res;
+    while ((ch = getchar()) != '\n' && ch != EOF) {
+        if (i < max_len && isdigit(ch)) {
+            str[i++] = ch;
+        }
+    }
+    str[i] = 0;
+    res = strtoul(str, NULL, 10);
+    if (res < min || res > max) res = min;
+    return res;
+}
 
-    // m/49'/0'/0'
-    bnz_set_bnz(&parent_private_key, &child_private_key);
-    bnz_set_bnz(&parent_chain_code, &child_chain_code);
-    get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, 0);
+void get_str_input(char str[], int max_len) // get string from stdin with strlen <= max_len
+{
+    int i = 0, ch;
+    while ((ch = getchar()) != '\n' && ch != EOF) {
+        if (ch >= 32 && ch <= 126 && i < max_len) {
+            str[i++] = ch;
+        }
+    }
+    str[i] = 0;
+}
 
-    // m/49'/0'/0'/0
-    bnz_set_bnz(&parent_private_key, &child_private_key);
-    bnz_set_bnz(&parent_chain_code, &child_chain_code);
-    get_public_key_compressed(secp256k1, &parent_public_key_compressed, &parent_private_key);
-    get_child_normal(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, &parent_public_key_compressed, 0);
+uint32_t get_benchmark_iterations(uint32_t default_iterations) // get number of benchmark iterations from stdin, 'Enter' selects default_iterations
+{
+    uint32_t iterations;
 
-    // m/49'/0'/0'/0/0 to m/49'/0'/0'/0/19
-    bnz_set_bnz(&parent_private_key, &child_private_key);
-    bnz_set_bnz(&parent_chain_code, &child_chain_code);
-    get_public_key_compressed(secp256k1, &parent_public_key_compressed, &parent_private_key);
-    for (i = 0; i < 20; i++) {
-        get_child_normal(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, &parent_public_key_compressed, i);
-        get_public_key_compressed(secp256k1, &child_public_key_compressed, &child_private_key);
-        get_p2sh_p2wpkh_address(&p2sh_p2wpkh, &child_public_key_compressed);
-        printf("m/49'/0'/0'/0/%d: ", i);
-        bnz_print(&p2sh_p2wpkh, 58, "");
-    }
-    printf("\n");
+    printf("Iterations (press 'Enter' for %u): ", default_iterations);
+    iterations = get_num_input(7, 0, 1000000);
+    if (iterations < 1) iterations = default_iterations;
 
-    bnz_free(&parent_private_key);
-    bnz_free(&parent_chain_code);
-    bnz_free(&parent_public_key_compressed);
-    bnz_free(&child_private_key);
-    bnz_free(&child_chain_code);
-    bnz_free(&p2sh_p2wpkh);
+    return iterations;
 }
 
-void get_wallet_p2wpkh_addresses(const SECP256K1 secp256k1, bnz_t *master_private_key, bnz_t *master_chain_code)
+size_t get_file_size(FILE *file)
 {
-    uint32_t i;
-    
-    bnz_t parent_private_key, parent_chain_code, parent_public_key_compressed, child_private_key, child_chain_code, child_public_key_compressed, p2wpkh;
+    size_t file_size;
+    fseek(file, 0, SEEK_END);
+    file_size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    return file_size;
+}
 
-    bnz_init(&parent_private_key);
-    bnz_init(&parent_chain_code);
-    bnz_init(&parent_public_key_compressed);
-    bnz_init(&child_private_key);
-    bnz_init(&child_chain_code);
-    bnz_init(&child_public_key_compressed);
-    bnz_init(&p2wpkh);
+char *get_file_contents(const char *file_path)
+{
+    char *file_contents = NULL;
+    size_t file_size, bytes_read;
+    FILE *file = NULL;
 
-    // m/84'
-    bnz_set_bnz(&parent_private_key, master_private_key);
-    bnz_set_bnz(&parent_chain_code, master_chain_code);
-    get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, 84);
+    file = fopen(file_path, "rb");
 
-    // m/84'/0'
-    bnz_set_bnz(&parent_private_key, &child_private_key);
-    bnz_set_bnz(&parent_chain_code, &child_chain_code);
-    get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, 0);
+    if (!file) {
+        printf("Could not open file: %s\n\n", file_path);
+        return NULL;
+    }
 
-    // m/84'/0'/0'
-    bnz_set_bnz(&parent_private_key, &child_private_key);
-    bnz_set_bnz(&parent_chain_code, &child_chain_code);
-    get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, 0);
+    file_size = get_file_size(file);
 
-    // m/84'/0'/0'/0
-    bnz_set_bnz(&parent_private_key, &child_private_key);
-    bnz_set_bnz(&parent_chain_code, &child_chain_code);
-    get_public_key_compressed(secp256k1, &parent_public_key_compressed, &parent_private_key);
-    get_child_normal(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, &parent_public_key_compressed, 0);
+    file_contents = malloc(file_size + 1);
 
-    // m/84'/0'/0'/0/0 to m/84'/0'/0'/0/19
-    bnz_set_bnz(&parent_private_key, &child_private_key);
-    bnz_set_bnz(&parent_chain_code, &child_chain_code);
-    get_public_key_compressed(secp256k1, &parent_public_key_compressed, &parent_private_key);
-    for (i = 0; i < 20; i++) {
-        get_child_normal(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, &parent_public_key_compressed, i);
-        get_public_key_compressed(secp256k1, &child_public_key_compressed, &child_private_key);
-        get_p2wpkh_address(&p2wpkh, &child_public_key_compressed);
-        printf("m/84'/0'/0'/0/%d: ", i);
-        print_p2wpkh_address(&p2wpkh, "");
+    if (!file_contents) {
+        fclose(file);
+        printf("Could not allocate memory for file contents: %s.\n\n", file_path);
+        return NULL;
     }
-    printf("\n");
-
-    bnz_free(&parent_private_key);
-    bnz_free(&parent_chain_code);
-    bnz_free(&parent_public_key_compressed);
-    bnz_free(&child_private_key);
-    bnz_free(&child_chain_code);
-    bnz_free(&p2wpkh);
-}
 
-/* BITCOIN ECDSA FUNCTIONS */
+    memset(file_contents, 0, file_size + 1);
+    bytes_read = fread(file_contents, 1, file_size, file);
+    fclose(file);
 
-void secp256k1_ecdsa_get_random_nonce(const SECP256K1, bnz_t *);
-void secp256k1_ecdsa_get_RFC6979_nonce(const SECP256K1, const bnz_t *, const bnz_t *, bnz_t *);
-void secp256k1_ecdsa_get_signature_from_r_s(const bnz_t *, const bnz_t *, bnz_t *);
-void secp256k1_ecdsa_get_r_s_from_signature(const bnz_t *, bnz_t *, bnz_t *);
-void secp256k1_ecdsa_sign(const SECP256K1, const bnz_t *, const bnz_t *, bnz_t *, bnz_t *, uint32_t);
-bool secp256k1_ecdsa_verify_from_signature(const SECP256K1, const bnz_t *, const bnz_t *, const bnz_t *);
-bool secp256k1_ecdsa_verify_from_r_s(const SECP256K1, const bnz_t *, const bnz_t *, const bnz_t *, const bnz_t *);
+    if (bytes_read != file_size) {
+        free(file_contents);
+        printf("Could not read entire file: %s.\n\n", file_path);
+        return NULL;
+    }
 
-void secp256k1_ecdsa_get_random_nonce(SECP256K1 secp256k1, bnz_t *nonce)
-{
-    do {
-        bnz_256_bit_rnd(nonce);
-    } while (bnz_cmp_bnz(nonce, &secp256k1.n) == 1);
+    return file_contents;
 }
 
-void secp256k1_ecdsa_get_RFC6979_nonce(const SECP256K1 secp256k1, const bnz_t *private_key, const bnz_t *hash, bnz_t *nonce) // RFC6979
+void get_file_hash(const char *version, uint32_t hash_type)
 {
-    uint8_t mac[32];
-    int range_flag;
+    char file_path[256] = {0}, *file_contents = NULL;
+    uint32_t file_size;
+    FILE *f = NULL;
+    bnz_t h;
 
-    bnz_t k, v, key, message, private_key_tmp;
-    bnz_init(&k);
-    bnz_init(&v);
-    bnz_init(&key);
-    bnz_init(&message);
-    bnz_init(&private_key_tmp);
+    bnz_init(&h);
 
-    bnz_set_bnz(&private_key_tmp, private_key); // mutable copy of private_key to permit resizing to 32 bytes
-    bnz_resize(&private_key_tmp, 32, true); // private_key_tmp resized to 32 bytes
+    system("cls");
+    printf("%s\n\n", version);
 
-    // (a) hash = SHA256(m)
+    printf("File path: ");
+    get_str_input(file_path, 256);
 
-    // (b) V = 0x1 x 32
-    bnz_set_str(&v, (const char *)"0101010101010101010101010101010101010101010101010101010101010101", 16); // v = 0x1 x 32
-    // no need to convert v to big endian order because is is an array of 32 x 0x1 bytes
+    file_contents = get_file_contents(file_path);
 
-    // (c) K = 0x0 x 32
-    bnz_set_i32(&k, 0); // k = 0x0 x 32
+    if (!file_contents) {
+        printf("Press any key to continue...");
+        getchar();
+        return;
+    }
 
-    // (d) K = HMAC_K(V || 0x00 || private_key || hash)
-    bnz_set_bnz(&key, &k); // key = k
-    // no need to convert key to big endian order because is is an array of 32 x 0x0 bytes
-    bnz_resize(&key, 32, true); // ensure key size is 32 bytes
+    system("cls");
+    printf("%s\n\n", version);
+
+    printf("File path: %s\n\n", file_path);
 
-    bnz_set_bnz(&message, &v); // message = v, message will be assembled in little endian order
-    bnz_concatenate_ui8(&message, &message, 0, 1); // message = v || 0x0
-    bnz_concatenate_bnz(&message, &message, &private_key_tmp, 1); // message = v || 0x0 || private_key_tmp
-    bnz_concatenate_bnz(&message, &message, hash, 1); // message = v || 0x0 || private_key_tmp || hash
-    bnz_reverse_digits(&message); // convert message to big endian order
+    switch(hash_type) {
+        case 1:
+            get_ripemd160(&h, (const uint8_t *)file_contents);
+            bnz_print(&h, 16, "RIPEMD160: ");
+            break;
+        case 2:
+            get_sha256(&h, (const uint8_t *)file_contents);
+            bnz_print(&h, 16, "SHA256: ");
+            break;
+        case 3:
+            get_sha512(&h, (const uint8_t *)file_contents);
+            bnz_print(&h, 16, "SHA512: ");
+            break;
+        default:
+            return;
+    }
 
-    hmac_sha256(key.digits, key.size, message.digits, message.size, mac, 32); // mac = hmac_sha256(key, message)
+    free(file_contents);
 
-    bnz_resize(&k, 32, false); // prepare k to receive 32 bytes of mac
-    memcpy(k.digits, mac, 32); // k = mac
-    bnz_reverse_digits(&k); // convert k to standard little endian order
+    printf("\n");
 
-    // (e) V = HMAC_K(V)
-    bnz_set_bnz(&key, &k); // key = k
-    bnz_reverse_digits(&key); // convert key to big endian order
+    printf("Press any key to continue...");
 
-    bnz_set_bnz(&message, &v); // message = v
-    bnz_reverse_digits(&message); // convert message to big endian order
+    getchar();
+}
 
-    hmac_sha256(key.digits, key.size, message.digits, message.size, mac, 32); // mac = hmac_sha256(key, message)
+void menu_1_master_keys(const char *version) // input 256 bits of entropy and generate master private key, master chain code, master public key, and corresponding p2pkh and p2wpkh hdk addresses
+{
+    uint32_t i, wd_ids[24];
+    char entropy_str[257], base = 16, passphrase_str[257], *mnemonic = NULL;
+    bnz_t entropy, master_private_key, master_chain_code, master_public_key, master_public_key_compressed, seed;
 
-    bnz_resize(&v, 32, false); // prepare v to receive 32 bytes of mac
-    memcpy(v.digits, mac, 32); // v = mac
-    bnz_reverse_digits(&v); // convert v to standard little endian order
+    SECP256K1 secp256k1;
 
-    // (f) K = HMAC_K(V || 0x01 || int2octets(x) || bits2octets(h1))
-    bnz_set_bnz(&key, &k); // key = k
-    bnz_reverse_digits(&key); // convert key to big endian order
-    bnz_resize(&key, 32, true); // ensure that key is 32 bytes
+    bnz_init(&entropy);
+    bnz_init(&master_private_key);
+    bnz_init(&master_chain_code);
+    bnz_init(&master_public_key);
+    bnz_init(&master_public_key_compressed);
+    bnz_init(&seed);
 
-    bnz_set_bnz(&message, &v); // message = v
-    bnz_concatenate_ui8(&message, &message, 1, 1); // message = v || 0x1 
-    bnz_concatenate_bnz(&message, &message, &private_key_tmp, 1); // message = v || 0x1 || private_key_tmp
-    bnz_concatenate_bnz(&message, &message, hash, 1); // message = v || 0x1 || private_key_tmp || hash
-    bnz_reverse_digits(&message); // convert message to big endian order
+    secp256k1_init(&secp256k1);
 
-    hmac_sha256(key.digits, key.size, message.digits, message.size, mac, 32); // mac = hmac_sha256(key, message)
+    system("cls");
+    printf("%s\n\n", version);
 
-    bnz_resize(&k, 32, false); // prepare k to receive 32 bytes of mac
-    memcpy(k.digits, mac, 32); // k = mac
-    bnz_reverse_digits(&k); // convert k to standard little endian order
+    printf("Entropy (press 'Enter' for random): ");
+    get_str_input(entropy_str, 256);
 
-    // (g) V = HMAC_K(V)
-    bnz_set_bnz(&key, &k); // key = k
-    bnz_reverse_digits(&key); // convert key to big endian order
+    system("cls");
+    printf("%s\n\n", version);
+    printf("Entropy: ");
 
-    bnz_set_bnz(&message, &v); // message = v
-    bnz_reverse_digits(&message); // convert message to big endian order
+    if (isalnum(entropy_str[0])) {
+        printf("%s\n", entropy_str);
+        printf("Base (2 - 64): ");
+        base = get_num_input(2, 0, 64);
+        if (base < 2) base = 16;
+        bnz_set_str(&entropy, (const char *)entropy_str, base);
+    } else {
+        bnz_256_bit_rnd(&entropy);
+    }
 
-    hmac_sha256(key.digits, key.size, message.digits, message.size, mac, 32); // mac = hmac_sha256(key, message)
+    system("cls");
+    printf("%s\n\n", version); 
+    bnz_print(&entropy, 16, "Entropy: ");
+    if (base == 16) {
+        printf("Base: 16\n");
+    } else {
+        printf("Base: 16 (converted from base %d)\n", base);
+    }
 
-    bnz_resize(&v, 32, false); // prepare v to receive 32 bytes of mac
-    memcpy(v.digits, mac, 32); // v = mac
-    bnz_reverse_digits(&v); // convert v to standard little endian order
+    printf("Passphrase (optional): ");
+    get_str_input(passphrase_str, 256);
 
-    // (h) final loop to confirm nonce is at least 32 bytes and lies in the range 1 <= nonce <= secp256k1.n
-    do {
-        // 1. set nonce to zero length bnz_t
-        bnz_init(nonce);
+    system("cls");
+    printf("%s\n\n", version);
+    bnz_print(&entropy, 16, "ENTROPY: ");
+    printf("BASE: 16\n\n");
 
-        // 2. V = HMAC_K(V), nonce = nonce || V until nonce.size >= 32
-        while (nonce->size < 32) {
-            bnz_set_bnz(&key, &k); // key = k
-            bnz_reverse_digits(&key); // convert key to big endian order
+    entropy_checksum(&entropy);
 
-            bnz_set_bnz(&message, &v); // message = v
-            bnz_reverse_digits(&message); // convert message to big endian order
+    get_bip39_word_ids_bnz(&entropy, wd_ids);
 
-            hmac_sha256(key.digits, key.size, message.digits, message.size, mac, 32); // mac = hmac_sha256(key, message)
+    printf("CHECKSUM: 0x%02x\n\n", entropy.digits[0]);
 
-            bnz_resize(&v, 32, false); // prepare v to receive 32 bytes of mac
-            memcpy(v.digits, mac, 32); // v = mac
-            bnz_reverse_digits(&v); // convert v to standard little endian order
+    printf("BIP39 IDs: %d", wd_ids[0]);
+    for (i = 1; i < 24; i++) {
+        printf(", %d", wd_ids[i]);
+    }
+    printf("\n\n");
 
-            bnz_concatenate_bnz(nonce, nonce, &v, 1); // nonce = nonce || v
-        }
+    mnemonic = get_mnemonic_phrase(wd_ids);
+    printf("MNEMONIC PHRASE: %s\n\n", mnemonic);
 
-        // 3. ensure nonce is in the range 1 to Secp256k1.n
-        range_flag = 0;
+    if (isalnum(passphrase_str[0])) {
+        printf("PASSPHRASE: %s\n\n", passphrase_str);
+    }
 
-        if (bnz_cmp_i32(nonce, 1) == -1 || bnz_cmp_bnz(nonce, &secp256k1.n) == 1) {
+    get_seed_from_mnemonic_phrase(&seed, mnemonic, passphrase_str);
+    bnz_print(&seed, 16, "SEED: ");
+    printf("\n");
 
-            // K = HMAC_K(V || 0x00)
-            bnz_set_bnz(&key, &k); // key = k
+    get_master_keys(&master_private_key, &master_chain_code, &seed);
 
-            bnz_set_bnz(&message, &v); // message = v
+    if (is_valid_private_key(secp256k1, &master_private_key) == false) { // ensure that master_private_key is valid
+        system("cls");
+        printf("%s\n\n", version);
+        bnz_print(&master_private_key, 16, "Master private key: ");
+        printf("\n");
+        printf("This private key is not in the valid range 0 < k < Secp256k1.\n\n");
+        printf("It is not possible to generate a public key from this private key.\n\n");
+        printf("Press any key to rerun the command with a different private key value.\n");
+        getchar();
 
-            bnz_concatenate_ui8(&message, &message, 0, 1); // message = message || 0x0
-            bnz_concatenate_bnz(&message, &message, &private_key_tmp, 1); // message = message || 0x0 || private_key_tmp
-            bnz_concatenate_bnz(&message, &message, hash, 1); // message = message || 0x0 || private_key_tmp || hash
-            bnz_reverse_digits(&message); // convert message to big endian order
+        bnz_free(&entropy);
+        bnz_free(&master_private_key);
+        bnz_free(&master_chain_code);
+        bnz_free(&master_public_key);
+        bnz_free(&master_public_key_compressed);
+        bnz_free(&seed);
 
-            hmac_sha256(key.digits, key.size, message.digits, message.size, mac, 32); // mac = hmac_sha256(key, message)
+        secp256k1_free(secp256k1);
 
-            bnz_resize(&k, 32, false); // prepare k to receive 32 bytes of mac
-            memcpy(k.digits, mac, 32); // k = mac
-            bnz_reverse_digits(&k); // convert k to standard little endian order
+        menu_1_master_keys(version);
+    }
+    
+    bnz_print(&master_private_key, 16, "MASTER PRIVATE KEY: ");
+    bnz_print(&master_chain_code, 16, "MASTER CHAIN CODE: ");
 
-            // V = HMAC_K(V)
-            bnz_set_bnz(&key, &k); // key = k
+    printf("\nHDK ADDRESSES:\n");
+    
+    get_wallet_p2pkh_addresses(secp256k1, &master_private_key, &master_chain_code);
+    get_wallet_p2sh_p2wpkh_addresses(secp256k1, &master_private_key, &master_chain_code);
+    get_wallet_p2wpkh_addresses(secp256k1, &master_private_key, &master_chain_code);
 
-            bnz_set_bnz(&message, &v); // message = v
+    bnz_free(&entropy);
+    bnz_free(&master_private_key);
+    bnz_free(&master_chain_code);
+    bnz_free(&master_public_key);
+    bnz_free(&master_public_key_compressed);
+    bnz_free(&seed);
 
-            hmac_sha256(key.digits, key.size, message.digits, message.size, mac, 32); // mac = hmac_sha256(key, message)
+    printf("press any key to continue...");
 
-            bnz_resize(&v, 32, false); // prepare v to receive max
-            memcpy(v.digits, mac, 32); // v = mac
-            bnz_reverse_digits(&v); // convert to standard little endian order 
-        } else {
-            range_flag = 1; // if 1 <= nonce <= secp256k1.n, set range_flag 
-        }
-    } while (range_flag != 1);
+    getchar();
+}
 
-    bnz_free(&k);
-    bnz_free(&v);
-    bnz_free(&key);
-    bnz_free(&message);
-    bnz_free(&private_key_tmp);
+void menu_2_child_keys(const char *version)
+{
+    int menu;
+    system("cls");
+    printf("%s\n\n", version);
+    printf("1. Normal child\n");
+    printf("2. Hardened child\n");
+    printf("3. Child public key\n");
+    printf("4. HDK intermediate values\n");
+    printf("\n");
+    menu = get_num_input(1, 0, 4);
+    switch (menu) {
+        case 1:
+            menu_2_1_normal_child(version);
+            break;
+        case 2:
+            menu_2_2_hardened_child(version);
+            break;
+        case 3:
+            menu_2_3_public_child(version);
+            break;
+        case 4:
+            menu_2_4_hdk_intermediate_values(version);
+            break;
+        default:
+            break;
+    }
 }
 
-void secp256k1_ecdsa_get_signature_from_r_s(const bnz_t *r, const bnz_t *s, bnz_t *signature) // 0x30 [len(signature)] 0x02 [len(r)] [r] 0x02 [len(s)] [s]
+void menu_2_1_normal_child(const char *version)
 {
-    uint8_t len;
-    bnz_t rr, ss;
+    uint8_t parent_private_key_str[67], parent_chain_code_str[67], depth_num;
+    uint32_t index_num, p2pkh_leading_zeros;
+    bnz_t tmp, index, entropy, parent_private_key, parent_chain_code, parent_public_key_compressed, child_private_key, child_chain_code, child_public_key_compressed, p2pkh, p2sh_p2wpkh, p2wpkh;
+    APT parent_public_key_pt, child_public_key_pt;
+    SECP256K1 secp256k1;
+
+    secp256k1_init(&secp256k1);
 
-    bnz_init(&rr);
-    bnz_init(&ss);
+    bnz_init(&tmp);
+    bnz_init(&index);
+    bnz_init(&entropy);
+    bnz_init(&parent_private_key);
+    bnz_init(&parent_chain_code);
+    bnz_init(&parent_public_key_compressed);
+    bnz_init(&child_private_key);
+    bnz_init(&child_chain_code);
+    bnz_init(&child_public_key_compressed);
+    bnz_init(&p2pkh);
+    bnz_init(&p2sh_p2wpkh);
+    bnz_init(&p2wpkh);
 
-    bnz_set_bnz(&rr, r); // mutable copies of r and s
-    bnz_set_bnz(&ss, s);
+    bnz_init(&parent_public_key_pt.x);
+    bnz_init(&parent_public_key_pt.y);
+    bnz_init(&child_public_key_pt.x);
+    bnz_init(&child_public_key_pt.y);
 
-    if (rr.digits[rr.size - 1] > 128) bnz_concatenate_ui8(&rr, &rr, 0, 0); // if msb of r > 128, concatenate 0x0 at msb end
-    if (ss.digits[ss.size - 1] > 128) bnz_concatenate_ui8(&ss, &ss, 0, 0); // if msb of s > 128, concatenate 0x0 at msb end
+    system("cls");
+    printf("%s\n\n", version);
 
-    len = rr.size + ss.size + 6; // len = total length of signature
+    printf("Parent private key (press 'Enter' for random): ");
+    get_str_input(parent_private_key_str, 66);
 
-    bnz_set_ui32(signature, 48); // signature = 0x30
-    bnz_concatenate_ui8(signature, signature, len, 1); // concatente total length
+    if (isalnum(parent_private_key_str[0])) {
+        printf("%s\n", parent_private_key_str);
+        bnz_set_str(&parent_private_key, (const char *)parent_private_key_str, 16);
+        system("cls");
+        printf("%s\n\n", version);
+        bnz_print(&parent_private_key, 16, "Parent private key: ");
+        printf("Parent chain code: ");
+        get_str_input(parent_chain_code_str, 66);
+        bnz_set_str(&parent_chain_code, (const char *)parent_chain_code_str, 16);
+        system("cls");
+        printf("%s\n\n", version);
+        bnz_print(&parent_private_key, 16, "Parent private key: ");
+        bnz_print(&parent_chain_code, 16, "Parent chain code: ");
+    } else {
+        get_random_master_keys(&entropy, &parent_private_key, &parent_chain_code);
+        system("cls");
+        printf("%s\n\n", version);
+        bnz_print(&entropy, 16, "Entropy: ");
+        bnz_print(&parent_private_key, 16, "Parent private key: ");
+        bnz_print(&parent_chain_code, 16, "Parent chain code: ");
+    }
 
-    bnz_concatenate_ui8(signature, signature, 2, 1); // concatenate 0x02
-    bnz_concatenate_ui8(signature, signature, rr.size, 1); // concatenate len(rr)
-    bnz_concatenate_bnz(signature, signature, &rr, 1); // concatenate rr
+    if (is_valid_private_key(secp256k1, &parent_private_key) == false) { // ensure that parent_private_key is valid
+        system("cls");
+        printf("%s\n\n", version);
+        bnz_print(&parent_private_key, 16, "Parent private key: ");
+        printf("\n");
+        printf("This private key is not in the valid range 0 < k < Secp256k1.\n\n");
+        printf("It is not possible to generate a public key from this private key.\n\n");
+        printf("Press any key to rerun the command with a different private key value.\n");
+        getchar();
 
-    bnz_concatenate_ui8(signature, signature, 2, 1); // concatenate 0x02
-    bnz_concatenate_ui8(signature, signature, ss.size, 1); // concatenate len(ss)
-    bnz_concatenate_bnz(signature, signature, &ss, 1); // concatenate ss
+        bnz_free(&tmp);
+        bnz_free(&index);
+        bnz_free(&entropy);
+        bnz_free(&parent_private_key);
+        bnz_free(&parent_chain_code);
+        bnz_free(&parent_public_key_compressed);
+        bnz_free(&child_private_key);
+        bnz_free(&child_chain_code);
+        bnz_free(&child_public_key_compressed);
+        bnz_free(&p2pkh);
+        bnz_free(&p2sh_p2wpkh);
+        bnz_free(&p2wpkh);
 
-    bnz_free(&rr); // free resources
-    bnz_free(&ss);
-}
+        bnz_free(&parent_public_key_pt.x);
+        bnz_free(&parent_public_key_pt.y);
+        bnz_free(&child_public_key_pt.x);
+        bnz_free(&child_public_key_pt.y);
 
-void secp256k1_ecdsa_get_r_s_from_signature(const bnz_t *signature, bnz_t *r, bnz_t *s)
-{
-    bnz_t tmp;
-    bnz_init(&tmp);
+        secp256k1_free(secp256k1);
 
-    bnz_set_bnz(&tmp, signature); // tmp = local mutable copy of signature, little endian order
+        menu_2_1_normal_child(version);
+    }
 
-    bnz_reverse_digits(&tmp); // reverse tmp, big endian order
+    printf("\n");
+    printf("Depth (1 to 255): ");
+    depth_num = get_num_input(3, 1, 255);
 
-    bnz_resize(r, tmp.digits[3], false); // tmp.digits[3] = len(r) 
-    memcpy(r->digits, tmp.digits + 4, tmp.digits[3]); // copy len(r) bytes into r, offset 4
-    bnz_reverse_digits(r);
-    bnz_trim(r); // delete any leading zeros from the msb end
+    system("cls");
+    printf("%s\n\n", version);
+    if (bnz_is_zero(&entropy) == false) bnz_print(&entropy, 16, "Entropy: ");
+    bnz_print(&parent_private_key, 16, "Parent private key: ");
+    bnz_print(&parent_chain_code, 16, "Parent chain code: ");
+    printf("\n");
+    printf("Depth: %u\n", depth_num);
+    printf("Index (0 to 2147483647): ");
+    index_num = get_num_input(11, 0, 2147483647);
 
-    bnz_resize(s, tmp.digits[tmp.digits[3] + 5], false); // tmp.digits[len(r) + 5] = len(s)
-    memcpy(s->digits, tmp.digits + tmp.digits[3] + 6, tmp.digits[tmp.digits[3] + 5]); // copy len(s) bytes into s, offset len(r) + 6
-    bnz_reverse_digits(s);
-    bnz_trim(s); // delete any leading zeros from the msb end
+    get_public_key(secp256k1, &parent_public_key_pt, &parent_public_key_compressed, &parent_private_key);
 
-    bnz_free(&tmp); // free resources
-}
+    system("cls");
+    printf("%s\n\n", version);
+    if (bnz_is_zero(&entropy) == false) bnz_print(&entropy, 16, "ENTROPY: ");
+    bnz_print(&parent_private_key, 16, "PARENT PRIVATE KEY: ");
+    bnz_print(&parent_chain_code, 16, "PARENT CHAIN CODE: ");
+    bnz_print(&parent_public_key_compressed, 16, "PARENT PUBLIC KEY COMPRESSED: ");
+    bnz_print(&parent_public_key_pt.x, 16, " x: ");
+    bnz_print(&parent_public_key_pt.y, 16, " y: ");
+    printf("\n");
+    printf("DEPTH: %u\n", depth_num);
+    printf("INDEX: %u\n", index_num);
+    printf("\n");
 
-void secp256k1_ecdsa_sign(const SECP256K1 secp256k1, const bnz_t *private_key, const bnz_t *hash, bnz_t *r, bnz_t *s, uint32_t nonce_type) // r = x coordinate of (nonce * Secp256k1.G), s = (hash + (r * private_key)) / nonce
-{
-    bnz_t nonce, inv_nonce, half_n;
-    APT tmp; // temporary APT
+    get_child_normal(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, &parent_public_key_compressed, index_num);
 
-    bnz_init(&nonce); // random nonce ("number used once")
-    bnz_init(&inv_nonce); // modular multiplicative inverse of nonce
-    bnz_init(&half_n); // floor(secp256k1.n / 2) // floor(secp256k1.n / 2), to determine whether s is "high" or "low"
+    bnz_print(&child_private_key, 16, "CHILD PRIVATE KEY: ");
+    bnz_print(&child_chain_code, 16, "CHILD CHAIN CODE: ");
+    printf("\n");
 
-    bnz_init(&tmp.x);
-    bnz_init(&tmp.y);
+    get_public_key(secp256k1, &child_public_key_pt, &child_public_key_compressed, &child_private_key); // generate compressed public key from private key
+    get_p2pkh_address(&p2pkh, &child_public_key_compressed, &p2pkh_leading_zeros); // serialise p2pkh address
+    get_p2sh_p2wpkh_address(&p2sh_p2wpkh, &child_public_key_compressed); // serialise p2sh_p2wpkh address
+    get_p2wpkh_address(&p2wpkh, &parent_public_key_compressed); // serialise p2wpkh address
 
-    bnz_set_str(&half_n, (const char *)"57896044618658097711785492504343953926418782139537452191302581570759080747168", 10); // floor(secp256k1.n / 2)
+    bnz_print(&child_public_key_compressed, 16, "CHILD PUBLIC KEY COMPRESSED: ");
+    bnz_print(&child_public_key_pt.x, 16, " x: ");
+    bnz_print(&child_public_key_pt.y, 16, " y: ");
+    print_p2pkh_address(&p2pkh, "CHILD P2PKH ADDRESS: ", p2pkh_leading_zeros);
+    bnz_print(&p2sh_p2wpkh, 58, "CHILD P2SH-P2WPKH ADDRESS: ");
+    print_p2wpkh_address(&p2wpkh, "CHILD P2WPKH ADDRESS: ");
+    printf("\n");
 
-    if (nonce_type == 0) {
-        secp256k1_ecdsa_get_RFC6979_nonce(secp256k1, private_key, hash, &nonce); // RFC6979 deterministic nonce
-    } else {
-        secp256k1_ecdsa_get_random_nonce(secp256k1, &nonce); // random nonce
-    }
+    bnz_free(&tmp);
+    bnz_free(&index);
+    bnz_free(&entropy);
+    bnz_free(&parent_private_key);
+    bnz_free(&parent_chain_code);
+    bnz_free(&parent_public_key_compressed);
+    bnz_free(&child_private_key);
+    bnz_free(&child_chain_code);
+    bnz_free(&child_public_key_compressed);
+    bnz_free(&p2pkh);
+    bnz_free(&p2sh_p2wpkh);
+    bnz_free(&p2wpkh);
 
-    bnz_modular_multiplicative_inverse(&inv_nonce, &nonce, &secp256k1.n); // set value of inv_nonce to the modular multiplicative inverse of nonce, modulo secp256k1.n the curve order
-    secp256k1_scalar_multiplication(secp256k1, &secp256k1.G, &nonce, &tmp); // tmp = nonce * secp256k1.G (generator point)
+    bnz_free(&parent_public_key_pt.x);
+    bnz_free(&parent_public_key_pt.y);
+    bnz_free(&child_public_key_pt.x);
+    bnz_free(&child_public_key_pt.y);
 
-    bnz_set_bnz(r, &tmp.x); // r = x coordinate of tmp
-    bnz_multiply_bnz(s, private_key, r); // s = private_key * r
+    secp256k1_free(secp256k1);
 
-    bnz_mod_bnz(s, s, &secp256k1.n); // s = s mod secp256k1.n
-    bnz_add_bnz(s, s, hash); // s = s + hash
-    bnz_mod_bnz(s, s, &secp256k1.n); // s = s mod secp256k1.n
-    bnz_multiply_bnz(s, s, &inv_nonce); // s = s * inv_nonce
-    bnz_mod_bnz(s, s, &secp256k1.n); // s = s mod secp256k1.n
-    if (bnz_cmp_bnz(s, &half_n) == 1) bnz_subtract_bnz(s, &secp256k1.n, s); // if s > floor(secp256k1.n / 2) ("high s") negate s i.e. s = secp256k1.n - s to ensure "low s"
+    printf("press any key to continue...");
 
-    bnz_free(&nonce); // free resources
-    bnz_free(&inv_nonce);
-    bnz_free(&half_n);
-    bnz_free(&tmp.x);
-    bnz_free(&tmp.y);
+    getchar();
 }
 
-bool secp256k1_ecdsa_verify_from_signature(const SECP256K1 secp256k1, const bnz_t *public_key_compressed, const bnz_t *hash, const bnz_t *signature)
+void menu_2_2_hardened_child(const char *version)
 {
-    bool verified;
-
-    bnz_t r, s;
-
-    bnz_init(&r); // variable to hold r extracted from DER format ECDSA signature
-    bnz_init(&s); // variable to hold s extracted from DER format ECDSA signature
+    uint8_t parent_private_key_str[67], parent_chain_code_str[67], depth_num;
+    uint32_t index_num, p2pkh_leading_zeros;
+    bnz_t tmp, index, entropy, parent_private_key, parent_chain_code, parent_public_key_compressed, child_private_key, child_chain_code, child_public_key_compressed, p2pkh, p2sh_p2wpkh, p2wpkh;
+    APT parent_public_key_pt, child_public_key_pt;
+    SECP256K1 secp256k1;
 
-    secp256k1_ecdsa_get_r_s_from_signature(signature, &r, &s); // extract r and s from DER format ECDSA signature
-    verified = secp256k1_ecdsa_verify_from_r_s(secp256k1, public_key_compressed, hash, &r, &s); // verify using r and s
+    secp256k1_init(&secp256k1);
 
-    bnz_free(&r);
-    bnz_free(&s);
+    bnz_init(&tmp);
+    bnz_init(&index);
+    bnz_init(&entropy);
+    bnz_init(&parent_private_key);
+    bnz_init(&parent_chain_code);
+    bnz_init(&parent_public_key_compressed);
+    bnz_init(&child_private_key);
+    bnz_init(&child_chain_code);
+    bnz_init(&child_public_key_compressed);
+    bnz_init(&p2pkh);
+    bnz_init(&p2sh_p2wpkh);
+    bnz_init(&p2wpkh);
 
-    return verified;
-}
+    bnz_init(&parent_public_key_pt.x);
+    bnz_init(&parent_public_key_pt.y);
+    bnz_init(&child_public_key_pt.x);
+    bnz_init(&child_public_key_pt.y);
 
-bool secp256k1_ecdsa_verify_from_r_s(const SECP256K1 secp256k1, const bnz_t *public_key_compressed, const bnz_t *hash, const bnz_t *r, const bnz_t *s)
-{
-    bool verified;
-    
-    bnz_t inv_s, m1, m2;
-    APT public_key_pt, tmp1, tmp2, verification_pt;
+    system("cls");
+    printf("%s\n\n", version);
 
-    bnz_init(&inv_s);
-    bnz_init(&m1);
-    bnz_init(&m2);
+    printf("Parent private key (press 'Enter' for random): ");
+    get_str_input(parent_private_key_str, 66);
 
-    bnz_init(&public_key_pt.x);
-    bnz_init(&public_key_pt.y);
-    bnz_init(&tmp1.x);
-    bnz_init(&tmp1.y);
-    bnz_init(&tmp2.x);
-    bnz_init(&tmp2.y);
-    bnz_init(&verification_pt.x);
-    bnz_init(&verification_pt.y);
+    if (isalnum(parent_private_key_str[0])) {
+        printf("%s\n", parent_private_key_str);
+        bnz_set_str(&parent_private_key, (const char *)parent_private_key_str, 16);
+        system("cls");
+        printf("%s\n\n", version);
+        bnz_print(&parent_private_key, 16, "Parent private key: ");
+        printf("Parent chain code: ");
+        get_str_input(parent_chain_code_str, 66);
+        bnz_set_str(&parent_chain_code, (const char *)parent_chain_code_str, 16);
+        system("cls");
+        printf("%s\n\n", version);
+        bnz_print(&parent_private_key, 16, "Parent private key: ");
+        bnz_print(&parent_chain_code, 16, "Parent chain code: ");
+    } else {
+        get_random_master_keys(&entropy, &parent_private_key, &parent_chain_code);
+        system("cls");
+        printf("%s\n\n", version);
+        if (bnz_is_zero(&entropy) == false) bnz_print(&entropy, 16, "Entropy: ");
+        bnz_print(&parent_private_key, 16, "Parent private key: ");
+        bnz_print(&parent_chain_code, 16, "Parent chain code: ");
+    }
 
-    get_public_key_xy(secp256k1, &public_key_pt, public_key_compressed); // extract xy coordinates of original public key Secp256k1 point from compressed public key
+    if (is_valid_private_key(secp256k1, &parent_private_key) == false) { // ensure that parent_private_key is valid
+        system("cls");
+        printf("%s\n\n", version);
+        bnz_print(&parent_private_key, 16, "Parent private key: ");
+        printf("\n");
+        printf("This private key is not in the valid range 0 < k < Secp256k1.\n\n");
+        printf("It is not possible to generate a public key from this private key.\n\n");
+        printf("Press any key to rerun the command with a different private key value.\n");
 
-    bnz_modular_multiplicative_inverse(&inv_s, s, &secp256k1.n); // set value of inv_s to the modular multiplicative inverse of s, modulo secp256k1.n the curve order
+        getchar();
 
-    bnz_multiply_bnz(&m1, &inv_s, hash); // m1 = inv_s * hash
-    bnz_mod_bnz(&m1, &m1, &secp256k1.n); // m1 = m1 mod secp256k1.n
-    secp256k1_scalar_multiplication(secp256k1, &secp256k1.G, &m1, &tmp1); // tmp1 = m1 * secp256k1.G mod secp256k1.p
+        bnz_free(&tmp);
+        bnz_free(&index);
+        bnz_free(&entropy);
+        bnz_free(&parent_private_key);
+        bnz_free(&parent_chain_code);
+        bnz_free(&parent_public_key_compressed);
+        bnz_free(&child_private_key);
+        bnz_free(&child_chain_code);
+        bnz_free(&child_public_key_compressed);
+        bnz_free(&p2pkh);
+        bnz_free(&p2sh_p2wpkh);
+        bnz_free(&p2wpkh);
+    
+        secp256k1_free(secp256k1);
 
-    bnz_multiply_bnz(&m2, &inv_s, r); // m2 = inv_s * r
-    bnz_mod_bnz(&m2, &m2, &secp256k1.n); // m2 = m2 mod secp256k1.n
-    secp256k1_scalar_multiplication(secp256k1, &public_key_pt, &m2, &tmp2); // tmp2 = m2 * public key point mod secp256k1.p
+        menu_2_2_hardened_child(version);
+    }
 
-    secp256k1_point_addition(secp256k1, &tmp1, &tmp2, &verification_pt); // verification_pt = tmp1 + tmp2 mod secp256k1.p
+    printf("\n");
+    printf("Depth (1 to 255): ");
+    depth_num = get_num_input(3, 1, 255);
 
-    bnz_mod_bnz(&verification_pt.x, &verification_pt.x, &secp256k1.n);// verification_pt.x = verification_pt.x mod secp256k1.n
+    system("cls");
+    printf("%s\n\n", version);
+    if (bnz_is_zero(&entropy) == false) bnz_print(&entropy, 16, "Entropy: ");
+    bnz_print(&parent_private_key, 16, "Parent private key: ");
+    bnz_print(&parent_chain_code, 16, "Parent chain code: ");
+    printf("\n");
+    printf("Depth: %u\n", depth_num);
+    printf("Index (2147483648 to 4294967295): ");
+    index_num = get_num_input(10, 0, 4294967295);
+    if (index_num < 2147483648) index_num += 2147483648;
 
-    if (bnz_cmp_bnz(&verification_pt.x, r) == 0) { // compare verfication_pt.x and r
-        verified = true; // if verification_pt.x and r are equal, verification has succeded, set value of verfied to 1
-    } else {
-        verified = false; // if verification_pt.x and r are not equal, verification has failed, set value of verfied to 0
-    }
+    get_public_key(secp256k1, &parent_public_key_pt, &parent_public_key_compressed, &parent_private_key);
 
-    bnz_free(&public_key_pt.x); // free resources
-    bnz_free(&public_key_pt.y);
-    bnz_free(&tmp1.x);
-    bnz_free(&tmp1.y);
-    bnz_free(&tmp2.x);
-    bnz_free(&tmp2.y);
-    bnz_free(&verification_pt.x);
-    bnz_free(&verification_pt.y);
+    system("cls");
+    printf("%s\n\n", version);
+    if (bnz_is_zero(&entropy) == false) bnz_print(&entropy, 16, "ENTROPY: ");
+    bnz_print(&parent_private_key, 16, "PARENT PRIVATE KEY: ");
+    bnz_print(&parent_chain_code, 16, "PARENT CHAIN CODE: ");
+    bnz_print(&parent_public_key_compressed, 16, "PARENT PUBLIC KEY COMPRESSED: ");
+    bnz_print(&parent_public_key_pt.x, 16, " x: ");
+    bnz_print(&parent_public_key_pt.y, 16, " y: ");
+    printf("\n");
+    printf("DEPTH: %u\n", depth_num);
+    printf("INDEX: %u\n", index_num);
+    printf("\n");
 
-    return verified; // return verified
-}
+    get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, index_num);
 
-/* MENU FUNCTIONS */
+    bnz_print(&child_private_key, 16, "CHILD PRIVATE KEY: ");
+    bnz_print(&child_chain_code, 16, "CHILD CHAIN CODE: ");
+    printf("\n");
 
-uint32_t get_num_input(uint32_t, uint32_t, uint32_t);
-void get_str_input(char[], int);
-size_t get_file_size(FILE *);
-char *get_file_contents(const char *);
-void get_file_hash(const char *, uint32_t);
-void menu_1_master_keys(const char *);
-void menu_2_child_keys(const char *);
-void menu_2_1_normal_child(const char *);
-void menu_2_2_hardened_child(const char *);
-void menu_2_3_public_child(const char *);
-void menu_2_4_hdk_intermediate_values(const char *);
-void menu_3_base_converter(const char *);
-void menu_4_functions(const char *);
-void menu_4_1_validate_mnemonic_phrase_checksum(const char *);
-void menu_4_2_private_and_public_key_functions(const char *);
-void menu_4_2_1_private_key_to_WIF(const char *);
-void menu_4_2_2_WIF_to_private_key(const char *);
-void menu_4_2_3_public_key_to_address(const char *);
-void menu_4_3_secp256k1_functions(const char *);
-void menu_4_3_1_secp256k1_point_addition(const char *);
-void menu_4_3_2_secp256k1_point_doubling(const char *);
-void menu_4_3_3_secp256k1_scalar_multiplication(const char *);
-void menu_4_4_ecdsa_functions(const char *);
-void menu_4_4_1_ecdsa_sign(const char *);
-void menu_4_4_2_ecdsa_verify_signature(const char *);
-void menu_4_4_3_ecdsa_verify_r_s(const char *);
-void menu_5_file_hash_functions(const char *);
+    get_public_key(secp256k1, &child_public_key_pt, &child_public_key_compressed, &child_private_key); // generate compressed public key from private key
+    get_p2pkh_address(&p2pkh, &child_public_key_compressed, &p2pkh_leading_zeros); // serialise p2pkh address
+    get_p2sh_p2wpkh_address(&p2sh_p2wpkh, &child_public_key_compressed); // serialise p2sh_p2wpkh address
+    get_p2wpkh_address(&p2wpkh, &child_public_key_compressed);
 
-uint32_t get_num_input(uint32_t max_len, uint32_t min, uint32_t max) // get base 10 number between min and max from stdin
-{
-    char str[max_len + 1];
-    int i = 0, ch;
-    uint32_t res;
-    while ((ch = getchar()) != '\n' && ch != EOF) {
-        if (i < max_len && isdigit(ch)) {
-            str[i++] = ch;
-        }
-    }
-    str[i] = 0;
-    res = strtoul(str, NULL, 10);
-    if (res < min || res > max) res = min;
-    return res;
-}
+    bnz_print(&child_public_key_compressed, 16, "CHILD PUBLIC KEY COMPRESSED: ");
+    bnz_print(&child_public_key_pt.x, 16, " x: ");
+    bnz_print(&child_public_key_pt.y, 16, " y: ");
+    print_p2pkh_address(&p2pkh, "CHILD P2PKH ADDRESS: ", p2pkh_leading_zeros);
+    bnz_print(&p2sh_p2wpkh, 58, "CHILD P2SH-P2WPKH ADDRESS: ");
+    print_p2wpkh_address(&p2wpkh, "CHILD P2WPKH ADDRESS: ");
+    printf("\n");
 
-void get_str_input(char str[], int max_len) // get string from stdin with strlen <= max_len
-{
-    int i = 0, ch;
-    while ((ch = getchar()) != '\n' && ch != EOF) {
-        if (ch >= 32 && ch <= 126 && i < max_len) {
-            str[i++] = ch;
-        }
-    }
-    str[i] = 0;
-}
+    bnz_free(&tmp);
+    bnz_free(&index);
+    bnz_free(&entropy);
+    bnz_free(&parent_private_key);
+    bnz_free(&parent_chain_code);
+    bnz_free(&parent_public_key_compressed);
+    bnz_free(&child_private_key);
+    bnz_free(&child_chain_code);
+    bnz_free(&child_public_key_compressed);
+    bnz_free(&p2pkh);
+    bnz_free(&p2sh_p2wpkh);
+    bnz_free(&p2wpkh);
 
-size_t get_file_size(FILE *file)
-{
-    size_t file_size;
-    fseek(file, 0, SEEK_END);
-    file_size = ftell(file);
-    fseek(file, 0, SEEK_SET);
-    return file_size;
+    bnz_free(&child_public_key_pt.x);
+    bnz_free(&child_public_key_pt.y);
+
+    secp256k1_free(secp256k1);
+
+    printf("press any key to continue...");
+
+    getchar();
 }
 
-char *get_file_contents(const char *file_path)
+void menu_2_3_public_child(const char *version)
 {
-    char *file_contents = NULL;
-    size_t file_size, bytes_read;
-    FILE *file = NULL;
+    uint8_t parent_public_key_compressed_str[69], parent_chain_code_str[67], mac[65], depth_num;
+    uint32_t index_num, p2pkh_leading_zeros;
+    bnz_t tmp, index, parent_public_key_compressed, parent_chain_code, child_public_key_compressed, child_chain_code, p2pkh, p2sh_p2wpkh, p2wpkh;
+    APT tmp_key, parent_public_key_pt, child_public_key_pt;
 
-    file = fopen(file_path, "rb");
+    SECP256K1 secp256k1;
 
-    if (!file) {
-        printf("Could not open file: %s\n\n", file_path);
-        return NULL;
-    }
+    bnz_init(&tmp);
+    bnz_init(&index);
+    bnz_init(&parent_public_key_compressed);
+    bnz_init(&parent_chain_code);
+    bnz_init(&child_public_key_compressed);
+    bnz_init(&child_chain_code);
+    bnz_init(&p2pkh);
+    bnz_init(&p2sh_p2wpkh);
+    bnz_init(&p2wpkh);
 
-    file_size = get_file_size(file);
+    bnz_init(&tmp_key.x);
+    bnz_init(&tmp_key.y);
+    bnz_init(&parent_public_key_pt.x);
+    bnz_init(&parent_public_key_pt.y);
+    bnz_init(&child_public_key_pt.x);
+    bnz_init(&child_public_key_pt.y);
 
-    file_contents = malloc(file_size + 1);
+    secp256k1_init(&secp256k1);
 
-    if (!file_contents) {
-        fclose(file);
-        printf("Could not allocate memory for file contents: %s.\n\n", file_path);
-        return NULL;
-    }
+    system("cls");
+    printf("%s\n\n", version);
 
-    memset(file_contents, 0, file_size + 1);
-    bytes_read = fread(file_contents, 1, file_size, file);
-    fclose(file);
+    printf("Parent public key compressed: ");
+    get_str_input(parent_public_key_compressed_str, 68); // optional "0x" + 33 bytes
 
-    if (bytes_read != file_size) {
-        free(file_contents);
-        printf("Could not read entire file: %s.\n\n", file_path);
-        return NULL;
+    if (isalnum(parent_public_key_compressed_str[0])) {
+        printf("%s\n", parent_public_key_compressed_str);
+        bnz_set_str(&parent_public_key_compressed, (const char *)parent_public_key_compressed_str, 16);
+        system("cls");
+        printf("%s\n\n", version);
+        bnz_print(&parent_public_key_compressed, 16, "Parent public key compressed: ");
+        printf("Parent chain code: ");
+        get_str_input(parent_chain_code_str, 66); // 32 bytes + optional "0x"
+        bnz_set_str(&parent_chain_code, (const char *)parent_chain_code_str, 16);
+        system("cls");
+        printf("%s\n\n", version);
+        bnz_print(&parent_public_key_compressed, 16, "Parent public key compressed: ");
+        bnz_print(&parent_chain_code, 16, "Parent chain code: ");
+    } else {
+        return;
     }
 
-    return file_contents;
-}
+    printf("\n");
+    printf("Depth (1 to 255): ");
+    depth_num = get_num_input(3, 1, 255);
 
-void get_file_hash(const char *version, uint32_t hash_type)
-{
-    char file_path[256] = {0}, *file_contents = NULL;
-    uint32_t file_size;
-    FILE *f = NULL;
-    bnz_t h;
+    system("cls");
+    printf("%s\n\n", version);
+    bnz_print(&parent_public_key_compressed, 16, "Parent public key compressed: ");
+    bnz_print(&parent_chain_code, 16, "Parent chain code: ");
+    printf("\n");
+    printf("Depth: %u\n", depth_num);
+    printf("Index (0 to 2147483647): ");
+    index_num = get_num_input(10, 0, 2147483647);
 
-    bnz_init(&h);
+    get_public_key_xy(secp256k1, &parent_public_key_pt, &parent_public_key_compressed);
 
     system("cls");
     printf("%s\n\n", version);
+    bnz_print(&parent_chain_code, 16, "PARENT CHAIN CODE: ");
+    bnz_print(&parent_public_key_compressed, 16, "PARENT PUBLIC KEY COMPRESSED: ");
+    bnz_print(&parent_public_key_pt.x, 16, " x: ");
+    bnz_print(&parent_public_key_pt.y, 16, " y: ");
+    printf("\n");
+    printf("DEPTH: %u\n", depth_num);
+    printf("INDEX: %u\n", index_num);
+    printf("\n");
 
-    printf("File path: ");
-    get_str_input(file_path, 256);
+    bnz_set_i32(&index, index_num); // convert index to bnz_t
+    bnz_resize(&index, 4, true); // ensure that index is four bytes
+    bnz_resize(&parent_public_key_compressed, 33, true); // ensure that parent_public_key_compressed is 33 bytes
+    bnz_resize(&parent_chain_code, 32, true); // ensure that parent_chain_code is 32 bytes
 
-    file_contents = get_file_contents(file_path);
+    bnz_concatenate_bnz(&tmp, &parent_public_key_compressed, &index, 1); // tmp = parent_public_key_compressed concatenated with index
 
-    if (!file_contents) {
-        printf("Press any key to continue...");
-        getchar();
-        return;
-    }
+    bnz_reverse_digits(&tmp);  // convert tmp.digits to big endian in preparation for hmac_512
+    bnz_reverse_digits(&parent_chain_code); // convert parent_chain_code.digits to big endian in preparation for hmac_512
 
-    system("cls");
-    printf("%s\n\n", version);
+    hmac_sha512(parent_chain_code.digits, parent_chain_code.size, tmp.digits, tmp.size, mac, 64); // generate mac
+    bnz_reverse_digits(&parent_chain_code); // convert parent_chain_code.digits back to default little endian
 
-    printf("File path: %s\n\n", file_path);
+    bnz_resize(&tmp, 32, false); // resize and zero tmp in preparation for receipt of first 32 bytes of mac
+    memcpy(tmp.digits, mac, 32); // copy first 32 bytes of mac into tmp.digits
+    bnz_reverse_digits(&tmp); // convert tmp.digits back to default little endian
 
-    switch(hash_type) {
-        case 1:
-            get_ripemd160(&h, (const uint8_t *)file_contents);
-            bnz_print(&h, 16, "RIPEMD160: ");
-            break;
-        case 2:
-            get_sha256(&h, (const uint8_t *)file_contents);
-            bnz_print(&h, 16, "SHA256: ");
-            break;
-        case 3:
-            get_sha512(&h, (const uint8_t *)file_contents);
-            bnz_print(&h, 16, "SHA512: ");
-            break;
-        default:
-            return;
+    secp256k1_point_addition(secp256k1, &parent_public_key_pt, &tmp_key, &child_public_key_pt); // child_public_key_pt = (parent_public_key_pt + tmp) mod secp256k1.p
+
+    if (bnz_bit_set(&child_public_key_pt.y, 0) == false) { // even
+        bnz_concatenate_ui8(&child_public_key_compressed, &child_public_key_pt.x, 2, 0); // prepend 2
+    } else { // odd
+        bnz_concatenate_ui8(&child_public_key_compressed, &child_public_key_pt.x, 3, 0); // prepend 3
     }
 
-    free(file_contents);
+    bnz_resize(&child_chain_code, 32, 0); // resize and zero child_chain_code in preparation for receipt of last 32 bytes of mac
+    memcpy(child_chain_code.digits, mac + 32, 32); // copy first 32 bytes of mac into child_chain_code.digits
+    bnz_reverse_digits(&child_chain_code); // convert child_chain_code.digits back to default little endian
+
+    get_p2pkh_address(&p2pkh, &child_public_key_compressed, &p2pkh_leading_zeros); // serialise p2pkh address
+    get_p2sh_p2wpkh_address(&p2sh_p2wpkh, &child_public_key_compressed); // serialise p2sh_p2wpkh address
+    get_p2wpkh_address(&p2wpkh, &child_public_key_compressed);
 
+    bnz_print(&child_chain_code, 16, "CHILD CHAIN CODE: ");
+    bnz_print(&child_public_key_compressed, 16, "CHILD PUBLIC KEY COMPRESSED: ");
+    bnz_print(&child_public_key_pt.x, 16, " x: ");
+    bnz_print(&child_public_key_pt.y, 16, " y: ");
+    print_p2pkh_address(&p2pkh, "CHILD P2PKH ADDRESS: ", p2pkh_leading_zeros);
+    bnz_print(&p2sh_p2wpkh, 58, "CHILD P2SH-P2WPKH ADDRESS: ");
+    print_p2wpkh_address(&p2wpkh, "CHILD P2WPKH ADDRESS: ");
     printf("\n");
 
-    printf("Press any key to continue...");
+    bnz_free(&tmp);
+    bnz_free(&index);
+    bnz_free(&parent_public_key_compressed);
+    bnz_free(&parent_chain_code);
+    bnz_free(&child_public_key_compressed);
+    bnz_free(&child_chain_code);
+    bnz_free(&p2pkh);
+    bnz_free(&p2sh_p2wpkh);
+    bnz_free(&p2wpkh);
+
+    bnz_free(&tmp_key.x);
+    bnz_free(&tmp_key.y);
+    bnz_free(&parent_public_key_pt.x);
+    bnz_free(&parent_public_key_pt.y);
+    bnz_free(&child_public_key_pt.x);
+    bnz_free(&child_public_key_pt.y);
+
+    secp256k1_free(secp256k1);
+
+    printf("press any key to continue...");
 
     getchar();
 }
 
-void menu_1_master_keys(const char *version) // input 256 bits of entropy and generate master private key, master chain code, master public key, and corresponding p2pkh and p2wpkh hdk addresses
+void menu_2_4_hdk_intermediate_values(const char *version)
 {
-    uint32_t i, wd_ids[24];
-    char entropy_str[257], base = 16, passphrase_str[257], *mnemonic = NULL;
-    bnz_t entropy, master_private_key, master_chain_code, master_public_key, master_public_key_compressed, seed;
+    char hdk_str[32], master_private_key_str[67], master_chain_code_str[67];
+
+    bnz_t entropy, master_private_key, master_chain_code;
 
     SECP256K1 secp256k1;
 
     bnz_init(&entropy);
     bnz_init(&master_private_key);
     bnz_init(&master_chain_code);
-    bnz_init(&master_public_key);
-    bnz_init(&master_public_key_compressed);
-    bnz_init(&seed);
-
-    secp256k1 = secp256k1_init();
-
-    system("cls");
-    printf("%s\n\n", version);
-
-    printf("Entropy (press 'Enter' for random): ");
-    get_str_input(entropy_str, 256);
-
-    system("cls");
-    printf("%s\n\n", version);
-    printf("Entropy: ");
-
-    if (isalnum(entropy_str[0])) {
-        printf("%s\n", entropy_str);
-        printf("Base (2 - 64): ");
-        base = get_num_input(2, 0, 64);
-        if (base < 2) base = 16;
-        bnz_set_str(&entropy, (const char *)entropy_str, base);
-    } else {
-        bnz_256_bit_rnd(&entropy);
-    }
-
-    system("cls");
-    printf("%s\n\n", version); 
-    bnz_print(&entropy, 16, "Entropy: ");
-    if (base == 16) {
-        printf("Base: 16\n");
-    } else {
-        printf("Base: 16 (converted from base %d)\n", base);
-    }
 
-    printf("Passphrase (optional): ");
-    get_str_input(passphrase_str, 256);
+    secp256k1_init(&secp256k1);
 
     system("cls");
     printf("%s\n\n", version);
-    bnz_print(&entropy, 16, "ENTROPY: ");
-    printf("BASE: 16\n\n");
-
-    entropy_checksum(&entropy);
-
-    get_bip39_word_ids_bnz(&entropy, wd_ids);
-
-    printf("CHECKSUM: 0x%02x\n\n", entropy.digits[0]);
-
-    printf("BIP39 IDs: %d", wd_ids[0]);
-    for (i = 1; i < 24; i++) {
-        printf(", %d", wd_ids[i]);
-    }
-    printf("\n\n");
 
-    mnemonic = get_mnemonic_phrase(wd_ids);
-    printf("MNEMONIC PHRASE: %s\n\n", mnemonic);
+    printf("Master private key (press 'Enter' for random): ");
+    get_str_input(master_private_key_str, 66);
 
-    if (isalnum(passphrase_str[0])) {
-        printf("PASSPHRASE: %s\n\n", passphrase_str);
+    if (isalnum(master_private_key_str[0])) {
+        printf("%s\n", master_private_key_str);
+        bnz_set_str(&master_private_key, (const char *)master_private_key_str, 16);
+        system("cls");
+        printf("%s\n\n", version);
+        bnz_print(&master_private_key, 16, "Master private key: ");
+        printf("Master chain code: ");
+        get_str_input(master_chain_code_str, 66);
+        bnz_set_str(&master_chain_code, (const char *)master_chain_code_str, 16);
+        system("cls");
+        printf("%s\n\n", version);
+        bnz_print(&master_private_key, 16, "Master private key: ");
+        bnz_print(&master_chain_code, 16, "Master chain code: ");
+    } else {
+        get_random_master_keys(&entropy, &master_private_key, &master_chain_code);
+        system("cls");
+        printf("%s\n\n", version);
+        bnz_print(&entropy, 16, "Entropy: ");
+        bnz_print(&master_private_key, 16, "Master private key: ");
+        bnz_print(&master_chain_code, 16, "Master chain code: ");
     }
 
-    get_seed_from_mnemonic_phrase(&seed, mnemonic, passphrase_str);
-    bnz_print(&seed, 16, "SEED: ");
-    printf("\n");
-
-    get_master_keys(&master_private_key, &master_chain_code, &seed);
-
     if (is_valid_private_key(secp256k1, &master_private_key) == false) { // ensure that master_private_key is valid
         system("cls");
         printf("%s\n\n", version);
@@ -3946,292 +10385,340 @@ void menu_1_master_keys(const char *version) // input 256 bits of entropy and ge
         printf("This private key is not in the valid range 0 < k < Secp256k1.\n\n");
         printf("It is not possible to generate a public key from this private key.\n\n");
         printf("Press any key to rerun the command with a different private key value.\n");
+
         getchar();
 
         bnz_free(&entropy);
         bnz_free(&master_private_key);
         bnz_free(&master_chain_code);
-        bnz_free(&master_public_key);
-        bnz_free(&master_public_key_compressed);
-        bnz_free(&seed);
-
+    
         secp256k1_free(secp256k1);
 
-        menu_1_master_keys(version);
+        menu_2_4_hdk_intermediate_values(version);
     }
-    
+
+    printf("\n");
+    printf("HDK string (e.g. m/44'/0'/0'/0/0): ");
+    get_str_input(hdk_str, 31);
+
+    system("cls");
+    printf("%s\n\n", version);
+    if (bnz_is_zero(&entropy) == false) bnz_print(&entropy, 16, "ENTROPY: ");
     bnz_print(&master_private_key, 16, "MASTER PRIVATE KEY: ");
     bnz_print(&master_chain_code, 16, "MASTER CHAIN CODE: ");
+    printf("HDK STRING: %s\n", hdk_str);
+    printf("\n");
 
-    printf("\nHDK ADDRESSES:\n");
-    
-    get_wallet_p2pkh_addresses(secp256k1, &master_private_key, &master_chain_code);
-    get_wallet_p2sh_p2wpkh_addresses(secp256k1, &master_private_key, &master_chain_code);
-    get_wallet_p2wpkh_addresses(secp256k1, &master_private_key, &master_chain_code);
+    get_hdk_intermediate_values(secp256k1, &master_private_key, &master_chain_code, hdk_str);
 
     bnz_free(&entropy);
     bnz_free(&master_private_key);
     bnz_free(&master_chain_code);
-    bnz_free(&master_public_key);
-    bnz_free(&master_public_key_compressed);
-    bnz_free(&seed);
+
+    secp256k1_free(secp256k1);
 
     printf("press any key to continue...");
 
     getchar();
 }
 
-void menu_2_child_keys(const char *version)
+void menu_3_base_converter(const char *version)
 {
-    int menu;
+    char number_str[2049], base = 16;
+    bnz_t number;
+
+    bnz_init(&number);
+
     system("cls");
     printf("%s\n\n", version);
-    printf("1. Normal child\n");
-    printf("2. Hardened child\n");
-    printf("3. Child public key\n");
-    printf("4. HDK intermediate values\n");
-    printf("\n");
-    menu = get_num_input(1, 0, 4);
-    switch (menu) {
-        case 1:
-            menu_2_1_normal_child(version);
-            break;
-        case 2:
-            menu_2_2_hardened_child(version);
-            break;
-        case 3:
-            menu_2_3_public_child(version);
-            break;
-        case 4:
-            menu_2_4_hdk_intermediate_values(version);
-            break;
-        default:
-            break;
-    }
-}
-
-void menu_2_1_normal_child(const char *version)
-{
-    uint8_t parent_private_key_str[67], parent_chain_code_str[67], depth_num;
-    uint32_t index_num, p2pkh_leading_zeros;
-    bnz_t tmp, index, entropy, parent_private_key, parent_chain_code, parent_public_key_compressed, child_private_key, child_chain_code, child_public_key_compressed, p2pkh, p2sh_p2wpkh, p2wpkh;
-    APT parent_public_key_pt, child_public_key_pt;
-    SECP256K1 secp256k1;
 
-    secp256k1 = secp256k1_init();
+    printf("Number (press 'Enter' for random): ");
+    get_str_input(number_str, 2048);
 
-    bnz_init(&tmp);
-    bnz_init(&index);
-    bnz_init(&entropy);
-    bnz_init(&parent_private_key);
-    bnz_init(&parent_chain_code);
-    bnz_init(&parent_public_key_compressed);
-    bnz_init(&child_private_key);
-    bnz_init(&child_chain_code);
-    bnz_init(&child_public_key_compressed);
-    bnz_init(&p2pkh);
-    bnz_init(&p2sh_p2wpkh);
-    bnz_init(&p2wpkh);
+    system("cls");
+    printf("%s\n\n", version);
 
-    bnz_init(&parent_public_key_pt.x);
-    bnz_init(&parent_public_key_pt.y);
-    bnz_init(&child_public_key_pt.x);
-    bnz_init(&child_public_key_pt.y);
+    if (isalnum(number_str[0])) {
+        printf("Number: %s\n", number_str);
+        printf("Base (2 - 64): ");
+        base = get_num_input(3, 2, 64);
+        if (base == 0) base = 16;
+        bnz_set_str(&number, (const char *)number_str, base);
+    } else {
+        bnz_256_bit_rnd(&number);
+    }
 
     system("cls");
     printf("%s\n\n", version);
+    bnz_print(&number, base, "Number: ");
+    printf("Base: %d\n\n", base);
 
-    printf("Parent private key (press 'Enter' for random): ");
-    get_str_input(parent_private_key_str, 66);
+    bnz_print(&number, -2, "Binary: ");
+    printf("\n");
 
-    if (isalnum(parent_private_key_str[0])) {
-        printf("%s\n", parent_private_key_str);
-        bnz_set_str(&parent_private_key, (const char *)parent_private_key_str, 16);
-        system("cls");
-        printf("%s\n\n", version);
-        bnz_print(&parent_private_key, 16, "Parent private key: ");
-        printf("Parent chain code: ");
-        get_str_input(parent_chain_code_str, 66);
-        bnz_set_str(&parent_chain_code, (const char *)parent_chain_code_str, 16);
-        system("cls");
-        printf("%s\n\n", version);
-        bnz_print(&parent_private_key, 16, "Parent private key: ");
-        bnz_print(&parent_chain_code, 16, "Parent chain code: ");
-    } else {
-        get_random_master_keys(&entropy, &parent_private_key, &parent_chain_code);
-        system("cls");
-        printf("%s\n\n", version);
-        bnz_print(&entropy, 16, "Entropy: ");
-        bnz_print(&parent_private_key, 16, "Parent private key: ");
-        bnz_print(&parent_chain_code, 16, "Parent chain code: ");
-    }
+    bnz_print(&number, 8, "Octal: ");
+    printf("\n");
 
-    if (is_valid_private_key(secp256k1, &parent_private_key) == false) { // ensure that parent_private_key is valid
-        system("cls");
-        printf("%s\n\n", version);
-        bnz_print(&parent_private_key, 16, "Parent private key: ");
-        printf("\n");
-        printf("This private key is not in the valid range 0 < k < Secp256k1.\n\n");
-        printf("It is not possible to generate a public key from this private key.\n\n");
-        printf("Press any key to rerun the command with a different private key value.\n");
-        getchar();
+    bnz_print(&number, 10, "Decimal: ");
+    printf("\n");
 
-        bnz_free(&tmp);
-        bnz_free(&index);
-        bnz_free(&entropy);
-        bnz_free(&parent_private_key);
-        bnz_free(&parent_chain_code);
-        bnz_free(&parent_public_key_compressed);
-        bnz_free(&child_private_key);
-        bnz_free(&child_chain_code);
-        bnz_free(&child_public_key_compressed);
-        bnz_free(&p2pkh);
-        bnz_free(&p2sh_p2wpkh);
-        bnz_free(&p2wpkh);
+    bnz_print(&number, 16, "Hex: ");
+    printf("\n");
 
-        bnz_free(&parent_public_key_pt.x);
-        bnz_free(&parent_public_key_pt.y);
-        bnz_free(&child_public_key_pt.x);
-        bnz_free(&child_public_key_pt.y);
+    bnz_print(&number, 32, "Bech32: ");
+    printf("\n");
+
+    bnz_print(&number, 58, "Bitcoin base 58: ");
+    printf("\n");
+
+    bnz_print(&number, 256, "Bytes: ");
+    printf("\n");
+
+    bnz_print(&number, 2, "Base 2: ");
+    bnz_print(&number, 3, "Base 3: ");
+    bnz_print(&number, 4, "Base 4: ");
+    bnz_print(&number, 5, "Base 5: ");
+    bnz_print(&number, 6, "Base 6: ");
+    bnz_print(&number, 7, "Base 7: ");
+    bnz_print(&number, 8, "Base 8: ");
+    bnz_print(&number, 9, "Base 9: ");
+
+    printf("\n");
+
+    bnz_print(&number, 10, "Base 10: ");
+    bnz_print(&number, 11, "Base 11: ");
+    bnz_print(&number, 12, "Base 12: ");
+    bnz_print(&number, 13, "Base 13: ");
+    bnz_print(&number, 14, "Base 14: ");
+    bnz_print(&number, 15, "Base 15: ");
+    bnz_print(&number, -16, "Base 16: ");
+    bnz_print(&number, 17, "Base 17: ");
+    bnz_print(&number, 18, "Base 18: ");
+    bnz_print(&number, 19, "Base 19: ");
+
+    printf("\n");
+
+    bnz_print(&number, 20, "Base 20: ");
+    bnz_print(&number, 21, "Base 21: ");
+    bnz_print(&number, 22, "Base 22: ");
+    bnz_print(&number, 23, "Base 23: ");
+    bnz_print(&number, 24, "Base 24: ");
+    bnz_print(&number, 25, "Base 25: ");
+    bnz_print(&number, 26, "Base 26: ");
+    bnz_print(&number, 27, "Base 27: ");
+    bnz_print(&number, 28, "Base 28: ");
+    bnz_print(&number, 29, "Base 29: ");
+
+    printf("\n");
+
+    bnz_print(&number, 30, "Base 30: ");
+    bnz_print(&number, 31, "Base 31: ");
+    bnz_print(&number, -32, "Base 32: ");
+    bnz_print(&number, 33, "Base 33: ");
+    bnz_print(&number, 34, "Base 34: ");
+    bnz_print(&number, 35, "Base 35: ");
+    bnz_print(&number, 36, "Base 36: ");
+    bnz_print(&number, 37, "Base 37: ");
+    bnz_print(&number, 38, "Base 38: ");
+    bnz_print(&number, 39, "Base 39: ");
+
+    printf("\n");
+
+    bnz_print(&number, 40, "Base 40: ");
+    bnz_print(&number, 41, "Base 41: ");
+    bnz_print(&number, 42, "Base 42: ");
+    bnz_print(&number, 43, "Base 43: ");
+    bnz_print(&number, 44, "Base 44: ");
+    bnz_print(&number, 45, "Base 45: ");
+    bnz_print(&number, 46, "Base 46: ");
+    bnz_print(&number, 47, "Base 47: ");
+    bnz_print(&number, 48, "Base 48: ");
+    bnz_print(&number, 49, "Base 49: ");
+
+    printf("\n");
+
+    bnz_print(&number, 50, "Base 50: ");
+    bnz_print(&number, 51, "Base 51: ");
+    bnz_print(&number, 52, "Base 52: ");
+    bnz_print(&number, 53, "Base 53: ");
+    bnz_print(&number, 54, "Base 54: ");
+    bnz_print(&number, 55, "Base 55: ");
+    bnz_print(&number, 56, "Base 56: ");
+    bnz_print(&number, 57, "Base 57: ");
+    bnz_print(&number, -58, "Base 58: ");
+    bnz_print(&number, 59, "Base 59: ");
 
-        secp256k1_free(secp256k1);
+    printf("\n");
 
-        menu_2_1_normal_child(version);
-    }
+    bnz_print(&number, 60, "Base 60: ");
+    bnz_print(&number, 61, "Base 61: ");
+    bnz_print(&number, 62, "Base 62: ");
+    bnz_print(&number, 63, "Base 63: ");
+    bnz_print(&number, 64, "Base 64: ");
 
     printf("\n");
-    printf("Depth (1 to 255): ");
-    depth_num = get_num_input(3, 1, 255);
 
+    bnz_free(&number);
+
+    printf("press any key to continue...");
+
+    getchar();
+}
+
+void menu_4_functions(const char *version)
+{
+    int menu;
     system("cls");
     printf("%s\n\n", version);
-    if (bnz_is_zero(&entropy) == false) bnz_print(&entropy, 16, "Entropy: ");
-    bnz_print(&parent_private_key, 16, "Parent private key: ");
-    bnz_print(&parent_chain_code, 16, "Parent chain code: ");
+    printf("1. Validate mnemonic phrase checksum\n");
+    printf("2. Private and public key functions\n");
+    printf("3. Secp256k1 functions\n");
+    printf("4. ECDSA functions\n");
     printf("\n");
-    printf("Depth: %u\n", depth_num);
-    printf("Index (0 to 2147483647): ");
-    index_num = get_num_input(11, 0, 2147483647);
+    menu = get_num_input(1, 0, 4);
+    switch (menu) {
+        case 1:
+            menu_4_1_validate_mnemonic_phrase_checksum(version);
+            break;
+        case 2:
+            menu_4_2_private_and_public_key_functions(version);
+            break;
+        case 3:
+            menu_4_3_secp256k1_functions(version);
+            break;
+        case 4:
+            menu_4_4_ecdsa_functions(version);
+            break;
+        default:
+            break;
+    }
+}
 
-    get_public_key(secp256k1, &parent_public_key_pt, &parent_public_key_compressed, &parent_private_key);
+void menu_4_1_validate_mnemonic_phrase_checksum(const char *version) // check validity of entropy checksum from mnemonic phrase comprising 24 BIP39 words
+{
+    uint8_t chk;
+    char mnemonic_str[257];
+    bnz_t entropy, entropy_chk;
+
+    bnz_init(&entropy);
+    bnz_init(&entropy_chk);
 
     system("cls");
     printf("%s\n\n", version);
-    if (bnz_is_zero(&entropy) == false) bnz_print(&entropy, 16, "ENTROPY: ");
-    bnz_print(&parent_private_key, 16, "PARENT PRIVATE KEY: ");
-    bnz_print(&parent_chain_code, 16, "PARENT CHAIN CODE: ");
-    bnz_print(&parent_public_key_compressed, 16, "PARENT PUBLIC KEY COMPRESSED: ");
-    bnz_print(&parent_public_key_pt.x, 16, " x: ");
-    bnz_print(&parent_public_key_pt.y, 16, " y: ");
-    printf("\n");
-    printf("DEPTH: %u\n", depth_num);
-    printf("INDEX: %u\n", index_num);
-    printf("\n");
 
-    get_child_normal(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, &parent_public_key_compressed, index_num);
+    printf("Mnemonic phrase (24 BIP39 words): ");
+    get_str_input(mnemonic_str, 256);
 
-    bnz_print(&child_private_key, 16, "CHILD PRIVATE KEY: ");
-    bnz_print(&child_chain_code, 16, "CHILD CHAIN CODE: ");
-    printf("\n");
+    system("cls");
+    printf("%s\n\n", version);
+    printf("Mnemonic phrase: ");
 
-    get_public_key(secp256k1, &child_public_key_pt, &child_public_key_compressed, &child_private_key); // generate compressed public key from private key
-    get_p2pkh_address(&p2pkh, &child_public_key_compressed, &p2pkh_leading_zeros); // serialise p2pkh address
-    get_p2sh_p2wpkh_address(&p2sh_p2wpkh, &child_public_key_compressed); // serialise p2sh_p2wpkh address
-    get_p2wpkh_address(&p2wpkh, &parent_public_key_compressed); // serialise p2wpkh address
+    if (isalnum(mnemonic_str[0])) {
+        printf("%s\n", mnemonic_str);
+    } else {
+        return;
+    }
 
-    bnz_print(&child_public_key_compressed, 16, "CHILD PUBLIC KEY COMPRESSED: ");
-    bnz_print(&child_public_key_pt.x, 16, " x: ");
-    bnz_print(&child_public_key_pt.y, 16, " y: ");
-    print_p2pkh_address(&p2pkh, "CHILD P2PKH ADDRESS: ", p2pkh_leading_zeros);
-    bnz_print(&p2sh_p2wpkh, 58, "CHILD P2SH-P2WPKH ADDRESS: ");
-    print_p2wpkh_address(&p2wpkh, "CHILD P2WPKH ADDRESS: ");
-    printf("\n");
+    system("cls");
+    printf("%s\n\n", version);
+    printf("MNEMONIC PHRASE: ");
 
-    bnz_free(&tmp);
-    bnz_free(&index);
-    bnz_free(&entropy);
-    bnz_free(&parent_private_key);
-    bnz_free(&parent_chain_code);
-    bnz_free(&parent_public_key_compressed);
-    bnz_free(&child_private_key);
-    bnz_free(&child_chain_code);
-    bnz_free(&child_public_key_compressed);
-    bnz_free(&p2pkh);
-    bnz_free(&p2sh_p2wpkh);
-    bnz_free(&p2wpkh);
+    printf("%s\n\n", mnemonic_str);
 
-    bnz_free(&parent_public_key_pt.x);
-    bnz_free(&parent_public_key_pt.y);
-    bnz_free(&child_public_key_pt.x);
-    bnz_free(&child_public_key_pt.y);
+    get_bip39_word_ids_str(&entropy_chk, &entropy, &chk, mnemonic_str);
 
-    secp256k1_free(secp256k1);
+    bnz_print(&entropy, 16, "ENTROPY (HEX): ");
+    printf("\n");
+    bnz_print(&entropy, 2, "ENTROPY (BINARY): ");
+    printf("\n");
+    if (chk == entropy_chk.digits[0]) {
+        printf("CHECKSUM OK: %#02x\n\n", chk);
+    } else {
+        printf("CHECKSUM ERROR: %#02x SHOULD BE %#02x\n\n", chk, entropy_chk.digits[0]);
+    }
+
+    bnz_free(&entropy);
+    bnz_free(&entropy_chk);
 
     printf("press any key to continue...");
 
     getchar();
 }
 
-void menu_2_2_hardened_child(const char *version)
+void menu_4_2_private_and_public_key_functions(const char *version)
 {
-    uint8_t parent_private_key_str[67], parent_chain_code_str[67], depth_num;
-    uint32_t index_num, p2pkh_leading_zeros;
-    bnz_t tmp, index, entropy, parent_private_key, parent_chain_code, parent_public_key_compressed, child_private_key, child_chain_code, child_public_key_compressed, p2pkh, p2sh_p2wpkh, p2wpkh;
-    APT parent_public_key_pt, child_public_key_pt;
-    SECP256K1 secp256k1;
+    int menu;
+    system("cls");
+    printf("%s\n\n", version);
+    printf("1. Private key to WIF / public key / P2PKH / P2SH-P2WPKH / P2WPKH address\n");
+    printf("2. WIF to private key / public key / P2PKH / P2SH-P2WPKH / P2WPKH address\n");
+    printf("3. Public key to P2PKH, P2SH-P2WPKH and P2WPKH address\n");
+    printf("\n");
+    menu = get_num_input(1, 0, 3);
+    switch (menu) {
+        case 1:
+            menu_4_2_1_private_key_to_WIF(version);
+            break;
+        case 2:
+            menu_4_2_2_WIF_to_private_key(version);
+            break;
+        case 3:
+            menu_4_2_3_public_key_to_address(version);
+            break;
+        default:
+            break;
+    }
+}
 
-    secp256k1 = secp256k1_init();
+void menu_4_2_1_private_key_to_WIF(const char *version)
+{
+    uint8_t private_key_str[67]; // optional "0x" + 32 bytes + null terminus
+    uint32_t p2pkh_leading_zeros;
+    bnz_t private_key_wif, private_key, entropy, chain_code, public_key_compressed, p2pkh, p2sh_p2wpkh, p2wpkh, fingerprint;
+    APT public_key;
+    
+    SECP256K1 secp256k1;
 
-    bnz_init(&tmp);
-    bnz_init(&index);
+    bnz_init(&private_key_wif);
+    bnz_init(&private_key);
     bnz_init(&entropy);
-    bnz_init(&parent_private_key);
-    bnz_init(&parent_chain_code);
-    bnz_init(&parent_public_key_compressed);
-    bnz_init(&child_private_key);
-    bnz_init(&child_chain_code);
-    bnz_init(&child_public_key_compressed);
+    bnz_init(&chain_code);
+    bnz_init(&public_key_compressed);
     bnz_init(&p2pkh);
     bnz_init(&p2sh_p2wpkh);
     bnz_init(&p2wpkh);
+    bnz_init(&public_key.x);
+    bnz_init(&public_key.y);
+    bnz_init(&fingerprint);
 
-    bnz_init(&parent_public_key_pt.x);
-    bnz_init(&parent_public_key_pt.y);
-    bnz_init(&child_public_key_pt.x);
-    bnz_init(&child_public_key_pt.y);
+    secp256k1_init(&secp256k1);
 
     system("cls");
     printf("%s\n\n", version);
 
-    printf("Parent private key (press 'Enter' for random): ");
-    get_str_input(parent_private_key_str, 66);
+    printf("Private key (press 'Enter' for random): ");
+    get_str_input(private_key_str, 66);
 
-    if (isalnum(parent_private_key_str[0])) {
-        printf("%s\n", parent_private_key_str);
-        bnz_set_str(&parent_private_key, (const char *)parent_private_key_str, 16);
-        system("cls");
-        printf("%s\n\n", version);
-        bnz_print(&parent_private_key, 16, "Parent private key: ");
-        printf("Parent chain code: ");
-        get_str_input(parent_chain_code_str, 66);
-        bnz_set_str(&parent_chain_code, (const char *)parent_chain_code_str, 16);
+    if (isalnum(private_key_str[0])) {
+        printf("%s\n", private_key_str);
+        bnz_set_str(&private_key, (const char *)private_key_str, 16);
         system("cls");
         printf("%s\n\n", version);
-        bnz_print(&parent_private_key, 16, "Parent private key: ");
-        bnz_print(&parent_chain_code, 16, "Parent chain code: ");
+        bnz_print(&private_key, 16, "Private key: ");
     } else {
-        get_random_master_keys(&entropy, &parent_private_key, &parent_chain_code);
+        get_random_master_keys(&entropy, &private_key, &chain_code);
         system("cls");
         printf("%s\n\n", version);
-        if (bnz_is_zero(&entropy) == false) bnz_print(&entropy, 16, "Entropy: ");
-        bnz_print(&parent_private_key, 16, "Parent private key: ");
-        bnz_print(&parent_chain_code, 16, "Parent chain code: ");
+        bnz_print(&entropy, 16, "Entropy: ");
+        bnz_print(&private_key, 16, "Private key: ");
     }
 
-    if (is_valid_private_key(secp256k1, &parent_private_key) == false) { // ensure that parent_private_key is valid
+    printf("\n");
+
+    if (is_valid_private_key(secp256k1, &private_key) == false) { // ensure that private_key is valid
         system("cls");
         printf("%s\n\n", version);
-        bnz_print(&parent_private_key, 16, "Parent private key: ");
+        bnz_print(&private_key, 16, "Private key: ");
         printf("\n");
         printf("This private key is not in the valid range 0 < k < Secp256k1.\n\n");
         printf("It is not possible to generate a public key from this private key.\n\n");
@@ -4239,88 +10726,62 @@ void menu_2_2_hardened_child(const char *version)
 
         getchar();
 
-        bnz_free(&tmp);
-        bnz_free(&index);
+        bnz_free(&private_key_wif);
+        bnz_free(&private_key);
         bnz_free(&entropy);
-        bnz_free(&parent_private_key);
-        bnz_free(&parent_chain_code);
-        bnz_free(&parent_public_key_compressed);
-        bnz_free(&child_private_key);
-        bnz_free(&child_chain_code);
-        bnz_free(&child_public_key_compressed);
+        bnz_free(&chain_code);
+        bnz_free(&public_key_compressed);
         bnz_free(&p2pkh);
         bnz_free(&p2sh_p2wpkh);
-        bnz_free(&p2wpkh);
+        bnz_free(&public_key.x);
+        bnz_free(&public_key.y);
+        bnz_free(&fingerprint);
     
         secp256k1_free(secp256k1);
 
-        menu_2_2_hardened_child(version);
+        menu_4_2_1_private_key_to_WIF(version);
     }
 
-    printf("\n");
-    printf("Depth (1 to 255): ");
-    depth_num = get_num_input(3, 1, 255);
-
-    system("cls");
-    printf("%s\n\n", version);
-    if (bnz_is_zero(&entropy) == false) bnz_print(&entropy, 16, "Entropy: ");
-    bnz_print(&parent_private_key, 16, "Parent private key: ");
-    bnz_print(&parent_chain_code, 16, "Parent chain code: ");
-    printf("\n");
-    printf("Depth: %u\n", depth_num);
-    printf("Index (2147483648 to 4294967295): ");
-    index_num = get_num_input(10, 0, 4294967295);
-    if (index_num < 2147483648) index_num += 2147483648;
+    bnz_set_bnz(&private_key_wif, &private_key); // copy private key to private_key_wif
+    bnz_concatenate_ui8(&private_key_wif, &private_key_wif, 0x80, 0); // mainnet version, concatenate 0x80 to msb end (for testnet version concatenate 0xef)
+    bnz_concatenate_ui8(&private_key_wif, &private_key_wif, 0x01, 1); // compressed, concatenate 0x01 to lsb end (no concatenatation for uncompressed)
 
-    get_public_key(secp256k1, &parent_public_key_pt, &parent_public_key_compressed, &parent_private_key);
+    get_sha256_sha256(&fingerprint, &private_key_wif, 4); // set fingerprint to first four bytes of sha256(sha256(private_key_wif.digits))
+    bnz_concatenate_bnz(&private_key_wif, &private_key_wif, &fingerprint, 1); // concatenate fingerprint to lsb end of private_key_wif
 
     system("cls");
     printf("%s\n\n", version);
+
     if (bnz_is_zero(&entropy) == false) bnz_print(&entropy, 16, "ENTROPY: ");
-    bnz_print(&parent_private_key, 16, "PARENT PRIVATE KEY: ");
-    bnz_print(&parent_chain_code, 16, "PARENT CHAIN CODE: ");
-    bnz_print(&parent_public_key_compressed, 16, "PARENT PUBLIC KEY COMPRESSED: ");
-    bnz_print(&parent_public_key_pt.x, 16, " x: ");
-    bnz_print(&parent_public_key_pt.y, 16, " y: ");
-    printf("\n");
-    printf("DEPTH: %u\n", depth_num);
-    printf("INDEX: %u\n", index_num);
-    printf("\n");
+    bnz_print(&private_key, 16, "PRIVATE KEY: ");
+    bnz_print(&private_key_wif, 16, "PRIVATE KEY WIF (HEX): "); // hex version of WIF
+    bnz_print(&private_key_wif, 58, "PRIVATE KEY WIF (BITCOIN BASE 58): "); // Bitcoin Base 58 version of WIF (standard)
 
-    get_child_hardened(secp256k1, &child_private_key, &child_chain_code, &parent_private_key, &parent_chain_code, index_num);
+    get_public_key(secp256k1, &public_key, &public_key_compressed, &private_key);
+    get_p2pkh_address(&p2pkh, &public_key_compressed, &p2pkh_leading_zeros);
+    get_p2sh_p2wpkh_address(&p2sh_p2wpkh, &public_key_compressed);
+    get_p2wpkh_address(&p2wpkh, &public_key_compressed);
 
-    bnz_print(&child_private_key, 16, "CHILD PRIVATE KEY: ");
-    bnz_print(&child_chain_code, 16, "CHILD CHAIN CODE: ");
     printf("\n");
 
-    get_public_key(secp256k1, &child_public_key_pt, &child_public_key_compressed, &child_private_key); // generate compressed public key from private key
-    get_p2pkh_address(&p2pkh, &child_public_key_compressed, &p2pkh_leading_zeros); // serialise p2pkh address
-    get_p2sh_p2wpkh_address(&p2sh_p2wpkh, &child_public_key_compressed); // serialise p2sh_p2wpkh address
-    get_p2wpkh_address(&p2wpkh, &child_public_key_compressed);
+    bnz_print(&public_key_compressed, 16, "PUBLIC KEY (COMPRESSED): ");
+    print_p2pkh_address(&p2pkh, "P2PKH ADDRESS: ", p2pkh_leading_zeros);
+    bnz_print(&p2sh_p2wpkh, 58, "P2SH-P2WPKH ADDRESS: ");
+    print_p2wpkh_address(&p2wpkh, "P2WPKH ADDRESS: ");
 
-    bnz_print(&child_public_key_compressed, 16, "CHILD PUBLIC KEY COMPRESSED: ");
-    bnz_print(&child_public_key_pt.x, 16, " x: ");
-    bnz_print(&child_public_key_pt.y, 16, " y: ");
-    print_p2pkh_address(&p2pkh, "CHILD P2PKH ADDRESS: ", p2pkh_leading_zeros);
-    bnz_print(&p2sh_p2wpkh, 58, "CHILD P2SH-P2WPKH ADDRESS: ");
-    print_p2wpkh_address(&p2wpkh, "CHILD P2WPKH ADDRESS: ");
     printf("\n");
 
-    bnz_free(&tmp);
-    bnz_free(&index);
+    bnz_free(&private_key_wif);
+    bnz_free(&private_key);
     bnz_free(&entropy);
-    bnz_free(&parent_private_key);
-    bnz_free(&parent_chain_code);
-    bnz_free(&parent_public_key_compressed);
-    bnz_free(&child_private_key);
-    bnz_free(&child_chain_code);
-    bnz_free(&child_public_key_compressed);
+    bnz_free(&chain_code);
+    bnz_free(&public_key_compressed);
     bnz_free(&p2pkh);
     bnz_free(&p2sh_p2wpkh);
     bnz_free(&p2wpkh);
-
-    bnz_free(&child_public_key_pt.x);
-    bnz_free(&child_public_key_pt.y);
+    bnz_free(&public_key.x);
+    bnz_free(&public_key.y);
+    bnz_free(&fingerprint);
 
     secp256k1_free(secp256k1);
 
@@ -4329,596 +10790,550 @@ void menu_2_2_hardened_child(const char *version)
     getchar();
 }
 
-void menu_2_3_public_child(const char *version)
+void menu_4_2_2_WIF_to_private_key(const char *version)
 {
-    uint8_t parent_public_key_compressed_str[69], parent_chain_code_str[67], mac[65], depth_num;
-    uint32_t index_num, p2pkh_leading_zeros;
-    bnz_t tmp, index, parent_public_key_compressed, parent_chain_code, child_public_key_compressed, child_chain_code, p2pkh, p2sh_p2wpkh, p2wpkh;
-    APT tmp_key, parent_public_key_pt, child_public_key_pt;
+    uint8_t wif_str[53]; // 51 or 52 Bitcoin base 58 characters + null terminus
+    uint32_t p2pkh_leading_zeros;
+    bnz_t private_key_wif, private_key, public_key_compressed, p2pkh, p2sh_p2wpkh, p2wpkh;
 
-    SECP256K1 secp256k1;
+    APT public_key;
 
-    bnz_init(&tmp);
-    bnz_init(&index);
-    bnz_init(&parent_public_key_compressed);
-    bnz_init(&parent_chain_code);
-    bnz_init(&child_public_key_compressed);
-    bnz_init(&child_chain_code);
+    SECP256K1 secp256k1;
+    
+    bnz_init(&private_key_wif);
+    bnz_init(&private_key);
+    bnz_init(&public_key_compressed);
     bnz_init(&p2pkh);
     bnz_init(&p2sh_p2wpkh);
     bnz_init(&p2wpkh);
+    bnz_init(&public_key.x);
+    bnz_init(&public_key.y);
 
-    bnz_init(&tmp_key.x);
-    bnz_init(&tmp_key.y);
-    bnz_init(&parent_public_key_pt.x);
-    bnz_init(&parent_public_key_pt.y);
-    bnz_init(&child_public_key_pt.x);
-    bnz_init(&child_public_key_pt.y);
-
-    secp256k1 = secp256k1_init();
+    secp256k1_init(&secp256k1);
 
     system("cls");
     printf("%s\n\n", version);
 
-    printf("Parent public key compressed: ");
-    get_str_input(parent_public_key_compressed_str, 68); // optional "0x" + 33 bytes
-
-    if (isalnum(parent_public_key_compressed_str[0])) {
-        printf("%s\n", parent_public_key_compressed_str);
-        bnz_set_str(&parent_public_key_compressed, (const char *)parent_public_key_compressed_str, 16);
-        system("cls");
-        printf("%s\n\n", version);
-        bnz_print(&parent_public_key_compressed, 16, "Parent public key compressed: ");
-        printf("Parent chain code: ");
-        get_str_input(parent_chain_code_str, 66); // 32 bytes + optional "0x"
-        bnz_set_str(&parent_chain_code, (const char *)parent_chain_code_str, 16);
-        system("cls");
-        printf("%s\n\n", version);
-        bnz_print(&parent_public_key_compressed, 16, "Parent public key compressed: ");
-        bnz_print(&parent_chain_code, 16, "Parent chain code: ");
-    } else {
-        return;
-    }
-
-    printf("\n");
-    printf("Depth (1 to 255): ");
-    depth_num = get_num_input(3, 1, 255);
+    printf("Private key WIF (Bitcoin base 58): ");
+    get_str_input(wif_str, 52);
 
+    printf("%s\n", wif_str);
+    bnz_set_str(&private_key_wif, (const char *)wif_str, 58);
     system("cls");
     printf("%s\n\n", version);
-    bnz_print(&parent_public_key_compressed, 16, "Parent public key compressed: ");
-    bnz_print(&parent_chain_code, 16, "Parent chain code: ");
+    bnz_print(&private_key_wif, 58, "Private key WIF (Bitcoin base 58): ");
+
     printf("\n");
-    printf("Depth: %u\n", depth_num);
-    printf("Index (0 to 2147483647): ");
-    index_num = get_num_input(10, 0, 2147483647);
 
-    get_public_key_xy(secp256k1, &parent_public_key_pt, &parent_public_key_compressed);
+    bnz_set_bnz(&private_key, &private_key_wif); // copy wif to private key
+    bnz_resize(&private_key, private_key_wif.size - 1, true); // remove version byte from msb end
+    bnz_reverse_digits(&private_key); // reverse private_key.digits to enable 4 checksum bytes to be removed from msb end
+    bnz_resize(&private_key, private_key_wif.size - 5, true); // remove 4 checksum bytes from msb end
+    bnz_resize(&private_key, 32, true); // resize private_key.digits to 32 bytes to ensure than the compression byte (if present) is deleted
+    bnz_reverse_digits(&private_key); // reverse private_key.digits to standard little endian order
 
     system("cls");
     printf("%s\n\n", version);
-    bnz_print(&parent_chain_code, 16, "PARENT CHAIN CODE: ");
-    bnz_print(&parent_public_key_compressed, 16, "PARENT PUBLIC KEY COMPRESSED: ");
-    bnz_print(&parent_public_key_pt.x, 16, " x: ");
-    bnz_print(&parent_public_key_pt.y, 16, " y: ");
+
+    bnz_print(&private_key_wif, 58, "PRIVATE KEY WIF (BITCOIN BASE 58): "); // Bitcoin Base 58 version of WIF (standard)
+    bnz_print(&private_key_wif, 16, "PRIVATE KEY WIF (HEX): "); // hex version of WIF
+    bnz_print(&private_key, 16, "PRIVATE KEY: "); // hex version of private key
+
+    get_public_key(secp256k1, &public_key, &public_key_compressed, &private_key);
+    get_p2pkh_address(&p2pkh, &public_key_compressed, &p2pkh_leading_zeros);
+    get_p2sh_p2wpkh_address(&p2sh_p2wpkh, &public_key_compressed);
+    get_p2wpkh_address(&p2wpkh, &public_key_compressed);
+
     printf("\n");
-    printf("DEPTH: %u\n", depth_num);
-    printf("INDEX: %u\n", index_num);
+
+    bnz_print(&public_key_compressed, 16, "PUBLIC KEY (COMPRESSED): ");
+    print_p2pkh_address(&p2pkh, "P2PKH ADDRESS: ", p2pkh_leading_zeros);
+    bnz_print(&p2sh_p2wpkh, 58, "P2SH-P2WPKH ADDRESS: ");
+    print_p2wpkh_address(&p2wpkh, "P2WPKH ADDRESS: ");
+
     printf("\n");
 
-    bnz_set_i32(&index, index_num); // convert index to bnz_t
-    bnz_resize(&index, 4, true); // ensure that index is four bytes
-    bnz_resize(&parent_public_key_compressed, 33, true); // ensure that parent_public_key_compressed is 33 bytes
-    bnz_resize(&parent_chain_code, 32, true); // ensure that parent_chain_code is 32 bytes
+    bnz_free(&private_key_wif);
+    bnz_free(&private_key);
+    bnz_free(&public_key_compressed);
+    bnz_free(&p2pkh);
+    bnz_free(&p2sh_p2wpkh);
+    bnz_free(&p2wpkh);
+    bnz_free(&public_key.x);
+    bnz_free(&public_key.y);
 
-    bnz_concatenate_bnz(&tmp, &parent_public_key_compressed, &index, 1); // tmp = parent_public_key_compressed concatenated with index
+    secp256k1_free(secp256k1);
 
-    bnz_reverse_digits(&tmp);  // convert tmp.digits to big endian in preparation for hmac_512
-    bnz_reverse_digits(&parent_chain_code); // convert parent_chain_code.digits to big endian in preparation for hmac_512
+    printf("press any key to continue...");
 
-    hmac_sha512(parent_chain_code.digits, parent_chain_code.size, tmp.digits, tmp.size, mac, 64); // generate mac
-    bnz_reverse_digits(&parent_chain_code); // convert parent_chain_code.digits back to default little endian
+    getchar();
+}
 
-    bnz_resize(&tmp, 32, false); // resize and zero tmp in preparation for receipt of first 32 bytes of mac
-    memcpy(tmp.digits, mac, 32); // copy first 32 bytes of mac into tmp.digits
-    bnz_reverse_digits(&tmp); // convert tmp.digits back to default little endian
+void menu_4_2_3_public_key_to_address(const char *version)
+{
+    uint8_t public_key_compressed_str[69]; // optional "0x" + 33 bytes + null terminus
+    uint32_t p2pkh_leading_zeros;
+    bnz_t public_key_compressed, p2pkh, p2sh_p2wpkh, p2wpkh;
 
-    secp256k1_point_addition(secp256k1, &parent_public_key_pt, &tmp_key, &child_public_key_pt); // child_public_key_pt = (parent_public_key_pt + tmp) mod secp256k1.p
+    bnz_init(&public_key_compressed);
+    bnz_init(&p2pkh);
+    bnz_init(&p2sh_p2wpkh);
+    bnz_init(&p2wpkh);
 
-    if (bnz_bit_set(&child_public_key_pt.y, 0) == false) { // even
-        bnz_concatenate_ui8(&child_public_key_compressed, &child_public_key_pt.x, 2, 0); // prepend 2
-    } else { // odd
-        bnz_concatenate_ui8(&child_public_key_compressed, &child_public_key_pt.x, 3, 0); // prepend 3
-    }
+    system("cls");
+    printf("%s\n\n", version);
 
-    bnz_resize(&child_chain_code, 32, 0); // resize and zero child_chain_code in preparation for receipt of last 32 bytes of mac
-    memcpy(child_chain_code.digits, mac + 32, 32); // copy first 32 bytes of mac into child_chain_code.digits
-    bnz_reverse_digits(&child_chain_code); // convert child_chain_code.digits back to default little endian
+    printf("Public key (compressed): ");
+    get_str_input(public_key_compressed_str, 68);
+    bnz_set_str(&public_key_compressed, (const char *)public_key_compressed_str, 16);
 
-    get_p2pkh_address(&p2pkh, &child_public_key_compressed, &p2pkh_leading_zeros); // serialise p2pkh address
-    get_p2sh_p2wpkh_address(&p2sh_p2wpkh, &child_public_key_compressed); // serialise p2sh_p2wpkh address
-    get_p2wpkh_address(&p2wpkh, &child_public_key_compressed);
+    system("cls");
+    printf("%s\n\n", version);
 
-    bnz_print(&child_chain_code, 16, "CHILD CHAIN CODE: ");
-    bnz_print(&child_public_key_compressed, 16, "CHILD PUBLIC KEY COMPRESSED: ");
-    bnz_print(&child_public_key_pt.x, 16, " x: ");
-    bnz_print(&child_public_key_pt.y, 16, " y: ");
-    print_p2pkh_address(&p2pkh, "CHILD P2PKH ADDRESS: ", p2pkh_leading_zeros);
-    bnz_print(&p2sh_p2wpkh, 58, "CHILD P2SH-P2WPKH ADDRESS: ");
-    print_p2wpkh_address(&p2wpkh, "CHILD P2WPKH ADDRESS: ");
+    bnz_print(&public_key_compressed, 16, "PUBLIC KEY (COMPRESSED): ");
     printf("\n");
 
-    bnz_free(&tmp);
-    bnz_free(&index);
-    bnz_free(&parent_public_key_compressed);
-    bnz_free(&parent_chain_code);
-    bnz_free(&child_public_key_compressed);
-    bnz_free(&child_chain_code);
+    get_p2pkh_address(&p2pkh, &public_key_compressed, &p2pkh_leading_zeros);
+    get_p2sh_p2wpkh_address(&p2sh_p2wpkh, &public_key_compressed);
+    get_p2wpkh_address(&p2wpkh, &public_key_compressed);
+
+    print_p2pkh_address(&p2pkh, "P2PKH ADDRESS: ", p2pkh_leading_zeros);
+    bnz_print(&p2sh_p2wpkh, 58, "P2SH-P2WPKH ADDRESS: ");
+    print_p2wpkh_address(&p2wpkh, "P2WPKH ADDRESS: ");
+
+    printf("\n");
+
+    bnz_free(&public_key_compressed);
     bnz_free(&p2pkh);
     bnz_free(&p2sh_p2wpkh);
     bnz_free(&p2wpkh);
 
-    bnz_free(&tmp_key.x);
-    bnz_free(&tmp_key.y);
-    bnz_free(&parent_public_key_pt.x);
-    bnz_free(&parent_public_key_pt.y);
-    bnz_free(&child_public_key_pt.x);
-    bnz_free(&child_public_key_pt.y);
-
-    secp256k1_free(secp256k1);
-
     printf("press any key to continue...");
 
     getchar();
 }
 
-void menu_2_4_hdk_intermediate_values(const char *version)
+void menu_4_3_secp256k1_functions(const char *version)
 {
-    char hdk_str[32], master_private_key_str[67], master_chain_code_str[67];
+    int menu;
+    system("cls");
+    printf("%s\n\n", version);
+    printf("1. Secp256k1 point addition\n");
+    printf("2. Secp256k1 point doubling\n");
+    printf("3. Secp256k1 scalar multiplication\n");
+    printf("\n");
+    menu = get_num_input(1, 0, 3);
+    switch (menu) {
+        case 1:
+            menu_4_3_1_secp256k1_point_addition(version);
+            break;
+        case 2:
+            menu_4_3_2_secp256k1_point_doubling(version);
+            break;
+        case 3:
+            menu_4_3_3_secp256k1_scalar_multiplication(version);
+            break;
+        default:
+            break;
+    }
+}
 
-    bnz_t entropy, master_private_key, master_chain_code;
+void menu_4_3_1_secp256k1_point_addition(const char *version)
+{
+    uint8_t a_x_str[67], a_y_str[67], b_x_str[67], b_y_str[67];
+    APT a, b, c;
 
     SECP256K1 secp256k1;
 
-    bnz_init(&entropy);
-    bnz_init(&master_private_key);
-    bnz_init(&master_chain_code);
+    bnz_init(&a.x);
+    bnz_init(&a.y);
+    bnz_init(&b.x);
+    bnz_init(&b.y);
+    bnz_init(&c.x);
+    bnz_init(&c.y);
 
-    secp256k1 = secp256k1_init();
+    secp256k1_init(&secp256k1);
 
     system("cls");
     printf("%s\n\n", version);
 
-    printf("Master private key (press 'Enter' for random): ");
-    get_str_input(master_private_key_str, 66);
+    printf("Point 1 x: ");
+    get_str_input(a_x_str, 66);
+    bnz_set_str(&a.x, (const char *)a_x_str, 16);
 
-    if (isalnum(master_private_key_str[0])) {
-        printf("%s\n", master_private_key_str);
-        bnz_set_str(&master_private_key, (const char *)master_private_key_str, 16);
-        system("cls");
-        printf("%s\n\n", version);
-        bnz_print(&master_private_key, 16, "Master private key: ");
-        printf("Master chain code: ");
-        get_str_input(master_chain_code_str, 66);
-        bnz_set_str(&master_chain_code, (const char *)master_chain_code_str, 16);
-        system("cls");
-        printf("%s\n\n", version);
-        bnz_print(&master_private_key, 16, "Master private key: ");
-        bnz_print(&master_chain_code, 16, "Master chain code: ");
-    } else {
-        get_random_master_keys(&entropy, &master_private_key, &master_chain_code);
-        system("cls");
-        printf("%s\n\n", version);
-        bnz_print(&entropy, 16, "Entropy: ");
-        bnz_print(&master_private_key, 16, "Master private key: ");
-        bnz_print(&master_chain_code, 16, "Master chain code: ");
-    }
+    printf("Point 1 y: ");
+    get_str_input(a_y_str, 66);
+    bnz_set_str(&a.y, (const char *)a_y_str, 16);
 
-    if (is_valid_private_key(secp256k1, &master_private_key) == false) { // ensure that master_private_key is valid
+    if (secp256k1_valid_point(secp256k1, a) == false) { 
         system("cls");
         printf("%s\n\n", version);
-        bnz_print(&master_private_key, 16, "Master private key: ");
-        printf("\n");
-        printf("This private key is not in the valid range 0 < k < Secp256k1.\n\n");
-        printf("It is not possible to generate a public key from this private key.\n\n");
-        printf("Press any key to rerun the command with a different private key value.\n");
-
+        printf("This point is not on Secp256k1.\n\n");
+        printf("Press any key to rerun the command with a different point.\n");
         getchar();
 
-        bnz_free(&entropy);
-        bnz_free(&master_private_key);
-        bnz_free(&master_chain_code);
-    
+        bnz_free(&a.x);
+        bnz_free(&a.y);
+        bnz_free(&b.x);
+        bnz_free(&b.y);
+        bnz_free(&c.x);
+        bnz_free(&c.y);
+
         secp256k1_free(secp256k1);
 
-        menu_2_4_hdk_intermediate_values(version);
+        menu_4_3_1_secp256k1_point_addition(version);
     }
 
-    printf("\n");
-    printf("HDK string (e.g. m/44'/0'/0'/0/0): ");
-    get_str_input(hdk_str, 31);
-
-    system("cls");
-    printf("%s\n\n", version);
-    if (bnz_is_zero(&entropy) == false) bnz_print(&entropy, 16, "ENTROPY: ");
-    bnz_print(&master_private_key, 16, "MASTER PRIVATE KEY: ");
-    bnz_print(&master_chain_code, 16, "MASTER CHAIN CODE: ");
-    printf("HDK STRING: %s\n", hdk_str);
-    printf("\n");
-
-    get_hdk_intermediate_values(secp256k1, &master_private_key, &master_chain_code, hdk_str);
-
-    bnz_free(&entropy);
-    bnz_free(&master_private_key);
-    bnz_free(&master_chain_code);
-
-    secp256k1_free(secp256k1);
-
-    printf("press any key to continue...");
-
-    getchar();
-}
-
-void menu_3_base_converter(const char *version)
-{
-    char number_str[2049], base = 16;
-    bnz_t number;
+    printf("Point 2 x: ");
+    get_str_input(b_x_str, 66);
+    bnz_set_str(&b.x, (const char *)b_x_str, 16);
 
-    bnz_init(&number);
+    printf("Point 2 y: ");
+    get_str_input(b_y_str, 66);
+    bnz_set_str(&b.y, (const char *)b_y_str, 16);
 
-    system("cls");
-    printf("%s\n\n", version);
+    if (secp256k1_valid_point(secp256k1, b) == false) { 
+        system("cls");
+        printf("%s\n\n", version);
+        printf("This point is not on Secp256k1.\n\n");
+        printf("Press any key to rerun the command with a different point.\n");
+        getchar();
 
-    printf("Number (press 'Enter' for random): ");
-    get_str_input(number_str, 2048);
+        bnz_free(&a.x);
+        bnz_free(&a.y);
+        bnz_free(&b.x);
+        bnz_free(&b.y);
+        bnz_free(&c.x);
+        bnz_free(&c.y);
 
-    system("cls");
-    printf("%s\n\n", version);
+        secp256k1_free(secp256k1);
 
-    if (isalnum(number_str[0])) {
-        printf("Number: %s\n", number_str);
-        printf("Base (2 - 64): ");
-        base = get_num_input(3, 2, 64);
-        if (base == 0) base = 16;
-        bnz_set_str(&number, (const char *)number_str, base);
-    } else {
-        bnz_256_bit_rnd(&number);
+        menu_4_3_1_secp256k1_point_addition(version);
     }
 
+    secp256k1_point_addition(secp256k1, &a, &b, &c);
+
     system("cls");
     printf("%s\n\n", version);
-    bnz_print(&number, base, "Number: ");
-    printf("Base: %d\n\n", base);
 
-    bnz_print(&number, -2, "Binary: ");
+    printf("POINT 1:\n");
+    bnz_print(&a.x, 16, "x: ");
+    bnz_print(&a.y, 16, "y: ");
     printf("\n");
 
-    bnz_print(&number, 8, "Octal: ");
+    printf("POINT 2:\n");
+    bnz_print(&b.x, 16, "x: ");
+    bnz_print(&b.y, 16, "y: ");
     printf("\n");
 
-    bnz_print(&number, 10, "Decimal: ");
+    printf("POINT 1 + POINT 2:\n");
+    bnz_print(&c.x, 16, "x: ");
+    bnz_print(&c.y, 16, "y: ");
     printf("\n");
 
-    bnz_print(&number, 16, "Hex: ");
-    printf("\n");
+    secp256k1_free(secp256k1);
 
-    bnz_print(&number, 32, "Bech32: ");
-    printf("\n");
+    bnz_free(&a.x);
+    bnz_free(&a.y);
+    bnz_free(&b.x);
+    bnz_free(&b.y);
+    bnz_free(&c.x);
+    bnz_free(&c.y);
 
-    bnz_print(&number, 58, "Bitcoin base 58: ");
-    printf("\n");
+    printf("press any key to continue...");
 
-    bnz_print(&number, 256, "Bytes: ");
-    printf("\n");
+    getchar();
+}
 
-    bnz_print(&number, 2, "Base 2: ");
-    bnz_print(&number, 3, "Base 3: ");
-    bnz_print(&number, 4, "Base 4: ");
-    bnz_print(&number, 5, "Base 5: ");
-    bnz_print(&number, 6, "Base 6: ");
-    bnz_print(&number, 7, "Base 7: ");
-    bnz_print(&number, 8, "Base 8: ");
-    bnz_print(&number, 9, "Base 9: ");
+void menu_4_3_2_secp256k1_point_doubling(const char *version)
+{
+    uint8_t a_x_str[67], a_y_str[67];
+    APT a, b;
 
-    printf("\n");
+    SECP256K1 secp256k1;
 
-    bnz_print(&number, 10, "Base 10: ");
-    bnz_print(&number, 11, "Base 11: ");
-    bnz_print(&number, 12, "Base 12: ");
-    bnz_print(&number, 13, "Base 13: ");
-    bnz_print(&number, 14, "Base 14: ");
-    bnz_print(&number, 15, "Base 15: ");
-    bnz_print(&number, -16, "Base 16: ");
-    bnz_print(&number, 17, "Base 17: ");
-    bnz_print(&number, 18, "Base 18: ");
-    bnz_print(&number, 19, "Base 19: ");
+    bnz_init(&a.x);
+    bnz_init(&a.y);
+    bnz_init(&b.x);
+    bnz_init(&b.y);
 
-    printf("\n");
+    secp256k1_init(&secp256k1);
 
-    bnz_print(&number, 20, "Base 20: ");
-    bnz_print(&number, 21, "Base 21: ");
-    bnz_print(&number, 22, "Base 22: ");
-    bnz_print(&number, 23, "Base 23: ");
-    bnz_print(&number, 24, "Base 24: ");
-    bnz_print(&number, 25, "Base 25: ");
-    bnz_print(&number, 26, "Base 26: ");
-    bnz_print(&number, 27, "Base 27: ");
-    bnz_print(&number, 28, "Base 28: ");
-    bnz_print(&number, 29, "Base 29: ");
+    system("cls");
+    printf("%s\n\n", version);
 
-    printf("\n");
+    printf("Point x: ");
+    get_str_input(a_x_str, 66);
+    bnz_set_str(&a.x, (const char *)a_x_str, 16);
 
-    bnz_print(&number, 30, "Base 30: ");
-    bnz_print(&number, 31, "Base 31: ");
-    bnz_print(&number, -32, "Base 32: ");
-    bnz_print(&number, 33, "Base 33: ");
-    bnz_print(&number, 34, "Base 34: ");
-    bnz_print(&number, 35, "Base 35: ");
-    bnz_print(&number, 36, "Base 36: ");
-    bnz_print(&number, 37, "Base 37: ");
-    bnz_print(&number, 38, "Base 38: ");
-    bnz_print(&number, 39, "Base 39: ");
+    printf("Point y: ");
+    get_str_input(a_y_str, 66);
+    bnz_set_str(&a.y, (const char *)a_y_str, 16);
 
-    printf("\n");
+    if (secp256k1_valid_point(secp256k1, a) == false) { 
+        system("cls");
+        printf("%s\n\n", version);
+        printf("This point is not on Secp256k1.\n\n");
+        printf("Press any key to rerun the command with a different point.\n");
+        getchar();
 
-    bnz_print(&number, 40, "Base 40: ");
-    bnz_print(&number, 41, "Base 41: ");
-    bnz_print(&number, 42, "Base 42: ");
-    bnz_print(&number, 43, "Base 43: ");
-    bnz_print(&number, 44, "Base 44: ");
-    bnz_print(&number, 45, "Base 45: ");
-    bnz_print(&number, 46, "Base 46: ");
-    bnz_print(&number, 47, "Base 47: ");
-    bnz_print(&number, 48, "Base 48: ");
-    bnz_print(&number, 49, "Base 49: ");
+        bnz_free(&a.x);
+        bnz_free(&a.y);
+        bnz_free(&b.x);
+        bnz_free(&b.y);
 
-    printf("\n");
+        secp256k1_free(secp256k1);
 
-    bnz_print(&number, 50, "Base 50: ");
-    bnz_print(&number, 51, "Base 51: ");
-    bnz_print(&number, 52, "Base 52: ");
-    bnz_print(&number, 53, "Base 53: ");
-    bnz_print(&number, 54, "Base 54: ");
-    bnz_print(&number, 55, "Base 55: ");
-    bnz_print(&number, 56, "Base 56: ");
-    bnz_print(&number, 57, "Base 57: ");
-    bnz_print(&number, -58, "Base 58: ");
-    bnz_print(&number, 59, "Base 59: ");
+        menu_4_3_2_secp256k1_point_doubling(version);
+    }
 
-    printf("\n");
+    secp256k1_point_doubling(secp256k1, &a, &b);
 
-    bnz_print(&number, 60, "Base 60: ");
-    bnz_print(&number, 61, "Base 61: ");
-    bnz_print(&number, 62, "Base 62: ");
-    bnz_print(&number, 63, "Base 63: ");
-    bnz_print(&number, 64, "Base 64: ");
+    system("cls");
+    printf("%s\n\n", version);
 
+    printf("POINT:\n");
+    bnz_print(&a.x, 16, "x: ");
+    bnz_print(&a.y, 16, "y: ");
     printf("\n");
 
-    bnz_free(&number);
+    printf("DOUBLED POINT:\n");
+    bnz_print(&b.x, 16, "x: ");
+    bnz_print(&b.y, 16, "y: ");
+    printf("\n");
+
+    bnz_free(&a.x);
+    bnz_free(&a.y);
+    bnz_free(&b.x);
+    bnz_free(&b.y);
+
+    secp256k1_free(secp256k1);
 
     printf("press any key to continue...");
 
     getchar();
 }
 
-void menu_4_functions(const char *version)
+void menu_4_3_3_secp256k1_scalar_multiplication(const char *version)
 {
-    int menu;
+    uint8_t q_x_str[67], q_y_str[67], multiplier_str[67];
+    bnz_t multiplier;
+    APT q, r;
+
+    bnz_init(&multiplier);
+    bnz_init(&q.x);
+    bnz_init(&q.y);
+    bnz_init(&r.x);
+    bnz_init(&r.y);
+
+    SECP256K1 secp256k1;
+
+    secp256k1_init(&secp256k1);
+
     system("cls");
     printf("%s\n\n", version);
-    printf("1. Validate mnemonic phrase checksum\n");
-    printf("2. Private and public key functions\n");
-    printf("3. Secp256k1 functions\n");
-    printf("4. ECDSA functions\n");
-    printf("\n");
-    menu = get_num_input(1, 0, 4);
-    switch (menu) {
-        case 1:
-            menu_4_1_validate_mnemonic_phrase_checksum(version);
-            break;
-        case 2:
-            menu_4_2_private_and_public_key_functions(version);
-            break;
-        case 3:
-            menu_4_3_secp256k1_functions(version);
-            break;
-        case 4:
-            menu_4_4_ecdsa_functions(version);
-            break;
-        default:
-            break;
+
+    printf("q.x (press 'Enter' for Secp256k1.G.x): ");
+    get_str_input(q_x_str, 66);
+
+    if (isalnum(q_x_str[0])) {
+        bnz_set_str(&q.x, (const char *)q_x_str, 16);
+    } else {
+        bnz_set_bnz(&q.x, &secp256k1.G.x);
     }
-}
 
-void menu_4_1_validate_mnemonic_phrase_checksum(const char *version) // check validity of entropy checksum from mnemonic phrase comprising 24 BIP39 words
-{
-    uint8_t chk;
-    char mnemonic_str[257];
-    bnz_t entropy, entropy_chk;
+    system("cls");
+    printf("%s\n\n", version);
+    bnz_print(&q.x, 16, "q.x: ");
 
-    bnz_init(&entropy);
-    bnz_init(&entropy_chk);
+    printf("q.y (press 'Enter' for Secp256k1.G.y): ");
+    get_str_input(q_y_str, 66);
+
+    if (isalnum(q_y_str[0])) {
+        bnz_set_str(&q.y, (const char *)q_y_str, 16);
+    } else {
+        bnz_set_bnz(&q.y, &secp256k1.G.y);
+    }
+
+    if (secp256k1_valid_point(secp256k1, q) == false) { 
+        system("cls");
+        printf("%s\n\n", version);
+        printf("This point is not on Secp256k1.\n\n");
+        printf("Press any key to rerun the command with a different point.\n");
+        getchar();
+
+        bnz_free(&multiplier);
+        bnz_free(&q.x);
+        bnz_free(&q.y);
+        bnz_free(&r.x);
+        bnz_free(&r.y);
+
+        secp256k1_free(secp256k1);
+
+        menu_4_3_3_secp256k1_scalar_multiplication(version);
+    }
 
     system("cls");
     printf("%s\n\n", version);
+    bnz_print(&q.x, 16, "q.x: ");
+    bnz_print(&q.y, 16, "q.y: ");
 
-    printf("Mnemonic phrase (24 BIP39 words): ");
-    get_str_input(mnemonic_str, 256);
+    printf("\n");
+
+    printf("Multiplier: ");
+    get_str_input(multiplier_str, 66);
+    bnz_set_str(&multiplier, (const char *)multiplier_str, 16);
 
     system("cls");
     printf("%s\n\n", version);
-    printf("Mnemonic phrase: ");
 
-    if (isalnum(mnemonic_str[0])) {
-        printf("%s\n", mnemonic_str);
+    bnz_print(&q.x, 16, "q.x: ");
+    bnz_print(&q.y, 16, "q.y: ");
+
+    printf("\n");
+
+    if (is_valid_private_key(secp256k1, &multiplier) == false) { // ensure that multiplier is valid
+        bnz_mod_bnz(&multiplier, &multiplier, &secp256k1.n);
+        bnz_print(&multiplier, 16, "Multiplier (mod Secp256k1.n): ");
     } else {
-        return;
+        bnz_print(&multiplier, 16, "Multiplier: ");
     }
 
     system("cls");
     printf("%s\n\n", version);
-    printf("MNEMONIC PHRASE: ");
 
-    printf("%s\n\n", mnemonic_str);
+    bnz_print(&q.x, 16, "q.x: ");
+    bnz_print(&q.y, 16, "q.y: ");
+    bnz_print(&multiplier, 16, "Multiplier: ");
 
-    get_bip39_word_ids_str(&entropy_chk, &entropy, &chk, mnemonic_str);
+    printf("\n");
+
+    secp256k1_scalar_multiplication(secp256k1, &q, &multiplier, &r);
+
+    system("cls");
+    printf("%s\n\n", version);
+
+    bnz_print(&q.x, 16, "Q.X: ");
+    bnz_print(&q.y, 16, "Q.Y: ");
+    bnz_print(&multiplier, 16, "MULTIPLIER: ");
 
-    bnz_print(&entropy, 16, "ENTROPY (HEX): ");
     printf("\n");
-    bnz_print(&entropy, 2, "ENTROPY (BINARY): ");
+
+    bnz_print(&r.x, 16, "R.X: ");
+    bnz_print(&r.y, 16, "R.Y: ");
+
     printf("\n");
-    if (chk == entropy_chk.digits[0]) {
-        printf("CHECKSUM OK: %#02x\n\n", chk);
-    } else {
-        printf("CHECKSUM ERROR: %#02x SHOULD BE %#02x\n\n", chk, entropy_chk.digits[0]);
-    }
 
-    bnz_free(&entropy);
-    bnz_free(&entropy_chk);
+    bnz_free(&multiplier);
+    bnz_free(&q.x);
+    bnz_free(&q.y);
+    bnz_free(&r.x);
+    bnz_free(&r.y);
+
+    secp256k1_free(secp256k1);
 
     printf("press any key to continue...");
 
     getchar();
 }
 
-void menu_4_2_private_and_public_key_functions(const char *version)
+void menu_4_4_ecdsa_functions(const char *version)
 {
     int menu;
     system("cls");
     printf("%s\n\n", version);
-    printf("1. Private key to WIF / public key / P2PKH / P2SH-P2WPKH / P2WPKH address\n");
-    printf("2. WIF to private key / public key / P2PKH / P2SH-P2WPKH / P2WPKH address\n");
-    printf("3. Public key to P2PKH, P2SH-P2WPKH and P2WPKH address\n");
+    printf("1. Secp256k1 ECDSA sign\n");
+    printf("2. Secp256k1 ECDSA verify (signature)\n");
+    printf("3. Secp256k1 ECDSA verify (r, s)\n");
     printf("\n");
     menu = get_num_input(1, 0, 3);
     switch (menu) {
         case 1:
-            menu_4_2_1_private_key_to_WIF(version);
+            menu_4_4_1_ecdsa_sign(version);
             break;
         case 2:
-            menu_4_2_2_WIF_to_private_key(version);
+            menu_4_4_2_ecdsa_verify_signature(version);
             break;
         case 3:
-            menu_4_2_3_public_key_to_address(version);
+            menu_4_4_3_ecdsa_verify_r_s(version);
             break;
         default:
             break;
     }
 }
 
-void menu_4_2_1_private_key_to_WIF(const char *version)
+void menu_4_4_1_ecdsa_sign(const char *version)
 {
-    uint8_t private_key_str[67]; // optional "0x" + 32 bytes + null terminus
-    uint32_t p2pkh_leading_zeros;
-    bnz_t private_key_wif, private_key, entropy, chain_code, public_key_compressed, p2pkh, p2sh_p2wpkh, p2wpkh, fingerprint;
-    APT public_key;
-    
+    char private_key_str[67], message_hash_str[67];
+    uint32_t nonce_type = 0;
+    bnz_t private_key, message_hash, r, s, signature;
     SECP256K1 secp256k1;
 
-    bnz_init(&private_key_wif);
     bnz_init(&private_key);
-    bnz_init(&entropy);
-    bnz_init(&chain_code);
-    bnz_init(&public_key_compressed);
-    bnz_init(&p2pkh);
-    bnz_init(&p2sh_p2wpkh);
-    bnz_init(&p2wpkh);
-    bnz_init(&public_key.x);
-    bnz_init(&public_key.y);
-    bnz_init(&fingerprint);
+    bnz_init(&message_hash);
+    bnz_init(&r);
+    bnz_init(&s);
+    bnz_init(&signature);
 
-    secp256k1 = secp256k1_init();
+    secp256k1_init(&secp256k1);
 
     system("cls");
     printf("%s\n\n", version);
 
-    printf("Private key (press 'Enter' for random): ");
-    get_str_input(private_key_str, 66);
-
-    if (isalnum(private_key_str[0])) {
-        printf("%s\n", private_key_str);
-        bnz_set_str(&private_key, (const char *)private_key_str, 16);
-        system("cls");
-        printf("%s\n\n", version);
-        bnz_print(&private_key, 16, "Private key: ");
-    } else {
-        get_random_master_keys(&entropy, &private_key, &chain_code);
-        system("cls");
-        printf("%s\n\n", version);
-        bnz_print(&entropy, 16, "Entropy: ");
-        bnz_print(&private_key, 16, "Private key: ");
-    }
-
-    printf("\n");
-
-    if (is_valid_private_key(secp256k1, &private_key) == false) { // ensure that private_key is valid
-        system("cls");
-        printf("%s\n\n", version);
-        bnz_print(&private_key, 16, "Private key: ");
-        printf("\n");
-        printf("This private key is not in the valid range 0 < k < Secp256k1.\n\n");
-        printf("It is not possible to generate a public key from this private key.\n\n");
-        printf("Press any key to rerun the command with a different private key value.\n");
-
-        getchar();
-
-        bnz_free(&private_key_wif);
-        bnz_free(&private_key);
-        bnz_free(&entropy);
-        bnz_free(&chain_code);
-        bnz_free(&public_key_compressed);
-        bnz_free(&p2pkh);
-        bnz_free(&p2sh_p2wpkh);
-        bnz_free(&public_key.x);
-        bnz_free(&public_key.y);
-        bnz_free(&fingerprint);
-    
-        secp256k1_free(secp256k1);
-
-        menu_4_2_1_private_key_to_WIF(version);
-    }
-
-    bnz_set_bnz(&private_key_wif, &private_key); // copy private key to private_key_wif
-    bnz_concatenate_ui8(&private_key_wif, &private_key_wif, 0x80, 0); // mainnet version, concatenate 0x80 to msb end (for testnet version concatenate 0xef)
-    bnz_concatenate_ui8(&private_key_wif, &private_key_wif, 0x01, 1); // compressed, concatenate 0x01 to lsb end (no concatenatation for uncompressed)
-
-    get_sha256_sha256(&fingerprint, &private_key_wif, 4); // set fingerprint to first four bytes of sha256(sha256(private_key_wif.digits))
-    bnz_concatenate_bnz(&private_key_wif, &private_key_wif, &fingerprint, 1); // concatenate fingerprint to lsb end of private_key_wif
+    printf("Private key: ");
+    get_str_input(private_key_str, 66);
+    bnz_set_str(&private_key, (const char *)private_key_str, 16);
 
     system("cls");
     printf("%s\n\n", version);
+    bnz_print(&private_key, 16, "Private key: ");
 
-    if (bnz_is_zero(&entropy) == false) bnz_print(&entropy, 16, "ENTROPY: ");
-    bnz_print(&private_key, 16, "PRIVATE KEY: ");
-    bnz_print(&private_key_wif, 16, "PRIVATE KEY WIF (HEX): "); // hex version of WIF
-    bnz_print(&private_key_wif, 58, "PRIVATE KEY WIF (BITCOIN BASE 58): "); // Bitcoin Base 58 version of WIF (standard)
+    printf("Message hash: ");
+    get_str_input(message_hash_str, 66);
+    bnz_set_str(&message_hash, (const char *)message_hash_str, 16);
 
-    get_public_key(secp256k1, &public_key, &public_key_compressed, &private_key);
-    get_p2pkh_address(&p2pkh, &public_key_compressed, &p2pkh_leading_zeros);
-    get_p2sh_p2wpkh_address(&p2sh_p2wpkh, &public_key_compressed);
-    get_p2wpkh_address(&p2wpkh, &public_key_compressed);
+    system("cls");
+    printf("%s\n\n", version);
+    bnz_print(&private_key, 16, "Private key: ");
+    bnz_print(&message_hash, 16, "Message hash: ");
+
+    printf("Nonce: deterministic (0) or random (1): ");
+    nonce_type = get_num_input(1, 0, 1);
 
+    system("cls");
+    printf("%s\n\n", version);
+    bnz_print(&private_key, 16, "Private key: ");
+    bnz_print(&message_hash, 16, "Message hash: ");
+    if (nonce_type == 0) {
+        printf("Nonce: deterministic\n");
+    } else {
+        printf("Nonce: random\n");
+    }
     printf("\n");
 
-    bnz_print(&public_key_compressed, 16, "PUBLIC KEY (COMPRESSED): ");
-    print_p2pkh_address(&p2pkh, "P2PKH ADDRESS: ", p2pkh_leading_zeros);
-    bnz_print(&p2sh_p2wpkh, 58, "P2SH-P2WPKH ADDRESS: ");
-    print_p2wpkh_address(&p2wpkh, "P2WPKH ADDRESS: ");
+    secp256k1_ecdsa_sign(secp256k1, &private_key, &message_hash, &r, &s, nonce_type);
+    secp256k1_ecdsa_get_signature_from_r_s(&r, &s, &signature);
 
+    system("cls");
+    printf("%s\n\n", version);
+    bnz_print(&private_key, 16, "PRIVATE KEY: ");
+    bnz_print(&message_hash, 16, "MESSAGE HASH: ");
+    if (nonce_type == 0) {
+        printf("NONCE: DETERMINISTIC\n");
+    } else {
+        printf("NONCE: RANDOM\n");
+    }
+    printf("\n");
+
+    bnz_print(&signature, 16, "ECDSA SIGNATURE: ");
+    bnz_print(&r, 16, "ECDSA SIGNATURE R: ");
+    bnz_print(&s, 16, "ECDSA SIGNATURE S: ");
     printf("\n");
 
-    bnz_free(&private_key_wif);
     bnz_free(&private_key);
-    bnz_free(&entropy);
-    bnz_free(&chain_code);
-    bnz_free(&public_key_compressed);
-    bnz_free(&p2pkh);
-    bnz_free(&p2sh_p2wpkh);
-    bnz_free(&p2wpkh);
-    bnz_free(&public_key.x);
-    bnz_free(&public_key.y);
-    bnz_free(&fingerprint);
+    bnz_free(&message_hash);
+    bnz_free(&r);
+    bnz_free(&s);
 
     secp256k1_free(secp256k1);
 
@@ -4927,95 +11342,83 @@ void menu_4_2_1_private_key_to_WIF(const char *version)
     getchar();
 }
 
-void menu_4_2_2_WIF_to_private_key(const char *version)
+void menu_4_4_2_ecdsa_verify_signature(const char *version)
 {
-    uint8_t wif_str[53]; // 51 or 52 Bitcoin base 58 characters + null terminus
-    uint32_t p2pkh_leading_zeros;
-    bnz_t private_key_wif, private_key, public_key_compressed, p2pkh, p2sh_p2wpkh, p2wpkh;
-
-    APT public_key;
-
+    char public_key_compressed_str[69], message_hash_str[67], signature_str[147]; // 0x + (2 * (1 + 1 + 1 + 1 + 33 + 1 + 1 + 33)) + 0x0
+    bool verified;
+    bnz_t public_key_compressed, message_hash, signature;
     SECP256K1 secp256k1;
-    
-    bnz_init(&private_key_wif);
-    bnz_init(&private_key);
+
     bnz_init(&public_key_compressed);
-    bnz_init(&p2pkh);
-    bnz_init(&p2sh_p2wpkh);
-    bnz_init(&p2wpkh);
-    bnz_init(&public_key.x);
-    bnz_init(&public_key.y);
+    bnz_init(&message_hash);
+    bnz_init(&signature);
 
-    secp256k1 = secp256k1_init();
+    secp256k1_init(&secp256k1);
 
     system("cls");
     printf("%s\n\n", version);
 
-    printf("Private key WIF (Bitcoin base 58): ");
-    get_str_input(wif_str, 52);
+    printf("Public key (compressed): ");
+    get_str_input(public_key_compressed_str, 68);
+    bnz_set_str(&public_key_compressed, (const char *)public_key_compressed_str, 16);
 
-    printf("%s\n", wif_str);
-    bnz_set_str(&private_key_wif, (const char *)wif_str, 58);
     system("cls");
     printf("%s\n\n", version);
-    bnz_print(&private_key_wif, 58, "Private key WIF (Bitcoin base 58): ");
-
-    printf("\n");
+    bnz_print(&public_key_compressed, 16, "Public key (compressed): ");
 
-    bnz_set_bnz(&private_key, &private_key_wif); // copy wif to private key
-    bnz_resize(&private_key, private_key_wif.size - 1, true); // remove version byte from msb end
-    bnz_reverse_digits(&private_key); // reverse private_key.digits to enable 4 checksum bytes to be removed from msb end
-    bnz_resize(&private_key, private_key_wif.size - 5, true); // remove 4 checksum bytes from msb end
-    bnz_resize(&private_key, 32, true); // resize private_key.digits to 32 bytes to ensure than the compression byte (if present) is deleted
-    bnz_reverse_digits(&private_key); // reverse private_key.digits to standard little endian order
+    printf("Message hash: ");
+    get_str_input(message_hash_str, 66);
+    bnz_set_str(&message_hash, (const char *)message_hash_str, 16);
 
     system("cls");
     printf("%s\n\n", version);
+    bnz_print(&public_key_compressed, 16, "Public key (compressed): ");
+    bnz_print(&message_hash, 16, "Message hash: ");
 
-    bnz_print(&private_key_wif, 58, "PRIVATE KEY WIF (BITCOIN BASE 58): "); // Bitcoin Base 58 version of WIF (standard)
-    bnz_print(&private_key_wif, 16, "PRIVATE KEY WIF (HEX): "); // hex version of WIF
-    bnz_print(&private_key, 16, "PRIVATE KEY: "); // hex version of private key
-
-    get_public_key(secp256k1, &public_key, &public_key_compressed, &private_key);
-    get_p2pkh_address(&p2pkh, &public_key_compressed, &p2pkh_leading_zeros);
-    get_p2sh_p2wpkh_address(&p2sh_p2wpkh, &public_key_compressed);
-    get_p2wpkh_address(&p2wpkh, &public_key_compressed);
+    printf("ECDSA signature: ");
+    get_str_input(signature_str, 146);
+    bnz_set_str(&signature, (const char *)signature_str, 16);
 
+    system("cls");
+    printf("%s\n\n", version);
+    bnz_print(&public_key_compressed, 16, "Public key (compressed): ");
+    bnz_print(&message_hash, 16, "Message hash: ");
+    bnz_print(&signature, 16, "ECDSA signature: ");
     printf("\n");
 
-    bnz_print(&public_key_compressed, 16, "PUBLIC KEY (COMPRESSED): ");
-    print_p2pkh_address(&p2pkh, "P2PKH ADDRESS: ", p2pkh_leading_zeros);
-    bnz_print(&p2sh_p2wpkh, 58, "P2SH-P2WPKH ADDRESS: ");
-    print_p2wpkh_address(&p2wpkh, "P2WPKH ADDRESS: ");
-
-    printf("\n");
+    verified = secp256k1_ecdsa_verify_from_signature(secp256k1, &public_key_compressed, &message_hash, &signature);
 
-    bnz_free(&private_key_wif);
-    bnz_free(&private_key);
     bnz_free(&public_key_compressed);
-    bnz_free(&p2pkh);
-    bnz_free(&p2sh_p2wpkh);
-    bnz_free(&p2wpkh);
-    bnz_free(&public_key.x);
-    bnz_free(&public_key.y);
+    bnz_free(&message_hash);
+    bnz_free(&signature);
 
     secp256k1_free(secp256k1);
 
+    if (verified == true) {
+        printf("VERIFICATION SUCCEEDED\n");
+    } else {
+        printf("VERIFICATION FAILED\n");
+    }
+    printf("\n");
+
     printf("press any key to continue...");
 
     getchar();
 }
 
-void menu_4_2_3_public_key_to_address(const char *version)
+void menu_4_4_3_ecdsa_verify_r_s(const char *version)
 {
-    uint8_t public_key_compressed_str[69]; // optional "0x" + 33 bytes + null terminus
-    uint32_t p2pkh_leading_zeros;
-    bnz_t public_key_compressed, p2pkh, p2sh_p2wpkh, p2wpkh;
+    char public_key_compressed_str[69], message_hash_str[67], r_str[67], s_str[67];
+    bool verified;
+    bnz_t public_key_compressed, message_hash, r, s;
+    SECP256K1 secp256k1;
 
     bnz_init(&public_key_compressed);
-    bnz_init(&p2pkh);
-    bnz_init(&p2sh_p2wpkh);
-    bnz_init(&p2wpkh);
+    bnz_init(&message_hash);
+    bnz_init(&r);
+    bnz_init(&s);
+
+    secp256k1_init(&secp256k1);
 
     system("cls");
     printf("%s\n\n", version);
@@ -5026,623 +11429,616 @@ void menu_4_2_3_public_key_to_address(const char *version)
 
     system("cls");
     printf("%s\n\n", version);
+    bnz_print(&public_key_compressed, 16, "Public key (compressed): ");
 
-    bnz_print(&public_key_compressed, 16, "PUBLIC KEY (COMPRESSED): ");
-    printf("\n");
+    printf("Message hash: ");
+    get_str_input(message_hash_str, 66);
+    bnz_set_str(&message_hash, (const char *)message_hash_str, 16);
 
-    get_p2pkh_address(&p2pkh, &public_key_compressed, &p2pkh_leading_zeros);
-    get_p2sh_p2wpkh_address(&p2sh_p2wpkh, &public_key_compressed);
-    get_p2wpkh_address(&p2wpkh, &public_key_compressed);
+    system("cls");
+    printf("%s\n\n", version);
+    bnz_print(&public_key_compressed, 16, "Public key (compressed): ");
+    bnz_print(&message_hash, 16, "Message hash: ");
 
-    print_p2pkh_address(&p2pkh, "P2PKH ADDRESS: ", p2pkh_leading_zeros);
-    bnz_print(&p2sh_p2wpkh, 58, "P2SH-P2WPKH ADDRESS: ");
-    print_p2wpkh_address(&p2wpkh, "P2WPKH ADDRESS: ");
+    printf("ECDSA signature r: ");
+    get_str_input(r_str, 66);
+    bnz_set_str(&r, (const char *)r_str, 16);
+
+    system("cls");
+    printf("%s\n\n", version);
+    bnz_print(&public_key_compressed, 16, "Public key (compressed): ");
+    bnz_print(&message_hash, 16, "Message hash: ");
+    bnz_print(&r, 16, "ECDSA signature r: ");
+
+    printf("ECDSA signature s: ");
+    get_str_input(s_str, 66);
+    bnz_set_str(&s, s_str, 16);
 
+    system("cls");
+    printf("%s\n\n", version);
+    bnz_print(&public_key_compressed, 16, "Public key (compressed): ");
+    bnz_print(&message_hash, 16, "Message hash: ");
+    bnz_print(&r, 16, "ECDSA signature r: ");
+    bnz_print(&s, 16, "ECDSA signature s: ");
     printf("\n");
 
+    verified = secp256k1_ecdsa_verify_from_r_s(secp256k1, &public_key_compressed, &message_hash, &r, &s);
+
     bnz_free(&public_key_compressed);
-    bnz_free(&p2pkh);
-    bnz_free(&p2sh_p2wpkh);
-    bnz_free(&p2wpkh);
+    bnz_free(&message_hash);
+    bnz_free(&r);
+    bnz_free(&s);
+
+    secp256k1_free(secp256k1);
+
+    if (verified == true) {
+        printf("VERIFICATION SUCCEEDED\n");
+    } else {
+        printf("VERIFICATION FAILED\n");
+    }
+    printf("\n");
 
     printf("press any key to continue...");
 
     getchar();
 }
 
-void menu_4_3_secp256k1_functions(const char *version)
+void menu_5_file_hash_functions(const char *version)
 {
     int menu;
     system("cls");
     printf("%s\n\n", version);
-    printf("1. Secp256k1 point addition\n");
-    printf("2. Secp256k1 point doubling\n");
-    printf("3. Secp256k1 scalar multiplication\n");
+    printf("1. RIPEMD160\n");
+    printf("2. SHA256\n");
+    printf("3. SHA512\n");
     printf("\n");
     menu = get_num_input(1, 0, 3);
     switch (menu) {
         case 1:
-            menu_4_3_1_secp256k1_point_addition(version);
+            get_file_hash(version, 1);
+            break;
+        case 2:
+            get_file_hash(version, 2);
+            break;
+        case 3:
+            get_file_hash(version, 3);
+            break;
+        default:
+            break;
+    }
+}
+
+void menu_6_benchmarks(const char *version)
+{
+    int menu;
+    system("cls");
+    printf("%s\n\n", version);
+    printf("1. Secp256k1 Jacobian scalar multiplication\n");
+    printf("2. Reduction mod Secp256k1.p\n");
+    printf("3. Multiplication mod Secp256k1.n\n");
+    printf("4. Modulus context (Montgomery and Barrett reduction)\n");
+    printf("5. Multiplication (schoolbook, Karatsuba and Toom-3)\n");
+    printf("6. Public key decompression (get_public_key_xy)\n");
+    printf("7. Arena allocator (bnz_t signature arithmetic)\n");
+    printf("8. Derived address and signature (bnz_t copies)\n");
+    printf("9. Small integer operands (bnz_add_i32, bnz_multiply_i32 and bnz_cmp_i32)\n");
+    printf("10. Modular inversion (safegcd)\n");
+    printf("11. Batch inversion (Montgomery's trick)\n");
+    printf("12. Modular exponentiation (sliding window)\n");
+    printf("13. Large modular inverse (Lehmer)\n");
+    printf("14. Base 58 conversion (reciprocal division)\n");
+    printf("15. Large decimal conversion (divide and conquer)\n");
+    printf("16. Power of two bases (bit slicing)\n");
+    printf("17. Very large multiplication (number theoretic transform)\n");
+    printf("18. 4 by 4 limb multiplication kernels (BMI2/ADX)\n");
+    printf("19. 4 lane field multiplication and batch public keys (AVX2)\n");
+    printf("20. bnz_t call counts by scope (instrumentation)\n");
+    printf("\n");
+    menu = get_num_input(2, 0, 20);
+    switch (menu) {
+        case 1:
+            menu_6_1_benchmark_jacobian_scalar_multiplication(version);
+            break;
+        case 2:
+            menu_6_2_benchmark_reduce_p(version);
+            break;
+        case 3:
+            menu_6_3_benchmark_sc_mul(version);
+            break;
+        case 4:
+            menu_6_4_benchmark_mod_ctx(version);
+            break;
+        case 5:
+            menu_6_5_benchmark_multiplication(version);
+            break;
+        case 6:
+            menu_6_6_benchmark_public_key_xy(version);
+            break;
+        case 7:
+            menu_6_7_benchmark_arena(version);
+            break;
+        case 8:
+            menu_6_8_benchmark_derived_address(version);
+            break;
+        case 9:
+            menu_6_9_benchmark_word_operations(version);
+            break;
+        case 10:
+            menu_6_10_benchmark_inverse(version);
             break;
-        case 2:
-            menu_4_3_2_secp256k1_point_doubling(version);
+        case 11:
+            menu_6_11_benchmark_batch_inverse(version);
             break;
-        case 3:
-            menu_4_3_3_secp256k1_scalar_multiplication(version);
+        case 12:
+            menu_6_12_benchmark_mod_pow(version);
+            break;
+        case 13:
+            menu_6_13_benchmark_lehmer_inverse(version);
+            break;
+        case 14:
+            menu_6_14_benchmark_radix_conversion(version);
+            break;
+        case 15:
+            menu_6_15_benchmark_radix_divide_and_conquer(version);
+            break;
+        case 16:
+            menu_6_16_benchmark_radix_power_of_two(version);
+            break;
+        case 17:
+            menu_6_17_benchmark_ntt_multiplication(version);
+            break;
+        case 18:
+            menu_6_18_benchmark_mul_4x4(version);
+            break;
+        case 19:
+            menu_6_19_benchmark_fe4(version);
+            break;
+        case 20:
+            menu_6_20_benchmark_bnz_stats(version);
             break;
         default:
             break;
     }
 }
 
-void menu_4_3_1_secp256k1_point_addition(const char *version)
+void menu_6_1_benchmark_jacobian_scalar_multiplication(const char *version)
 {
-    uint8_t a_x_str[67], a_y_str[67], b_x_str[67], b_y_str[67];
-    APT a, b, c;
-
+    uint32_t iterations;
     SECP256K1 secp256k1;
 
-    bnz_init(&a.x);
-    bnz_init(&a.y);
-    bnz_init(&b.x);
-    bnz_init(&b.y);
-    bnz_init(&c.x);
-    bnz_init(&c.y);
+    secp256k1_init(&secp256k1);
+
+    system("cls");
+    printf("%s\n\n", version);
 
-    secp256k1 = secp256k1_init();
+    iterations = get_benchmark_iterations(1000);
 
     system("cls");
     printf("%s\n\n", version);
 
-    printf("Point 1 x: ");
-    get_str_input(a_x_str, 66);
-    bnz_set_str(&a.x, (const char *)a_x_str, 16);
+    benchmark_jacobian_scalar_multiplication(secp256k1, iterations);
 
-    printf("Point 1 y: ");
-    get_str_input(a_y_str, 66);
-    bnz_set_str(&a.y, (const char *)a_y_str, 16);
+    secp256k1_free(secp256k1);
 
-    if (secp256k1_valid_point(secp256k1, a) == false) { 
-        system("cls");
-        printf("%s\n\n", version);
-        printf("This point is not on Secp256k1.\n\n");
-        printf("Press any key to rerun the command with a different point.\n");
-        getchar();
+    printf("\npress any key to continue...");
 
-        bnz_free(&a.x);
-        bnz_free(&a.y);
-        bnz_free(&b.x);
-        bnz_free(&b.y);
-        bnz_free(&c.x);
-        bnz_free(&c.y);
+    getchar();
+}
 
-        secp256k1_free(secp256k1);
+void menu_6_2_benchmark_reduce_p(const char *version)
+{
+    uint32_t iterations;
+    SECP256K1 secp256k1;
 
-        menu_4_3_1_secp256k1_point_addition(version);
-    }
+    secp256k1_init(&secp256k1);
 
-    printf("Point 2 x: ");
-    get_str_input(b_x_str, 66);
-    bnz_set_str(&b.x, (const char *)b_x_str, 16);
+    system("cls");
+    printf("%s\n\n", version);
 
-    printf("Point 2 y: ");
-    get_str_input(b_y_str, 66);
-    bnz_set_str(&b.y, (const char *)b_y_str, 16);
+    iterations = get_benchmark_iterations(1000000);
 
-    if (secp256k1_valid_point(secp256k1, b) == false) { 
-        system("cls");
-        printf("%s\n\n", version);
-        printf("This point is not on Secp256k1.\n\n");
-        printf("Press any key to rerun the command with a different point.\n");
-        getchar();
+    system("cls");
+    printf("%s\n\n", version);
 
-        bnz_free(&a.x);
-        bnz_free(&a.y);
-        bnz_free(&b.x);
-        bnz_free(&b.y);
-        bnz_free(&c.x);
-        bnz_free(&c.y);
+    benchmark_reduce_p(secp256k1, iterations);
 
-        secp256k1_free(secp256k1);
+    secp256k1_free(secp256k1);
 
-        menu_4_3_1_secp256k1_point_addition(version);
-    }
+    printf("\npress any key to continue...");
 
-    secp256k1_point_addition(secp256k1, &a, &b, &c);
+    getchar();
+}
+
+void menu_6_3_benchmark_sc_mul(const char *version)
+{
+    uint32_t iterations;
+    SECP256K1 secp256k1;
+
+    secp256k1_init(&secp256k1);
 
     system("cls");
     printf("%s\n\n", version);
 
-    printf("POINT 1:\n");
-    bnz_print(&a.x, 16, "x: ");
-    bnz_print(&a.y, 16, "y: ");
-    printf("\n");
+    iterations = get_benchmark_iterations(1000000);
 
-    printf("POINT 2:\n");
-    bnz_print(&b.x, 16, "x: ");
-    bnz_print(&b.y, 16, "y: ");
-    printf("\n");
+    system("cls");
+    printf("%s\n\n", version);
 
-    printf("POINT 1 + POINT 2:\n");
-    bnz_print(&c.x, 16, "x: ");
-    bnz_print(&c.y, 16, "y: ");
-    printf("\n");
+    benchmark_sc_mul(secp256k1, iterations);
 
     secp256k1_free(secp256k1);
 
-    bnz_free(&a.x);
-    bnz_free(&a.y);
-    bnz_free(&b.x);
-    bnz_free(&b.y);
-    bnz_free(&c.x);
-    bnz_free(&c.y);
-
-    printf("press any key to continue...");
+    printf("\npress any key to continue...");
 
     getchar();
 }
 
-void menu_4_3_2_secp256k1_point_doubling(const char *version)
+void menu_6_4_benchmark_mod_ctx(const char *version)
 {
-    uint8_t a_x_str[67], a_y_str[67];
-    APT a, b;
-
+    uint32_t iterations;
     SECP256K1 secp256k1;
 
-    bnz_init(&a.x);
-    bnz_init(&a.y);
-    bnz_init(&b.x);
-    bnz_init(&b.y);
+    secp256k1_init(&secp256k1);
+
+    system("cls");
+    printf("%s\n\n", version);
 
-    secp256k1 = secp256k1_init();
+    iterations = get_benchmark_iterations(100000);
 
     system("cls");
     printf("%s\n\n", version);
 
-    printf("Point x: ");
-    get_str_input(a_x_str, 66);
-    bnz_set_str(&a.x, (const char *)a_x_str, 16);
+    benchmark_mod_ctx(secp256k1, iterations);
 
-    printf("Point y: ");
-    get_str_input(a_y_str, 66);
-    bnz_set_str(&a.y, (const char *)a_y_str, 16);
+    secp256k1_free(secp256k1);
 
-    if (secp256k1_valid_point(secp256k1, a) == false) { 
-        system("cls");
-        printf("%s\n\n", version);
-        printf("This point is not on Secp256k1.\n\n");
-        printf("Press any key to rerun the command with a different point.\n");
-        getchar();
+    printf("\npress any key to continue...");
 
-        bnz_free(&a.x);
-        bnz_free(&a.y);
-        bnz_free(&b.x);
-        bnz_free(&b.y);
+    getchar();
+}
 
-        secp256k1_free(secp256k1);
+void menu_6_5_benchmark_multiplication(const char *version)
+{
+    uint32_t iterations;
 
-        menu_4_3_2_secp256k1_point_doubling(version);
-    }
+    system("cls");
+    printf("%s\n\n", version);
 
-    secp256k1_point_doubling(secp256k1, &a, &b);
+    iterations = get_benchmark_iterations(10000000);
 
     system("cls");
     printf("%s\n\n", version);
 
-    printf("POINT:\n");
-    bnz_print(&a.x, 16, "x: ");
-    bnz_print(&a.y, 16, "y: ");
-    printf("\n");
+    benchmark_multiplication(iterations);
 
-    printf("DOUBLED POINT:\n");
-    bnz_print(&b.x, 16, "x: ");
-    bnz_print(&b.y, 16, "y: ");
-    printf("\n");
+    printf("\npress any key to continue...");
 
-    bnz_free(&a.x);
-    bnz_free(&a.y);
-    bnz_free(&b.x);
-    bnz_free(&b.y);
+    getchar();
+}
+
+void menu_6_6_benchmark_public_key_xy(const char *version)
+{
+    uint32_t iterations;
+    SECP256K1 secp256k1;
+
+    secp256k1_init(&secp256k1);
+
+    system("cls");
+    printf("%s\n\n", version);
+
+    iterations = get_benchmark_iterations(100000);
+
+    system("cls");
+    printf("%s\n\n", version);
+
+    benchmark_public_key_xy(secp256k1, iterations);
 
     secp256k1_free(secp256k1);
 
-    printf("press any key to continue...");
+    printf("\npress any key to continue...");
 
     getchar();
 }
 
-void menu_4_3_3_secp256k1_scalar_multiplication(const char *version)
+void menu_6_7_benchmark_arena(const char *version)
 {
-    uint8_t q_x_str[67], q_y_str[67], multiplier_str[67];
-    bnz_t multiplier;
-    APT q, r;
-
-    bnz_init(&multiplier);
-    bnz_init(&q.x);
-    bnz_init(&q.y);
-    bnz_init(&r.x);
-    bnz_init(&r.y);
-
+    uint32_t iterations;
     SECP256K1 secp256k1;
 
-    secp256k1 = secp256k1_init();
+    secp256k1_init(&secp256k1);
 
     system("cls");
     printf("%s\n\n", version);
 
-    printf("q.x (press 'Enter' for Secp256k1.G.x): ");
-    get_str_input(q_x_str, 66);
-
-    if (isalnum(q_x_str[0])) {
-        bnz_set_str(&q.x, (const char *)q_x_str, 16);
-    } else {
-        bnz_set_bnz(&q.x, &secp256k1.G.x);
-    }
+    iterations = get_benchmark_iterations(10000);
 
     system("cls");
     printf("%s\n\n", version);
-    bnz_print(&q.x, 16, "q.x: ");
 
-    printf("q.y (press 'Enter' for Secp256k1.G.y): ");
-    get_str_input(q_y_str, 66);
+    benchmark_arena(secp256k1, iterations);
 
-    if (isalnum(q_y_str[0])) {
-        bnz_set_str(&q.y, (const char *)q_y_str, 16);
-    } else {
-        bnz_set_bnz(&q.y, &secp256k1.G.y);
-    }
+    secp256k1_free(secp256k1);
 
-    if (secp256k1_valid_point(secp256k1, q) == false) { 
-        system("cls");
-        printf("%s\n\n", version);
-        printf("This point is not on Secp256k1.\n\n");
-        printf("Press any key to rerun the command with a different point.\n");
-        getchar();
+    printf("\npress any key to continue...");
 
-        bnz_free(&multiplier);
-        bnz_free(&q.x);
-        bnz_free(&q.y);
-        bnz_free(&r.x);
-        bnz_free(&r.y);
+    getchar();
+}
 
-        secp256k1_free(secp256k1);
+void menu_6_8_benchmark_derived_address(const char *version)
+{
+    uint32_t iterations;
+    SECP256K1 secp256k1;
 
-        menu_4_3_3_secp256k1_scalar_multiplication(version);
-    }
+    secp256k1_init(&secp256k1);
 
     system("cls");
     printf("%s\n\n", version);
-    bnz_print(&q.x, 16, "q.x: ");
-    bnz_print(&q.y, 16, "q.y: ");
-
-    printf("\n");
 
-    printf("Multiplier: ");
-    get_str_input(multiplier_str, 66);
-    bnz_set_str(&multiplier, (const char *)multiplier_str, 16);
+    iterations = get_benchmark_iterations(10000);
 
     system("cls");
     printf("%s\n\n", version);
 
-    bnz_print(&q.x, 16, "q.x: ");
-    bnz_print(&q.y, 16, "q.y: ");
+    benchmark_derived_address(secp256k1, iterations);
 
-    printf("\n");
+    secp256k1_free(secp256k1);
 
-    if (is_valid_private_key(secp256k1, &multiplier) == false) { // ensure that multiplier is valid
-        bnz_mod_bnz(&multiplier, &multiplier, &secp256k1.n);
-        bnz_print(&multiplier, 16, "Multiplier (mod Secp256k1.n): ");
-    } else {
-        bnz_print(&multiplier, 16, "Multiplier: ");
-    }
+    printf("\npress any key to continue...");
 
-    system("cls");
-    printf("%s\n\n", version);
+    getchar();
+}
 
-    bnz_print(&q.x, 16, "q.x: ");
-    bnz_print(&q.y, 16, "q.y: ");
-    bnz_print(&multiplier, 16, "Multiplier: ");
+void menu_6_9_benchmark_word_operations(const char *version)
+{
+    uint32_t iterations;
 
-    printf("\n");
+    system("cls");
+    printf("%s\n\n", version);
 
-    secp256k1_scalar_multiplication(secp256k1, &q, &multiplier, &r);
+    iterations = get_benchmark_iterations(1000000);
 
     system("cls");
     printf("%s\n\n", version);
 
-    bnz_print(&q.x, 16, "Q.X: ");
-    bnz_print(&q.y, 16, "Q.Y: ");
-    bnz_print(&multiplier, 16, "MULTIPLIER: ");
+    benchmark_word_operations(iterations);
+
+    printf("\npress any key to continue...");
+
+    getchar();
+}
+
+void menu_6_10_benchmark_inverse(const char *version)
+{
+    uint32_t iterations;
+    SECP256K1 secp256k1;
 
-    printf("\n");
+    secp256k1_init(&secp256k1);
 
-    bnz_print(&r.x, 16, "R.X: ");
-    bnz_print(&r.y, 16, "R.Y: ");
+    system("cls");
+    printf("%s\n\n", version);
 
-    printf("\n");
+    iterations = get_benchmark_iterations(100000);
 
-    bnz_free(&multiplier);
-    bnz_free(&q.x);
-    bnz_free(&q.y);
-    bnz_free(&r.x);
-    bnz_free(&r.y);
+    system("cls");
+    printf("%s\n\n", version);
+
+    benchmark_inverse(secp256k1, iterations);
 
     secp256k1_free(secp256k1);
 
-    printf("press any key to continue...");
+    printf("\npress any key to continue...");
 
     getchar();
 }
 
-void menu_4_4_ecdsa_functions(const char *version)
+void menu_6_11_benchmark_batch_inverse(const char *version)
 {
-    int menu;
+    uint32_t iterations;
+    SECP256K1 secp256k1;
+
+    secp256k1_init(&secp256k1);
+
     system("cls");
     printf("%s\n\n", version);
-    printf("1. Secp256k1 ECDSA sign\n");
-    printf("2. Secp256k1 ECDSA verify (signature)\n");
-    printf("3. Secp256k1 ECDSA verify (r, s)\n");
-    printf("\n");
-    menu = get_num_input(1, 0, 3);
-    switch (menu) {
-        case 1:
-            menu_4_4_1_ecdsa_sign(version);
-            break;
-        case 2:
-            menu_4_4_2_ecdsa_verify_signature(version);
-            break;
-        case 3:
-            menu_4_4_3_ecdsa_verify_r_s(version);
-            break;
-        default:
-            break;
-    }
-}
 
-void menu_4_4_1_ecdsa_sign(const char *version)
-{
-    char private_key_str[67], message_hash_str[67];
-    uint32_t nonce_type = 0;
-    bnz_t private_key, message_hash, r, s, signature;
-    SECP256K1 secp256k1;
+    iterations = get_benchmark_iterations(1000);
 
-    bnz_init(&private_key);
-    bnz_init(&message_hash);
-    bnz_init(&r);
-    bnz_init(&s);
-    bnz_init(&signature);
+    system("cls");
+    printf("%s\n\n", version);
+
+    benchmark_batch_inverse(secp256k1, iterations);
+
+    secp256k1_free(secp256k1);
+
+    printf("\npress any key to continue...");
 
-    secp256k1 = secp256k1_init();
+    getchar();
+}
+
+void menu_6_12_benchmark_mod_pow(const char *version)
+{
+    uint32_t iterations;
 
     system("cls");
     printf("%s\n\n", version);
 
-    printf("Private key: ");
-    get_str_input(private_key_str, 66);
-    bnz_set_str(&private_key, (const char *)private_key_str, 16);
+    iterations = get_benchmark_iterations(10000);
 
     system("cls");
     printf("%s\n\n", version);
-    bnz_print(&private_key, 16, "Private key: ");
 
-    printf("Message hash: ");
-    get_str_input(message_hash_str, 66);
-    bnz_set_str(&message_hash, (const char *)message_hash_str, 16);
+    benchmark_mod_pow(iterations);
+
+    printf("\npress any key to continue...");
+
+    getchar();
+}
+
+void menu_6_13_benchmark_lehmer_inverse(const char *version)
+{
+    uint32_t iterations;
 
     system("cls");
     printf("%s\n\n", version);
-    bnz_print(&private_key, 16, "Private key: ");
-    bnz_print(&message_hash, 16, "Message hash: ");
 
-    printf("Nonce: deterministic (0) or random (1): ");
-    nonce_type = get_num_input(1, 0, 1);
+    iterations = get_benchmark_iterations(10000);
 
     system("cls");
     printf("%s\n\n", version);
-    bnz_print(&private_key, 16, "Private key: ");
-    bnz_print(&message_hash, 16, "Message hash: ");
-    if (nonce_type == 0) {
-        printf("Nonce: deterministic\n");
-    } else {
-        printf("Nonce: random\n");
-    }
-    printf("\n");
 
-    secp256k1_ecdsa_sign(secp256k1, &private_key, &message_hash, &r, &s, nonce_type);
-    secp256k1_ecdsa_get_signature_from_r_s(&r, &s, &signature);
+    benchmark_lehmer_inverse(iterations);
+
+    printf("\npress any key to continue...");
+
+    getchar();
+}
+
+void menu_6_14_benchmark_radix_conversion(const char *version)
+{
+    uint32_t iterations;
 
     system("cls");
     printf("%s\n\n", version);
-    bnz_print(&private_key, 16, "PRIVATE KEY: ");
-    bnz_print(&message_hash, 16, "MESSAGE HASH: ");
-    if (nonce_type == 0) {
-        printf("NONCE: DETERMINISTIC\n");
-    } else {
-        printf("NONCE: RANDOM\n");
-    }
-    printf("\n");
 
-    bnz_print(&signature, 16, "ECDSA SIGNATURE: ");
-    bnz_print(&r, 16, "ECDSA SIGNATURE R: ");
-    bnz_print(&s, 16, "ECDSA SIGNATURE S: ");
-    printf("\n");
+    iterations = get_benchmark_iterations(10000);
 
-    bnz_free(&private_key);
-    bnz_free(&message_hash);
-    bnz_free(&r);
-    bnz_free(&s);
+    system("cls");
+    printf("%s\n\n", version);
 
-    secp256k1_free(secp256k1);
+    benchmark_radix_conversion(iterations);
 
-    printf("press any key to continue...");
+    printf("\npress any key to continue...");
 
     getchar();
 }
 
-void menu_4_4_2_ecdsa_verify_signature(const char *version)
+void menu_6_15_benchmark_radix_divide_and_conquer(const char *version)
 {
-    char public_key_compressed_str[69], message_hash_str[67], signature_str[147]; // 0x + (2 * (1 + 1 + 1 + 1 + 33 + 1 + 1 + 33)) + 0x0
-    bool verified;
-    bnz_t public_key_compressed, message_hash, signature;
-    SECP256K1 secp256k1;
+    uint32_t iterations;
 
-    bnz_init(&public_key_compressed);
-    bnz_init(&message_hash);
-    bnz_init(&signature);
+    system("cls");
+    printf("%s\n\n", version);
 
-    secp256k1 = secp256k1_init();
+    iterations = get_benchmark_iterations(1000);
 
     system("cls");
     printf("%s\n\n", version);
 
-    printf("Public key (compressed): ");
-    get_str_input(public_key_compressed_str, 68);
-    bnz_set_str(&public_key_compressed, (const char *)public_key_compressed_str, 16);
+    benchmark_radix_divide_and_conquer(iterations);
+
+    printf("\npress any key to continue...");
+
+    getchar();
+}
+
+void menu_6_16_benchmark_radix_power_of_two(const char *version)
+{
+    uint32_t iterations;
 
     system("cls");
     printf("%s\n\n", version);
-    bnz_print(&public_key_compressed, 16, "Public key (compressed): ");
 
-    printf("Message hash: ");
-    get_str_input(message_hash_str, 66);
-    bnz_set_str(&message_hash, (const char *)message_hash_str, 16);
+    iterations = get_benchmark_iterations(100000);
 
     system("cls");
     printf("%s\n\n", version);
-    bnz_print(&public_key_compressed, 16, "Public key (compressed): ");
-    bnz_print(&message_hash, 16, "Message hash: ");
 
-    printf("ECDSA signature: ");
-    get_str_input(signature_str, 146);
-    bnz_set_str(&signature, (const char *)signature_str, 16);
+    benchmark_radix_power_of_two(iterations);
+
+    printf("\npress any key to continue...");
+
+    getchar();
+}
+
+void menu_6_17_benchmark_ntt_multiplication(const char *version)
+{
+    uint32_t iterations;
 
     system("cls");
     printf("%s\n\n", version);
-    bnz_print(&public_key_compressed, 16, "Public key (compressed): ");
-    bnz_print(&message_hash, 16, "Message hash: ");
-    bnz_print(&signature, 16, "ECDSA signature: ");
-    printf("\n");
-
-    verified = secp256k1_ecdsa_verify_from_signature(secp256k1, &public_key_compressed, &message_hash, &signature);
 
-    bnz_free(&public_key_compressed);
-    bnz_free(&message_hash);
-    bnz_free(&signature);
+    iterations = get_benchmark_iterations(64);
 
-    secp256k1_free(secp256k1);
+    system("cls");
+    printf("%s\n\n", version);
 
-    if (verified == true) {
-        printf("VERIFICATION SUCCEEDED\n");
-    } else {
-        printf("VERIFICATION FAILED\n");
-    }
-    printf("\n");
+    benchmark_ntt_multiplication(iterations);
 
-    printf("press any key to continue...");
+    printf("\npress any key to continue...");
 
     getchar();
 }
 
-void menu_4_4_3_ecdsa_verify_r_s(const char *version)
+void menu_6_18_benchmark_mul_4x4(const char *version)
 {
-    char public_key_compressed_str[69], message_hash_str[67], r_str[67], s_str[67];
-    bool verified;
-    bnz_t public_key_compressed, message_hash, r, s;
+    uint32_t iterations;
     SECP256K1 secp256k1;
 
-    bnz_init(&public_key_compressed);
-    bnz_init(&message_hash);
-    bnz_init(&r);
-    bnz_init(&s);
-
-    secp256k1 = secp256k1_init();
+    secp256k1_init(&secp256k1);
 
     system("cls");
     printf("%s\n\n", version);
 
-    printf("Public key (compressed): ");
-    get_str_input(public_key_compressed_str, 68);
-    bnz_set_str(&public_key_compressed, (const char *)public_key_compressed_str, 16);
+    iterations = get_benchmark_iterations(1000000);
 
     system("cls");
     printf("%s\n\n", version);
-    bnz_print(&public_key_compressed, 16, "Public key (compressed): ");
 
-    printf("Message hash: ");
-    get_str_input(message_hash_str, 66);
-    bnz_set_str(&message_hash, (const char *)message_hash_str, 16);
+    benchmark_mul_4x4(secp256k1, iterations);
 
-    system("cls");
-    printf("%s\n\n", version);
-    bnz_print(&public_key_compressed, 16, "Public key (compressed): ");
-    bnz_print(&message_hash, 16, "Message hash: ");
+    secp256k1_free(secp256k1);
 
-    printf("ECDSA signature r: ");
-    get_str_input(r_str, 66);
-    bnz_set_str(&r, (const char *)r_str, 16);
+    printf("\npress any key to continue...");
+
+    getchar();
+}
+
+void menu_6_19_benchmark_fe4(const char *version)
+{
+    uint32_t iterations;
+    SECP256K1 secp256k1;
+
+    secp256k1_init(&secp256k1);
 
     system("cls");
     printf("%s\n\n", version);
-    bnz_print(&public_key_compressed, 16, "Public key (compressed): ");
-    bnz_print(&message_hash, 16, "Message hash: ");
-    bnz_print(&r, 16, "ECDSA signature r: ");
 
-    printf("ECDSA signature s: ");
-    get_str_input(s_str, 66);
-    bnz_set_str(&s, s_str, 16);
+    iterations = get_benchmark_iterations(1000);
 
     system("cls");
     printf("%s\n\n", version);
-    bnz_print(&public_key_compressed, 16, "Public key (compressed): ");
-    bnz_print(&message_hash, 16, "Message hash: ");
-    bnz_print(&r, 16, "ECDSA signature r: ");
-    bnz_print(&s, 16, "ECDSA signature s: ");
-    printf("\n");
 
-    verified = secp256k1_ecdsa_verify_from_r_s(secp256k1, &public_key_compressed, &message_hash, &r, &s);
-
-    bnz_free(&public_key_compressed);
-    bnz_free(&message_hash);
-    bnz_free(&r);
-    bnz_free(&s);
+    benchmark_fe4(secp256k1, iterations);
 
     secp256k1_free(secp256k1);
 
-    if (verified == true) {
-        printf("VERIFICATION SUCCEEDED\n");
-    } else {
-        printf("VERIFICATION FAILED\n");
-    }
-    printf("\n");
-
-    printf("press any key to continue...");
+    printf("\npress any key to continue...");
 
     getchar();
 }
 
-void menu_5_file_hash_functions(const char *version)
+void menu_6_20_benchmark_bnz_stats(const char *version)
 {
-    int menu;
+    uint32_t iterations;
+    SECP256K1 secp256k1;
+
+    secp256k1_init(&secp256k1);
+
     system("cls");
     printf("%s\n\n", version);
-    printf("1. RIPEMD160\n");
-    printf("2. SHA256\n");
-    printf("3. SHA512\n");
-    printf("\n");
-    menu = get_num_input(1, 0, 3);
-    switch (menu) {
-        case 1:
-            get_file_hash(version, 1);
-            break;
-        case 2:
-            get_file_hash(version, 2);
-            break;
-        case 3:
-            get_file_hash(version, 3);
-            break;
-        default:
-            break;
-    }
+
+    iterations = get_benchmark_iterations(100);
+
+    system("cls");
+    printf("%s\n\n", version);
+
+    benchmark_bnz_stats(secp256k1, iterations);
+
+    secp256k1_free(secp256k1);
+
+    printf("\npress any key to continue...");
+
+    getchar();
 }
 
 /* MAIN */
@@ -5651,6 +12047,9 @@ int main()
 {
     static char *version = "bitcoin_math\nv0.27, 2026-08-17";
     int menu, running = 1;
+#if BNZ_STATS
+    atexit(bnz_stats_print_at_exit); // the counts of the whole session, on stderr
+#endif
     while (running) {
         system("cls");
         printf("%s\n\n", version);
@@ -5659,8 +12058,9 @@ int main()
         printf("3. Base converter\n");
         printf("4. Functions\n");
         printf("5. File hash functions\n");
+        printf("6. Benchmarks\n");
         printf("\n");
-        menu = get_num_input(1, 0, 5);
+        menu = get_num_input(1, 0, 6);
         switch (menu) {
             case 1:
                 menu_1_master_keys(version);
@@ -5677,6 +12077,9 @@ int main()
             case 5:
                 menu_5_file_hash_functions(version);
                 break;
+            case 6:
+                menu_6_benchmarks(version);
+                break;
             default:
                 running = 0;
                 break;